@@ -79,6 +79,7 @@ namespace std {
 %include "base/src/sgpp/base/grid/storage/hashmap/SerializationVersion.hpp"
 %ignore sgpp::base::HashGridPoint::operator=;
 %include "base/src/sgpp/base/grid/storage/hashmap/HashGridPoint.hpp"
+%include "base/src/sgpp/base/grid/storage/flat/FlatGridStorage.hpp"
 %ignore sgpp::base::HashGridStorage::operator=;
 %ignore sgpp::base::HashGridStorage::operator[];
 %include "base/src/sgpp/base/grid/storage/hashmap/HashGridStorage.hpp"
@@ -132,6 +133,7 @@ namespace std {
 %include "base/src/sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp"
 %include "base/src/sgpp/base/grid/generation/functors/SurplusVolumeRefinementFunctor.hpp"
 %include "base/src/sgpp/base/grid/generation/PeriodicGridGenerator.hpp"
+%include "base/src/sgpp/base/grid/GridBinaryFile.hpp"
 %include "base/src/sgpp/base/grid/GridDataBase.hpp"
 
 %include "base/src/sgpp/base/algorithm/AlgorithmDGEMV.hpp"
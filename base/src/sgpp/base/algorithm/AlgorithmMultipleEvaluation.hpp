@@ -17,6 +17,11 @@
 
 #include <iostream>
 #include <utility>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 namespace sgpp {
 namespace base {
@@ -38,6 +43,12 @@ class AlgorithmMultipleEvaluation {
   /**
    * Performs a transposed mass evaluation
    *
+   * Every thread accumulates the contributions of its data points into a
+   * private result vector (thread 0 uses the result vector itself). The private
+   * vectors are then summed up in parallel, every thread being responsible for
+   * a contiguous block of grid points. Hence, the reduction is not serialized
+   * and the result does not depend on the scheduling of the threads.
+   *
    * @param storage GridStorage object that contains the grid's points information
    * @param basis a reference to a class that implements a specific basis
    * @param source the coefficients of the grid points
@@ -47,18 +58,36 @@ class AlgorithmMultipleEvaluation {
   void mult_transpose(GridStorage& storage, BASIS& basis, DataVector& source, DataMatrix& x,
                       DataVector& result) {
     result.setAll(0.0);
-    size_t source_size = source.getSize();
+    const size_t source_size = source.getSize();
+    const size_t result_size = result.getSize();
 
-#pragma omp parallel
+#ifdef _OPENMP
+    const size_t numThreads = static_cast<size_t>(omp_get_max_threads());
+#else
+    const size_t numThreads = 1;
+#endif
+
+    // private result vectors of threads 1, ..., numThreads - 1
+    std::vector<DataVector> privateResults(numThreads - 1);
+
+#pragma omp parallel num_threads(static_cast<int>(numThreads))
     {
-      DataVector privateResult(result.getSize());
-      privateResult.setAll(0.0);
+#ifdef _OPENMP
+      const size_t threadId = static_cast<size_t>(omp_get_thread_num());
+      const size_t actualNumThreads = static_cast<size_t>(omp_get_num_threads());
+#else
+      const size_t threadId = 0;
+      const size_t actualNumThreads = 1;
+#endif
+
+      if (threadId > 0) {
+        privateResults[threadId - 1].resizeZero(result_size);
+      }
 
+      DataVector& privateResult = (threadId == 0) ? result : privateResults[threadId - 1];
       DataVector line(x.getNcols());
       AlgorithmEvaluationTransposed<BASIS> AlgoEvalTrans(storage);
 
-      privateResult.setAll(0.0);
-
 #pragma omp for schedule(static)
 
       for (size_t i = 0; i < source_size; i++) {
@@ -67,34 +96,23 @@ class AlgorithmMultipleEvaluation {
         AlgoEvalTrans(basis, line, source[i], privateResult);
       }
 
-#pragma omp critical
-      { result.add(privateResult); }
+      // implicit barrier of the omp for: all private results are complete now
+
+      if (actualNumThreads > 1) {
+#pragma omp for schedule(static)
+
+        for (size_t j = 0; j < result_size; j++) {
+          double sum = 0.0;
+
+          for (size_t t = 0; t < actualNumThreads - 1; t++) {
+            sum += privateResults[t][j];
+          }
+
+          result[j] += sum;
+        }
+      }
     }
   }
-  // implementation requires OpenMP 4.0 support
-  //        void mult_transpose(GridStorage& storage, BASIS& basis, DataVector& source,
-  //                            DataMatrix& x, DataVector& result) {
-  //          result.setAll(0.0);
-  //          size_t source_size = source.getSize();
-  //
-  //          #pragma omp declare reduction(accumulate :
-  // ...      sgpp::base::DataVector : omp_out.add(omp_in))
-  // ...      initializer ( omp_priv = DataVector(omp_orig.getSize(), 0))
-  //
-  //          #pragma omp parallel
-  //          {
-  //            DataVector line(x.getNcols());
-  //            AlgorithmEvaluationTransposed<BASIS> AlgoEvalTrans(storage);
-  //
-  //            #pragma omp for reduction(accumulate:result) schedule(static)
-  //
-  //            for (size_t i = 0; i < source_size; i++) {
-  //              x.getRow(i, line);
-  //
-  //              AlgoEvalTrans(basis, line, source[i], result);
-  //            }
-  //          }
-  //        }
 
   /**
    * Performs a mass evaluation
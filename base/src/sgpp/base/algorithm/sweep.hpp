@@ -11,6 +11,11 @@
 
 #include <sgpp/globaldef.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
 #include <vector>
 #include <utility>
 #include <iostream>
@@ -172,7 +177,236 @@ class sweep {
                        dim_sweep);
   }
 
+  /**
+   * Same as sweep1D(DataVector&, DataVector&, size_t), but the independent 1D sweeps along the
+   * poles in direction dim_sweep are executed in parallel. Each pole is only read from source and
+   * written to result by one thread, so the result is identical to the one of sweep1D.
+   * If called from inside an OpenMP parallel region (e.g. from an OpenMP task), the poles are
+   * processed by OpenMP tasks of the enclosing team, otherwise a new parallel region is opened.
+   * Every task works on its own copy of the functor.
+   *
+   * @param source a DataVector containing the source coefficients of the grid points
+   * @param result a DataVector containing the result coefficients of the grid points
+   * @param dim_sweep the dimension in which the functor is executed
+   */
+  void sweep1DParallel(DataVector& source, DataVector& result, size_t dim_sweep) {
+    std::vector<size_t> dim_list;
+
+    for (size_t i = 0; i < storage.getDimension(); i++) {
+      if (i != dim_sweep) {
+        dim_list.push_back(i);
+      }
+    }
+
+    grid_iterator index(storage);
+    std::vector<size_t> poles;
+
+    if (storage.isInvalidSequenceNumber(index.seq()) || !isParallelSweepWorthwhile()) {
+      sweep1D(source, result, dim_sweep);
+      return;
+    }
+
+    collectPoles_rec(index, dim_list, storage.getDimension() - 1, poles);
+    sweepPoles(source, result, poles, dim_sweep);
+  }
+
+  /**
+   * Same as sweep1D_Boundary(DataVector&, DataVector&, size_t), but the independent 1D sweeps
+   * along the poles in direction dim_sweep are executed in parallel, see sweep1DParallel.
+   *
+   * @param source a DataVector containing the source coefficients of the grid points
+   * @param result a DataVector containing the result coefficients of the grid points
+   * @param dim_sweep the dimension in which the functor is executed
+   */
+  void sweep1D_BoundaryParallel(DataVector& source, DataVector& result,
+                                size_t dim_sweep) {
+    std::vector<size_t> dim_list;
+
+    for (size_t i = 0; i < storage.getDimension(); i++) {
+      if (i != dim_sweep) {
+        dim_list.push_back(i);
+      }
+    }
+
+    grid_iterator index(storage);
+    index.resetToLevelZero();
+    std::vector<size_t> poles;
+    bool valid = isParallelSweepWorthwhile();
+
+    if (valid) {
+      collectBoundaryPoles_rec(index, dim_list, storage.getDimension() - 1, poles, valid);
+    }
+
+    if (!valid) {
+      // some pole does not start at an existing grid point, which only the functors can handle
+      sweep1D_Boundary(source, result, dim_sweep);
+      return;
+    }
+
+    sweepPoles(source, result, poles, dim_sweep);
+  }
+
  protected:
+  /**
+   * @return true if more than one thread is available for a parallel sweep
+   */
+  bool isParallelSweepWorthwhile() const {
+#ifdef _OPENMP
+    return (omp_in_parallel() ? omp_get_num_threads() : omp_get_max_threads()) > 1;
+#else
+    return false;
+#endif
+  }
+
+  /**
+   * Calls the functor for the poles with sequence numbers poles[begin], ..., poles[end - 1].
+   */
+  void sweepPoleRange(DataVector& source, DataVector& result,
+                      const std::vector<size_t>& poles, size_t begin, size_t end,
+                      size_t dim_sweep) {
+    FUNC localFunctor(functor);
+    grid_iterator index(storage);
+
+    for (size_t i = begin; i < end; i++) {
+      index.set(storage.getPoint(poles[i]));
+      localFunctor(source, result, index, dim_sweep);
+    }
+  }
+
+  /**
+   * Executes the functor for all given poles in parallel.
+   */
+  void sweepPoles(DataVector& source, DataVector& result, const std::vector<size_t>& poles,
+                  size_t dim_sweep) {
+#ifdef _OPENMP
+    const bool inParallel = (omp_in_parallel() != 0);
+    const size_t numThreads = static_cast<size_t>(
+                                inParallel ? omp_get_num_threads() : omp_get_max_threads());
+    // a few chunks per thread for load balancing (poles have different lengths)
+    const size_t numChunks = std::max<size_t>(1, std::min(poles.size(), 4 * numThreads));
+    DataVector* sourcePtr = &source;
+    DataVector* resultPtr = &result;
+    const std::vector<size_t>* polesPtr = &poles;
+
+    if (inParallel) {
+      for (size_t c = 0; c < numChunks; c++) {
+        #pragma omp task firstprivate(c, sourcePtr, resultPtr, polesPtr, dim_sweep)
+        sweepPoleRange(*sourcePtr, *resultPtr, *polesPtr, polesPtr->size() * c / numChunks,
+                       polesPtr->size() * (c + 1) / numChunks, dim_sweep);
+      }
+
+      #pragma omp taskwait
+    } else {
+      #pragma omp parallel for schedule(dynamic, 1)
+      for (size_t c = 0; c < numChunks; c++) {
+        sweepPoleRange(*sourcePtr, *resultPtr, *polesPtr, polesPtr->size() * c / numChunks,
+                       polesPtr->size() * (c + 1) / numChunks, dim_sweep);
+      }
+    }
+#else
+    sweepPoleRange(source, result, poles, 0, poles.size(), dim_sweep);
+#endif
+  }
+
+  /**
+   * Collects the sequence numbers of the grid points at which sweep_rec calls the functor,
+   * i.e. the starting points of the poles in direction dim_sweep.
+   *
+   * @param index current grid position
+   * @param dim_list list of dimensions, that should be handled
+   * @param dim_rem number of remaining dims
+   * @param poles vector to which the sequence numbers are appended
+   */
+  void collectPoles_rec(grid_iterator& index, std::vector<size_t>& dim_list, size_t dim_rem,
+                        std::vector<size_t>& poles) {
+    poles.push_back(index.seq());
+
+    for (size_t d = 0; d < dim_rem; d++) {
+      size_t current_dim = dim_list[d];
+
+      if (index.hint()) {
+        continue;
+      }
+
+      index.leftChild(current_dim);
+
+      if (!storage.isInvalidSequenceNumber(index.seq())) {
+        collectPoles_rec(index, dim_list, d + 1, poles);
+      }
+
+      index.stepRight(current_dim);
+
+      if (!storage.isInvalidSequenceNumber(index.seq())) {
+        collectPoles_rec(index, dim_list, d + 1, poles);
+      }
+
+      index.up(current_dim);
+    }
+  }
+
+  /**
+   * Collects the sequence numbers of the grid points at which sweep_Boundary_rec calls the
+   * functor, i.e. the starting points of the poles in direction dim_sweep.
+   *
+   * @param index current grid position
+   * @param dim_list list of dimensions, that should be handled
+   * @param dim_rem number of remaining dims
+   * @param poles vector to which the sequence numbers are appended
+   * @param valid is set to false if a pole does not start at an existing grid point
+   */
+  void collectBoundaryPoles_rec(grid_iterator& index, std::vector<size_t>& dim_list,
+                                size_t dim_rem, std::vector<size_t>& poles, bool& valid) {
+    if (dim_rem == 0) {
+      if (storage.isInvalidSequenceNumber(index.seq())) {
+        valid = false;
+      } else {
+        poles.push_back(index.seq());
+      }
+    } else {
+      level_t current_level;
+      index_t current_index;
+
+      index.get(dim_list[dim_rem - 1], current_level, current_index);
+
+      // handle level greater zero
+      if (current_level > 0) {
+        // given current point to next dim
+        collectBoundaryPoles_rec(index, dim_list, dim_rem - 1, poles, valid);
+
+        if (!index.hint()) {
+          index.leftChild(dim_list[dim_rem - 1]);
+
+          if (!storage.isInvalidSequenceNumber(index.seq())) {
+            collectBoundaryPoles_rec(index, dim_list, dim_rem, poles, valid);
+          }
+
+          index.stepRight(dim_list[dim_rem - 1]);
+
+          if (!storage.isInvalidSequenceNumber(index.seq())) {
+            collectBoundaryPoles_rec(index, dim_list, dim_rem, poles, valid);
+          }
+
+          index.up(dim_list[dim_rem - 1]);
+        }
+      } else {  // handle level zero
+        collectBoundaryPoles_rec(index, dim_list, dim_rem - 1, poles, valid);
+
+        index.resetToRightLevelZero(dim_list[dim_rem - 1]);
+        collectBoundaryPoles_rec(index, dim_list, dim_rem - 1, poles, valid);
+
+        if (!index.hint()) {
+          index.resetToLevelOne(dim_list[dim_rem - 1]);
+
+          if (!storage.isInvalidSequenceNumber(index.seq())) {
+            collectBoundaryPoles_rec(index, dim_list, dim_rem, poles, valid);
+          }
+        }
+
+        index.resetToLeftLevelZero(dim_list[dim_rem - 1]);
+      }
+    }
+  }
+
   /**
    * Descends on all dimensions beside dim_sweep. Class functor for dim_sweep.
    * Boundaries are not regarded
@@ -0,0 +1,396 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/grid/GridBinaryFile.hpp>
+
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/grid/common/Stretching.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+namespace {
+
+const char MAGIC[8] = {'S', 'G', 'P', 'P', 'G', 'R', 'I', 'D'};
+const uint32_t BYTE_ORDER_MARK = 0x01020304;
+const size_t SECTION_ALIGNMENT = 64;
+/// number of grid points that are buffered while writing
+const size_t WRITE_BLOCK_SIZE = 4096;
+
+/// number of temporary files created by this process
+std::atomic<uint64_t> temporaryFileCounter(0);
+
+/**
+ * @param filename  path of the file to write
+ * @return          path of a temporary file next to it that is unique across
+ *                  processes, threads and calls
+ */
+std::string temporaryFileName(const std::string& filename) {
+#ifdef _WIN32
+  const int pid = _getpid();
+#else
+  const pid_t pid = getpid();
+#endif
+  return filename + ".tmp." + std::to_string(pid) + "." +
+         std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) + "." +
+         std::to_string(temporaryFileCounter++);
+}
+
+/// header at the beginning of every binary grid file, all offsets are in bytes
+struct BinaryHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t byteOrderMark;
+  uint64_t dimension;
+  uint64_t numberOfPoints;
+  uint64_t descriptionOffset;
+  uint64_t descriptionSize;
+  uint64_t levelOffset;
+  uint64_t indexOffset;
+  uint64_t leafOffset;
+  uint64_t alphaOffset;
+  uint64_t fileSize;
+  uint64_t reserved[5];
+};
+
+static_assert(sizeof(BinaryHeader) == 128, "unexpected padding in BinaryHeader");
+
+inline size_t alignSection(size_t offset) {
+  return (offset + SECTION_ALIGNMENT - 1) / SECTION_ALIGNMENT * SECTION_ALIGNMENT;
+}
+
+void writePadding(std::ofstream& file, size_t from, size_t to) {
+  const char zeros[SECTION_ALIGNMENT] = {};
+  file.write(zeros, static_cast<std::streamsize>(to - from));
+}
+
+/**
+ * Writes one array section of the grid points block by block.
+ *
+ * @param file      output file
+ * @param storage   grid storage
+ * @param getValues copies the values of one grid point to the output pointer and
+ *                  returns the pointer past the last value
+ */
+template <class T, class F>
+void writePointSection(std::ofstream& file, GridStorage& storage, size_t valuesPerPoint,
+                       F getValues) {
+  std::vector<T> block(WRITE_BLOCK_SIZE * valuesPerPoint);
+
+  for (size_t start = 0; start < storage.getSize(); start += WRITE_BLOCK_SIZE) {
+    const size_t end = std::min(start + WRITE_BLOCK_SIZE, storage.getSize());
+    T* out = block.data();
+
+    for (size_t seq = start; seq < end; seq++) {
+      out = getValues(storage.getPoint(seq), out);
+    }
+
+    file.write(reinterpret_cast<const char*>(block.data()),
+               static_cast<std::streamsize>((end - start) * valuesPerPoint * sizeof(T)));
+  }
+}
+
+}  // namespace
+
+void GridBinaryFile::write(const std::string& filename, Grid& grid) {
+  write(filename, grid, nullptr);
+}
+
+void GridBinaryFile::write(const std::string& filename, Grid& grid, const DataVector& alpha) {
+  if (alpha.getSize() != grid.getSize()) {
+    throw data_exception("GridBinaryFile::write : alpha has to have one entry per grid point");
+  }
+
+  write(filename, grid, &alpha);
+}
+
+void GridBinaryFile::write(const std::string& filename, Grid& grid, const DataVector* alpha) {
+  GridStorage& storage = grid.getStorage();
+  const size_t dim = storage.getDimension();
+  const size_t numPoints = storage.getSize();
+
+  // the description is the text serialization of an empty grid of the same type;
+  // the bounding box and stretching are written with full precision
+  std::unique_ptr<Grid> emptyGrid(grid.createGridOfEquivalentType(dim));
+  Stretching* stretching = dynamic_cast<Stretching*>(storage.getBoundingBox());
+
+  if (stretching != nullptr) {
+    emptyGrid->setStretching(*stretching);
+  } else {
+    emptyGrid->setBoundingBox(*storage.getBoundingBox());
+  }
+
+  std::ostringstream descriptionStream;
+  descriptionStream << std::setprecision(std::numeric_limits<double>::max_digits10);
+  emptyGrid->serialize(descriptionStream);
+  const std::string description = descriptionStream.str();
+
+  BinaryHeader header = {};
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.version = BINARY_SERIALIZATION_VERSION;
+  header.byteOrderMark = BYTE_ORDER_MARK;
+  header.dimension = dim;
+  header.numberOfPoints = numPoints;
+  header.descriptionOffset = alignSection(sizeof(BinaryHeader));
+  header.descriptionSize = description.size();
+  header.levelOffset = alignSection(header.descriptionOffset + header.descriptionSize);
+  header.indexOffset = alignSection(header.levelOffset + numPoints * dim * sizeof(level_type));
+  header.leafOffset = alignSection(header.indexOffset + numPoints * dim * sizeof(index_type));
+  size_t end = header.leafOffset + numPoints * sizeof(uint8_t);
+
+  if (alpha != nullptr) {
+    header.alphaOffset = alignSection(end);
+    end = header.alphaOffset + numPoints * sizeof(double);
+  }
+
+  header.fileSize = end;
+
+  // write to a temporary file first, such that other processes never see
+  // (or map) a partially written file and existing mappings of the old file
+  // stay valid; concurrent writers of the same file use different temporary
+  // files, the last rename wins
+  const std::string tmpFilename = temporaryFileName(filename);
+
+  {
+    std::ofstream file(tmpFilename, std::ios::binary | std::ios::trunc);
+
+    if (!file) {
+      throw file_exception("GridBinaryFile::write : could not open file for writing");
+    }
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    writePadding(file, sizeof(header), header.descriptionOffset);
+    file.write(description.data(), static_cast<std::streamsize>(description.size()));
+    writePadding(file, header.descriptionOffset + header.descriptionSize, header.levelOffset);
+
+    writePointSection<level_type>(file, storage, dim, [dim](HashGridPoint& point, level_type* out) {
+      for (size_t d = 0; d < dim; d++) {
+        *(out++) = point.getLevel(d);
+      }
+
+      return out;
+    });
+    writePadding(file, header.levelOffset + numPoints * dim * sizeof(level_type),
+                 header.indexOffset);
+
+    writePointSection<index_type>(file, storage, dim, [dim](HashGridPoint& point, index_type* out) {
+      for (size_t d = 0; d < dim; d++) {
+        *(out++) = point.getIndex(d);
+      }
+
+      return out;
+    });
+    writePadding(file, header.indexOffset + numPoints * dim * sizeof(index_type),
+                 header.leafOffset);
+
+    writePointSection<uint8_t>(file, storage, 1, [](HashGridPoint& point, uint8_t* out) {
+      *(out++) = point.isLeaf() ? 1 : 0;
+      return out;
+    });
+
+    if (alpha != nullptr) {
+      writePadding(file, header.leafOffset + numPoints, header.alphaOffset);
+      file.write(reinterpret_cast<const char*>(alpha->getPointer()),
+                 static_cast<std::streamsize>(numPoints * sizeof(double)));
+    }
+
+    file.close();
+
+    if (!file) {
+      std::remove(tmpFilename.c_str());
+      throw file_exception("GridBinaryFile::write : error while writing file");
+    }
+  }
+
+  // rename replaces existing files atomically on POSIX systems; on other systems,
+  // the existing file has to be removed first
+  if ((std::rename(tmpFilename.c_str(), filename.c_str()) != 0) &&
+      ((std::remove(filename.c_str()) != 0) ||
+       (std::rename(tmpFilename.c_str(), filename.c_str()) != 0))) {
+    std::remove(tmpFilename.c_str());
+    throw file_exception("GridBinaryFile::write : could not replace file");
+  }
+}
+
+GridBinaryFile::GridBinaryFile(const std::string& filename)
+    : file(filename),
+      data(file.getData()),
+      dimension(0),
+      numberOfPoints(0),
+      version(0),
+      descriptionOffset(0),
+      descriptionSize(0),
+      levelOffset(0),
+      indexOffset(0),
+      leafOffset(0),
+      alphaOffset(0) {
+  parseHeader();
+}
+
+void GridBinaryFile::parseHeader() {
+  const size_t fileSize = file.getSize();
+  BinaryHeader header;
+
+  if (fileSize < sizeof(header)) {
+    throw file_exception("GridBinaryFile : file is too small to be a binary grid file");
+  }
+
+  std::memcpy(&header, data, sizeof(header));
+
+  if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+    throw file_exception("GridBinaryFile : file is not a binary grid file");
+  }
+
+  if (header.byteOrderMark != BYTE_ORDER_MARK) {
+    throw file_exception("GridBinaryFile : file was written with a different byte order");
+  }
+
+  if ((header.version < 1) || (header.version > BINARY_SERIALIZATION_VERSION)) {
+    throw file_exception("GridBinaryFile : unsupported version of the binary grid format");
+  }
+
+  if (header.fileSize != fileSize) {
+    throw file_exception("GridBinaryFile : file is truncated");
+  }
+
+  // check that all sections lie within the file (before computing their sizes,
+  // the number of grid points is bounded to rule out overflows)
+  const uint64_t numValues = header.numberOfPoints * header.dimension;
+
+  if ((header.numberOfPoints > fileSize) ||
+      ((header.dimension > 0) && (header.numberOfPoints > fileSize / header.dimension)) ||
+      (header.descriptionOffset > fileSize) ||
+      (header.descriptionSize > fileSize - header.descriptionOffset) ||
+      (header.levelOffset > fileSize) ||
+      (numValues * sizeof(level_type) > fileSize - header.levelOffset) ||
+      (header.indexOffset > fileSize) ||
+      (numValues * sizeof(index_type) > fileSize - header.indexOffset) ||
+      (header.leafOffset > fileSize) || (header.numberOfPoints > fileSize - header.leafOffset) ||
+      (header.alphaOffset > fileSize) ||
+      ((header.alphaOffset != 0) &&
+       (header.numberOfPoints * sizeof(double) > fileSize - header.alphaOffset)) ||
+      (header.levelOffset % SECTION_ALIGNMENT != 0) ||
+      (header.indexOffset % SECTION_ALIGNMENT != 0) ||
+      (header.alphaOffset % SECTION_ALIGNMENT != 0)) {
+    throw file_exception("GridBinaryFile : corrupt section table");
+  }
+
+  version = static_cast<int>(header.version);
+  dimension = static_cast<size_t>(header.dimension);
+  numberOfPoints = static_cast<size_t>(header.numberOfPoints);
+  descriptionOffset = static_cast<size_t>(header.descriptionOffset);
+  descriptionSize = static_cast<size_t>(header.descriptionSize);
+  levelOffset = static_cast<size_t>(header.levelOffset);
+  indexOffset = static_cast<size_t>(header.indexOffset);
+  leafOffset = static_cast<size_t>(header.leafOffset);
+  alphaOffset = static_cast<size_t>(header.alphaOffset);
+}
+
+int GridBinaryFile::getVersion() const { return version; }
+
+size_t GridBinaryFile::getDimension() const { return dimension; }
+
+size_t GridBinaryFile::getSize() const { return numberOfPoints; }
+
+std::string GridBinaryFile::getDescription() const {
+  return std::string(data + descriptionOffset, descriptionSize);
+}
+
+const GridBinaryFile::level_type* GridBinaryFile::getLevelData() const {
+  return reinterpret_cast<const level_type*>(data + levelOffset);
+}
+
+const GridBinaryFile::index_type* GridBinaryFile::getIndexData() const {
+  return reinterpret_cast<const index_type*>(data + indexOffset);
+}
+
+const uint8_t* GridBinaryFile::getLeafData() const {
+  return reinterpret_cast<const uint8_t*>(data + leafOffset);
+}
+
+bool GridBinaryFile::hasAlpha() const { return alphaOffset != 0; }
+
+const double* GridBinaryFile::getAlphaData() const {
+  return hasAlpha() ? reinterpret_cast<const double*>(data + alphaOffset) : nullptr;
+}
+
+void GridBinaryFile::getAlpha(DataVector& alpha) const {
+  if (!hasAlpha()) {
+    throw file_exception("GridBinaryFile::getAlpha : file does not contain coefficients");
+  }
+
+  const double* alphaData = getAlphaData();
+  alpha.resize(numberOfPoints);
+  std::copy(alphaData, alphaData + numberOfPoints, alpha.getPointer());
+}
+
+Grid* GridBinaryFile::createGrid() const {
+  std::unique_ptr<Grid> grid(Grid::unserialize(getDescription()));
+  GridStorage& storage = grid->getStorage();
+
+  if (storage.getDimension() != dimension) {
+    throw file_exception("GridBinaryFile::createGrid : description does not match the data");
+  }
+
+  const level_type* levels = getLevelData();
+  const index_type* indices = getIndexData();
+  const uint8_t* leafs = getLeafData();
+  HashGridPoint point(dimension);
+  storage.reserve(numberOfPoints);
+
+  for (size_t seq = 0; seq < numberOfPoints; seq++) {
+    for (size_t d = 0; d < dimension; d++) {
+      point.push(d, levels[seq * dimension + d], indices[seq * dimension + d]);
+    }
+
+    point.setLeaf(leafs[seq] != 0);
+    point.rehash();
+    storage.insert(point);
+  }
+
+  return grid.release();
+}
+
+void GridBinaryFile::toFlatGridStorage(FlatGridStorage& storage) const {
+  if (storage.getDimension() != dimension) {
+    throw data_exception("GridBinaryFile::toFlatGridStorage : dimension mismatch");
+  }
+
+  const level_type* levels = getLevelData();
+  const index_type* indices = getIndexData();
+  const uint8_t* leafs = getLeafData();
+  storage.reserve(storage.getSize() + numberOfPoints);
+
+  for (size_t seq = 0; seq < numberOfPoints; seq++) {
+    storage.insert(levels + seq * dimension, indices + seq * dimension, leafs[seq] != 0);
+  }
+}
+
+}  // namespace base
+}  // namespace sgpp
@@ -0,0 +1,186 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef GRIDBINARYFILE_HPP
+#define GRIDBINARYFILE_HPP
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/storage/flat/FlatGridStorage.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridPoint.hpp>
+#include <sgpp/base/grid/storage/hashmap/SerializationVersion.hpp>
+#include <sgpp/base/tools/MemoryMappedFile.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Read-only view of a grid (and optionally its coefficient vector) that is
+ * stored in the binary grid format.
+ *
+ * In contrast to Grid::serialize, the grid points are not written as text,
+ * but as raw arrays of levels, indices and leaf properties (one row per grid
+ * point, in the order of the sequence numbers). Only the grid description,
+ * i.e., the grid type, its parameters (degree, boundary level, ...) and the
+ * bounding box or stretching, is stored as text, which is written with full
+ * precision and parsed by Grid::unserialize.
+ *
+ * On POSIX systems, the file is mapped read-only into memory, so opening a
+ * file takes constant time, the arrays are paged in on demand and worker
+ * processes opening the same file share the physical memory. The raw arrays
+ * can be used directly (e.g., to set up evaluation kernels); createGrid() and
+ * toFlatGridStorage() build the corresponding grid storages without any
+ * parsing.
+ *
+ * Files are written to a temporary file next to the target first, which then
+ * replaces the target, so readers never see partially written files and
+ * files that are already open stay valid when they are overwritten.
+ *
+ * All sections are aligned to 64 bytes. The file has to be read on a machine
+ * with the same byte order as the one it was written on.
+ */
+class GridBinaryFile {
+ public:
+  /// level type
+  typedef HashGridPoint::level_type level_type;
+  /// index type
+  typedef HashGridPoint::index_type index_type;
+
+  /**
+   * Writes a grid in the binary format.
+   *
+   * @param filename  name of the file
+   * @param grid      grid to be written
+   */
+  static void write(const std::string& filename, Grid& grid);
+
+  /**
+   * Writes a grid and its coefficient vector in the binary format.
+   *
+   * @param filename  name of the file
+   * @param grid      grid to be written
+   * @param alpha     coefficient vector of length grid.getSize()
+   */
+  static void write(const std::string& filename, Grid& grid, const DataVector& alpha);
+
+  /**
+   * Opens a file in the binary format. Throws a file_exception if the file
+   * cannot be opened or is not a valid binary grid file.
+   *
+   * @param filename  name of the file
+   */
+  explicit GridBinaryFile(const std::string& filename);
+
+  /**
+   * @return version of the binary format the file was written with
+   */
+  int getVersion() const;
+
+  /**
+   * @return dimension of the grid
+   */
+  size_t getDimension() const;
+
+  /**
+   * @return number of grid points
+   */
+  size_t getSize() const;
+
+  /**
+   * @return grid description (text serialization of the grid without grid points)
+   */
+  std::string getDescription() const;
+
+  /**
+   * @return levels of all grid points, the level of grid point @c seq in dimension @c d
+   *         is at position seq * getDimension() + d
+   */
+  const level_type* getLevelData() const;
+
+  /**
+   * @return indices of all grid points, in the same layout as getLevelData()
+   */
+  const index_type* getIndexData() const;
+
+  /**
+   * @return leaf properties of all grid points (0 or 1)
+   */
+  const uint8_t* getLeafData() const;
+
+  /**
+   * @return whether the file contains a coefficient vector
+   */
+  bool hasAlpha() const;
+
+  /**
+   * @return coefficients (of length getSize()) or nullptr if the file contains none
+   */
+  const double* getAlphaData() const;
+
+  /**
+   * Copies the coefficient vector. Throws a file_exception if the file contains none.
+   *
+   * @param[out] alpha coefficient vector, will be resized to getSize()
+   */
+  void getAlpha(DataVector& alpha) const;
+
+  /**
+   * Creates the grid stored in the file, with the same type, parameters,
+   * bounding box or stretching and grid points (in the same order).
+   *
+   * @return grid, the caller takes ownership
+   */
+  Grid* createGrid() const;
+
+  /**
+   * Appends all grid points (in order) to a FlatGridStorage, preserving the
+   * sequence numbers if the storage is empty.
+   *
+   * @param storage FlatGridStorage of the same dimension
+   */
+  void toFlatGridStorage(FlatGridStorage& storage) const;
+
+ private:
+  /// the mapped file
+  MemoryMappedFile file;
+  /// start of the file
+  const char* data;
+
+  /// dimension of the grid
+  size_t dimension;
+  /// number of grid points
+  size_t numberOfPoints;
+  /// format version
+  int version;
+  /// offset and length of the grid description
+  size_t descriptionOffset;
+  size_t descriptionSize;
+  /// offsets of the arrays (alphaOffset is 0 if there are no coefficients)
+  size_t levelOffset;
+  size_t indexOffset;
+  size_t leafOffset;
+  size_t alphaOffset;
+
+  /**
+   * Common implementation of both write functions.
+   */
+  static void write(const std::string& filename, Grid& grid, const DataVector* alpha);
+
+  /**
+   * Checks the header and the section bounds and sets the members.
+   */
+  void parseHeader();
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* GRIDBINARYFILE_HPP */
@@ -0,0 +1,417 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/grid/storage/flat/FlatGridStorage.hpp>
+
+#include <sgpp/base/exception/generation_exception.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridStorage.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+const size_t FlatGridStorage::NOT_FOUND = std::numeric_limits<size_t>::max();
+
+FlatGridStorage::FlatGridStorage(size_t dimension, Layout layout)
+    : dimension(dimension),
+      layout(layout),
+      size(0),
+      capacity(0),
+      level(),
+      index(),
+      leaf(),
+      hashes(),
+      slots() {
+  rehash(16);
+}
+
+FlatGridStorage::FlatGridStorage(HashGridStorage& storage, Layout layout)
+    : FlatGridStorage(storage.getDimension(), layout) {
+  const size_t numberOfPoints = storage.getSize();
+  reserve(numberOfPoints);
+
+  for (size_t seq = 0; seq < numberOfPoints; seq++) {
+    HashGridPoint& point = storage.getPoint(seq);
+    const size_t s = size++;
+    hashes[s] = point.getHash();
+    leaf[s] = point.isLeaf();
+
+    for (size_t d = 0; d < dimension; d++) {
+      point.get(d, level[offset(s, d)], index[offset(s, d)]);
+    }
+
+    addToIndex(s);
+  }
+}
+
+FlatGridStorage::~FlatGridStorage() {}
+
+void FlatGridStorage::clear() {
+  size = 0;
+  std::fill(slots.begin(), slots.end(), NOT_FOUND);
+}
+
+void FlatGridStorage::reserve(size_t numberOfPoints) {
+  if (numberOfPoints > capacity) {
+    grow(numberOfPoints);
+  }
+}
+
+size_t FlatGridStorage::getNumberOfInnerPoints() const {
+  size_t innerPoints = 0;
+
+  for (size_t seq = 0; seq < size; seq++) {
+    bool isInner = true;
+
+    for (size_t d = 0; d < dimension; d++) {
+      if (level[offset(seq, d)] == 0) {
+        isInner = false;
+        break;
+      }
+    }
+
+    if (isInner) innerPoints++;
+  }
+
+  return innerPoints;
+}
+
+void FlatGridStorage::getPoint(size_t seq, HashGridPoint& point) const {
+  if (point.getDimension() != dimension) {
+    point = HashGridPoint(dimension);
+  }
+
+  for (size_t d = 0; d < dimension; d++) {
+    const size_t k = offset(seq, d);
+    point.push(d, level[k], index[k]);
+  }
+
+  point.setLeaf(leaf[seq] != 0);
+  point.rehash();
+}
+
+HashGridPoint FlatGridStorage::getPoint(size_t seq) const {
+  HashGridPoint point(dimension);
+  getPoint(seq, point);
+  return point;
+}
+
+size_t FlatGridStorage::insert(const HashGridPoint& point) {
+  if (point.getDimension() != dimension) {
+    throw generation_exception("FlatGridStorage::insert: dimension mismatch");
+  }
+
+  size_t seq = find(point);
+
+  if (seq != NOT_FOUND) {
+    return seq;
+  }
+
+  seq = allocate(point.getHash(), const_cast<HashGridPoint&>(point).isLeaf());
+
+  for (size_t d = 0; d < dimension; d++) {
+    point.get(d, level[offset(seq, d)], index[offset(seq, d)]);
+  }
+
+  addToIndex(seq);
+  return seq;
+}
+
+size_t FlatGridStorage::insert(const level_type* l, const index_type* i, bool isLeaf) {
+  const size_t hash = computeHash(l, i);
+  size_t seq = find(l, i, hash);
+
+  if (seq != NOT_FOUND) {
+    return seq;
+  }
+
+  seq = allocate(hash, isLeaf);
+
+  for (size_t d = 0; d < dimension; d++) {
+    const size_t k = offset(seq, d);
+    level[k] = l[d];
+    index[k] = i[d];
+  }
+
+  addToIndex(seq);
+  return seq;
+}
+
+size_t FlatGridStorage::append(const HashGridPoint& point) {
+  if (point.getDimension() != dimension) {
+    throw generation_exception("FlatGridStorage::append: dimension mismatch");
+  }
+
+  const size_t seq = allocate(point.getHash(), const_cast<HashGridPoint&>(point).isLeaf());
+
+  for (size_t d = 0; d < dimension; d++) {
+    point.get(d, level[offset(seq, d)], index[offset(seq, d)]);
+  }
+
+  addToIndex(seq);
+  return seq;
+}
+
+void FlatGridStorage::update(const HashGridPoint& point, size_t seq) {
+  if (seq >= size) {
+    return;
+  }
+
+  removeFromIndex(seq);
+  hashes[seq] = point.getHash();
+  leaf[seq] = const_cast<HashGridPoint&>(point).isLeaf();
+
+  for (size_t d = 0; d < dimension; d++) {
+    point.get(d, level[offset(seq, d)], index[offset(seq, d)]);
+  }
+
+  addToIndex(seq);
+}
+
+void FlatGridStorage::deleteLast() {
+  if (size > 0) {
+    removeFromIndex(size - 1);
+    size--;
+  }
+}
+
+void FlatGridStorage::recalcLeafProperty() {
+  std::vector<level_type> l(dimension);
+  std::vector<index_type> i(dimension);
+
+  for (size_t seq = 0; seq < size; seq++) {
+    for (size_t d = 0; d < dimension; d++) {
+      get(seq, d, l[d], i[d]);
+    }
+
+    bool isLeaf = true;
+
+    for (size_t d = 0; (d < dimension) && isLeaf; d++) {
+      const level_type curLevel = l[d];
+      const index_type curIndex = i[d];
+
+      if (curLevel > 0) {
+        // test left and right child
+        l[d] = curLevel + 1;
+        i[d] = 2 * curIndex - 1;
+        isLeaf = (find(l.data(), i.data(), computeHash(l.data(), i.data())) == NOT_FOUND);
+        i[d] = 2 * curIndex + 1;
+        isLeaf = isLeaf &&
+                 (find(l.data(), i.data(), computeHash(l.data(), i.data())) == NOT_FOUND);
+      } else {
+        // test level 1
+        l[d] = 1;
+        i[d] = 1;
+        isLeaf = (find(l.data(), i.data(), computeHash(l.data(), i.data())) == NOT_FOUND);
+      }
+
+      l[d] = curLevel;
+      i[d] = curIndex;
+    }
+
+    leaf[seq] = isLeaf;
+  }
+}
+
+size_t FlatGridStorage::getMaxLevel() const {
+  level_type maxLevel = 0;
+
+  for (size_t seq = 0; seq < size; seq++) {
+    for (size_t d = 0; d < dimension; d++) {
+      maxLevel = std::max(maxLevel, level[offset(seq, d)]);
+    }
+  }
+
+  return static_cast<size_t>(maxLevel);
+}
+
+void FlatGridStorage::getLevelIndexArraysForEval(DataMatrix& level, DataMatrix& index) const {
+  level.resize(size, dimension);
+  index.resize(size, dimension);
+
+  for (size_t seq = 0; seq < size; seq++) {
+    for (size_t d = 0; d < dimension; d++) {
+      const size_t k = offset(seq, d);
+      level.set(seq, d, static_cast<double>(static_cast<index_type>(1) << this->level[k]));
+      index.set(seq, d, static_cast<double>(this->index[k]));
+    }
+  }
+}
+
+void FlatGridStorage::toHashGridStorage(HashGridStorage& storage) const {
+  if (storage.getDimension() != dimension) {
+    throw generation_exception("FlatGridStorage::toHashGridStorage: dimension mismatch");
+  }
+
+  HashGridPoint point(dimension);
+
+  for (size_t seq = 0; seq < size; seq++) {
+    getPoint(seq, point);
+    storage.insert(point);
+  }
+}
+
+size_t FlatGridStorage::computeHash(const level_type* l, const index_type* i) const {
+  size_t hash = 0xdeadbeef;
+
+  for (size_t d = 0; d < dimension; d++) {
+    hash = (static_cast<index_type>(1) << l[d]) + i[d] + hash * 65599;
+  }
+
+  return hash;
+}
+
+size_t FlatGridStorage::find(const HashGridPoint& point) const {
+  size_t slot = slotOf(point.getHash());
+
+  while (slots[slot] != NOT_FOUND) {
+    const size_t seq = slots[slot];
+
+    if ((hashes[seq] == point.getHash()) && equals(seq, point)) {
+      return seq;
+    }
+
+    slot = (slot + 1) & (slots.size() - 1);
+  }
+
+  return NOT_FOUND;
+}
+
+size_t FlatGridStorage::find(const level_type* l, const index_type* i, size_t hash) const {
+  size_t slot = slotOf(hash);
+
+  while (slots[slot] != NOT_FOUND) {
+    const size_t seq = slots[slot];
+
+    if ((hashes[seq] == hash) && equals(seq, l, i)) {
+      return seq;
+    }
+
+    slot = (slot + 1) & (slots.size() - 1);
+  }
+
+  return NOT_FOUND;
+}
+
+bool FlatGridStorage::equals(size_t seq, const level_type* l, const index_type* i) const {
+  for (size_t d = 0; d < dimension; d++) {
+    const size_t k = offset(seq, d);
+
+    if ((level[k] != l[d]) || (index[k] != i[d])) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool FlatGridStorage::equals(size_t seq, const HashGridPoint& point) const {
+  for (size_t d = 0; d < dimension; d++) {
+    const size_t k = offset(seq, d);
+
+    if ((level[k] != point.getLevel(d)) || (index[k] != point.getIndex(d))) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void FlatGridStorage::grow(size_t newCapacity) {
+  if (layout == Layout::PointMajor) {
+    level.resize(newCapacity * dimension);
+    index.resize(newCapacity * dimension);
+  } else {
+    // the column stride changes, so the existing entries have to be moved
+    std::vector<level_type> newLevel(newCapacity * dimension);
+    std::vector<index_type> newIndex(newCapacity * dimension);
+
+    for (size_t d = 0; d < dimension; d++) {
+      std::copy(level.begin() + d * capacity, level.begin() + d * capacity + size,
+                newLevel.begin() + d * newCapacity);
+      std::copy(index.begin() + d * capacity, index.begin() + d * capacity + size,
+                newIndex.begin() + d * newCapacity);
+    }
+
+    level.swap(newLevel);
+    index.swap(newIndex);
+  }
+
+  leaf.resize(newCapacity);
+  hashes.resize(newCapacity);
+  capacity = newCapacity;
+
+  size_t numberOfSlots = slots.size();
+
+  while (numberOfSlots < 2 * newCapacity) {
+    numberOfSlots *= 2;
+  }
+
+  if (numberOfSlots != slots.size()) {
+    rehash(numberOfSlots);
+  }
+}
+
+void FlatGridStorage::rehash(size_t numberOfSlots) {
+  slots.assign(numberOfSlots, NOT_FOUND);
+
+  for (size_t seq = 0; seq < size; seq++) {
+    addToIndex(seq);
+  }
+}
+
+size_t FlatGridStorage::allocate(size_t hash, bool isLeaf) {
+  if (size == capacity) {
+    grow(std::max<size_t>(2 * capacity, 16));
+  }
+
+  // keep the load factor of the index below 1/2
+  if (2 * (size + 1) > slots.size()) {
+    rehash(2 * slots.size());
+  }
+
+  const size_t seq = size++;
+  hashes[seq] = hash;
+  leaf[seq] = isLeaf;
+  return seq;
+}
+
+void FlatGridStorage::addToIndex(size_t seq) {
+  size_t slot = slotOf(hashes[seq]);
+
+  while (slots[slot] != NOT_FOUND) {
+    slot = (slot + 1) & (slots.size() - 1);
+  }
+
+  slots[slot] = seq;
+}
+
+void FlatGridStorage::removeFromIndex(size_t seq) {
+  const size_t mask = slots.size() - 1;
+  size_t hole = slotOf(hashes[seq]);
+
+  while (slots[hole] != seq) {
+    hole = (hole + 1) & mask;
+  }
+
+  // move entries of the same probe sequence into the hole, as long as this
+  // does not place them in front of their home slot
+  for (size_t next = (hole + 1) & mask; slots[next] != NOT_FOUND; next = (next + 1) & mask) {
+    const size_t home = slotOf(hashes[slots[next]]);
+
+    if (((next - home) & mask) >= ((next - hole) & mask)) {
+      slots[hole] = slots[next];
+      hole = next;
+    }
+  }
+
+  slots[hole] = NOT_FOUND;
+}
+
+}  // namespace base
+}  // namespace sgpp
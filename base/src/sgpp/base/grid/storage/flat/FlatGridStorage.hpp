@@ -0,0 +1,389 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef FLATGRIDSTORAGE_HPP
+#define FLATGRIDSTORAGE_HPP
+
+#include <sgpp/base/grid/storage/hashmap/HashGridPoint.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+class HashGridStorage;
+
+/**
+ * Grid storage that keeps the levels and indices of all grid points in
+ * contiguous structure-of-arrays buffers instead of one heap-allocated
+ * HashGridPoint per grid point. Grid points are found via an open-addressing
+ * hash index (linear probing) over the packed level/index keys, which uses the
+ * same per-dimension key as HashGridPoint::getHash() and therefore matches
+ * HashGridStorage for lookups.
+ *
+ * The class provides the query and insertion interface of HashGridStorage
+ * (getSize, insert, isContaining, getSequenceNumber, recalcLeafProperty,
+ * getLevelIndexArraysForEval, ...) with identical semantics and sequence
+ * numbers, so a FlatGridStorage built from a HashGridStorage can be used
+ * interchangeably for read-mostly algorithms.
+ *
+ * HashGridStorage can keep a FlatGridStorage as backend (see
+ * HashGridStorage::enableFlatStorage), which is then kept up to date on every
+ * modification and answers all grid point lookups, i.e. those of
+ * HashGridIterator and therefore of hierarchisation, refinement and up/down.
+ * Kernels that run over all grid points read the levels and indices from the
+ * contiguous arrays instead (e.g. OperationMultipleEvalLinearNaive).
+ */
+class FlatGridStorage {
+ public:
+  /// type of grid points
+  typedef HashGridPoint point_type;
+  /// level type
+  typedef HashGridPoint::level_type level_type;
+  /// index type
+  typedef HashGridPoint::index_type index_type;
+
+  /**
+   * Memory layout of the level and index arrays.
+   */
+  enum class Layout {
+    /// levels/indices of one grid point are contiguous: [seq * dim + d]
+    PointMajor,
+    /// levels/indices of one dimension are contiguous: [d * capacity + seq]
+    DimensionMajor
+  };
+
+  /**
+   * Constructor
+   *
+   * @param dimension the dimension of the sparse grid
+   * @param layout    memory layout of the level and index arrays
+   */
+  explicit FlatGridStorage(size_t dimension, Layout layout = Layout::PointMajor);
+
+  /**
+   * Constructor that copies all grid points (in the same order) from a HashGridStorage
+   *
+   * @param storage storage whose grid points should be copied
+   * @param layout  memory layout of the level and index arrays
+   */
+  explicit FlatGridStorage(HashGridStorage& storage, Layout layout = Layout::PointMajor);
+
+  /**
+   * Destructor
+   */
+  ~FlatGridStorage();
+
+  /**
+   * deletes all grid points in the storage
+   */
+  void clear();
+
+  /**
+   * reserves memory for a given number of grid points, such that no
+   * reallocation of the arrays or the hash index takes place until the
+   * storage contains more grid points
+   *
+   * @param numberOfPoints number of grid points
+   */
+  void reserve(size_t numberOfPoints);
+
+  /**
+   * @return number of grid points
+   */
+  inline size_t getSize() const { return size; }
+
+  /**
+   * @return dimension of the grid
+   */
+  inline size_t getDimension() const { return dimension; }
+
+  /**
+   * @return memory layout of the level and index arrays
+   */
+  inline Layout getLayout() const { return layout; }
+
+  /**
+   * gets the number of inner grid points
+   *
+   * @return the number of inner grid points
+   */
+  size_t getNumberOfInnerPoints() const;
+
+  /**
+   * @param seq sequence number of the grid point
+   * @param d   dimension
+   * @return    level of the grid point in dimension d
+   */
+  inline level_type getLevel(size_t seq, size_t d) const { return level[offset(seq, d)]; }
+
+  /**
+   * @param seq sequence number of the grid point
+   * @param d   dimension
+   * @return    index of the grid point in dimension d
+   */
+  inline index_type getIndex(size_t seq, size_t d) const { return index[offset(seq, d)]; }
+
+  /**
+   * Gets level @c l and index @c i in dimension @c d of a grid point
+   *
+   * @param seq sequence number of the grid point
+   * @param d   dimension
+   * @param l   level of the grid point in dimension d
+   * @param i   index of the grid point in dimension d
+   */
+  inline void get(size_t seq, size_t d, level_type& l, index_type& i) const {
+    const size_t k = offset(seq, d);
+    l = level[k];
+    i = index[k];
+  }
+
+  /**
+   * @param seq sequence number of the grid point
+   * @return    whether the grid point is a leaf
+   */
+  inline bool isLeaf(size_t seq) const { return leaf[seq] != 0; }
+
+  /**
+   * @param seq     sequence number of the grid point
+   * @param isLeaf  whether the grid point is a leaf
+   */
+  inline void setLeaf(size_t seq, bool isLeaf) { leaf[seq] = isLeaf; }
+
+  /**
+   * Copies a stored grid point into a HashGridPoint (including the leaf property).
+   *
+   * @param seq         sequence number of the grid point
+   * @param[out] point  grid point, will be resized to the grid's dimension if necessary
+   */
+  void getPoint(size_t seq, HashGridPoint& point) const;
+
+  /**
+   * @param seq sequence number of the grid point
+   * @return    grid point with sequence number seq as HashGridPoint
+   */
+  HashGridPoint getPoint(size_t seq) const;
+
+  /**
+   * Calculates the standard coordinate (in the unit hypercube) of a grid point.
+   *
+   * @param seq sequence number of the grid point
+   * @param d   dimension
+   * @return    coordinate of the grid point in dimension d
+   */
+  inline double getStandardCoordinate(size_t seq, size_t d) const {
+    const size_t k = offset(seq, d);
+    return static_cast<double>(index[k]) /
+           static_cast<double>(static_cast<index_type>(1) << level[k]);
+  }
+
+  /**
+   * Inserts a grid point at the end of the storage. If the grid point is
+   * already contained, the storage is not changed.
+   *
+   * @param point grid point to be inserted
+   * @return      sequence number of the grid point
+   */
+  size_t insert(const HashGridPoint& point);
+
+  /**
+   * Inserts a grid point given by its level and index arrays.
+   *
+   * @param l       level array of the grid point (of length getDimension())
+   * @param i       index array of the grid point (of length getDimension())
+   * @param isLeaf  leaf property of the grid point
+   * @return        sequence number of the grid point
+   */
+  size_t insert(const level_type* l, const index_type* i, bool isLeaf = true);
+
+  /**
+   * Appends a grid point at the end of the storage without checking whether
+   * it is already contained, which the caller has to ensure (as
+   * HashGridStorage::insert does).
+   *
+   * @param point grid point to be appended
+   * @return      sequence number of the appended grid point
+   */
+  size_t append(const HashGridPoint& point);
+
+  /**
+   * Replaces the grid point with sequence number seq (as HashGridStorage::update).
+   *
+   * @param point grid point to be stored
+   * @param seq   sequence number of the grid point that should be replaced
+   */
+  void update(const HashGridPoint& point, size_t seq);
+
+  /**
+   * Removes the grid point added last.
+   */
+  void deleteLast();
+
+  /**
+   * Tests if a grid point is in the storage
+   *
+   * @param point grid point
+   * @return      true if the grid point is in the storage
+   */
+  inline bool isContaining(const HashGridPoint& point) const {
+    return find(point) != NOT_FOUND;
+  }
+
+  /**
+   * Gets the sequence number of a grid point. As in HashGridStorage,
+   * getSize() + 1 is returned if the grid point is not in the storage.
+   *
+   * @param point grid point
+   * @return      sequence number of the grid point
+   */
+  inline size_t getSequenceNumber(const HashGridPoint& point) const {
+    const size_t seq = find(point);
+    return (seq == NOT_FOUND) ? (size + 1) : seq;
+  }
+
+  /**
+   * Gets the sequence number of a grid point given by its level and index arrays.
+   * getSize() + 1 is returned if the grid point is not in the storage.
+   *
+   * @param l level array of the grid point (of length getDimension())
+   * @param i index array of the grid point (of length getDimension())
+   * @return  sequence number of the grid point
+   */
+  inline size_t getSequenceNumber(const level_type* l, const index_type* i) const {
+    const size_t seq = find(l, i, computeHash(l, i));
+    return (seq == NOT_FOUND) ? (size + 1) : seq;
+  }
+
+  /**
+   * Tests if seq number does not point to a valid grid point
+   *
+   * @param s sequence number that should be tested
+   * @return  true if s is not a valid sequence number
+   */
+  inline bool isInvalidSequenceNumber(size_t s) const { return s > size; }
+
+  /**
+   * Recalculates the leaf property of every grid point.
+   */
+  void recalcLeafProperty();
+
+  /**
+   * returns the max. depth in all dimension of the grid
+   */
+  size_t getMaxLevel() const;
+
+  /**
+   * Same as HashGridStorage::getLevelIndexArraysForEval: the level matrix
+   * contains 2^level, the index matrix the indices (one row per grid point).
+   *
+   * @param level DataMatrix to store the grid's level to the power of two
+   * @param index DataMatrix to store the grid's indices
+   */
+  void getLevelIndexArraysForEval(DataMatrix& level, DataMatrix& index) const;
+
+  /**
+   * Appends all grid points (in order) to a HashGridStorage, preserving the
+   * sequence numbers if the HashGridStorage is empty.
+   *
+   * @param storage HashGridStorage of the same dimension
+   */
+  void toHashGridStorage(HashGridStorage& storage) const;
+
+  /**
+   * @return pointer to the raw level array (see getLayout() and getStride())
+   */
+  inline const level_type* getLevelData() const { return level.data(); }
+
+  /**
+   * @return pointer to the raw index array (see getLayout() and getStride())
+   */
+  inline const index_type* getIndexData() const { return index.data(); }
+
+  /**
+   * @return distance between consecutive dimensions of one grid point in the raw arrays
+   *         (1 for Layout::PointMajor, capacity for Layout::DimensionMajor)
+   */
+  inline size_t getStride() const { return (layout == Layout::PointMajor) ? 1 : capacity; }
+
+ private:
+  /// marker for empty hash slots and missing grid points
+  static const size_t NOT_FOUND;
+
+  /// dimension of the grid
+  size_t dimension;
+  /// memory layout of level and index
+  Layout layout;
+  /// number of stored grid points
+  size_t size;
+  /// number of grid points for which memory has been allocated
+  size_t capacity;
+  /// levels of all grid points
+  std::vector<level_type> level;
+  /// indices of all grid points
+  std::vector<index_type> index;
+  /// leaf property of all grid points
+  std::vector<char> leaf;
+  /// hash values of all grid points
+  std::vector<size_t> hashes;
+  /// open-addressing hash index (sequence numbers or NOT_FOUND), size is a power of two
+  std::vector<size_t> slots;
+
+  /**
+   * @param seq sequence number
+   * @param d   dimension
+   * @return    position of (seq, d) in the level/index arrays
+   */
+  inline size_t offset(size_t seq, size_t d) const {
+    return (layout == Layout::PointMajor) ? (seq * dimension + d) : (d * capacity + seq);
+  }
+
+  /**
+   * Computes the hash value of a grid point, equal to HashGridPoint::getHash().
+   */
+  size_t computeHash(const level_type* l, const index_type* i) const;
+
+  /**
+   * Maps a hash value to a slot of the open-addressing index.
+   */
+  inline size_t slotOf(size_t hash) const {
+    // the per-dimension keys are not well distributed in the lower bits,
+    // therefore the hash value is mixed before masking
+    uint64_t h = static_cast<uint64_t>(hash);
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return static_cast<size_t>(h) & (slots.size() - 1);
+  }
+
+  /// sequence number of point (or NOT_FOUND)
+  size_t find(const HashGridPoint& point) const;
+  /// sequence number of the point given by level/index arrays (or NOT_FOUND)
+  size_t find(const level_type* l, const index_type* i, size_t hash) const;
+  /// whether the stored grid point seq equals the given level/index arrays
+  bool equals(size_t seq, const level_type* l, const index_type* i) const;
+  /// whether the stored grid point seq equals the given grid point
+  bool equals(size_t seq, const HashGridPoint& point) const;
+  /// grows the arrays to hold at least newCapacity grid points
+  void grow(size_t newCapacity);
+  /// rebuilds the hash index with the given number of slots (power of two)
+  void rehash(size_t numberOfSlots);
+  /// reserves the next sequence number (without adding it to the hash index)
+  size_t allocate(size_t hash, bool isLeaf);
+  /// adds the grid point seq to the hash index
+  void addToIndex(size_t seq);
+  /// removes the grid point seq from the hash index (backward shift deletion)
+  void removeFromIndex(size_t seq);
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* FLATGRIDSTORAGE_HPP */
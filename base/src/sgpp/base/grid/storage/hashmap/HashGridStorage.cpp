@@ -104,6 +104,10 @@ HashGridStorage::HashGridStorage(HashGridStorage& copyFrom)
   for (size_t i = 0; i < copyFrom.getSize(); i++) {
     this->insert(copyFrom[i]);
   }
+
+  if (copyFrom.flatStorage) {
+    enableFlatStorage(copyFrom.flatStorage->getLayout());
+  }
 }
 
 void HashGridStorage::operator=(const HashGridStorage& other) {
@@ -128,6 +132,12 @@ void HashGridStorage::operator=(const HashGridStorage& other) {
   for (size_t i = 0; i < other.getSize(); i++) {
     this->insert(other[i]);
   }
+
+  if (other.flatStorage) {
+    enableFlatStorage(other.flatStorage->getLayout());
+  } else {
+    disableFlatStorage();
+  }
 }
 
 HashGridStorage::~HashGridStorage() {
@@ -153,6 +163,20 @@ void HashGridStorage::clear() {
   map.clear();
   // remove all list entries
   list.clear();
+  modificationCount++;
+
+  if (flatStorage) {
+    flatStorage->clear();
+  }
+}
+
+void HashGridStorage::reserve(size_t numberOfPoints) {
+  list.reserve(numberOfPoints);
+  map.reserve(numberOfPoints);
+
+  if (flatStorage) {
+    flatStorage->reserve(numberOfPoints);
+  }
 }
 
 std::vector<size_t> HashGridStorage::deletePoints(std::list<size_t>& removePoints) {
@@ -162,6 +186,7 @@ std::vector<size_t> HashGridStorage::deletePoints(std::list<size_t>& removePoint
 
   // sort list
   removePoints.sort();
+  modificationCount++;
 
   // DEBUG : print list points to delete, sorted
   // std::cout << std::endl << "List of points to delete, sorted" << std::endl;
@@ -194,6 +219,11 @@ std::vector<size_t> HashGridStorage::deletePoints(std::list<size_t>& removePoint
     map[curPoint] = i;
   }
 
+  // the sequence numbers have changed
+  if (flatStorage) {
+    enableFlatStorage(flatStorage->getLayout());
+  }
+
   // reset the whole grid's leaf property in order
   // to guarantee a consistent grid
   recalcLeafProperty();
@@ -285,10 +315,32 @@ size_t HashGridStorage::getNumberOfInnerPoints() const {
 
 size_t HashGridStorage::getDimension() const { return dimension; }
 
+size_t HashGridStorage::getModificationCount() const { return modificationCount; }
+
+void HashGridStorage::enableFlatStorage(FlatGridStorage::Layout layout) {
+  flatStorage.reset(new FlatGridStorage(*this, layout));
+}
+
+void HashGridStorage::disableFlatStorage() { flatStorage.reset(); }
+
 size_t HashGridStorage::insert(const point_type& index) {
   point_pointer insert = new HashGridPoint(index);
+  std::pair<grid_map_iterator, bool> entry = map.emplace(insert, list.size());
+
+  // the grid point is already contained
+  if (!entry.second) {
+    delete insert;
+    return entry.first->second;
+  }
+
   list.push_back(insert);
-  return (map[insert] = list.size() - 1);
+  modificationCount++;
+
+  if (flatStorage) {
+    flatStorage->append(*insert);
+  }
+
+  return entry.first->second;
 }
 
 void HashGridStorage::insert(point_type& index, std::vector<size_t>& insertedPoints) {
@@ -332,6 +384,11 @@ void HashGridStorage::update(point_type& index, size_t pos) {
     point_pointer insert = new HashGridPoint(index);
     list[pos] = insert;
     map[insert] = pos;
+    modificationCount++;
+
+    if (flatStorage) {
+      flatStorage->update(*insert, pos);
+    }
   }
 }
 
@@ -340,6 +397,11 @@ void HashGridStorage::deleteLast() {
   map.erase(del);
   list.pop_back();
   delete del;
+  modificationCount++;
+
+  if (flatStorage) {
+    flatStorage->deleteLast();
+  }
 }
 
 void HashGridStorage::setAlgorithmicDimensions(std::vector<size_t> newAlgoDims) {
@@ -434,6 +496,18 @@ void HashGridStorage::getLevelIndexArraysForEval(DataMatrix& level, DataMatrix&
   point_type::level_type curLevel;
   point_type::level_type curIndex;
 
+  if (flatStorage) {
+    for (size_t i = 0; i < list.size(); i++) {
+      for (size_t current_dim = 0; current_dim < dimension; current_dim++) {
+        flatStorage->get(i, current_dim, curLevel, curIndex);
+        level.set(i, current_dim, static_cast<double>(1 << curLevel));
+        index.set(i, current_dim, static_cast<double>(curIndex));
+      }
+    }
+
+    return;
+  }
+
   // Parallelization may lead to segfaults.... comment on your own risk
   //    #pragma omp parallel
   //    {
@@ -666,6 +740,12 @@ void HashGridStorage::parseGridDescription(std::istream& istream) {
     map[index] = i;
   }
 
+  modificationCount++;
+
+  if (flatStorage) {
+    enableFlatStorage(flatStorage->getLayout());
+  }
+
   // set's the grid point's leaf information which is not saved in version 1
   if (version == 1 || version == 4) {
     recalcLeafProperty();
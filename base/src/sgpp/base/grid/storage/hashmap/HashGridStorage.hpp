@@ -8,6 +8,7 @@
 
 #include <sgpp/base/exception/generation_exception.hpp>
 
+#include <sgpp/base/grid/storage/flat/FlatGridStorage.hpp>
 #include <sgpp/base/grid/storage/hashmap/HashGridPoint.hpp>
 #include <sgpp/base/grid/storage/hashmap/SerializationVersion.hpp>
 
@@ -127,6 +128,14 @@ class HashGridStorage {
    */
   void clear();
 
+  /**
+   * reserves memory for a given number of grid points, such that no
+   * rehashing takes place until the storage contains more grid points
+   *
+   * @param numberOfPoints number of grid points
+   */
+  void reserve(size_t numberOfPoints);
+
   /**
    * Remove several point from HashGridStorage. The points to removed
    * are stored in a list. This function returns a vector of remaining points
@@ -189,6 +198,40 @@ class HashGridStorage {
    */
   size_t getNumberOfInnerPoints() const;
 
+  /**
+   * gets the number of modifications of the set of grid points
+   * (insertion, deletion, update, clearing), which can be used to detect
+   * whether data derived from the grid points is outdated
+   * (changes of grid points via operator[] are not counted)
+   *
+   * @return the number of modifications since the construction
+   */
+  size_t getModificationCount() const;
+
+  /**
+   * Uses a FlatGridStorage as backend for grid point lookups: it keeps the
+   * levels and indices of all grid points in contiguous arrays with an
+   * open-addressing hash index and from now on answers isContaining and
+   * getSequenceNumber, i.e. every move of a HashGridIterator. The backend is
+   * kept up to date on every modification of the set of grid points. The leaf
+   * property is changed via the stored HashGridPoint objects and therefore not
+   * maintained in the backend.
+   *
+   * @param layout memory layout of the level and index arrays
+   */
+  void enableFlatStorage(FlatGridStorage::Layout layout = FlatGridStorage::Layout::PointMajor);
+
+  /**
+   * Removes the FlatGridStorage backend, lookups use the hash map again.
+   */
+  void disableFlatStorage();
+
+  /**
+   * @return the FlatGridStorage backend or nullptr if it is not enabled
+   *         (see enableFlatStorage)
+   */
+  inline const FlatGridStorage* getFlatStorage() const { return flatStorage.get(); }
+
   /**
    * gets the dimension of the grid
    *
@@ -223,11 +266,11 @@ class HashGridStorage {
   inline HashGridPoint& getPoint(size_t seq) const { return *list[seq]; }
 
   /**
-   * insert a new index into map
+   * insert a new index into map, if it is not contained yet
    *
    * @param index reference to the index that should be inserted
    *
-   * @return
+   * @return sequence number of the inserted index (or of the equal index that is already contained)
    */
   size_t insert(const point_type& index);
 
@@ -275,7 +318,8 @@ class HashGridStorage {
   void destroy(point_pointer index);
 
   /**
-   * stores a given index in the hashmap
+   * stores a given index in the hashmap; if an equal index is already
+   * stored, the given one is not stored (and remains owned by the caller)
    *
    * @param index pointer to index that should be stored
    *
@@ -534,6 +578,12 @@ class HashGridStorage {
   /// Flag to check if stretching or boundingBox used
   bool bUseStretching;
 
+  /// number of modifications of the set of grid points
+  size_t modificationCount = 0;
+
+  /// flat copy of the grid points used for lookups, nullptr if not enabled
+  std::unique_ptr<FlatGridStorage> flatStorage;
+
   /**
    * Parses the gird's information (grid points, dimensions, bounding box) from a string stream
    *
@@ -550,8 +600,18 @@ HashGridStorage::point_pointer inline HashGridStorage::create(point_type& index)
 void inline HashGridStorage::destroy(point_pointer index) { delete index; }
 
 unsigned int inline HashGridStorage::store(point_pointer index) {
-  list.push_back(index);
-  return static_cast<unsigned int>(map[index] = static_cast<unsigned int>(list.size() - 1));
+  std::pair<grid_map_iterator, bool> entry = map.emplace(index, list.size());
+
+  if (entry.second) {
+    modificationCount++;
+    list.push_back(index);
+
+    if (flatStorage) {
+      flatStorage->append(*index);
+    }
+  }
+
+  return static_cast<unsigned int>(entry.first->second);
 }
 
 HashGridStorage::grid_map_iterator inline HashGridStorage::find(point_pointer index) {
@@ -563,10 +623,18 @@ HashGridStorage::grid_map_iterator inline HashGridStorage::begin() { return map.
 HashGridStorage::grid_map_iterator inline HashGridStorage::end() { return map.end(); }
 
 bool inline HashGridStorage::isContaining(HashGridPoint& index) const {
+  if (flatStorage) {
+    return flatStorage->isContaining(index);
+  }
+
   return map.find(&index) != map.end();
 }
 
 size_t inline HashGridStorage::getSequenceNumber(HashGridPoint& index) const {
+  if (flatStorage) {
+    return flatStorage->getSequenceNumber(index);
+  }
+
   grid_map_const_iterator iter = map.find(&index);
 
   if (iter != map.end()) {
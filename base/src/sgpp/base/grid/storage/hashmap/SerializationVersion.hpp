@@ -23,4 +23,12 @@
  */
 #define SERIALIZATION_VERSION 9
 
+/**
+ * This specifies the available versions of the binary grid format (see GridBinaryFile)
+ *
+ * Version 1: header, grid description (as text, without grid points), levels, indices,
+ *            leaf properties and optional coefficients as raw arrays
+ */
+#define BINARY_SERIALIZATION_VERSION 1
+
 #endif /* SERIALIZATIONVERSION_HPP */
@@ -125,6 +125,19 @@
 
 #include <sgpp/base/operation/hash/OperationMultipleEvalInterModLinear.hpp>
 
+#include <sgpp/base/operation/hash/OperationMultipleEvalBatched.hpp>
+#include <sgpp/base/operation/hash/common/basis/BsplineBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/BsplineBoundaryBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/BsplineModifiedBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/FundamentalSplineBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/FundamentalSplineModifiedBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/PolyBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/PolyBoundaryBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/PolyModifiedBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/WaveletBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/WaveletBoundaryBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/WaveletModifiedBasis.hpp>
+
 #include <sgpp/base/operation/hash/OperationMultipleEvalBsplineBoundaryNaive.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEvalBsplineClenshawCurtisNaive.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEvalBsplineNaive.hpp>
@@ -556,6 +569,53 @@ base::OperationMultipleEval* createOperationMultipleEvalNaive(base::Grid& grid,
   }
 }
 
+base::OperationMultipleEval* createOperationMultipleEvalBatched(base::Grid& grid,
+                                                                base::DataMatrix& dataset) {
+  if (grid.getType() == base::GridType::Bspline) {
+    return new base::OperationMultipleEvalBatched<base::SBsplineBase>(
+        grid, dataset, base::SBsplineBase(dynamic_cast<base::BsplineGrid&>(grid).getDegree()));
+  } else if (grid.getType() == base::GridType::BsplineBoundary) {
+    return new base::OperationMultipleEvalBatched<base::SBsplineBoundaryBase>(
+        grid, dataset,
+        base::SBsplineBoundaryBase(dynamic_cast<base::BsplineBoundaryGrid&>(grid).getDegree()));
+  } else if (grid.getType() == base::GridType::ModBspline) {
+    return new base::OperationMultipleEvalBatched<base::SBsplineModifiedBase>(
+        grid, dataset,
+        base::SBsplineModifiedBase(dynamic_cast<base::ModBsplineGrid&>(grid).getDegree()));
+  } else if (grid.getType() == base::GridType::FundamentalSpline) {
+    return new base::OperationMultipleEvalBatched<base::SFundamentalSplineBase>(
+        grid, dataset,
+        base::SFundamentalSplineBase(dynamic_cast<base::FundamentalSplineGrid&>(grid).getDegree()));
+  } else if (grid.getType() == base::GridType::ModFundamentalSpline) {
+    return new base::OperationMultipleEvalBatched<base::SFundamentalSplineModifiedBase>(
+        grid, dataset,
+        base::SFundamentalSplineModifiedBase(
+            dynamic_cast<base::ModFundamentalSplineGrid&>(grid).getDegree()));
+  } else if (grid.getType() == base::GridType::Poly) {
+    return new base::OperationMultipleEvalBatched<base::SPolyBase>(
+        grid, dataset, base::SPolyBase(dynamic_cast<base::PolyGrid&>(grid).getDegree()));
+  } else if (grid.getType() == base::GridType::PolyBoundary) {
+    return new base::OperationMultipleEvalBatched<base::SPolyBoundaryBase>(
+        grid, dataset,
+        base::SPolyBoundaryBase(dynamic_cast<base::PolyBoundaryGrid&>(grid).getDegree()));
+  } else if (grid.getType() == base::GridType::ModPoly) {
+    return new base::OperationMultipleEvalBatched<base::SPolyModifiedBase>(
+        grid, dataset, base::SPolyModifiedBase(dynamic_cast<base::ModPolyGrid&>(grid).getDegree()));
+  } else if (grid.getType() == base::GridType::Wavelet) {
+    return new base::OperationMultipleEvalBatched<base::SWaveletBase>(grid, dataset,
+                                                                      base::SWaveletBase());
+  } else if (grid.getType() == base::GridType::WaveletBoundary) {
+    return new base::OperationMultipleEvalBatched<base::SWaveletBoundaryBase>(
+        grid, dataset, base::SWaveletBoundaryBase());
+  } else if (grid.getType() == base::GridType::ModWavelet) {
+    return new base::OperationMultipleEvalBatched<base::SWaveletModifiedBase>(
+        grid, dataset, base::SWaveletModifiedBase());
+  } else {
+    throw base::factory_exception(
+        "createOperationMultipleEvalBatched is not implemented for this grid type.");
+  }
+}
+
 base::OperationEval* createOperationEvalNaive(base::Grid& grid) {
   if (grid.getType() == base::GridType::Linear) {
     return new base::OperationEvalLinearNaive(grid.getStorage());
@@ -147,6 +147,22 @@ base::OperationMultipleEval* createOperationMultipleEvalInter(base::Grid& grid,
 base::OperationMultipleEval* createOperationMultipleEvalNaive(base::Grid& grid,
                                                               base::DataMatrix& dataset);
 
+/**
+ * Factory method, returning an OperationMultipleEvalBatched for the grid at hand.
+ * This evaluates each distinct 1D basis function only once per data point and, in fine
+ * subspaces, only looks up the grid points whose support contains the data point, which is
+ * much faster than createOperationMultipleEvalNaive for B-spline, fundamental spline,
+ * polynomial and wavelet grids.
+ * Note: object has to be freed after use.
+ *
+ * @param grid Grid which is to be used
+ * @param dataset The dataset (DataMatrix, one datapoint per row) that is to be evaluated for
+ * the sparse grid function
+ * @return Pointer to the new OperationMultipleEval object for the Grid grid
+ */
+base::OperationMultipleEval* createOperationMultipleEvalBatched(base::Grid& grid,
+                                                                base::DataMatrix& dataset);
+
 /**
  * Factory method, returning an OperationEval for the grid at hand.
  * In contrast to OperationEval, implementations of OperationEval
@@ -66,6 +66,35 @@ class OperationEvalGradient {
     }
   }
 
+  /**
+   * Evaluates the linear combination and its gradient at multiple points.
+   * The default implementation evaluates the points one after another.
+   *
+   * @param       alpha     coefficient vector
+   * @param       points    evaluation points (each row is a point)
+   * @param[out]  values    values of the linear combination at the points
+   * @param[out]  gradients gradients of the linear combination at the points
+   *                        (each row is a gradient vector)
+   */
+  virtual void evalGradient(const DataVector& alpha,
+                            const DataMatrix& points,
+                            DataVector& values,
+                            DataMatrix& gradients) {
+    const size_t m = points.getNrows();
+    const size_t d = points.getNcols();
+    DataVector curPoint(d);
+    DataVector curGradient(d);
+
+    values.resize(m);
+    gradients.resize(m, d);
+
+    for (size_t j = 0; j < m; j++) {
+      points.getRow(j, curPoint);
+      values[j] = evalGradient(alpha, curPoint, curGradient);
+      gradients.setRow(j, curGradient);
+    }
+  }
+
   /// untransformed evaluation point (temporary vector)
   DataVector pointInUnitCube;
 };
@@ -5,6 +5,7 @@
 
 #include <sgpp/globaldef.hpp>
 #include <sgpp/base/operation/hash/OperationEvalGradientBsplineNaive.hpp>
+#include <sgpp/base/operation/hash/common/algorithm_batch/DerivativesBatchEvaluator.hpp>
 
 namespace sgpp {
 namespace base {
@@ -110,5 +111,13 @@ void OperationEvalGradientBsplineNaive::evalGradient(const DataMatrix& alpha,
   }
 }
 
+void OperationEvalGradientBsplineNaive::evalGradient(const DataVector& alpha,
+                                                     const DataMatrix& points,
+                                                     DataVector& values,
+                                                     DataMatrix& gradients) {
+  DerivativesBatchEvaluator<SBsplineBase> evaluator(storage, base);
+  evaluator.evalGradient(alpha, points, values, gradients);
+}
+
 }  // namespace base
 }  // namespace sgpp
@@ -20,6 +20,8 @@ namespace base {
  */
 class OperationEvalGradientBsplineNaive : public OperationEvalGradient {
  public:
+  using OperationEvalGradient::evalGradient;
+
   /**
    * Constructor.
    *
@@ -60,6 +62,22 @@ class OperationEvalGradientBsplineNaive : public OperationEvalGradient {
                     DataVector& value,
                     DataMatrix& gradient) override;
 
+  /**
+   * Evaluates the linear combination and its gradient at multiple points.
+   * The 1D basis functions are tabulated per point and shared by all grid points and the
+   * points are processed in parallel (see DerivativesBatchEvaluator).
+   *
+   * @param       alpha     coefficient vector
+   * @param       points    evaluation points (each row is a point)
+   * @param[out]  values    values of the linear combination at the points
+   * @param[out]  gradients gradients of the linear combination at the points
+   *                        (each row is a gradient vector)
+   */
+  void evalGradient(const DataVector& alpha,
+                    const DataMatrix& points,
+                    DataVector& values,
+                    DataMatrix& gradients) override;
+
  protected:
   /// storage of the sparse grid
   GridStorage& storage;
@@ -5,6 +5,7 @@
 
 #include <sgpp/globaldef.hpp>
 #include <sgpp/base/operation/hash/OperationEvalGradientModBsplineClenshawCurtisNaive.hpp>
+#include <sgpp/base/operation/hash/common/algorithm_batch/DerivativesBatchEvaluator.hpp>
 
 namespace sgpp {
 namespace base {
@@ -110,5 +111,13 @@ void OperationEvalGradientModBsplineClenshawCurtisNaive::evalGradient(const Data
   }
 }
 
+void OperationEvalGradientModBsplineClenshawCurtisNaive::evalGradient(const DataVector& alpha,
+                                                                      const DataMatrix& points,
+                                                                      DataVector& values,
+                                                                      DataMatrix& gradients) {
+  DerivativesBatchEvaluator<SBsplineModifiedClenshawCurtisBase> evaluator(storage, base);
+  evaluator.evalGradient(alpha, points, values, gradients);
+}
+
 }  // namespace base
 }  // namespace sgpp
@@ -21,6 +21,8 @@ namespace base {
  */
 class OperationEvalGradientModWaveletNaive : public OperationEvalGradient {
  public:
+  using OperationEvalGradient::evalGradient;
+
   /**
    * Constructor.
    *
@@ -21,6 +21,8 @@ namespace base {
 class OperationEvalGradientWaveletBoundaryNaive : public
   OperationEvalGradient {
  public:
+  using OperationEvalGradient::evalGradient;
+
   /**
    * Constructor.
    *
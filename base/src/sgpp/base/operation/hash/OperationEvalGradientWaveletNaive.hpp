@@ -20,6 +20,8 @@ namespace base {
  */
 class OperationEvalGradientWaveletNaive : public OperationEvalGradient {
  public:
+  using OperationEvalGradient::evalGradient;
+
   /**
    * Constructor.
    *
@@ -77,6 +77,39 @@ class OperationEvalHessian {
       gradient.setRow(j, curGradient);
     }
   }
+
+  /**
+   * Evaluates the linear combination, its gradient and its Hessian at multiple points.
+   * The default implementation evaluates the points one after another.
+   *
+   * @param       alpha     coefficient vector
+   * @param       points    evaluation points (each row is a point)
+   * @param[out]  values    values of the linear combination at the points
+   * @param[out]  gradients gradients of the linear combination at the points
+   *                        (each row is a gradient vector)
+   * @param[out]  hessians  Hessians of the linear combination at the points
+   */
+  virtual void evalHessian(const DataVector& alpha,
+                           const DataMatrix& points,
+                           DataVector& values,
+                           DataMatrix& gradients,
+                           std::vector<DataMatrix>& hessians) {
+    const size_t m = points.getNrows();
+    const size_t d = points.getNcols();
+    DataVector curPoint(d);
+    DataVector curGradient(d);
+
+    values.resize(m);
+    gradients.resize(m, d);
+    hessians.resize(m);
+
+    for (size_t j = 0; j < m; j++) {
+      points.getRow(j, curPoint);
+      values[j] = evalHessian(alpha, curPoint, curGradient, hessians[j]);
+      gradients.setRow(j, curGradient);
+    }
+  }
+
   /// untransformed evaluation point (temporary vector)
   DataVector pointInUnitCube;
 };
@@ -5,6 +5,7 @@
 
 #include <sgpp/globaldef.hpp>
 #include <sgpp/base/operation/hash/OperationEvalHessianBsplineClenshawCurtisNaive.hpp>
+#include <sgpp/base/operation/hash/common/algorithm_batch/DerivativesBatchEvaluator.hpp>
 
 #include <vector>
 
@@ -171,5 +172,15 @@ void OperationEvalHessianBsplineClenshawCurtisNaive::evalHessian(const DataMatri
   }
 }
 
+void OperationEvalHessianBsplineClenshawCurtisNaive::evalHessian(
+    const DataVector& alpha,
+    const DataMatrix& points,
+    DataVector& values,
+    DataMatrix& gradients,
+    std::vector<DataMatrix>& hessians) {
+  DerivativesBatchEvaluator<SBsplineClenshawCurtisBase> evaluator(storage, base);
+  evaluator.evalHessian(alpha, points, values, gradients, hessians);
+}
+
 }  // namespace base
 }  // namespace sgpp
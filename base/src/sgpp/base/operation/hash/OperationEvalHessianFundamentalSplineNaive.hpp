@@ -25,6 +25,8 @@ namespace base {
 class OperationEvalHessianFundamentalSplineNaive : public
   OperationEvalHessian {
  public:
+  using OperationEvalHessian::evalHessian;
+
   /**
    * Constructor.
    *
@@ -69,6 +71,24 @@ class OperationEvalHessianFundamentalSplineNaive : public
                    DataMatrix& gradient,
                    std::vector<DataMatrix>& hessian) override;
 
+  /**
+   * Evaluates the linear combination, its gradient and its Hessian at multiple points.
+   * The 1D basis functions are tabulated per point and shared by all grid points and the
+   * points are processed in parallel (see DerivativesBatchEvaluator).
+   *
+   * @param       alpha     coefficient vector
+   * @param       points    evaluation points (each row is a point)
+   * @param[out]  values    values of the linear combination at the points
+   * @param[out]  gradients gradients of the linear combination at the points
+   *                        (each row is a gradient vector)
+   * @param[out]  hessians  Hessians of the linear combination at the points
+   */
+  void evalHessian(const DataVector& alpha,
+                   const DataMatrix& points,
+                   DataVector& values,
+                   DataMatrix& gradients,
+                   std::vector<DataMatrix>& hessians) override;
+
  protected:
   /// storage of the sparse grid
   GridStorage& storage;
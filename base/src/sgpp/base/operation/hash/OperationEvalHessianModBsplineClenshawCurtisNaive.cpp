@@ -5,6 +5,7 @@
 
 #include <sgpp/globaldef.hpp>
 #include <sgpp/base/operation/hash/OperationEvalHessianModBsplineClenshawCurtisNaive.hpp>
+#include <sgpp/base/operation/hash/common/algorithm_batch/DerivativesBatchEvaluator.hpp>
 
 #include <vector>
 
@@ -172,5 +173,15 @@ void OperationEvalHessianModBsplineClenshawCurtisNaive::evalHessian(
   }
 }
 
+void OperationEvalHessianModBsplineClenshawCurtisNaive::evalHessian(
+    const DataVector& alpha,
+    const DataMatrix& points,
+    DataVector& values,
+    DataMatrix& gradients,
+    std::vector<DataMatrix>& hessians) {
+  DerivativesBatchEvaluator<SBsplineModifiedClenshawCurtisBase> evaluator(storage, base);
+  evaluator.evalHessian(alpha, points, values, gradients, hessians);
+}
+
 }  // namespace base
 }  // namespace sgpp
@@ -5,6 +5,7 @@
 
 #include <sgpp/globaldef.hpp>
 #include <sgpp/base/operation/hash/OperationEvalHessianModBsplineNaive.hpp>
+#include <sgpp/base/operation/hash/common/algorithm_batch/DerivativesBatchEvaluator.hpp>
 
 #include <vector>
 
@@ -171,5 +172,14 @@ void OperationEvalHessianModBsplineNaive::evalHessian(const DataMatrix& alpha,
   }
 }
 
+void OperationEvalHessianModBsplineNaive::evalHessian(const DataVector& alpha,
+                                                      const DataMatrix& points,
+                                                      DataVector& values,
+                                                      DataMatrix& gradients,
+                                                      std::vector<DataMatrix>& hessians) {
+  DerivativesBatchEvaluator<SBsplineModifiedBase> evaluator(storage, base);
+  evaluator.evalHessian(alpha, points, values, gradients, hessians);
+}
+
 }  // namespace base
 }  // namespace sgpp
@@ -24,6 +24,8 @@ namespace base {
  */
 class OperationEvalHessianModWaveletNaive : public OperationEvalHessian {
  public:
+  using OperationEvalHessian::evalHessian;
+
   /**
    * Constructor.
    *
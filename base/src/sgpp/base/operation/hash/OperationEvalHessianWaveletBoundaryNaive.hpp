@@ -25,6 +25,8 @@ namespace base {
 class OperationEvalHessianWaveletBoundaryNaive : public
   OperationEvalHessian {
  public:
+  using OperationEvalHessian::evalHessian;
+
   /**
    * Constructor.
    *
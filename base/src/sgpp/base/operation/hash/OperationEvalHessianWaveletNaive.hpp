@@ -24,6 +24,8 @@ namespace base {
  */
 class OperationEvalHessianWaveletNaive : public OperationEvalHessian {
  public:
+  using OperationEvalHessian::evalHessian;
+
   /**
    * Constructor.
    *
@@ -23,7 +23,7 @@ void OperationHierarchisationLinearStretched::doHierarchisation(
 
   // Execute hierarchisation in every dimension of the grid
   for (size_t i = 0; i < this->storage.getDimension(); i++) {
-    s.sweep1D(node_values, node_values, i);
+    s.sweep1DParallel(node_values, node_values, i);
   }
 }
 
@@ -34,7 +34,7 @@ void OperationHierarchisationLinearStretched::doDehierarchisation(
 
   // Execute hierarchisation in every dimension of the grid
   for (size_t i = 0; i < this->storage.getDimension(); i++) {
-    s.sweep1D(alpha, alpha, i);
+    s.sweep1DParallel(alpha, alpha, i);
   }
 }
 
@@ -22,7 +22,7 @@ void OperationHierarchisationPolyClenshawCurtisBoundary::doHierarchisation(
 
   // Execute hierarchisation in every dimension of the grid
   for (size_t i = 0; i < this->storage.getDimension(); i++) {
-    s.sweep1D_Boundary(node_values, node_values, i);
+    s.sweep1D_BoundaryParallel(node_values, node_values, i);
   }
 }
 
@@ -33,7 +33,7 @@ void OperationHierarchisationPolyClenshawCurtisBoundary::doDehierarchisation(Dat
   // Execute hierarchisation in every dimension of the grid
   for (size_t i = 0; i < this->storage.getDimension(); i++) {
     DataVector source(alpha);
-    s.sweep1D_Boundary(source, alpha, i);
+    s.sweep1D_BoundaryParallel(source, alpha, i);
   }
 }
 
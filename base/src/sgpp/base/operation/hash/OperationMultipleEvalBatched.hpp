@@ -0,0 +1,502 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef OPERATIONMULTIPLEEVALBATCHED_HPP
+#define OPERATIONMULTIPLEEVALBATCHED_HPP
+
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Multiple evaluation of linear combinations of tensor product basis functions
+ * (B-splines, polynomials, wavelets, ...) for a whole set of data points.
+ *
+ * In contrast to the Naive operations, which evaluate the 1D basis for every
+ * grid point and every dimension, this operation
+ * - enumerates the distinct 1D basis functions (level, index) of every
+ *   dimension once (in prepare()),
+ * - groups the grid points by their level vector (subspace),
+ * - evaluates, for every data point, each distinct 1D basis function only once
+ *   and collects the non-zero ones per dimension and level,
+ * - skips whole subspaces for which some level has no non-zero 1D basis
+ *   function at the data point,
+ * - visits, in subspaces with many more grid points than combinations of
+ *   non-zero 1D basis functions (e.g., fine subspaces of B-spline grids), only
+ *   the grid points whose support contains the data point (found by hash
+ *   lookups), and
+ * - forms the tensor products by table lookups.
+ *
+ * Evaluation is parallelized over data points, every thread using its own copy
+ * of the 1D basis (some bases use internal scratch memory).
+ *
+ * @tparam BASIS  1D basis type, needs to be copy-constructible and to provide
+ *                eval(level, index, x)
+ */
+template <class BASIS>
+class OperationMultipleEvalBatched : public OperationMultipleEval {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param grid      sparse grid
+   * @param dataset   data points (row-wise)
+   * @param basis     1D basis
+   */
+  OperationMultipleEvalBatched(Grid& grid, DataMatrix& dataset, const BASIS& basis)
+      : OperationMultipleEval(grid, dataset),
+        storage(grid.getStorage()),
+        base(basis),
+        points(nullptr),
+        modificationCount(0) {
+    prepare();
+  }
+
+  /**
+   * Destructor.
+   */
+  ~OperationMultipleEvalBatched() override {}
+
+  /**
+   * Rebuilds the subspace and 1D basis function tables.
+   * Has to be called if the grid changed since the last call.
+   */
+  void prepare() override {
+    const size_t n = storage.getSize();
+    const size_t d = storage.getDimension();
+
+    // distinct 1D basis functions of every dimension
+    // (sorted by level, such that the functions of one level are contiguous)
+    std::vector<std::map<std::pair<level_t, index_t>, uint32_t>> functionIds(d);
+    // subspaces (level vectors) and their grid points
+    std::map<std::vector<level_t>, std::vector<size_t>> subspaceMap;
+    std::vector<level_t> levelVector(d);
+
+    functionLevel.assign(d, std::vector<level_t>());
+    functionIndex.assign(d, std::vector<index_t>());
+    maxLevel.assign(d, 0);
+
+    for (size_t i = 0; i < n; i++) {
+      const GridPoint& gp = storage[i];
+
+      for (size_t t = 0; t < d; t++) {
+        const level_t l = gp.getLevel(t);
+        const index_t idx = gp.getIndex(t);
+        levelVector[t] = l;
+
+        functionIds[t].emplace(std::make_pair(l, idx), 0);
+
+        if (l > maxLevel[t]) {
+          maxLevel[t] = l;
+        }
+      }
+
+      subspaceMap[levelVector].push_back(i);
+    }
+
+    // offsets of the per-dimension 1D value tables in one contiguous array
+    functionOffset.assign(d + 1, 0);
+    levelOffset.assign(d + 1, 0);
+
+    for (size_t t = 0; t < d; t++) {
+      functionOffset[t + 1] = functionOffset[t] + functionIds[t].size();
+      levelOffset[t + 1] = levelOffset[t] + maxLevel[t] + 1;
+    }
+
+    // number the 1D basis functions and store the range of every level
+    levelFunctionBegin.assign(levelOffset.back(), 0);
+
+    for (size_t t = 0; t < d; t++) {
+      uint32_t id = 0;
+
+      for (auto& function : functionIds[t]) {
+        const level_t l = function.first.first;
+
+        if ((id == 0) || (l != functionLevel[t].back())) {
+          levelFunctionBegin[levelOffset[t] + l] = static_cast<uint32_t>(functionOffset[t] + id);
+        }
+
+        function.second = id;
+        functionLevel[t].push_back(l);
+        functionIndex[t].push_back(function.first.second);
+        id++;
+      }
+    }
+
+    // sort grid points by subspaces and store, for every grid point and dimension,
+    // the position of its 1D basis value in the value table
+    subspaceLevels.clear();
+    subspaceStart.assign(1, 0);
+    gridPointSeq.resize(n);
+    gridPointFunction.resize(n * d);
+
+    size_t k = 0;
+
+    for (auto& subspace : subspaceMap) {
+      for (size_t t = 0; t < d; t++) {
+        subspaceLevels.push_back(
+            static_cast<uint32_t>(levelOffset[t] + subspace.first[t]));
+      }
+
+      for (size_t i : subspace.second) {
+        const GridPoint& gp = storage[i];
+        gridPointSeq[k] = i;
+
+        for (size_t t = 0; t < d; t++) {
+          gridPointFunction[k * d + t] = static_cast<uint32_t>(
+              functionOffset[t] +
+              functionIds[t][std::make_pair(gp.getLevel(t), gp.getIndex(t))]);
+        }
+
+        k++;
+      }
+
+      subspaceStart.push_back(k);
+    }
+
+    modificationCount = storage.getModificationCount();
+    isPrepared = true;
+  }
+
+  /**
+   * @param      alpha   coefficient vector
+   * @param[out] result  values of the linear combination at the data points
+   */
+  void mult(DataVector& alpha, DataVector& result) override {
+    if (modificationCount != storage.getModificationCount()) {
+      prepare();
+    }
+
+    const size_t m = dataset.getNrows();
+
+    result.setAll(0.0);
+    transformDataset();
+
+#pragma omp parallel
+    {
+      ThreadData data(*this);
+
+#pragma omp for schedule(dynamic, 16)
+
+      for (size_t j = 0; j < m; j++) {
+        evalBasis1D(data, j);
+
+        double value = 0.0;
+        forEachNonZero(data, [&value, &alpha](size_t i, double phi) {
+          value += alpha[i] * phi;
+        });
+
+        result[j] = value;
+      }
+    }
+  }
+
+  /**
+   * @param      source  data point weights
+   * @param[out] result  result of the transposed evaluation (one entry per grid point)
+   */
+  void multTranspose(DataVector& source, DataVector& result) override {
+    if (modificationCount != storage.getModificationCount()) {
+      prepare();
+    }
+
+    const size_t m = dataset.getNrows();
+    const size_t n = gridPointSeq.size();
+
+    result.setAll(0.0);
+    transformDataset();
+
+#ifdef _OPENMP
+    const size_t numThreads = static_cast<size_t>(omp_get_max_threads());
+#else
+    const size_t numThreads = 1;
+#endif
+
+    // private result vectors of threads 1, ..., numThreads - 1
+    // (thread 0 accumulates into result), summed up in parallel
+    std::vector<DataVector> privateResults(numThreads - 1);
+
+#pragma omp parallel num_threads(static_cast<int>(numThreads))
+    {
+#ifdef _OPENMP
+      const size_t threadId = static_cast<size_t>(omp_get_thread_num());
+      const size_t actualNumThreads = static_cast<size_t>(omp_get_num_threads());
+#else
+      const size_t threadId = 0;
+      const size_t actualNumThreads = 1;
+#endif
+
+      if (threadId > 0) {
+        privateResults[threadId - 1].resizeZero(n);
+      }
+
+      DataVector& privateResult = (threadId == 0) ? result : privateResults[threadId - 1];
+      ThreadData data(*this);
+
+#pragma omp for schedule(dynamic, 16)
+
+      for (size_t j = 0; j < m; j++) {
+        evalBasis1D(data, j);
+
+        const double weight = source[j];
+        forEachNonZero(data, [&privateResult, weight](size_t i, double phi) {
+          privateResult[i] += weight * phi;
+        });
+      }
+
+      if (actualNumThreads > 1) {
+#pragma omp for schedule(static)
+
+        for (size_t i = 0; i < n; i++) {
+          double sum = 0.0;
+
+          for (size_t t = 0; t < actualNumThreads - 1; t++) {
+            sum += privateResults[t][i];
+          }
+
+          result[i] += sum;
+        }
+      }
+    }
+  }
+
+  double getDuration() override { return 0.0; }
+
+ protected:
+  /// cost of looking up a grid point relative to scanning one grid point of a subspace
+  static const size_t LOOKUP_COST = 16;
+
+  /// level type
+  typedef GridPoint::level_type level_t;
+  /// index type
+  typedef GridPoint::index_type index_t;
+
+  /// storage of the sparse grid
+  GridStorage& storage;
+  /// 1D basis (copied for every thread)
+  BASIS base;
+  /// data points transformed to the unit cube (only used for non-trivial bounding boxes)
+  DataMatrix pointsInUnitCube;
+  /// data points in the unit cube, either the dataset itself or pointsInUnitCube
+  const DataMatrix* points;
+  /// modification count of the grid storage at the time of the last prepare()
+  size_t modificationCount;
+
+  /// levels of the distinct 1D basis functions of every dimension
+  std::vector<std::vector<level_t>> functionLevel;
+  /// indices of the distinct 1D basis functions of every dimension
+  std::vector<std::vector<index_t>> functionIndex;
+  /// maximal level of every dimension
+  std::vector<level_t> maxLevel;
+  /// offsets of the dimensions in the 1D value table
+  std::vector<size_t> functionOffset;
+  /// offsets of the dimensions in the per-level tables
+  std::vector<size_t> levelOffset;
+  /// first 1D basis function (position in the value table) of every dimension and level
+  std::vector<uint32_t> levelFunctionBegin;
+
+  /// subspace level vectors (as positions in the per-level tables), d per subspace
+  std::vector<uint32_t> subspaceLevels;
+  /// start of every subspace in gridPointSeq (plus end of the last subspace)
+  std::vector<size_t> subspaceStart;
+  /// sequence numbers of the grid points, sorted by subspaces
+  std::vector<size_t> gridPointSeq;
+  /// positions of the 1D basis values in the value table, d per grid point
+  std::vector<uint32_t> gridPointFunction;
+
+  /**
+   * Per-thread scratch memory.
+   */
+  struct ThreadData {
+    /// 1D basis (some bases use internal scratch memory)
+    BASIS basis;
+    /// values of the 1D basis functions at the current data point
+    std::vector<double> values1d;
+    /// non-zero 1D basis functions, stored in the ranges given by levelFunctionBegin
+    std::vector<uint32_t> nonZeroFunctions;
+    /// end of the non-zero 1D basis functions of every dimension and level
+    std::vector<uint32_t> nonZeroEnd;
+    /// current combination of non-zero 1D basis functions (positions in nonZeroFunctions)
+    std::vector<uint32_t> combination;
+    /// grid point for hash lookups
+    GridPoint gridPoint;
+
+    explicit ThreadData(const OperationMultipleEvalBatched& op)
+        : basis(op.base),
+          values1d(op.functionOffset.back()),
+          nonZeroFunctions(op.functionOffset.back()),
+          nonZeroEnd(op.levelOffset.back()),
+          combination(op.functionLevel.size()),
+          gridPoint(op.functionLevel.size()) {}
+  };
+
+  /**
+   * Sets points to the data points in the unit cube. The dataset is only copied
+   * if the bounding box is not the unit cube.
+   */
+  void transformDataset() {
+    BoundingBox* boundingBox = storage.getBoundingBox();
+
+    if ((boundingBox == nullptr) || boundingBox->isUnitCube()) {
+      points = &dataset;
+    } else {
+      pointsInUnitCube = dataset;
+      boundingBox->transformPointsToUnitCube(pointsInUnitCube);
+      points = &pointsInUnitCube;
+    }
+  }
+
+  /**
+   * Evaluates all distinct 1D basis functions at a data point and collects
+   * the non-zero ones per dimension and level.
+   *
+   * @param data  scratch memory of the current thread
+   * @param j     index of the data point
+   */
+  void evalBasis1D(ThreadData& data, size_t j) {
+    const size_t d = functionLevel.size();
+
+    for (size_t t = 0; t < d; t++) {
+      const double x = points->get(j, t);
+      const std::vector<level_t>& fl = functionLevel[t];
+      const std::vector<index_t>& fi = functionIndex[t];
+      double* values = &data.values1d[functionOffset[t]];
+
+      for (size_t l = levelOffset[t]; l < levelOffset[t + 1]; l++) {
+        data.nonZeroEnd[l] = levelFunctionBegin[l];
+      }
+
+      for (size_t k = 0; k < fl.size(); k++) {
+        values[k] = data.basis.eval(fl[k], fi[k], x);
+
+        if (values[k] != 0.0) {
+          data.nonZeroFunctions[data.nonZeroEnd[levelOffset[t] + fl[k]]++] =
+              static_cast<uint32_t>(functionOffset[t] + k);
+        }
+      }
+    }
+  }
+
+  /**
+   * Calls f(seq, value) for every grid point with non-zero basis function value
+   * at the data point whose 1D values have been computed by evalBasis1D.
+   */
+  template <class F>
+  inline void forEachNonZero(ThreadData& data, F f) const {
+    const size_t d = functionLevel.size();
+    const size_t numberOfSubspaces = subspaceStart.size() - 1;
+    const std::vector<double>& values1d = data.values1d;
+
+    for (size_t s = 0; s < numberOfSubspaces; s++) {
+      const uint32_t* levels = &subspaceLevels[s * d];
+      const size_t subspaceSize = subspaceStart[s + 1] - subspaceStart[s];
+      // number of combinations of non-zero 1D basis functions
+      // (capped at the size of the subspace)
+      size_t numberOfCombinations = 1;
+
+      for (size_t t = 0; t < d; t++) {
+        numberOfCombinations = std::min(
+            numberOfCombinations * (data.nonZeroEnd[levels[t]] - levelFunctionBegin[levels[t]]),
+            subspaceSize);
+      }
+
+      // hash lookups only pay off if the subspace is much larger
+      // than the number of combinations
+
+      if (numberOfCombinations == 0) {
+        continue;
+      } else if (LOOKUP_COST * numberOfCombinations < subspaceSize) {
+        forEachCombination(data, levels, f);
+        continue;
+      }
+
+      for (size_t k = subspaceStart[s]; k < subspaceStart[s + 1]; k++) {
+        const uint32_t* functions = &gridPointFunction[k * d];
+        double value = 1.0;
+
+        for (size_t t = 0; t < d; t++) {
+          value *= values1d[functions[t]];
+
+          if (value == 0.0) {
+            break;
+          }
+        }
+
+        if (value != 0.0) {
+          f(gridPointSeq[k], value);
+        }
+      }
+    }
+  }
+
+  /**
+   * Calls f(seq, value) for every grid point of a subspace which is a tensor product
+   * of non-zero 1D basis functions, looking the grid points up in the grid storage.
+   *
+   * @param data    scratch memory of the current thread
+   * @param levels  level vector of the subspace (as positions in the per-level tables)
+   * @param f       function to call
+   */
+  template <class F>
+  inline void forEachCombination(ThreadData& data, const uint32_t* levels, F f) const {
+    const size_t d = functionLevel.size();
+    std::vector<uint32_t>& combination = data.combination;
+    GridPoint& gp = data.gridPoint;
+
+    for (size_t t = 0; t < d; t++) {
+      combination[t] = levelFunctionBegin[levels[t]];
+    }
+
+    while (true) {
+      double value = 1.0;
+
+      for (size_t t = 0; t < d; t++) {
+        const size_t function = data.nonZeroFunctions[combination[t]] - functionOffset[t];
+        value *= data.values1d[functionOffset[t] + function];
+        gp.push(t, functionLevel[t][function], functionIndex[t][function]);
+      }
+
+      gp.rehash();
+      const size_t seq = storage.getSequenceNumber(gp);
+
+      if (seq < storage.getSize()) {
+        f(seq, value);
+      }
+
+      // next combination
+      size_t t = 0;
+
+      while ((t < d) && (++combination[t] == data.nonZeroEnd[levels[t]])) {
+        combination[t] = levelFunctionBegin[levels[t]];
+        t++;
+      }
+
+      if (t == d) {
+        break;
+      }
+    }
+  }
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* OPERATIONMULTIPLEEVALBATCHED_HPP */
@@ -19,13 +19,15 @@ void OperationMultipleEvalLinearBoundaryNaive::mult(DataVector& alpha, DataVecto
   pointsInUnitCube = dataset;
   storage.getBoundingBox()->transformPointsToUnitCube(pointsInUnitCube);
 
+  const FlatGridStorage& flatStorage = getFlatStorage();
+
   for (size_t j = 0; j < m; j++) {
     for (size_t i = 0; i < n; i++) {
-      const GridPoint& gp = storage[i];
       double curValue = 1.0;
 
       for (size_t t = 0; t < d; t++) {
-        const double val1d = base.eval(gp.getLevel(t), gp.getIndex(t), pointsInUnitCube(j, t));
+        const double val1d = base.eval(flatStorage.getLevel(i, t), flatStorage.getIndex(i, t),
+                                       pointsInUnitCube(j, t));
 
         if (val1d == 0.0) {
           curValue = 0.0;
@@ -51,14 +53,15 @@ void OperationMultipleEvalLinearBoundaryNaive::multTranspose(DataVector& alpha,
   pointsInUnitCube = dataset;
   storage.getBoundingBox()->transformPointsToUnitCube(pointsInUnitCube);
 
-  for (size_t i = 0; i < n; i++) {
-    const GridPoint& gp = storage[i];
+  const FlatGridStorage& flatStorage = getFlatStorage();
 
+  for (size_t i = 0; i < n; i++) {
     for (size_t j = 0; j < m; j++) {
       double curValue = 1.0;
 
       for (size_t t = 0; t < d; t++) {
-        const double val1d = base.eval(gp.getLevel(t), gp.getIndex(t), pointsInUnitCube(j, t));
+        const double val1d = base.eval(flatStorage.getLevel(i, t), flatStorage.getIndex(i, t),
+                                       pointsInUnitCube(j, t));
 
         if (val1d == 0.0) {
           curValue = 0.0;
@@ -75,5 +78,20 @@ void OperationMultipleEvalLinearBoundaryNaive::multTranspose(DataVector& alpha,
 
 double OperationMultipleEvalLinearBoundaryNaive::getDuration() { return 0.0; }
 
+const FlatGridStorage& OperationMultipleEvalLinearBoundaryNaive::getFlatStorage() {
+  const FlatGridStorage* flatStorage = storage.getFlatStorage();
+
+  if (flatStorage != nullptr) {
+    return *flatStorage;
+  }
+
+  if ((flatCopy == nullptr) || (flatCopyModificationCount != storage.getModificationCount())) {
+    flatCopy.reset(new FlatGridStorage(storage));
+    flatCopyModificationCount = storage.getModificationCount();
+  }
+
+  return *flatCopy;
+}
+
 }  // namespace base
 }  // namespace sgpp
@@ -19,13 +19,15 @@ void OperationMultipleEvalLinearNaive::mult(DataVector& alpha, DataVector& resul
   pointsInUnitCube = dataset;
   storage.getBoundingBox()->transformPointsToUnitCube(pointsInUnitCube);
 
+  const FlatGridStorage& flatStorage = getFlatStorage();
+
   for (size_t j = 0; j < m; j++) {
     for (size_t i = 0; i < n; i++) {
-      const GridPoint& gp = storage[i];
       double curValue = 1.0;
 
       for (size_t t = 0; t < d; t++) {
-        const double val1d = base.eval(gp.getLevel(t), gp.getIndex(t), pointsInUnitCube(j, t));
+        const double val1d = base.eval(flatStorage.getLevel(i, t), flatStorage.getIndex(i, t),
+                                       pointsInUnitCube(j, t));
 
         if (val1d == 0.0) {
           curValue = 0.0;
@@ -50,14 +52,15 @@ void OperationMultipleEvalLinearNaive::multTranspose(DataVector& alpha, DataVect
   pointsInUnitCube = dataset;
   storage.getBoundingBox()->transformPointsToUnitCube(pointsInUnitCube);
 
-  for (size_t i = 0; i < n; i++) {
-    const GridPoint& gp = storage[i];
+  const FlatGridStorage& flatStorage = getFlatStorage();
 
+  for (size_t i = 0; i < n; i++) {
     for (size_t j = 0; j < m; j++) {
       double curValue = 1.0;
 
       for (size_t t = 0; t < d; t++) {
-        const double val1d = base.eval(gp.getLevel(t), gp.getIndex(t), pointsInUnitCube(j, t));
+        const double val1d = base.eval(flatStorage.getLevel(i, t), flatStorage.getIndex(i, t),
+                                       pointsInUnitCube(j, t));
 
         if (val1d == 0.0) {
           curValue = 0.0;
@@ -74,5 +77,20 @@ void OperationMultipleEvalLinearNaive::multTranspose(DataVector& alpha, DataVect
 
 double OperationMultipleEvalLinearNaive::getDuration() { return 0.0; }
 
+const FlatGridStorage& OperationMultipleEvalLinearNaive::getFlatStorage() {
+  const FlatGridStorage* flatStorage = storage.getFlatStorage();
+
+  if (flatStorage != nullptr) {
+    return *flatStorage;
+  }
+
+  if ((flatCopy == nullptr) || (flatCopyModificationCount != storage.getModificationCount())) {
+    flatCopy.reset(new FlatGridStorage(storage));
+    flatCopyModificationCount = storage.getModificationCount();
+  }
+
+  return *flatCopy;
+}
+
 }  // namespace base
 }  // namespace sgpp
@@ -7,10 +7,13 @@
 
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/grid/storage/flat/FlatGridStorage.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearBasis.hpp>
 
 #include <sgpp/globaldef.hpp>
 
+#include <memory>
+
 namespace sgpp {
 namespace base {
 
@@ -33,6 +36,16 @@ class OperationMultipleEvalLinearNaive : public OperationMultipleEval {
   SLinearBase base;
   /// untransformed evaluation point (temporary vector)
   DataMatrix pointsInUnitCube;
+  /// flat copy of the grid points if the storage has no flat backend
+  std::unique_ptr<FlatGridStorage> flatCopy;
+  /// modification count of the storage when flatCopy was created
+  size_t flatCopyModificationCount = 0;
+
+  /**
+   * @return the flat backend of the storage or, if there is none, an up-to-date flat copy
+   *         of the grid points, from which the levels and indices are read contiguously
+   */
+  const FlatGridStorage& getFlatStorage();
 };
 
 }  // namespace base
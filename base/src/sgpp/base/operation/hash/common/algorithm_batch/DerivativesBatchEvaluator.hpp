@@ -0,0 +1,310 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef DERIVATIVESBATCHEVALUATOR_HPP
+#define DERIVATIVESBATCHEVALUATOR_HPP
+
+#include <sgpp/globaldef.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Evaluates a linear combination of tensor product basis functions together with its gradient
+ * and Hessian at many points at once.
+ *
+ * The naive evaluation operations evaluate the 1D basis functions once for every grid point and
+ * dimension. Usually, many grid points share the same 1D basis function (level and index) in a
+ * dimension, so this class numbers the distinct 1D functions per dimension once (for all points).
+ * For each point, every distinct 1D function and its derivatives are evaluated only once; the
+ * tensor products are then assembled from these tables. The gradient is computed with prefix
+ * and suffix products (\f$\mathcal{O}(d)\f$ instead of \f$\mathcal{O}(d^2)\f$ per grid point)
+ * and grid points whose basis function vanishes in too many dimensions are skipped.
+ * The points are processed in parallel; each thread works on its own copy of the basis, as
+ * the evaluation methods of some bases use temporary members.
+ *
+ * @tparam BASIS  1D basis type providing eval(), evalDx() and evalDxDx()
+ */
+template <class BASIS>
+class DerivativesBatchEvaluator {
+ public:
+  /**
+   * Constructor.
+   * The numbering of the 1D functions is computed here, so the grid must not be changed during
+   * the lifetime of the object.
+   *
+   * @param storage   storage of the sparse grid
+   * @param basis     1D basis (copied for every thread)
+   */
+  DerivativesBatchEvaluator(GridStorage& storage, const BASIS& basis)
+      : storage(storage),
+        basis(basis),
+        n(storage.getSize()),
+        d(storage.getDimension()),
+        levels(d),
+        indices(d),
+        functionNumbers(n * d) {
+    for (size_t t = 0; t < d; t++) {
+      std::unordered_map<uint64_t, size_t> numbers;
+
+      for (size_t i = 0; i < n; i++) {
+        const GridPoint& gp = storage[i];
+        const uint64_t key = (static_cast<uint64_t>(gp.getLevel(t)) << 32) |
+                             static_cast<uint64_t>(gp.getIndex(t));
+        auto it = numbers.find(key);
+
+        if (it == numbers.end()) {
+          it = numbers.insert(std::make_pair(key, levels[t].size())).first;
+          levels[t].push_back(gp.getLevel(t));
+          indices[t].push_back(gp.getIndex(t));
+        }
+
+        functionNumbers[i * d + t] = it->second;
+      }
+    }
+  }
+
+  /**
+   * @param       alpha       coefficient vector
+   * @param       points      evaluation points (each row is a point)
+   * @param[out]  values      values of the linear combination at the points
+   * @param[out]  gradients   gradients of the linear combination (each row is a gradient)
+   */
+  void evalGradient(const DataVector& alpha, const DataMatrix& points, DataVector& values,
+                    DataMatrix& gradients) {
+    const size_t m = points.getNrows();
+
+    values.resize(m);
+    gradients.resize(m, d);
+
+    #pragma omp parallel
+    {
+      Tables tables(*this);
+      DataVector point(d);
+      DataVector gradient(d);
+
+      #pragma omp for schedule(dynamic)
+      for (size_t j = 0; j < m; j++) {
+        points.getRow(j, point);
+        tables.compute(point, false);
+        values[j] = evalGradientAt(alpha, tables, gradient);
+        gradients.setRow(j, gradient);
+      }
+    }
+  }
+
+  /**
+   * @param       alpha       coefficient vector
+   * @param       points      evaluation points (each row is a point)
+   * @param[out]  values      values of the linear combination at the points
+   * @param[out]  gradients   gradients of the linear combination (each row is a gradient)
+   * @param[out]  hessians    Hessians of the linear combination (one matrix per point)
+   */
+  void evalHessian(const DataVector& alpha, const DataMatrix& points, DataVector& values,
+                   DataMatrix& gradients, std::vector<DataMatrix>& hessians) {
+    const size_t m = points.getNrows();
+
+    values.resize(m);
+    gradients.resize(m, d);
+    hessians.assign(m, DataMatrix(d, d));
+
+    #pragma omp parallel
+    {
+      Tables tables(*this);
+      DataVector point(d);
+      DataVector gradient(d);
+
+      #pragma omp for schedule(dynamic)
+      for (size_t j = 0; j < m; j++) {
+        points.getRow(j, point);
+        tables.compute(point, true);
+        values[j] = evalHessianAt(alpha, tables, gradient, hessians[j]);
+        gradients.setRow(j, gradient);
+      }
+    }
+  }
+
+ protected:
+  /**
+   * Values and derivatives of all distinct 1D functions at one point (one instance per thread).
+   */
+  struct Tables {
+    explicit Tables(const DerivativesBatchEvaluator& evaluator)
+        : evaluator(evaluator),
+          basis(evaluator.basis),
+          values(evaluator.d),
+          dxs(evaluator.d),
+          dxdxs(evaluator.d),
+          innerDerivative(evaluator.d),
+          prefix(evaluator.d + 1),
+          suffix(evaluator.d + 1),
+          curValues(evaluator.d),
+          curDxs(evaluator.d),
+          curDxDxs(evaluator.d) {
+      for (size_t t = 0; t < evaluator.d; t++) {
+        values[t].resize(evaluator.levels[t].size());
+        dxs[t].resize(evaluator.levels[t].size());
+        dxdxs[t].resize(evaluator.levels[t].size());
+        innerDerivative[t] = 1.0 / evaluator.storage.getBoundingBox()->getIntervalWidth(t);
+      }
+    }
+
+    void compute(DataVector& point, bool secondDerivatives) {
+      evaluator.storage.getBoundingBox()->transformPointToUnitCube(point);
+
+      for (size_t t = 0; t < evaluator.d; t++) {
+        const std::vector<level_t>& curLevels = evaluator.levels[t];
+        const std::vector<index_t>& curIndices = evaluator.indices[t];
+        const double x = point[t];
+
+        for (size_t k = 0; k < curLevels.size(); k++) {
+          values[t][k] = basis.eval(curLevels[k], curIndices[k], x);
+          dxs[t][k] = basis.evalDx(curLevels[k], curIndices[k], x) * innerDerivative[t];
+
+          if (secondDerivatives) {
+            dxdxs[t][k] = basis.evalDxDx(curLevels[k], curIndices[k], x) * innerDerivative[t] *
+                          innerDerivative[t];
+          }
+        }
+      }
+    }
+
+    /**
+     * Gathers the 1D values of grid point i and returns the number of vanishing 1D values.
+     */
+    size_t gather(size_t i, bool secondDerivatives) {
+      const size_t d = evaluator.d;
+      const size_t* numbers = &evaluator.functionNumbers[i * d];
+      size_t zeros = 0;
+
+      for (size_t t = 0; t < d; t++) {
+        curValues[t] = values[t][numbers[t]];
+        curDxs[t] = dxs[t][numbers[t]];
+
+        if (secondDerivatives) {
+          curDxDxs[t] = dxdxs[t][numbers[t]];
+        }
+
+        if (curValues[t] == 0.0) {
+          zeros++;
+        }
+      }
+
+      return zeros;
+    }
+
+    /**
+     * Computes prefix[t] = curValues[0] * ... * curValues[t - 1] and
+     * suffix[t] = curValues[t] * ... * curValues[d - 1].
+     */
+    void computeProducts() {
+      const size_t d = evaluator.d;
+      prefix[0] = 1.0;
+      suffix[d] = 1.0;
+
+      for (size_t t = 0; t < d; t++) {
+        prefix[t + 1] = prefix[t] * curValues[t];
+        suffix[d - t - 1] = suffix[d - t] * curValues[d - t - 1];
+      }
+    }
+
+    const DerivativesBatchEvaluator& evaluator;
+    BASIS basis;
+    std::vector<std::vector<double>> values;
+    std::vector<std::vector<double>> dxs;
+    std::vector<std::vector<double>> dxdxs;
+    std::vector<double> innerDerivative;
+    std::vector<double> prefix;
+    std::vector<double> suffix;
+    std::vector<double> curValues;
+    std::vector<double> curDxs;
+    std::vector<double> curDxDxs;
+  };
+
+  double evalGradientAt(const DataVector& alpha, Tables& tables, DataVector& gradient) const {
+    double result = 0.0;
+    gradient.setAll(0.0);
+
+    for (size_t i = 0; i < n; i++) {
+      // if two 1D values vanish, the value and all partial derivatives vanish
+      if ((alpha[i] == 0.0) || (tables.gather(i, false) > 1)) {
+        continue;
+      }
+
+      tables.computeProducts();
+      result += alpha[i] * tables.prefix[d];
+
+      for (size_t t = 0; t < d; t++) {
+        gradient[t] += alpha[i] * tables.prefix[t] * tables.curDxs[t] * tables.suffix[t + 1];
+      }
+    }
+
+    return result;
+  }
+
+  double evalHessianAt(const DataVector& alpha, Tables& tables, DataVector& gradient,
+                       DataMatrix& hessian) const {
+    double result = 0.0;
+    gradient.setAll(0.0);
+    hessian.setAll(0.0);
+
+    for (size_t i = 0; i < n; i++) {
+      // if three 1D values vanish, the value and all derivatives up to order two vanish
+      if ((alpha[i] == 0.0) || (tables.gather(i, true) > 2)) {
+        continue;
+      }
+
+      tables.computeProducts();
+      result += alpha[i] * tables.prefix[d];
+
+      for (size_t t1 = 0; t1 < d; t1++) {
+        const double dx1 = alpha[i] * tables.curDxs[t1];
+        gradient[t1] += dx1 * tables.prefix[t1] * tables.suffix[t1 + 1];
+        hessian(t1, t1) +=
+            alpha[i] * tables.curDxDxs[t1] * tables.prefix[t1] * tables.suffix[t1 + 1];
+
+        // product of the 1D values strictly between t1 and t2
+        double between = 1.0;
+
+        for (size_t t2 = t1 + 1; t2 < d; t2++) {
+          const double entry =
+              dx1 * tables.curDxs[t2] * tables.prefix[t1] * between * tables.suffix[t2 + 1];
+          hessian(t1, t2) += entry;
+          hessian(t2, t1) += entry;
+          between *= tables.curValues[t2];
+        }
+      }
+    }
+
+    return result;
+  }
+
+  /// storage of the sparse grid
+  GridStorage& storage;
+  /// 1D basis
+  const BASIS& basis;
+  /// number of grid points
+  size_t n;
+  /// dimensionality
+  size_t d;
+  /// levels of the distinct 1D functions per dimension
+  std::vector<std::vector<level_t>> levels;
+  /// indices of the distinct 1D functions per dimension
+  std::vector<std::vector<index_t>> indices;
+  /// number of the 1D function of grid point i in dimension t at position i * d + t
+  std::vector<size_t> functionNumbers;
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* DERIVATIVESBATCHEVALUATOR_HPP */
@@ -0,0 +1,57 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/tools/CPUFeatures.hpp>
+
+namespace sgpp {
+namespace base {
+
+#ifdef SGPP_CPU_DISPATCH
+
+bool CPUFeatures::hasAVX() {
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx");
+}
+
+bool CPUFeatures::hasAVX2() {
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+}
+
+bool CPUFeatures::hasAVX512F() {
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx512f");
+}
+
+#else
+
+bool CPUFeatures::hasAVX() {
+#ifdef __AVX__
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool CPUFeatures::hasAVX2() {
+#if defined(__AVX2__) && defined(__FMA__)
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool CPUFeatures::hasAVX512F() {
+#ifdef __AVX512F__
+  return true;
+#else
+  return false;
+#endif
+}
+
+#endif
+
+}  // namespace base
+}  // namespace sgpp
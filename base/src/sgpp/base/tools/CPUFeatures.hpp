@@ -0,0 +1,55 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef CPUFEATURES_HPP
+#define CPUFEATURES_HPP
+
+#include <sgpp/globaldef.hpp>
+
+/**
+ * SGPP_CPU_DISPATCH is defined if the compiler can generate code for
+ * instruction sets that are not enabled on the command line
+ * (via __attribute__((target(...)))) and if the instruction set extensions
+ * of the CPU can be queried at runtime. Kernels for AVX2 or AVX-512 can then
+ * be compiled into every build and selected at runtime with CPUFeatures.
+ */
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__)) && \
+    !defined(__MIC__) && !defined(__INTEL_COMPILER)
+#define SGPP_CPU_DISPATCH
+#endif
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Runtime detection of the SIMD instruction set extensions supported by the
+ * CPU (and the operating system) the program is running on.
+ *
+ * The queries are answered via CPUID (by the compiler's builtins, which also
+ * check that the OS saves the extended registers). If SGPP_CPU_DISPATCH is
+ * not defined, the extensions enabled at compile time are reported.
+ */
+class CPUFeatures {
+ public:
+  /**
+   * @return whether AVX is supported
+   */
+  static bool hasAVX();
+
+  /**
+   * @return whether AVX2 and FMA3 are supported
+   */
+  static bool hasAVX2();
+
+  /**
+   * @return whether the AVX-512 foundation instructions are supported
+   */
+  static bool hasAVX512F();
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* CPUFEATURES_HPP */
@@ -0,0 +1,89 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/tools/MemoryMappedFile.hpp>
+
+#include <sgpp/base/exception/file_exception.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <fstream>
+#include <iterator>
+#include <string>
+
+namespace sgpp {
+namespace base {
+
+MemoryMappedFile::MemoryMappedFile(const std::string& filename)
+    : data(nullptr), size(0), buffer(), mapped(false) {
+#ifndef _WIN32
+  const int fd = open(filename.c_str(), O_RDONLY);
+
+  if (fd < 0) {
+    throw file_exception("MemoryMappedFile : could not open file");
+  }
+
+  struct stat fileStatus;
+
+  if (fstat(fd, &fileStatus) != 0) {
+    close(fd);
+    throw file_exception("MemoryMappedFile : could not determine the file size");
+  }
+
+  size = static_cast<size_t>(fileStatus.st_size);
+
+  if (size > 0) {
+    void* address = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+
+    if (address != MAP_FAILED) {
+      data = static_cast<const char*>(address);
+      mapped = true;
+    }
+  }
+
+  close(fd);
+
+  if (mapped || (size == 0)) {
+    return;
+  }
+#endif
+
+  // fallback: read the whole file
+  std::ifstream file(filename, std::ios::binary);
+
+  if (!file) {
+    throw file_exception("MemoryMappedFile : could not open file");
+  }
+
+  buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  data = buffer.empty() ? nullptr : buffer.data();
+  size = buffer.size();
+}
+
+MemoryMappedFile::~MemoryMappedFile() {
+#ifndef _WIN32
+  if (mapped) {
+    munmap(const_cast<char*>(data), size);
+  }
+#endif
+}
+
+void MemoryMappedFile::adviseSequential() const {
+#ifndef _WIN32
+  if (mapped) {
+    madvise(const_cast<char*>(data), size, MADV_SEQUENTIAL);
+  }
+#endif
+}
+
+}  // namespace base
+}  // namespace sgpp
@@ -0,0 +1,78 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef MEMORYMAPPEDFILE_HPP
+#define MEMORYMAPPEDFILE_HPP
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Read-only view of the contents of a file.
+ *
+ * On POSIX systems, the file is mapped into memory, i.e., opening the file
+ * takes constant time, its pages are loaded on demand and shared with other
+ * processes mapping the same file. On other systems (or if the mapping
+ * fails), the file is read into a buffer.
+ */
+class MemoryMappedFile {
+ public:
+  /**
+   * Opens a file. Throws a file_exception if the file cannot be opened.
+   *
+   * @param filename  name of the file
+   */
+  explicit MemoryMappedFile(const std::string& filename);
+
+  /**
+   * Destructor, unmaps the file.
+   */
+  ~MemoryMappedFile();
+
+  MemoryMappedFile(const MemoryMappedFile&) = delete;
+  MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+  /**
+   * @return pointer to the contents of the file (nullptr for empty files)
+   */
+  inline const char* getData() const { return data; }
+
+  /**
+   * @return size of the file in bytes
+   */
+  inline size_t getSize() const { return size; }
+
+  /**
+   * @return whether the file is mapped (and not copied into a buffer)
+   */
+  inline bool isMapped() const { return mapped; }
+
+  /**
+   * Tells the operating system that the file will be read sequentially,
+   * which enables aggressive read-ahead. Has no effect if the file isn't mapped.
+   */
+  void adviseSequential() const;
+
+ private:
+  /// contents of the file
+  const char* data;
+  /// size of the file in bytes
+  size_t size;
+  /// file contents if the file could not be mapped
+  std::vector<char> buffer;
+  /// whether data points to a memory mapping
+  bool mapped;
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* MEMORYMAPPEDFILE_HPP */
@@ -48,6 +48,7 @@
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/GridBinaryFile.hpp>
 #include <sgpp/base/grid/GridDataBase.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/grid/common/BoundingBox.hpp>
@@ -134,6 +135,7 @@
 #include <sgpp/base/tools/GaussLegendreQuadRule1D.hpp>
 #include <sgpp/base/tools/GridPrinter.hpp>
 #include <sgpp/base/tools/GridPrinterForStretching.hpp>
+#include <sgpp/base/tools/MemoryMappedFile.hpp>
 #include <sgpp/base/tools/MultipleClassPoint.hpp>
 #include <sgpp/base/tools/OperationQuadratureMC.hpp>
 #include <sgpp/base/tools/QuadRule1D.hpp>
@@ -0,0 +1,335 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/grid/storage/flat/FlatGridStorage.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridIterator.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridPoint.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridStorage.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusCoarseningFunctor.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
+#include <sgpp/base/grid/generation/hashmap/HashCoarsening.hpp>
+#include <sgpp/base/grid/generation/hashmap/HashGenerator.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationHierarchisation.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::FlatGridStorage;
+using sgpp::base::Grid;
+using sgpp::base::HashCoarsening;
+using sgpp::base::HashGenerator;
+using sgpp::base::HashGridIterator;
+using sgpp::base::HashGridPoint;
+using sgpp::base::HashGridStorage;
+using sgpp::base::OperationMultipleEval;
+using sgpp::base::SurplusCoarseningFunctor;
+using sgpp::base::SurplusRefinementFunctor;
+
+namespace {
+
+/**
+ * Checks that the flat backend of a HashGridStorage contains exactly its grid points
+ * (with the same sequence numbers).
+ */
+void checkFlatBackend(HashGridStorage& storage) {
+  const FlatGridStorage* flatStorage = storage.getFlatStorage();
+  BOOST_REQUIRE(flatStorage != nullptr);
+  BOOST_CHECK_EQUAL(flatStorage->getSize(), storage.getSize());
+
+  for (size_t seq = 0; seq < storage.getSize(); seq++) {
+    HashGridPoint& point = storage.getPoint(seq);
+    BOOST_CHECK_EQUAL(storage.getSequenceNumber(point), seq);
+
+    for (size_t d = 0; d < storage.getDimension(); d++) {
+      BOOST_CHECK_EQUAL(flatStorage->getLevel(seq, d), point.getLevel(d));
+      BOOST_CHECK_EQUAL(flatStorage->getIndex(seq, d), point.getIndex(d));
+    }
+  }
+}
+
+/**
+ * Hierarchises f(x) = prod_d x_d^2 on the grid and evaluates the interpolant with the naive
+ * and the default multiple evaluation.
+ */
+void hierarchiseAndEvaluate(Grid& grid, DataVector& alpha, DataVector& naiveResult,
+                            DataVector& result) {
+  HashGridStorage& storage = grid.getStorage();
+  alpha.resize(storage.getSize());
+
+  for (size_t seq = 0; seq < storage.getSize(); seq++) {
+    alpha[seq] = 1.0;
+
+    for (size_t d = 0; d < storage.getDimension(); d++) {
+      alpha[seq] *= std::pow(storage.getPoint(seq).getStandardCoordinate(d), 2);
+    }
+  }
+
+  std::unique_ptr<sgpp::base::OperationHierarchisation>(
+      sgpp::op_factory::createOperationHierarchisation(grid))
+      ->doHierarchisation(alpha);
+
+  DataMatrix points(50, storage.getDimension());
+
+  for (size_t i = 0; i < points.getNrows(); i++) {
+    for (size_t d = 0; d < points.getNcols(); d++) {
+      points.set(i, d, std::fmod(0.137 * static_cast<double>((i + 1) * (d + 3)), 1.0));
+    }
+  }
+
+  naiveResult.resize(points.getNrows());
+  result.resize(points.getNrows());
+  std::unique_ptr<OperationMultipleEval>(
+      sgpp::op_factory::createOperationMultipleEvalNaive(grid, points))
+      ->mult(alpha, naiveResult);
+  std::unique_ptr<OperationMultipleEval>(
+      sgpp::op_factory::createOperationMultipleEval(grid, points))
+      ->mult(alpha, result);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestFlatGridStorage)
+
+BOOST_AUTO_TEST_CASE(testCopyFromHashGridStorage) {
+  const std::vector<FlatGridStorage::Layout> layouts = {FlatGridStorage::Layout::PointMajor,
+                                                        FlatGridStorage::Layout::DimensionMajor};
+
+  for (FlatGridStorage::Layout layout : layouts) {
+    HashGridStorage storage(3);
+    HashGenerator generator;
+    generator.regular(storage, 4);
+
+    FlatGridStorage flatStorage(storage, layout);
+
+    BOOST_CHECK_EQUAL(flatStorage.getSize(), storage.getSize());
+    BOOST_CHECK_EQUAL(flatStorage.getDimension(), storage.getDimension());
+    BOOST_CHECK_EQUAL(flatStorage.getMaxLevel(), storage.getMaxLevel());
+    BOOST_CHECK_EQUAL(flatStorage.getNumberOfInnerPoints(), storage.getNumberOfInnerPoints());
+
+    for (size_t seq = 0; seq < storage.getSize(); seq++) {
+      HashGridPoint& point = storage.getPoint(seq);
+      BOOST_CHECK(flatStorage.isContaining(point));
+      BOOST_CHECK_EQUAL(flatStorage.getSequenceNumber(point), seq);
+      BOOST_CHECK(flatStorage.getPoint(seq).equals(point));
+      BOOST_CHECK_EQUAL(flatStorage.isLeaf(seq), point.isLeaf());
+
+      for (size_t d = 0; d < storage.getDimension(); d++) {
+        BOOST_CHECK_EQUAL(flatStorage.getLevel(seq, d), point.getLevel(d));
+        BOOST_CHECK_EQUAL(flatStorage.getIndex(seq, d), point.getIndex(d));
+      }
+    }
+
+    DataMatrix level(storage.getSize(), 3), index(storage.getSize(), 3);
+    DataMatrix flatLevel, flatIndex;
+    storage.getLevelIndexArraysForEval(level, index);
+    flatStorage.getLevelIndexArraysForEval(flatLevel, flatIndex);
+
+    for (size_t k = 0; k < level.getSize(); k++) {
+      BOOST_CHECK_EQUAL(level[k], flatLevel[k]);
+      BOOST_CHECK_EQUAL(index[k], flatIndex[k]);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testInsertAndLeafProperty) {
+  const std::vector<FlatGridStorage::Layout> layouts = {FlatGridStorage::Layout::PointMajor,
+                                                        FlatGridStorage::Layout::DimensionMajor};
+
+  for (FlatGridStorage::Layout layout : layouts) {
+    HashGridStorage storage(2);
+    HashGenerator generator;
+    generator.regular(storage, 5);
+
+    // insert the points one by one to exercise the growth of the arrays and the index
+    FlatGridStorage flatStorage(2, layout);
+
+    for (size_t seq = 0; seq < storage.getSize(); seq++) {
+      BOOST_CHECK_EQUAL(flatStorage.insert(storage.getPoint(seq)), seq);
+    }
+
+    // inserting an existing point must not change the storage
+    BOOST_CHECK_EQUAL(flatStorage.insert(storage.getPoint(3)), 3U);
+    BOOST_CHECK_EQUAL(flatStorage.getSize(), storage.getSize());
+
+    HashGridPoint missing(2);
+    missing.set(0, 6, 1);
+    missing.set(1, 1, 1);
+    BOOST_CHECK(!flatStorage.isContaining(missing));
+    BOOST_CHECK(flatStorage.isInvalidSequenceNumber(flatStorage.getSequenceNumber(missing)));
+
+    flatStorage.recalcLeafProperty();
+
+    for (size_t seq = 0; seq < storage.getSize(); seq++) {
+      BOOST_CHECK_EQUAL(flatStorage.isLeaf(seq), storage.getPoint(seq).isLeaf());
+    }
+
+    HashGridStorage copy(2);
+    flatStorage.toHashGridStorage(copy);
+    BOOST_CHECK_EQUAL(copy.getSize(), storage.getSize());
+
+    for (size_t seq = 0; seq < storage.getSize(); seq++) {
+      BOOST_CHECK(copy.getPoint(seq).equals(storage.getPoint(seq)));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testUpdateAndDeleteLast) {
+  HashGridStorage storage(2);
+  HashGenerator generator;
+  generator.regular(storage, 6);
+  FlatGridStorage flatStorage(storage);
+  const size_t size = storage.getSize();
+
+  // replace every second point by a point of level 7, such that many entries of the
+  // hash index are removed and the probe sequences have to stay intact
+  std::vector<HashGridPoint> replacements;
+
+  for (size_t seq = 0; seq < size; seq += 2) {
+    HashGridPoint point(2);
+    point.set(0, 7, static_cast<HashGridPoint::index_type>(2 * seq + 1));
+    point.set(1, 1, 1);
+    flatStorage.update(point, seq);
+    replacements.push_back(point);
+  }
+
+  BOOST_CHECK_EQUAL(flatStorage.getSize(), size);
+
+  for (size_t seq = 0; seq < size; seq++) {
+    if (seq % 2 == 0) {
+      BOOST_CHECK(!flatStorage.isContaining(storage.getPoint(seq)));
+      BOOST_CHECK_EQUAL(flatStorage.getSequenceNumber(replacements[seq / 2]), seq);
+    } else {
+      BOOST_CHECK_EQUAL(flatStorage.getSequenceNumber(storage.getPoint(seq)), seq);
+    }
+  }
+
+  const size_t last = size - 1;
+  HashGridPoint lastPoint = flatStorage.getPoint(last);
+  flatStorage.deleteLast();
+  BOOST_CHECK_EQUAL(flatStorage.getSize(), last);
+  BOOST_CHECK(!flatStorage.isContaining(lastPoint));
+  BOOST_CHECK_EQUAL(flatStorage.insert(lastPoint), last);
+}
+
+BOOST_AUTO_TEST_CASE(testDuplicateInsert) {
+  HashGridStorage storage(2);
+  HashGridStorage reference(2);
+  HashGenerator generator;
+  generator.regular(storage, 3);
+  generator.regular(reference, 3);
+  storage.enableFlatStorage();
+
+  // inserting a contained grid point must neither change the storage nor the backend
+  HashGridPoint duplicate(storage.getPoint(2));
+  HashGridPoint point(2);
+  point.set(0, 5, 3);
+  point.set(1, 1, 1);
+
+  for (HashGridStorage* s : {&storage, &reference}) {
+    BOOST_CHECK_EQUAL(s->insert(duplicate), 2U);
+    const size_t seq = s->insert(point);
+    BOOST_CHECK_EQUAL(seq, s->getSize() - 1);
+  }
+
+  BOOST_CHECK_EQUAL(storage.getSize(), reference.getSize());
+  checkFlatBackend(storage);
+
+  for (size_t seq = 0; seq < storage.getSize(); seq++) {
+    BOOST_CHECK(storage.getPoint(seq).equals(reference.getPoint(seq)));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testBackendOfHashGridStorage) {
+  const std::vector<FlatGridStorage::Layout> layouts = {FlatGridStorage::Layout::PointMajor,
+                                                        FlatGridStorage::Layout::DimensionMajor};
+
+  for (FlatGridStorage::Layout layout : layouts) {
+    for (bool boundary : {false, true}) {
+      std::unique_ptr<Grid> grid(boundary ? Grid::createLinearBoundaryGrid(3)
+                                          : Grid::createLinearGrid(3));
+      std::unique_ptr<Grid> reference(boundary ? Grid::createLinearBoundaryGrid(3)
+                                               : Grid::createLinearGrid(3));
+      HashGridStorage& storage = grid->getStorage();
+      HashGridStorage& referenceStorage = reference->getStorage();
+
+      // the backend is enabled before the generation, so it has to follow all modifications
+      storage.enableFlatStorage(layout);
+      BOOST_CHECK(storage.getFlatStorage()->getLayout() == layout);
+      grid->getGenerator().regular(3);
+      reference->getGenerator().regular(3);
+      checkFlatBackend(storage);
+
+      DataVector alpha, naiveResult, result;
+      DataVector referenceAlpha, referenceNaiveResult, referenceResult;
+      hierarchiseAndEvaluate(*grid, alpha, naiveResult, result);
+      hierarchiseAndEvaluate(*reference, referenceAlpha, referenceNaiveResult, referenceResult);
+
+      // refinement and hierarchisation run on the HashGridIterator, which uses the backend
+      SurplusRefinementFunctor functor(alpha, 5);
+      SurplusRefinementFunctor referenceFunctor(referenceAlpha, 5);
+      grid->getGenerator().refine(functor);
+      reference->getGenerator().refine(referenceFunctor);
+      BOOST_CHECK_EQUAL(storage.getSize(), referenceStorage.getSize());
+      checkFlatBackend(storage);
+
+      hierarchiseAndEvaluate(*grid, alpha, naiveResult, result);
+      hierarchiseAndEvaluate(*reference, referenceAlpha, referenceNaiveResult, referenceResult);
+
+      for (size_t seq = 0; seq < storage.getSize(); seq++) {
+        BOOST_CHECK(storage.getPoint(seq).equals(referenceStorage.getPoint(seq)));
+        BOOST_CHECK_CLOSE(alpha[seq], referenceAlpha[seq], 1e-12);
+      }
+
+      // level and index arrays of the streaming kernels
+      DataMatrix level(storage.getSize(), 3), index(storage.getSize(), 3);
+      DataMatrix referenceLevel(storage.getSize(), 3), referenceIndex(storage.getSize(), 3);
+      storage.getLevelIndexArraysForEval(level, index);
+      referenceStorage.getLevelIndexArraysForEval(referenceLevel, referenceIndex);
+
+      for (size_t k = 0; k < level.getSize(); k++) {
+        BOOST_CHECK_EQUAL(level[k], referenceLevel[k]);
+        BOOST_CHECK_EQUAL(index[k], referenceIndex[k]);
+      }
+
+      for (size_t i = 0; i < result.getSize(); i++) {
+        BOOST_CHECK_CLOSE(naiveResult[i], referenceNaiveResult[i], 1e-12);
+        BOOST_CHECK_CLOSE(naiveResult[i], result[i], 1e-10);
+        BOOST_CHECK_CLOSE(result[i], referenceResult[i], 1e-12);
+      }
+
+      HashGridIterator iterator(storage);
+      HashGridIterator referenceIterator(referenceStorage);
+      BOOST_CHECK_EQUAL(iterator.getGridDepth(0), referenceIterator.getGridDepth(0));
+
+      // removing points changes the sequence numbers
+      const size_t sizeBeforeCoarsening = storage.getSize();
+      HashCoarsening coarsening;
+      SurplusCoarseningFunctor coarseningFunctor(alpha, 10, 1.0);
+      coarsening.free_coarsen(storage, coarseningFunctor, alpha);
+      BOOST_CHECK_LT(storage.getSize(), sizeBeforeCoarsening);
+      checkFlatBackend(storage);
+
+      HashGridStorage copy(storage);
+      checkFlatBackend(copy);
+
+      storage.disableFlatStorage();
+      BOOST_CHECK(storage.getFlatStorage() == nullptr);
+      BOOST_CHECK_EQUAL(storage.getSequenceNumber(copy.getPoint(1)), 1U);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
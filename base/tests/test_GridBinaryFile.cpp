@@ -0,0 +1,194 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/GridBinaryFile.hpp>
+#include <sgpp/base/grid/common/BoundingBox.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
+#include <sgpp/base/grid/storage/flat/FlatGridStorage.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+
+using sgpp::base::BoundingBox;
+using sgpp::base::BoundingBox1D;
+using sgpp::base::DataVector;
+using sgpp::base::FlatGridStorage;
+using sgpp::base::Grid;
+using sgpp::base::GridBinaryFile;
+using sgpp::base::GridStorage;
+
+namespace {
+
+void checkEqualGrids(Grid& grid, Grid& other) {
+  GridStorage& storage = grid.getStorage();
+  GridStorage& otherStorage = other.getStorage();
+
+  BOOST_CHECK(grid.getType() == other.getType());
+  BOOST_CHECK_EQUAL(grid.serialize(), other.serialize());
+  BOOST_REQUIRE_EQUAL(storage.getSize(), otherStorage.getSize());
+
+  for (size_t seq = 0; seq < storage.getSize(); seq++) {
+    BOOST_CHECK(storage[seq].equals(otherStorage[seq]));
+    BOOST_CHECK_EQUAL(storage[seq].isLeaf(), otherStorage[seq].isLeaf());
+    BOOST_CHECK_EQUAL(otherStorage.getSequenceNumber(storage[seq]), seq);
+  }
+
+  for (size_t d = 0; d < storage.getDimension(); d++) {
+    BOOST_CHECK_EQUAL(storage.getBoundingBox()->getBoundary(d).leftBoundary,
+                      otherStorage.getBoundingBox()->getBoundary(d).leftBoundary);
+    BOOST_CHECK_EQUAL(storage.getBoundingBox()->getBoundary(d).rightBoundary,
+                      otherStorage.getBoundingBox()->getBoundary(d).rightBoundary);
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestGridBinaryFile)
+
+BOOST_AUTO_TEST_CASE(testWriteAndRead) {
+  const std::string filename = "test_GridBinaryFile.sgb";
+  std::unique_ptr<Grid> grids[] = {
+      std::unique_ptr<Grid>(Grid::createLinearGrid(3)),
+      std::unique_ptr<Grid>(Grid::createLinearBoundaryGrid(3, 2)),
+      std::unique_ptr<Grid>(Grid::createModBsplineGrid(3, 5)),
+      std::unique_ptr<Grid>(Grid::createPolyGrid(3, 3))};
+
+  for (auto& grid : grids) {
+    grid->getGenerator().regular(4);
+
+    // refine to get a grid with a non-trivial ordering and leaf property
+    DataVector alpha(grid->getSize());
+
+    for (size_t i = 0; i < alpha.getSize(); i++) {
+      alpha[i] = static_cast<double>(i % 11) / 3.0;
+    }
+
+    sgpp::base::SurplusRefinementFunctor functor(alpha, 5);
+    grid->getGenerator().refine(functor);
+    alpha.resize(grid->getSize());
+
+    for (size_t i = 0; i < alpha.getSize(); i++) {
+      alpha[i] = 1.0 / static_cast<double>(i + 3);
+    }
+
+    // bounding box that isn't exactly representable with the default text precision
+    BoundingBox boundingBox(3);
+
+    for (size_t d = 0; d < 3; d++) {
+      BoundingBox1D boundary(-1.0 / 3.0, 2.0 / 7.0 + static_cast<double>(d), false, false);
+      boundingBox.setBoundary(d, boundary);
+    }
+
+    grid->setBoundingBox(boundingBox);
+
+    GridBinaryFile::write(filename, *grid, alpha);
+
+    {
+      GridBinaryFile file(filename);
+      BOOST_CHECK_EQUAL(file.getVersion(), BINARY_SERIALIZATION_VERSION);
+      BOOST_CHECK_EQUAL(file.getDimension(), 3);
+      BOOST_CHECK_EQUAL(file.getSize(), grid->getSize());
+      BOOST_REQUIRE(file.hasAlpha());
+
+      std::unique_ptr<Grid> loadedGrid(file.createGrid());
+      checkEqualGrids(*grid, *loadedGrid);
+
+      DataVector loadedAlpha;
+      file.getAlpha(loadedAlpha);
+      BOOST_REQUIRE_EQUAL(loadedAlpha.getSize(), alpha.getSize());
+
+      for (size_t i = 0; i < alpha.getSize(); i++) {
+        BOOST_CHECK_EQUAL(loadedAlpha[i], alpha[i]);
+        BOOST_CHECK_EQUAL(file.getAlphaData()[i], alpha[i]);
+      }
+
+      FlatGridStorage flatStorage(3);
+      file.toFlatGridStorage(flatStorage);
+      BOOST_REQUIRE_EQUAL(flatStorage.getSize(), grid->getSize());
+
+      for (size_t seq = 0; seq < flatStorage.getSize(); seq++) {
+        BOOST_CHECK(flatStorage.getPoint(seq).equals(grid->getStorage()[seq]));
+        BOOST_CHECK_EQUAL(flatStorage.isLeaf(seq), grid->getStorage()[seq].isLeaf());
+      }
+    }
+
+    // without coefficients
+    GridBinaryFile::write(filename, *grid);
+    GridBinaryFile file(filename);
+    BOOST_CHECK(!file.hasAlpha());
+    BOOST_CHECK(file.getAlphaData() == nullptr);
+    std::unique_ptr<Grid> loadedGrid(file.createGrid());
+    checkEqualGrids(*grid, *loadedGrid);
+  }
+
+  std::remove(filename.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(testOverwriteOpenFile) {
+  const std::string filename = "test_GridBinaryFile_overwrite.sgb";
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(2));
+  grid->getGenerator().regular(5);
+  GridBinaryFile::write(filename, *grid);
+  GridBinaryFile file(filename);
+
+  // overwriting the file must not change the already opened (mapped) file
+  std::unique_ptr<Grid> otherGrid(Grid::createLinearGrid(2));
+  otherGrid->getGenerator().regular(2);
+  GridBinaryFile::write(filename, *otherGrid);
+
+  BOOST_CHECK_EQUAL(file.getSize(), grid->getSize());
+  std::unique_ptr<Grid> loadedGrid(file.createGrid());
+  checkEqualGrids(*grid, *loadedGrid);
+
+  GridBinaryFile otherFile(filename);
+  std::unique_ptr<Grid> loadedOtherGrid(otherFile.createGrid());
+  checkEqualGrids(*otherGrid, *loadedOtherGrid);
+
+  std::remove(filename.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(testInvalidFiles) {
+  const std::string filename = "test_GridBinaryFile_invalid.sgb";
+  BOOST_CHECK_THROW(GridBinaryFile("does_not_exist.sgb"), sgpp::base::file_exception);
+
+  // text serialization instead of the binary format
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(2));
+  grid->getGenerator().regular(3);
+
+  {
+    std::ofstream file(filename);
+    file << grid->serialize();
+  }
+
+  BOOST_CHECK_THROW(GridBinaryFile file(filename), sgpp::base::file_exception);
+
+  // truncated file
+  GridBinaryFile::write(filename, *grid);
+  std::string contents;
+
+  {
+    std::ifstream file(filename, std::ios::binary);
+    contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  }
+
+  {
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    file.write(contents.data(), static_cast<std::streamsize>(contents.size() - 8));
+  }
+
+  BOOST_CHECK_THROW(GridBinaryFile file(filename), sgpp::base::file_exception);
+  std::remove(filename.c_str());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -295,6 +295,50 @@ BOOST_AUTO_TEST_CASE(TestOperationEvalNaive) {
         checkClose(fxGradient, fxGradient2);
         checkClose(fxHessian, fxHessian2);
       }
+
+      // test batch evaluation (multiple points)
+      if (hasGradients) {
+        DataMatrix points(N, d);
+
+        for (size_t r = 0; r < N; r++) {
+          for (size_t t = 0; t < d; t++) {
+            points(r, t) = boundingBox.getIntervalOffset(t) +
+                           boundingBox.getIntervalWidth(t) * uniformDistribution(generator);
+          }
+        }
+
+        DataVector fxBatch(0);
+        DataMatrix fxGradientBatch(0, 0);
+        std::vector<DataMatrix> fxHessianBatch;
+        opEvalGradient->evalGradient(alpha, points, fxBatch, fxGradientBatch);
+        BOOST_CHECK_EQUAL(fxBatch.getSize(), N);
+        BOOST_CHECK_EQUAL(fxGradientBatch.getNrows(), N);
+
+        for (size_t r = 0; r < N; r++) {
+          points.getRow(r, y);
+          DataVector fxGradient2(d);
+          DataVector fxGradientRow(d);
+          fx = opEvalGradient->evalGradient(alpha, y, fxGradient2);
+          fxGradientBatch.getRow(r, fxGradientRow);
+          checkClose(fx, fxBatch[r]);
+          checkClose(fxGradient2, fxGradientRow);
+        }
+
+        opEvalHessian->evalHessian(alpha, points, fxBatch, fxGradientBatch, fxHessianBatch);
+        BOOST_CHECK_EQUAL(fxHessianBatch.size(), N);
+
+        for (size_t r = 0; r < N; r++) {
+          points.getRow(r, y);
+          DataVector fxGradient2(d);
+          DataVector fxGradientRow(d);
+          DataMatrix fxHessian2(d, d);
+          fx = opEvalHessian->evalHessian(alpha, y, fxGradient2, fxHessian2);
+          fxGradientBatch.getRow(r, fxGradientRow);
+          checkClose(fx, fxBatch[r]);
+          checkClose(fxGradient2, fxGradientRow);
+          checkClose(fxHessian2, fxHessianBatch[r]);
+        }
+      }
     }
 
     // test matrix version (multiple coefficient vectors)
@@ -11,6 +11,10 @@
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include <vector>
 
 using sgpp::base::DataVector;
@@ -307,4 +311,55 @@ BOOST_AUTO_TEST_CASE(testHierarchisationStretchedTruncatedBoundary3D) {
   testHierarchisationDehierarchisation(*grid, level, &parabolaBoundary, 1e-12, false);
 }
 
+BOOST_AUTO_TEST_CASE(testHierarchisationThreadIndependence) {
+  // the poles of each dimension are processed in parallel, which must not change the result
+  const size_t dim = 3;
+  const size_t level = 6;
+  std::vector<std::unique_ptr<Grid>> grids;
+  grids.emplace_back(Grid::createLinearGrid(dim));
+  grids.emplace_back(Grid::createLinearBoundaryGrid(dim));
+  grids.emplace_back(Grid::createModLinearGrid(dim));
+  grids.emplace_back(Grid::createPolyGrid(dim, 3));
+  grids.emplace_back(Grid::createPolyBoundaryGrid(dim, 3));
+
+  for (std::unique_ptr<Grid>& grid : grids) {
+    grid->getGenerator().regular(level);
+    GridStorage& gridStore = grid->getStorage();
+    DataVector node_values(gridStore.getSize());
+    DataVector coords(dim);
+
+    for (size_t n = 0; n < gridStore.getSize(); n++) {
+      gridStore.getCoordinates(gridStore[n], coords);
+      node_values[n] = parabolaBoundary(coords);
+    }
+
+    std::unique_ptr<OperationHierarchisation> hierarchisation(
+        sgpp::op_factory::createOperationHierarchisation(*grid));
+    DataVector alphaSerial(node_values);
+    DataVector alphaParallel(node_values);
+    DataVector valuesSerial(node_values);
+    DataVector valuesParallel(node_values);
+
+#ifdef _OPENMP
+    int numThreads = omp_get_max_threads();
+    omp_set_num_threads(1);
+#endif
+    hierarchisation->doHierarchisation(alphaSerial);
+    hierarchisation->doDehierarchisation(valuesSerial);
+#ifdef _OPENMP
+    omp_set_num_threads(4);
+#endif
+    hierarchisation->doHierarchisation(alphaParallel);
+    hierarchisation->doDehierarchisation(valuesParallel);
+#ifdef _OPENMP
+    omp_set_num_threads(numThreads);
+#endif
+
+    for (size_t n = 0; n < gridStore.getSize(); n++) {
+      BOOST_CHECK_EQUAL(alphaSerial[n], alphaParallel[n]);
+      BOOST_CHECK_EQUAL(valuesSerial[n], valuesParallel[n]);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -10,13 +10,17 @@
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 // #include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 
+#include <vector>
+
 using sgpp::base::BoundingBox1D;
 using sgpp::base::DataMatrix;
 using sgpp::base::DataVector;
 using sgpp::base::Grid;
 using sgpp::base::GridStorage;
+using sgpp::base::OperationEval;
 using sgpp::base::OperationMultipleEval;
 
 BOOST_AUTO_TEST_SUITE(TestOperationMultipleEval)
@@ -78,4 +82,146 @@ BOOST_AUTO_TEST_CASE(testOperationMultipleEval) {
   BOOST_CHECK_CLOSE(result[2], result_ref[2], 1e-7);
 }
 
+BOOST_AUTO_TEST_CASE(testOperationMultipleEvalTranspose) {
+  const size_t dim = 3;
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(4);
+
+  const size_t N = grid->getSize();
+  const size_t numberDataPoints = 500;
+
+  DataMatrix dataset(numberDataPoints, dim);
+  DataVector alpha(N);
+  DataVector y(numberDataPoints);
+
+  for (size_t i = 0; i < numberDataPoints; i++) {
+    for (size_t t = 0; t < dim; t++) {
+      dataset.set(i, t, static_cast<double>((i * (t + 3) * 37) % 101) / 101.0);
+    }
+
+    y[i] = static_cast<double>(i % 7) - 3.0;
+  }
+
+  for (size_t j = 0; j < N; j++) {
+    alpha[j] = static_cast<double>(j % 5) + 1.0;
+  }
+
+  std::unique_ptr<OperationMultipleEval> opEval(
+      sgpp::op_factory::createOperationMultipleEval(*grid, dataset));
+
+  DataVector Balpha(numberDataPoints);
+  DataVector BTy(N);
+  opEval->mult(alpha, Balpha);
+  opEval->multTranspose(y, BTy);
+
+  // <B alpha, y> = <alpha, B^T y>
+  BOOST_CHECK_CLOSE(Balpha.dotProduct(y), alpha.dotProduct(BTy), 1e-10);
+
+  // repeated calls have to give identical results (deterministic reduction)
+  DataVector BTy2(N);
+  opEval->multTranspose(y, BTy2);
+
+  for (size_t j = 0; j < N; j++) {
+    BOOST_CHECK_EQUAL(BTy[j], BTy2[j]);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testOperationMultipleEvalBatched) {
+  const size_t dim = 3;
+  const size_t numberDataPoints = 100;
+  std::vector<std::unique_ptr<Grid>> grids;
+  grids.emplace_back(Grid::createBsplineGrid(dim, 3));
+  grids.emplace_back(Grid::createBsplineBoundaryGrid(dim, 3));
+  grids.emplace_back(Grid::createModBsplineGrid(dim, 3));
+  grids.emplace_back(Grid::createFundamentalSplineGrid(dim, 3));
+  grids.emplace_back(Grid::createPolyGrid(dim, 3));
+  grids.emplace_back(Grid::createModPolyGrid(dim, 2));
+  grids.emplace_back(Grid::createWaveletGrid(dim));
+  grids.emplace_back(Grid::createModWaveletGrid(dim));
+
+  DataMatrix dataset(numberDataPoints, dim);
+  DataVector y(numberDataPoints);
+
+  for (size_t i = 0; i < numberDataPoints; i++) {
+    for (size_t t = 0; t < dim; t++) {
+      dataset.set(i, t, static_cast<double>((i * (t + 3) * 37) % 101) / 101.0);
+    }
+
+    y[i] = static_cast<double>(i % 7) - 3.0;
+  }
+
+  for (std::unique_ptr<Grid>& grid : grids) {
+    grid->getGenerator().regular(3);
+    const size_t N = grid->getSize();
+    DataVector alpha(N);
+
+    for (size_t j = 0; j < N; j++) {
+      alpha[j] = static_cast<double>(j % 5) - 2.0;
+    }
+
+    std::unique_ptr<OperationMultipleEval> opBatched(
+        sgpp::op_factory::createOperationMultipleEvalBatched(*grid, dataset));
+    std::unique_ptr<OperationEval> opEval(sgpp::op_factory::createOperationEvalNaive(*grid));
+
+    DataVector Balpha(numberDataPoints);
+    DataVector BTy(N);
+    opBatched->mult(alpha, Balpha);
+    opBatched->multTranspose(y, BTy);
+
+    DataVector point(dim);
+
+    for (size_t i = 0; i < numberDataPoints; i++) {
+      dataset.getRow(i, point);
+      BOOST_CHECK_SMALL(Balpha[i] - opEval->eval(alpha, point), 1e-10);
+    }
+
+    BOOST_CHECK_SMALL(Balpha.dotProduct(y) - alpha.dotProduct(BTy), 1e-8);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testOperationMultipleEvalBatchedAdaptive) {
+  // fine subspaces, in which only the grid points whose support contains the data
+  // point are looked up, on a non-trivial bounding box and an adaptively refined grid
+  const size_t dim = 2;
+  const size_t numberDataPoints = 50;
+  std::unique_ptr<Grid> grid(Grid::createBsplineGrid(dim, 3));
+  grid->getGenerator().regular(8);
+  grid->getBoundingBox().setBoundary(0, BoundingBox1D(3.0, 5.0));
+  grid->getBoundingBox().setBoundary(1, BoundingBox1D(-2.0, 2.0));
+
+  DataMatrix dataset(numberDataPoints, dim);
+
+  for (size_t i = 0; i < numberDataPoints; i++) {
+    dataset.set(i, 0, 3.0 + 2.0 * static_cast<double>((i * 37) % 101) / 101.0);
+    dataset.set(i, 1, -2.0 + 4.0 * static_cast<double>((i * 53) % 103) / 103.0);
+  }
+
+  std::unique_ptr<OperationMultipleEval> opBatched(
+      sgpp::op_factory::createOperationMultipleEvalBatched(*grid, dataset));
+  std::unique_ptr<OperationEval> opEval(sgpp::op_factory::createOperationEvalNaive(*grid));
+
+  for (size_t refinement = 0; refinement < 2; refinement++) {
+    const size_t N = grid->getSize();
+    DataVector alpha(N);
+
+    for (size_t j = 0; j < N; j++) {
+      alpha[j] = static_cast<double>(j % 5) - 2.0;
+    }
+
+    DataVector Balpha(numberDataPoints);
+    opBatched->mult(alpha, Balpha);
+
+    DataVector point(dim);
+
+    for (size_t i = 0; i < numberDataPoints; i++) {
+      dataset.getRow(i, point);
+      BOOST_CHECK_SMALL(Balpha[i] - opEval->eval(alpha, point), 1e-10);
+    }
+
+    // the operation has to notice the refinement
+    sgpp::base::SurplusRefinementFunctor functor(alpha, 5);
+    grid->getGenerator().refine(functor);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -124,6 +124,7 @@
 
 
 %include "combigrid/src/sgpp/combigrid/GeneralFunction.hpp"
+%ignore sgpp::combigrid::ThreadPool::parallelFor;
 %include "combigrid/src/sgpp/combigrid/threading/ThreadPool.hpp"
 
 namespace sgpp {
@@ -15,6 +15,7 @@
 #include <sgpp/combigrid/operation/CombigridMultiOperation.hpp>
 #include <sgpp/combigrid/operation/Configurations.hpp>
 #include <sgpp/combigrid/operation/multidim/AveragingLevelManager.hpp>
+#include <sgpp/combigrid/operation/multidim/CombigridBatchEvaluator.hpp>
 #include <sgpp/combigrid/operation/multidim/CombigridEvaluator.hpp>
 #include <sgpp/combigrid/operation/multidim/WeightedRatioLevelManager.hpp>
 #include <sgpp/combigrid/operation/multidim/fullgrid/AbstractFullGridEvaluationStrategy.hpp>
@@ -45,13 +46,18 @@ class CombigridMultiOperationImpl {
       std::shared_ptr<LevelManager> levelManager, std::shared_ptr<AbstractCombigridStorage> storage,
       FullGridSummationStrategyType summationStrategyType,
       std::shared_ptr<NormStrategy<FloatArrayVector>> normStrategy)
-      : storage(storage), pointHierarchies(pointHierarchies), levelManager(levelManager) {
+      : storage(storage),
+        pointHierarchies(pointHierarchies),
+        levelManager(levelManager),
+        summationStrategyType(summationStrategyType) {
     fullGridEval = std::make_shared<FullGridCallbackEvaluator<FloatArrayVector>>(
         storage, evaluatorPrototypes, pointHierarchies, summationStrategyType);
     combiEval = std::make_shared<CombigridEvaluator<FloatArrayVector>>(pointHierarchies.size(),
                                                                        fullGridEval, normStrategy);
 
     levelManager->setLevelEvaluator(combiEval);
+    batchEval = std::make_shared<CombigridBatchEvaluator<FloatArrayVector>>(
+        storage, evaluatorPrototypes, pointHierarchies);
   }
 
   CombigridMultiOperationImpl(
@@ -60,12 +66,17 @@ class CombigridMultiOperationImpl {
       std::shared_ptr<LevelManager> levelManager, std::shared_ptr<AbstractCombigridStorage> storage,
       GridFunction gridFunc, FullGridSummationStrategyType summationStrategyType,
       std::shared_ptr<NormStrategy<FloatArrayVector>> normStrategy)
-      : storage(storage), pointHierarchies(pointHierarchies), levelManager(levelManager) {
+      : storage(storage),
+        pointHierarchies(pointHierarchies),
+        levelManager(levelManager),
+        summationStrategyType(summationStrategyType) {
     fullGridEval = std::make_shared<FullGridGridBasedEvaluator<FloatArrayVector>>(
         storage, evaluatorPrototypes, pointHierarchies, gridFunc, summationStrategyType);
     combiEval = std::make_shared<CombigridEvaluator<FloatArrayVector>>(pointHierarchies.size(),
                                                                        fullGridEval, normStrategy);
     levelManager->setLevelEvaluator(combiEval);
+    batchEval = std::make_shared<CombigridBatchEvaluator<FloatArrayVector>>(
+        storage, evaluatorPrototypes, pointHierarchies);
   }
 
   std::shared_ptr<AbstractCombigridStorage> storage;
@@ -73,6 +84,8 @@ class CombigridMultiOperationImpl {
   std::shared_ptr<AbstractFullGridEvaluationStrategy<FloatArrayVector>> fullGridEval;
   std::shared_ptr<CombigridEvaluator<FloatArrayVector>> combiEval;
   std::shared_ptr<LevelManager> levelManager;
+  std::shared_ptr<CombigridBatchEvaluator<FloatArrayVector>> batchEval;
+  FullGridSummationStrategyType summationStrategyType;
 };
 
 CombigridMultiOperation::CombigridMultiOperation(
@@ -194,6 +207,16 @@ base::DataVector CombigridMultiOperation::evaluate(size_t q, base::DataMatrix co
   return getResult();
 }
 
+base::DataVector CombigridMultiOperation::evaluate(base::DataMatrix const &params) {
+  if (impl->summationStrategyType != FullGridSummationStrategyType::LINEAR) {
+    throw std::runtime_error(
+        "CombigridMultiOperation::evaluate(): batch evaluation needs the linear summation "
+        "strategy");
+  }
+
+  return impl->batchEval->eval(impl->combiEval->getLevelStructure(), params);
+}
+
 std::shared_ptr<AbstractMultiStorage<FloatArrayVector>> CombigridMultiOperation::getDifferences() {
   return impl->combiEval->differences();
 }
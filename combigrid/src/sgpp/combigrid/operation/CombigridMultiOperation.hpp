@@ -119,6 +119,14 @@ class CombigridMultiOperation {
    */
   base::DataVector evaluate(size_t q, base::DataMatrix const &params = base::DataMatrix(0, 0));
 
+  /**
+   * Evaluates the combination of the levels that have already been added at the columns of params.
+   * In contrast to setParameters() and getResult(), this does not clear the computed data and
+   * processes the points in cache-friendly blocks on several threads, which is much faster for
+   * many points. It is only available for the linear summation strategy.
+   */
+  base::DataVector evaluate(base::DataMatrix const &params);
+
   /**
    * @return the storage containing the computed coefficients.
    * For the basic operations these are the function values at evaluation points.
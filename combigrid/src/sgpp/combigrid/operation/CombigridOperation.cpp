@@ -10,6 +10,7 @@
 #include <sgpp/combigrid/grid/ordering/ExponentialLevelorderPointOrdering.hpp>
 #include <sgpp/combigrid/operation/CombigridOperation.hpp>
 #include <sgpp/combigrid/operation/multidim/AveragingLevelManager.hpp>
+#include <sgpp/combigrid/operation/multidim/CombigridBatchEvaluator.hpp>
 #include <sgpp/combigrid/operation/multidim/CombigridEvaluator.hpp>
 #include <sgpp/combigrid/operation/multidim/WeightedRatioLevelManager.hpp>
 #include <sgpp/combigrid/operation/multidim/fullgrid/AbstractFullGridEvaluationStrategy.hpp>
@@ -42,12 +43,17 @@ class CombigridOperationImpl {
       std::shared_ptr<LevelManager> levelManager, std::shared_ptr<AbstractCombigridStorage> storage,
       FullGridSummationStrategyType summationStrategyType,
       std::shared_ptr<NormStrategy<FloatScalarVector>> normStrategy)
-      : storage(storage), pointHierarchies(pointHierarchies), levelManager(levelManager) {
+      : storage(storage),
+        pointHierarchies(pointHierarchies),
+        levelManager(levelManager),
+        summationStrategyType(summationStrategyType) {
     fullGridEval = std::make_shared<FullGridCallbackEvaluator<FloatScalarVector>>(
         storage, evaluatorPrototypes, pointHierarchies, summationStrategyType);
     combiEval = std::make_shared<CombigridEvaluator<FloatScalarVector>>(pointHierarchies.size(),
                                                                         fullGridEval, normStrategy);
     levelManager->setLevelEvaluator(combiEval);
+    batchEval = std::make_shared<CombigridBatchEvaluator<FloatScalarVector>>(
+        storage, evaluatorPrototypes, pointHierarchies);
   }
 
   CombigridOperationImpl(
@@ -56,12 +62,17 @@ class CombigridOperationImpl {
       std::shared_ptr<LevelManager> levelManager, std::shared_ptr<AbstractCombigridStorage> storage,
       GridFunction gridFunc, FullGridSummationStrategyType summationStrategyType,
       std::shared_ptr<NormStrategy<FloatScalarVector>> normStrategy)
-      : storage(storage), pointHierarchies(pointHierarchies), levelManager(levelManager) {
+      : storage(storage),
+        pointHierarchies(pointHierarchies),
+        levelManager(levelManager),
+        summationStrategyType(summationStrategyType) {
     fullGridEval = std::make_shared<FullGridGridBasedEvaluator<FloatScalarVector>>(
         storage, evaluatorPrototypes, pointHierarchies, gridFunc, summationStrategyType);
     combiEval = std::make_shared<CombigridEvaluator<FloatScalarVector>>(pointHierarchies.size(),
                                                                         fullGridEval, normStrategy);
     levelManager->setLevelEvaluator(combiEval);
+    batchEval = std::make_shared<CombigridBatchEvaluator<FloatScalarVector>>(
+        storage, evaluatorPrototypes, pointHierarchies);
   }
 
   std::shared_ptr<AbstractCombigridStorage> storage;
@@ -69,6 +80,8 @@ class CombigridOperationImpl {
   std::shared_ptr<AbstractFullGridEvaluator<FloatScalarVector>> fullGridEval;
   std::shared_ptr<CombigridEvaluator<FloatScalarVector>> combiEval;
   std::shared_ptr<LevelManager> levelManager;
+  std::shared_ptr<CombigridBatchEvaluator<FloatScalarVector>> batchEval;
+  FullGridSummationStrategyType summationStrategyType;
 };
 
 CombigridOperation::CombigridOperation(
@@ -125,6 +138,15 @@ double CombigridOperation::evaluate(size_t q, base::DataVector const& param) {
   return getResult();
 }
 
+base::DataVector CombigridOperation::evaluate(base::DataMatrix const& params) {
+  if (impl->summationStrategyType != FullGridSummationStrategyType::LINEAR) {
+    throw std::runtime_error(
+        "CombigridOperation::evaluate(): batch evaluation needs the linear summation strategy");
+  }
+
+  return impl->batchEval->eval(impl->combiEval->getLevelStructure(), params);
+}
+
 std::shared_ptr<AbstractCombigridStorage> CombigridOperation::getStorage() { return impl->storage; }
 
 void CombigridOperation::setStorage(std::shared_ptr<AbstractCombigridStorage> storage) {
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/combigrid/GeneralFunction.hpp>
 #include <sgpp/combigrid/algebraic/FloatScalarVector.hpp>
@@ -86,6 +87,17 @@ class CombigridOperation {
   double getResult();
 
   double evaluate(size_t q, base::DataVector const &param = base::DataVector(0));
+
+  /**
+   * Evaluates the combination of the levels that have already been added at many points at once.
+   * This does not change the level structure and is much faster than calling setParameters() and
+   * getResult() for each point. It is only available for the linear summation strategy.
+   * @param params The evaluation points are the columns of the matrix. The rows only contain the
+   * dimensions whose evaluator needs a parameter (see setParameters()).
+   * @return the values at the evaluation points
+   */
+  base::DataVector evaluate(base::DataMatrix const &params);
+
   std::shared_ptr<LevelManager> getLevelManager();
   void setLevelManager(std::shared_ptr<LevelManager> levelManager);
 
@@ -0,0 +1,368 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef COMBIGRID_SRC_SGPP_COMBIGRID_OPERATION_MULTIDIM_COMBIGRIDBATCHEVALUATOR_HPP_
+#define COMBIGRID_SRC_SGPP_COMBIGRID_OPERATION_MULTIDIM_COMBIGRIDBATCHEVALUATOR_HPP_
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/combigrid/algebraic/FloatArrayVector.hpp>
+#include <sgpp/combigrid/algebraic/FloatScalarVector.hpp>
+#include <sgpp/combigrid/common/MultiIndexIterator.hpp>
+#include <sgpp/combigrid/definitions.hpp>
+#include <sgpp/combigrid/grid/hierarchy/AbstractPointHierarchy.hpp>
+#include <sgpp/combigrid/operation/onedim/AbstractLinearEvaluator.hpp>
+#include <sgpp/combigrid/storage/AbstractCombigridStorage.hpp>
+#include <sgpp/combigrid/storage/tree/TreeStorage.hpp>
+#include <sgpp/combigrid/threading/ThreadPool.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace sgpp {
+namespace combigrid {
+
+/**
+ * Evaluates the linear combination of full grid interpolants of the levels that have been added to
+ * a CombigridEvaluator at many points at once.
+ *
+ * In contrast to the evaluation via FloatArrayVector, where each grid point of each level costs
+ * several temporary vectors, the points are processed in blocks. For each block, the 1D basis
+ * values are computed only once per dimension and 1D level and are stored contiguously with the
+ * points as the fastest index. The tensor products are then contracted with plain loops over the
+ * points of the block, which the compiler can vectorize. The blocks are distributed over several
+ * threads.
+ *
+ * Only the linear summation strategy (interpolation and quadrature) is supported. The function
+ * values of the levels are taken from the storage, so they should have been computed before (e.g.
+ * by adding the levels via a LevelManager).
+ *
+ * The template parameter V is the vector type of the evaluators (FloatScalarVector or
+ * FloatArrayVector).
+ */
+template <typename V>
+class CombigridBatchEvaluator {
+  std::shared_ptr<AbstractCombigridStorage> storage;
+  std::vector<std::shared_ptr<AbstractLinearEvaluator<V>>> evaluatorPrototypes;
+  std::vector<std::shared_ptr<AbstractPointHierarchy>> pointHierarchies;
+
+  /**
+   * Number of points that are processed together. The partial products for a block of points
+   * should fit into the L1 cache.
+   */
+  static const size_t BLOCK_SIZE = 128;
+
+  /**
+   * A level with a nonzero combination coefficient and its function values, ordered such that the
+   * index of the last dimension changes fastest.
+   */
+  struct CombinationTerm {
+    MultiIndex level;
+    double coefficient;
+    std::vector<double> values;
+  };
+
+  /**
+   * Sets the count parameters (if params is not nullptr) and writes the basis values to weights,
+   * such that weights[j * BLOCK_SIZE + i] is the basis value of grid point j at the i-th point.
+   */
+  static void computeBasisValues(AbstractLinearEvaluator<FloatScalarVector> &evaluator,
+                                 double const *params, size_t count, double *weights) {
+    for (size_t i = 0; i < count; ++i) {
+      if (params != nullptr) {
+        evaluator.setParameter(FloatScalarVector(params[i]));
+      }
+
+      std::vector<FloatScalarVector> basisValues = evaluator.getBasisValues();
+
+      for (size_t j = 0; j < basisValues.size(); ++j) {
+        weights[j * BLOCK_SIZE + i] = basisValues[j].value();
+      }
+    }
+  }
+
+  static void computeBasisValues(AbstractLinearEvaluator<FloatArrayVector> &evaluator,
+                                 double const *params, size_t count, double *weights) {
+    if (params != nullptr) {
+      FloatArrayVector param;
+
+      for (size_t i = 0; i < count; ++i) {
+        param.at(i) = FloatScalarVector(params[i]);
+      }
+
+      evaluator.setParameter(param);
+    }
+
+    std::vector<FloatArrayVector> basisValues = evaluator.getBasisValues();
+
+    for (size_t j = 0; j < basisValues.size(); ++j) {
+      // without parameters, the vectors only contain a single value, which at() replicates
+      for (size_t i = 0; i < count; ++i) {
+        weights[j * BLOCK_SIZE + i] = basisValues[j].at(i).value();
+      }
+    }
+  }
+
+  /**
+   * Adds coefficient * (interpolant of the term) at the count points of a block to result.
+   * weights[d][l] contains the basis values of dimension d and 1D level l for the block.
+   */
+  static void contract(CombinationTerm const &term,
+                       std::vector<std::vector<std::vector<double>>> const &weights, size_t count,
+                       std::vector<std::vector<double>> &partialProducts, double *result) {
+    const size_t numDimensions = term.level.size();
+    const size_t lastDim = numDimensions - 1;
+    std::vector<size_t> numPoints(numDimensions);
+    std::vector<double const *> levelWeights(numDimensions);
+
+    for (size_t d = 0; d < numDimensions; ++d) {
+      levelWeights[d] = weights[d][term.level[d]].data();
+      numPoints[d] = weights[d][term.level[d]].size() / BLOCK_SIZE;
+    }
+
+    // partialProducts[d] contains the product of the basis values of the first d dimensions
+    // (scaled with the combination coefficient) at the current multi-index
+    MultiIndex index(numDimensions, 0);
+    double *pp0 = partialProducts[0].data();
+
+    for (size_t i = 0; i < count; ++i) {
+      pp0[i] = term.coefficient;
+    }
+
+    size_t h = 0;
+    double const *values = term.values.data();
+    double *sum = partialProducts[numDimensions].data();
+
+    while (true) {
+      // update the partial products of the dimensions whose index has changed
+      for (size_t d = h; d < lastDim; ++d) {
+        double const *pp = partialProducts[d].data();
+        double const *w = levelWeights[d] + index[d] * BLOCK_SIZE;
+        double *next = partialProducts[d + 1].data();
+
+        for (size_t i = 0; i < count; ++i) {
+          next[i] = pp[i] * w[i];
+        }
+      }
+
+      // sum over the last dimension
+      std::fill(sum, sum + count, 0.0);
+
+      for (size_t j = 0; j < numPoints[lastDim]; ++j) {
+        const double value = values[j];
+        double const *w = levelWeights[lastDim] + j * BLOCK_SIZE;
+
+        for (size_t i = 0; i < count; ++i) {
+          sum[i] += value * w[i];
+        }
+      }
+
+      values += numPoints[lastDim];
+      double const *pp = partialProducts[lastDim].data();
+
+      for (size_t i = 0; i < count; ++i) {
+        result[i] += pp[i] * sum[i];
+      }
+
+      // move to the next multi-index of the first numDimensions - 1 dimensions
+      size_t d = lastDim;
+
+      while (d > 0) {
+        --d;
+
+        if (++index[d] < numPoints[d]) {
+          break;
+        }
+
+        index[d] = 0;
+      }
+
+      if ((d == 0) && (index[0] == 0)) {
+        // all multi-indices have been traversed
+        break;
+      }
+
+      h = d;
+    }
+  }
+
+ public:
+  /**
+   * Constructor.
+   *
+   * @param storage Storage that provides the function values for each grid point.
+   * @param evaluatorPrototypes prototype objects for the evaluators of each dimension.
+   * @param pointHierarchies PointHierarchy objects for each dimension providing the points for each
+   * level and information about their ordering.
+   */
+  CombigridBatchEvaluator(
+      std::shared_ptr<AbstractCombigridStorage> storage,
+      std::vector<std::shared_ptr<AbstractLinearEvaluator<V>>> evaluatorPrototypes,
+      std::vector<std::shared_ptr<AbstractPointHierarchy>> pointHierarchies)
+      : storage(storage),
+        evaluatorPrototypes(evaluatorPrototypes),
+        pointHierarchies(pointHierarchies) {}
+
+  /**
+   * Evaluates the combination of the given levels at several points.
+   *
+   * @param levelStructure contains the levels of the combination (has to be downward closed)
+   * @param params The columns of this matrix are the evaluation points. Like in setParameters(),
+   * the rows only contain the dimensions whose evaluator needs a parameter.
+   * @param numThreads number of threads, 0 for the number of hardware threads
+   * @return the combined values at the points
+   */
+  base::DataVector eval(std::shared_ptr<TreeStorage<uint8_t>> levelStructure,
+                        base::DataMatrix const &params, size_t numThreads = 0) {
+    const size_t numDimensions = pointHierarchies.size();
+    const size_t numEvalPoints = params.getNcols();
+    std::vector<bool> needsParam(numDimensions);
+    std::vector<size_t> paramRow(numDimensions);
+    std::vector<bool> orderingConfiguration(numDimensions);
+    size_t numParams = 0;
+
+    for (size_t d = 0; d < numDimensions; ++d) {
+      needsParam[d] = evaluatorPrototypes[d]->needsParameter();
+      orderingConfiguration[d] = evaluatorPrototypes[d]->needsOrderedPoints();
+      paramRow[d] = numParams;
+
+      if (needsParam[d]) {
+        ++numParams;
+      }
+    }
+
+    if (params.getNrows() < numParams) {
+      throw std::runtime_error(
+          "CombigridBatchEvaluator::eval(): parameter dimensionality is too low.");
+    }
+
+    // the combination coefficients are computed by iterating over {0, 1}^d
+    if (numDimensions >= static_cast<size_t>(std::numeric_limits<size_t>::digits)) {
+      throw std::runtime_error(
+          "CombigridBatchEvaluator::eval(): dimensionality is too high.");
+    }
+
+    // combination coefficients of the downward closed level set: c_l is the sum of (-1)^|z| over
+    // all z in {0, 1}^d for which l + z is contained in the set
+    std::vector<CombinationTerm> terms;
+    std::vector<size_t> maxLevels(numDimensions, 0);
+
+    for (auto it = levelStructure->getStoredDataIterator(); it->isValid(); it->moveToNext()) {
+      MultiIndex level = it->getMultiIndex();
+      double coefficient = 0.0;
+
+      for (size_t z = 0; z < (size_t{1} << numDimensions); ++z) {
+        MultiIndex neighbor = level;
+        double sign = 1.0;
+
+        for (size_t d = 0; d < numDimensions; ++d) {
+          if ((z >> d) & 1) {
+            ++neighbor[d];
+            sign = -sign;
+          }
+        }
+
+        if (levelStructure->containsIndex(neighbor)) {
+          coefficient += sign;
+        }
+      }
+
+      if (coefficient == 0.0) {
+        continue;
+      }
+
+      for (size_t d = 0; d < numDimensions; ++d) {
+        maxLevels[d] = std::max(maxLevels[d], level[d]);
+      }
+
+      terms.push_back(CombinationTerm{level, coefficient, std::vector<double>()});
+    }
+
+    // read the function values (this might evaluate the function if they are not stored yet)
+    for (auto &term : terms) {
+      MultiIndex multiBounds(numDimensions);
+
+      for (size_t d = 0; d < numDimensions; ++d) {
+        multiBounds[d] = pointHierarchies[d]->getNumPoints(term.level[d]);
+      }
+
+      MultiIndexIterator multiIt(multiBounds);
+      auto storageIt = storage->getGuidedIterator(term.level, multiIt, orderingConfiguration);
+
+      while (storageIt->isValid()) {
+        term.values.push_back(storageIt->value());
+        storageIt->moveToNext();
+      }
+    }
+
+    // prototypes for each dimension and 1D level, the grid points are set only once
+    std::vector<std::vector<std::shared_ptr<AbstractLinearEvaluator<V>>>> evaluators(
+        numDimensions);
+
+    for (size_t d = 0; d < numDimensions; ++d) {
+      for (size_t l = 0; l <= maxLevels[d]; ++l) {
+        auto evaluator = evaluatorPrototypes[d]->cloneLinear();
+        evaluator->setGridPoints(pointHierarchies[d]->getPoints(l, orderingConfiguration[d]));
+        evaluator->setLevel(l);
+        evaluators[d].push_back(evaluator);
+      }
+    }
+
+    base::DataVector result(numEvalPoints, 0.0);
+
+    if (terms.empty() || (numEvalPoints == 0)) {
+      return result;
+    }
+
+    if (numThreads == 0) {
+      numThreads = std::max<size_t>(1, std::thread::hardware_concurrency());
+    }
+
+    const size_t numBlocks = (numEvalPoints + BLOCK_SIZE - 1) / BLOCK_SIZE;
+
+    ThreadPool::parallelFor(numThreads, 0, numBlocks, [&](size_t block) {
+      const size_t begin = block * BLOCK_SIZE;
+      const size_t count = std::min(BLOCK_SIZE, numEvalPoints - begin);
+
+      // basis values of all 1D levels for this block
+      std::vector<std::vector<std::vector<double>>> weights(numDimensions);
+
+      for (size_t d = 0; d < numDimensions; ++d) {
+        for (size_t l = 0; l <= maxLevels[d]; ++l) {
+          // the evaluators store the parameter, so each block needs its own copy
+          auto evaluator = evaluators[d][l]->cloneLinear();
+          const size_t numPoints = pointHierarchies[d]->getNumPoints(l);
+          std::vector<double> levelWeights(numPoints * BLOCK_SIZE, 0.0);
+          // the matrix is stored row-major, so the parameters of a dimension are contiguous
+          double const *blockParams =
+              needsParam[d] ? params.getPointer() + paramRow[d] * numEvalPoints + begin : nullptr;
+          computeBasisValues(*evaluator, blockParams, count, levelWeights.data());
+          weights[d].push_back(std::move(levelWeights));
+        }
+      }
+
+      std::vector<std::vector<double>> partialProducts(numDimensions + 1,
+                                                       std::vector<double>(BLOCK_SIZE));
+
+      for (auto &term : terms) {
+        contract(term, weights, count, partialProducts, result.getPointer() + begin);
+      }
+    });
+
+    return result;
+  }
+};
+
+template <typename V>
+const size_t CombigridBatchEvaluator<V>::BLOCK_SIZE;
+
+} /* namespace combigrid */
+} /* namespace sgpp*/
+
+#endif /* COMBIGRID_SRC_SGPP_COMBIGRID_OPERATION_MULTIDIM_COMBIGRIDBATCHEVALUATOR_HPP_ */
@@ -155,6 +155,65 @@ class LevelInfo {
   }
 };
 
+/**
+ * Throughput counters of a parallel adaptive level generation (see
+ * LevelManager::addLevelsAdaptiveParallel()).
+ */
+class ParallelRefinementStats {
+ public:
+  ParallelRefinementStats()
+      : numLevelsStarted(0),
+        numLevelsCommitted(0),
+        numCommitBatches(0),
+        numTasks(0),
+        elapsedSeconds(0.0),
+        busySeconds(0.0) {}
+
+  /**
+   * Number of levels whose computation has been started.
+   */
+  size_t numLevelsStarted;
+
+  /**
+   * Number of levels that have been passed to the CombigridEvaluator.
+   */
+  size_t numLevelsCommitted;
+
+  /**
+   * Number of batches in which the levels have been passed to the CombigridEvaluator.
+   */
+  size_t numCommitBatches;
+
+  /**
+   * Number of tasks (batches of function evaluations) that have been executed.
+   */
+  size_t numTasks;
+
+  /**
+   * Wall-clock time of the refinement in seconds.
+   */
+  double elapsedSeconds;
+
+  /**
+   * Time spent in the tasks in seconds, summed over all threads.
+   */
+  double busySeconds;
+
+  /**
+   * @return the average number of threads that were busy with function evaluations
+   */
+  double getAverageParallelism() const {
+    return (elapsedSeconds > 0.0) ? busySeconds / elapsedSeconds : 0.0;
+  }
+
+  /**
+   * @return the number of committed levels per second
+   */
+  double getLevelsPerSecond() const {
+    return (elapsedSeconds > 0.0) ? static_cast<double>(numLevelsCommitted) / elapsedSeconds : 0.0;
+  }
+};
+
 /**
  * Storage for meta information on the levels during adaptive refinement
  */
@@ -6,10 +6,15 @@
 #include "LevelManager.hpp"
 
 #include <sgpp/combigrid/threading/PtrGuard.hpp>
+#include <sgpp/combigrid/utils/Stopwatch.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <iostream>
 #include <map>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -23,12 +28,14 @@ LevelManager::LevelManager(std::shared_ptr<AbstractLevelEvaluator> levelEvaluato
       combiEval(levelEvaluator),
       collectStats(collectStats) {
   managerMutex = std::make_shared<std::recursive_mutex>();
+  completedLevelsMutex = std::make_shared<std::mutex>();
   infoOnAddedLevels = std::make_shared<LevelInfos>();
   levelData = std::make_shared<TreeStorage<std::shared_ptr<LevelInfo>>>(numDimensions);
 }
 
 LevelManager::LevelManager() : queue(), numDimensions(0), combiEval(nullptr), collectStats(false) {
   managerMutex = std::make_shared<std::recursive_mutex>();
+  completedLevelsMutex = std::make_shared<std::mutex>();
   infoOnAddedLevels = std::make_shared<LevelInfos>();
   levelData = std::make_shared<TreeStorage<std::shared_ptr<LevelInfo>>>(numDimensions);
 }
@@ -399,65 +406,187 @@ void LevelManager::addLevelsAdaptive(size_t maxNumPoints) {
   }
 }
 
+size_t LevelManager::commitCompletedLevels() {
+  std::vector<MultiIndex> levels;
+
+  {
+    std::lock_guard<std::mutex> guard(*completedLevelsMutex);
+    levels.swap(completedLevels);
+  }
+
+  if (levels.empty()) {
+    return 0;
+  }
+
+  for (auto &level : levels) {
+    afterComputation(level);
+  }
+
+  return levels.size();
+}
+
 void LevelManager::addLevelsAdaptiveParallel(size_t maxNumPoints, size_t numThreads) {
+  Stopwatch stopwatch;
   initAdaption();
 
   size_t currentPointBound = 0;
   infoOnAddedLevels->incrementCounter();
 
-  combiEval->setMutex(managerMutex);
+  std::atomic<size_t> numLevelsStarted(0);
+  std::atomic<size_t> numLevelsCommitted(0);
+  std::atomic<size_t> numCommitBatches(0);
+  std::atomic<size_t> numTasks(0);
+  std::atomic<int64_t> busyNanoseconds(0);
 
-  auto threadPool = std::make_shared<ThreadPool>(
-      numThreads,
-      ThreadPool::IdleCallback([&currentPointBound, maxNumPoints, this](ThreadPool &tp) {
+  auto commit = [&]() {
+    size_t numCommitted = commitCompletedLevels();
+
+    if (numCommitted > 0) {
+      numLevelsCommitted += numCommitted;
+      ++numCommitBatches;
+    }
+  };
+
+  // Commits the buffered levels unless another thread is already committing. The loop ensures
+  // that levels buffered while this thread was committing are not left behind.
+  std::atomic<bool> committing(false);
+  ThreadPool::Task tryCommit([this, &commit, &committing]() {
+    while (!committing.exchange(true)) {
+      {
         CGLOG_SURROUND(PtrGuard guard(managerMutex));
-        if (queue.empty()) {
-          std::cout << "Error: queue is empty\n";
-          CGLOG("leave guard(*managerMutex)");
-          return;
-        }
+        commit();
+        CGLOG("leave guard(*managerMutex) in tryCommit");
+      }
+
+      committing = false;
+      std::lock_guard<std::mutex> guard(*completedLevelsMutex);
+
+      if (completedLevels.empty()) {
+        return;
+      }
+    }
+  });
 
-        // print current queue
-        //        queue.print();
+  combiEval->setMutex(managerMutex);
 
-        QueueEntry entry = queue.top();
+  // number of levels whose tasks have been added to the thread pool, but which have not been
+  // buffered for committing yet
+  std::atomic<size_t> numLevelsInFlight(0);
+  // whether a level did not fit into the point bound, such that no more levels are started (as
+  // in addLevelsAdaptive()), guarded by managerMutex
+  bool pointBoundReached = false;
 
-        currentPointBound += entry.maxNewPoints;
+  auto threadPool = std::make_shared<ThreadPool>(
+      numThreads, ThreadPool::IdleCallback([&](ThreadPool &tp) {
+        size_t numStarted = 0;
+        bool terminate = false;
+
+        {
+          CGLOG_SURROUND(PtrGuard guard(managerMutex));
+
+          // A level is buffered before it stops being in flight. Hence, if no levels are in
+          // flight now, the following commit adds the successors of all started levels to the
+          // queue.
+          const bool levelsInFlight = (numLevelsInFlight > 0);
+          commit();
+
+          // start several levels at once, so that the threads don't run out of work while the
+          // scheduling thread holds managerMutex
+          while (!pointBoundReached && (numStarted < std::max<size_t>(numThreads, 1)) &&
+                 !queue.empty()) {
+            QueueEntry entry = queue.top();
+
+            if (currentPointBound + entry.maxNewPoints > maxNumPoints) {
+              pointBoundReached = true;
+              break;
+            }
+
+            currentPointBound += entry.maxNewPoints;
+
+            /*
+             * After the pop() operation, the corresponding handle in the LevelInfo must be set to
+             * nullptr in order to avoid accessing a handle to a popped element. Invalidating the
+             * handle is done by beforeComputation().
+             */
+            queue.pop();
+            beforeComputation(entry.level);
+
+            MultiIndex level = entry.level;
+            std::vector<ThreadPool::Task> tasks;
+
+            // Instead of committing the level while the mutex is locked (which would block all
+            // threads storing function values), the callback only buffers the level. A separate
+            // task commits all buffered levels at once.
+            ThreadPool::Task callback([this, level, &tp, tryCommit, &numLevelsInFlight]() {
+              {
+                std::lock_guard<std::mutex> guard(*completedLevelsMutex);
+                completedLevels.push_back(level);
+              }
+
+              --numLevelsInFlight;
+              tp.addTask(tryCommit, ThreadPool::Priority::HIGH);
+            });
+            // the callback is called right away if the level doesn't need any evaluations
+            ++numLevelsInFlight;
+            tasks = combiEval->getLevelTasks(level, callback);
+
+            for (auto &task : tasks) {
+              task = ThreadPool::Task([task, &numTasks, &busyNanoseconds]() {
+                auto start = std::chrono::steady_clock::now();
+                task();
+                busyNanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                       std::chrono::steady_clock::now() - start)
+                                       .count();
+                ++numTasks;
+              });
+            }
+
+            tp.addTasks(tasks);
+            ++numStarted;
+          }
+
+          numLevelsStarted += numStarted;
+
+          if ((numStarted == 0) && !levelsInFlight) {
+            // No level can be started and all started levels have been committed, so the queue
+            // won't change anymore. No tasks are left, as the pool is idle and no level is in
+            // flight, hence the threads can terminate.
+            terminate = true;
+            tp.triggerTermination();
+          }
 
-        if (currentPointBound > maxNumPoints) {
-          tp.triggerTermination();
           CGLOG("leave guard(*managerMutex)");
-          return;
         }
 
-        CGLOG("before beforeComputation()");
-        /*
-         * Must be placed after the triggerTermination() in the if clause since after the pop()
-         * operation, the corresponding handle in the LevelInfo must be set to nullptr in order to
-         * avoid accessing a handle to a popped element. Invalidating the handle is done by
-         * beforeComputation().
-         */
-        queue.pop();  // TODO(rehmemk)
-
-        beforeComputation(entry.level);
-        CGLOG("before getLevelTasks()");
-        auto tasks = combiEval->getLevelTasks(entry.level, ThreadPool::Task([this, entry]() {
-                                                // the mutex will be locked when this callback is
-                                                // called
-                                                // PtrGuard guard(this->managerMutex);
-                                                afterComputation(entry.level);
-                                              }));
-        CGLOG("before addTasks()");
-        tp.addTasks(tasks);
-        CGLOG("leave guard(*managerMutex)");
+        if ((numStarted == 0) && !terminate) {
+          // the other threads are executing the last tasks of the levels in flight, which have to
+          // be committed before their successors can be started
+          std::this_thread::yield();
+        }
       }));
 
   threadPool->start();
   threadPool->join();
 
+  // commit the levels that have been completed by the last tasks
+  {
+    CGLOG_SURROUND(PtrGuard guard(managerMutex));
+    commit();
+  }
+
   combiEval->setMutex(nullptr);
+
+  parallelStats = ParallelRefinementStats();
+  parallelStats.numLevelsStarted = numLevelsStarted;
+  parallelStats.numLevelsCommitted = numLevelsCommitted;
+  parallelStats.numCommitBatches = numCommitBatches;
+  parallelStats.numTasks = numTasks;
+  parallelStats.elapsedSeconds = stopwatch.elapsedSeconds();
+  parallelStats.busySeconds = static_cast<double>(busyNanoseconds) * 1e-9;
 }
 
+ParallelRefinementStats LevelManager::getParallelRefinementStats() const { return parallelStats; }
+
 void LevelManager::addLevelsAdaptiveByNumLevels(size_t numLevels) {
   initAdaption();
 
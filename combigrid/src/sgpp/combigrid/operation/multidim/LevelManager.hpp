@@ -83,6 +83,18 @@ class LevelManager {
    */
   std::shared_ptr<std::recursive_mutex> managerMutex;
 
+  /**
+   * Levels whose function values have been computed during parallel adaptive refinement, but which
+   * have not been committed via afterComputation() yet, guarded by completedLevelsMutex.
+   */
+  std::vector<MultiIndex> completedLevels;
+  std::shared_ptr<std::mutex> completedLevelsMutex;
+
+  /**
+   * Throughput counters of the last call to addLevelsAdaptiveParallel().
+   */
+  ParallelRefinementStats parallelStats;
+
   /**
    * Defines if statistics on the refinement process are collected or not.
    */
@@ -181,6 +193,12 @@ class LevelManager {
    */
   void precomputeLevelsParallel(std::vector<MultiIndex> const &levels, size_t numThreads);
 
+  /**
+   * Passes all levels in completedLevels to afterComputation(). managerMutex has to be locked.
+   * @return the number of committed levels
+   */
+  size_t commitCompletedLevels();
+
   /**
    * Adds all the given levels.
    */
@@ -326,9 +344,25 @@ class LevelManager {
 
   /**
    * Does the same as addLevelsAdaptive(), but with parallel function evaluations.
+   *
+   * The refinement is organized as a pipeline: Whenever the threads run out of work, up to
+   * numThreads levels are taken from the priority queue at once and their function evaluations are
+   * distributed to the threads. Completed levels are buffered and committed to the
+   * CombigridEvaluator in batches by a single thread, while the other threads continue evaluating
+   * the function. As in addLevelsAdaptive(), no more levels are started once the level with the
+   * highest priority does not fit into the point bound; the threads terminate after all started
+   * levels have been committed. As several levels are taken from the queue before the successors
+   * of the levels in flight are known, the added levels may differ slightly from the ones added by
+   * addLevelsAdaptive() if more than one thread is used. See getParallelRefinementStats() for the
+   * achieved throughput.
    */
   virtual void addLevelsAdaptiveParallel(size_t maxNumPoints, size_t numThreads);
 
+  /**
+   * @return throughput counters of the last call to addLevelsAdaptiveParallel()
+   */
+  ParallelRefinementStats getParallelRefinementStats() const;
+
   /**
    * @return a vector with all grid points where the function has been evaluated (without
    * duplicates).
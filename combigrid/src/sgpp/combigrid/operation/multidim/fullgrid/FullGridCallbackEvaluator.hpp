@@ -14,6 +14,10 @@
 #include <sgpp/combigrid/threading/PtrGuard.hpp>
 #include <sgpp/combigrid/threading/ThreadPool.hpp>
 
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <thread>
 #include <vector>
 
 namespace sgpp {
@@ -86,16 +90,33 @@ class FullGridCallbackEvaluator : public AbstractFullGridEvaluationStrategy<V> {
       // make it a pointer so that it does not get deleted before all tasks are completed
       auto counter = std::make_shared<size_t>(computationTasks.size());
 
-      for (size_t i = 0; i < computationTasks.size(); ++i) {
-        auto compTask = computationTasks[i];
-        auto index = multiIndices[i];
-
-        tasks.push_back(ThreadPool::Task([compTask, index, counter, callback, this, level]() {
-          auto result = compTask();
+      // Group the function evaluations into batches, so that the mutex is locked once per batch
+      // instead of once per point. There are still enough batches to keep all threads busy.
+      size_t numBatches =
+          std::min(computationTasks.size(),
+                   static_cast<size_t>(8 * std::max(1u, std::thread::hardware_concurrency())));
+
+      for (size_t b = 0; b < numBatches; ++b) {
+        size_t begin = computationTasks.size() * b / numBatches;
+        size_t end = computationTasks.size() * (b + 1) / numBatches;
+        auto batchTasks = std::make_shared<std::vector<std::function<double()>>>(
+            computationTasks.begin() + begin, computationTasks.begin() + end);
+        auto batchIndices = std::make_shared<std::vector<MultiIndex>>(
+            multiIndices.begin() + begin, multiIndices.begin() + end);
+
+        tasks.push_back(ThreadPool::Task([batchTasks, batchIndices, counter, callback, this,
+                                          level]() {
+          std::vector<double> results(batchTasks->size());
+
+          for (size_t i = 0; i < batchTasks->size(); ++i) {
+            results[i] = (*batchTasks)[i]();
+          }
 
           CGLOG_SURROUND(PtrGuard guard(this->mutexPtr));
-          this->storage->set(level, index, result);
-          --(*counter);
+          for (size_t i = 0; i < results.size(); ++i) {
+            this->storage->set(level, (*batchIndices)[i], results[i]);
+          }
+          *counter -= results.size();
           if (*counter == 0) {
             callback();
           }
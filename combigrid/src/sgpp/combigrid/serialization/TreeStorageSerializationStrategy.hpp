@@ -13,6 +13,8 @@
 #include <sgpp/combigrid/utils/Utils.hpp>
 #include <sgpp/globaldef.hpp>
 
+#include <functional>
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -23,12 +25,21 @@ namespace combigrid {
 /**
  * This class provides a serialization strategy for TreeStorage<T>-objects (though not particularly
  * well-compressed).
+ * The storage class can be selected via StorageType, e.g. HashStorage<T>, or
+ * AbstractMultiStorage<T> together with a factory that creates the concrete storage on
+ * deserialization. The serialized format does not depend on the storage class, so a storage
+ * serialized from a TreeStorage can be deserialized into a HashStorage and vice versa.
  */
-template <typename T>
+template <typename T, typename StorageType = TreeStorage<T>>
 class TreeStorageSerializationStrategy
-    : public AbstractSerializationStrategy<std::shared_ptr<TreeStorage<T>>> {
+    : public AbstractSerializationStrategy<std::shared_ptr<StorageType>> {
+ public:
+  typedef std::function<std::shared_ptr<StorageType>(size_t)> factory_type;
+
+ private:
   std::shared_ptr<AbstractSerializationStrategy<T>> innerStrategy;
   size_t numDimensions;
+  factory_type factory;
 
   static std::shared_ptr<AbstractSerializationStrategy<T>> getDefaultStrategy() {
     std::shared_ptr<AbstractSerializationStrategy<T>> ans =
@@ -36,6 +47,10 @@ class TreeStorageSerializationStrategy
     return ans;
   }
 
+  static factory_type getDefaultFactory() {
+    return [](size_t numDimensions) { return std::make_shared<StorageType>(numDimensions); };
+  }
+
  public:
   /**
    * Constructor. A serialization strategy for the type T can be provided, otherwise, a
@@ -44,15 +59,18 @@ class TreeStorageSerializationStrategy
    * @param numDimensions Dimension of the tree storage.
    * @param innerStrategy Strategy that should be used to serialize the contained objects of the
    * TreeStorage.
+   * @param factory Creates an empty storage with the given number of dimensions on
+   * deserialization. Has to be specified if StorageType is abstract.
    */
   TreeStorageSerializationStrategy(
       size_t numDimensions,
-      std::shared_ptr<AbstractSerializationStrategy<T>> innerStrategy = getDefaultStrategy())
-      : innerStrategy(innerStrategy), numDimensions(numDimensions) {}
+      std::shared_ptr<AbstractSerializationStrategy<T>> innerStrategy = getDefaultStrategy(),
+      factory_type factory = getDefaultFactory())
+      : innerStrategy(innerStrategy), numDimensions(numDimensions), factory(factory) {}
 
   virtual ~TreeStorageSerializationStrategy() {}
 
-  virtual std::string serialize(std::shared_ptr<TreeStorage<T>> const &storage) {
+  virtual std::string serialize(std::shared_ptr<StorageType> const &storage) {
     DefaultSerializationStrategy<size_t> indexStrategy;
 
     std::vector<std::string> entries;
@@ -73,8 +91,8 @@ class TreeStorageSerializationStrategy
     return join(entries, "\n");
   }
 
-  virtual std::shared_ptr<TreeStorage<T>> deserialize(std::string const &input) {
-    auto storage = std::make_shared<TreeStorage<T>>(numDimensions);
+  virtual std::shared_ptr<StorageType> deserialize(std::string const &input) {
+    std::shared_ptr<StorageType> storage = factory(numDimensions);
 
     DefaultSerializationStrategy<size_t> indexStrategy;
 
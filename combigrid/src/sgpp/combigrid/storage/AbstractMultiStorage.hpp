@@ -11,12 +11,19 @@
 #include <sgpp/combigrid/storage/AbstractMultiStorageIterator.hpp>
 #include <sgpp/combigrid/storage/IterationPolicy.hpp>
 
+#include <functional>
 #include <memory>
 #include <string>
 
 namespace sgpp {
 namespace combigrid {
 
+/**
+ * Selects the implementation of AbstractMultiStorage that is used where a storage can be chosen,
+ * e.g. in CombigridTreeStorage. TREE selects TreeStorage, HASH selects the flat HashStorage.
+ */
+enum class MultiStorageType { TREE, HASH };
+
 /**
  * Interface for storage classes which store values of type T. These values can be accessed via a
  * multi-index.
@@ -48,6 +55,11 @@ class AbstractMultiStorage {
    */
   virtual bool containsIndex(MultiIndex const &index) const = 0;
 
+  /**
+   * Changes the function that is used by get() to compute entries that are not yet stored.
+   */
+  virtual void setFunc(std::function<T(MultiIndex const &)> func) = 0;
+
   /**
    * @return Returns an iterator that iterates over all values that are already stored in the
    * storage.
@@ -3,12 +3,19 @@
 // use, please see the copyright notice provided with SG++ or at
 // sgpp.sparsegrids.org
 
+#include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/base/tools/MemoryMappedFile.hpp>
 #include <sgpp/combigrid/serialization/DefaultSerializationStrategy.hpp>
 #include <sgpp/combigrid/serialization/FloatSerializationStrategy.hpp>
 #include <sgpp/combigrid/storage/FunctionLookupTable.hpp>
 #include <sgpp/combigrid/utils/DataVectorHashing.hpp>
 #include <sgpp/combigrid/utils/Utils.hpp>
 
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <future>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -16,72 +23,179 @@
 namespace sgpp {
 namespace combigrid {
 
+namespace {
+
+/// header of store files: magic number, format version and byte order mark
+const char STORE_MAGIC[8] = {'S', 'G', 'P', 'P', 'F', 'L', 'T', '\0'};
+const uint32_t STORE_VERSION = 1;
+const uint32_t STORE_BYTE_ORDER_MARK = 0x01020304;
+const size_t STORE_HEADER_SIZE = sizeof(STORE_MAGIC) + 2 * sizeof(uint32_t);
+
+}  // namespace
+
+/**
+ * Part of the hashtable, protected by its own mutex
+ */
+struct FunctionLookupTableShard {
+  std::mutex mutex;
+  std::unordered_map<base::DataVector, double, DataVectorHash, DataVectorEqualTo> values;
+  // evaluations that are currently running in some thread
+  std::unordered_map<base::DataVector, std::shared_future<double>, DataVectorHash,
+                     DataVectorEqualTo>
+      pending;
+};
+
 /**
  * Helper to realize the PIMPL pattern
  */
 struct FunctionLookupTableImpl {
-  std::shared_ptr<std::unordered_map<base::DataVector, double, DataVectorHash, DataVectorEqualTo>>
-      hashmap;
+  static const size_t NUM_SHARDS = 64;
+
   MultiFunction func;
-  std::recursive_mutex tableMutex;
+  FunctionLookupTableShard shards[NUM_SHARDS];
+  std::mutex storeMutex;
+  FILE* store;
 
-  explicit FunctionLookupTableImpl(MultiFunction func) : func(func), tableMutex() {
-    hashmap = std::make_shared<
-        std::unordered_map<base::DataVector, double, DataVectorHash, DataVectorEqualTo>>();
+  explicit FunctionLookupTableImpl(MultiFunction func)
+      : func(func), storeMutex(), store(nullptr) {}
+
+  ~FunctionLookupTableImpl() { closeStore(); }
+
+  FunctionLookupTableShard& getShard(base::DataVector const& x) {
+    // use the upper bits of the mixed hash, the lower bits are used by the hashtables
+    uint64_t h = static_cast<uint64_t>(DataVectorHash()(x));
+    h = (h ^ (h >> 32)) * 0x9E3779B97F4A7C15ull;
+    return shards[h >> 58];
+  }
+
+  void insert(base::DataVector const& x, double y) {
+    {
+      FunctionLookupTableShard& shard = getShard(x);
+      std::lock_guard<std::mutex> guard(shard.mutex);
+      shard.values[x] = y;
+    }
+
+    append(x, y);
+  }
+
+  void append(base::DataVector const& x, double y) {
+    std::lock_guard<std::mutex> guard(storeMutex);
+
+    if (store == nullptr) {
+      return;
+    }
+
+    // write each record with a single call, so that only the last record can be incomplete
+    const uint64_t dim = x.getSize();
+    std::vector<char> record(sizeof(uint64_t) + (dim + 1) * sizeof(double));
+    std::memcpy(record.data(), &dim, sizeof(uint64_t));
+    std::memcpy(record.data() + sizeof(uint64_t), x.data(), dim * sizeof(double));
+    std::memcpy(record.data() + sizeof(uint64_t) + dim * sizeof(double), &y, sizeof(double));
+
+    if ((std::fwrite(record.data(), 1, record.size(), store) != record.size()) ||
+        (std::fflush(store) != 0)) {
+      throw std::runtime_error("FunctionLookupTable: could not write to the store");
+    }
+  }
+
+  void closeStore() {
+    std::lock_guard<std::mutex> guard(storeMutex);
+
+    if (store != nullptr) {
+      std::fclose(store);
+      store = nullptr;
+    }
   }
 };
 
+const size_t FunctionLookupTableImpl::NUM_SHARDS;
+
 FunctionLookupTable::FunctionLookupTable(MultiFunction const& func)
     : impl(std::make_shared<FunctionLookupTableImpl>(func)) {}
 
 double FunctionLookupTable::operator()(const base::DataVector& x) {
-  auto it = impl->hashmap->find(x);
-  if (it == impl->hashmap->end()) {
-    auto y = impl->func(x);
-    addEntry(x, y);
-    return y;
+  {
+    FunctionLookupTableShard& shard = impl->getShard(x);
+    std::lock_guard<std::mutex> guard(shard.mutex);
+    auto it = shard.values.find(x);
+
+    if (it != shard.values.end()) {
+      return it->second;
+    }
   }
 
-  return it->second;
+  auto y = impl->func(x);
+  addEntry(x, y);
+  return y;
 }
 
 double FunctionLookupTable::eval(const base::DataVector& x) { return (*this)(x); }
 
 double FunctionLookupTable::evalThreadsafe(const base::DataVector& x) {
-  impl->tableMutex.lock();
-  auto it = impl->hashmap->find(x);
-  if (it == impl->hashmap->end()) {
-    impl->tableMutex.unlock();
-    auto y = impl->func(x);
-    impl->tableMutex.lock();
-    addEntry(x, y);
-    impl->tableMutex.unlock();
-    return y;
+  FunctionLookupTableShard& shard = impl->getShard(x);
+  std::promise<double> promise;
+  std::unique_lock<std::mutex> lock(shard.mutex);
+  auto it = shard.values.find(x);
+
+  if (it != shard.values.end()) {
+    return it->second;
+  }
+
+  auto pendingIt = shard.pending.find(x);
+
+  if (pendingIt != shard.pending.end()) {
+    // another thread is evaluating the function at x, wait for its result
+    std::shared_future<double> result = pendingIt->second;
+    lock.unlock();
+    return result.get();
   }
 
-  std::lock_guard<std::recursive_mutex> guard(impl->tableMutex);
-  auto y = it->second;
-  impl->tableMutex.unlock();
+  shard.pending[x] = promise.get_future().share();
+  lock.unlock();
+
+  double y;
+
+  try {
+    y = impl->func(x);
+  } catch (...) {
+    promise.set_exception(std::current_exception());
+    std::lock_guard<std::mutex> guard(shard.mutex);
+    shard.pending.erase(x);
+    throw;
+  }
+
+  {
+    std::lock_guard<std::mutex> guard(shard.mutex);
+    shard.values[x] = y;
+    shard.pending.erase(x);
+  }
+
+  promise.set_value(y);
+  impl->append(x, y);
   return y;
 }
 
-void FunctionLookupTable::addEntry(const base::DataVector& x, double y) { (*impl->hashmap)[x] = y; }
+void FunctionLookupTable::addEntry(const base::DataVector& x, double y) { impl->insert(x, y); }
 
 std::string FunctionLookupTable::serialize() {
   FloatSerializationStrategy<double> strategy;
 
   std::vector<std::string> entries;
 
-  for (auto it = impl->hashmap->begin(); it != impl->hashmap->end(); ++it) {
-    std::vector<std::string> vectorEntries;
+  for (auto& shard : impl->shards) {
+    std::lock_guard<std::mutex> guard(shard.mutex);
 
-    auto& vec = it->first;
+    for (auto it = shard.values.begin(); it != shard.values.end(); ++it) {
+      std::vector<std::string> vectorEntries;
 
-    for (size_t i = 0; i < vec.getSize(); ++i) {
-      vectorEntries.push_back(strategy.serialize(vec[i]));
-    }
+      auto& vec = it->first;
+
+      for (size_t i = 0; i < vec.getSize(); ++i) {
+        vectorEntries.push_back(strategy.serialize(vec[i]));
+      }
 
-    entries.push_back(join(vectorEntries, ", ") + " -> " + strategy.serialize(it->second));
+      entries.push_back(join(vectorEntries, ", ") + " -> " + strategy.serialize(it->second));
+    }
   }
 
   return join(entries, "\n");
@@ -121,12 +235,106 @@ void FunctionLookupTable::deserialize(const std::string& value) {
   }
 }
 
+void FunctionLookupTable::openStore(const std::string& filename) {
+  closeStore();
+
+  // load the existing records
+  size_t validSize = 0;
+  std::string validContents;
+
+  try {
+    base::MemoryMappedFile file(filename);
+    const char* data = file.getData();
+    const size_t size = file.getSize();
+
+    if (size > 0) {
+      uint32_t version = 0;
+      uint32_t byteOrderMark = 0;
+
+      if (size >= STORE_HEADER_SIZE) {
+        std::memcpy(&version, data + sizeof(STORE_MAGIC), sizeof(uint32_t));
+        std::memcpy(&byteOrderMark, data + sizeof(STORE_MAGIC) + sizeof(uint32_t),
+                    sizeof(uint32_t));
+      }
+
+      if ((size < STORE_HEADER_SIZE) ||
+          (std::memcmp(data, STORE_MAGIC, sizeof(STORE_MAGIC)) != 0) ||
+          (version != STORE_VERSION) || (byteOrderMark != STORE_BYTE_ORDER_MARK)) {
+        throw std::runtime_error("FunctionLookupTable::openStore(): " + filename +
+                                 " is not a valid store");
+      }
+
+      validSize = STORE_HEADER_SIZE;
+
+      while (validSize + sizeof(uint64_t) <= size) {
+        uint64_t dim;
+        std::memcpy(&dim, data + validSize, sizeof(uint64_t));
+
+        if (dim >= (size - validSize - sizeof(uint64_t)) / sizeof(double)) {
+          // incomplete last record
+          break;
+        }
+
+        base::DataVector x(dim);
+        double y;
+        const char* values = data + validSize + sizeof(uint64_t);
+        std::memcpy(x.data(), values, dim * sizeof(double));
+        std::memcpy(&y, values + dim * sizeof(double), sizeof(double));
+
+        FunctionLookupTableShard& shard = impl->getShard(x);
+        {
+          std::lock_guard<std::mutex> shardGuard(shard.mutex);
+          shard.values[x] = y;
+        }
+        validSize += sizeof(uint64_t) + (dim + 1) * sizeof(double);
+      }
+
+      if (validSize < size) {
+        validContents.assign(data, validSize);
+      }
+    }
+  } catch (base::file_exception&) {
+    // the file does not exist yet
+  }
+
+  if (validSize == 0) {
+    // new store, write the header
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    file.write(STORE_MAGIC, sizeof(STORE_MAGIC));
+    file.write(reinterpret_cast<const char*>(&STORE_VERSION), sizeof(uint32_t));
+    file.write(reinterpret_cast<const char*>(&STORE_BYTE_ORDER_MARK), sizeof(uint32_t));
+  } else if (!validContents.empty()) {
+    // discard the incomplete record, such that new records are appended at the right position
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    file.write(validContents.data(), static_cast<std::streamsize>(validContents.size()));
+  }
+
+  std::lock_guard<std::mutex> guard(impl->storeMutex);
+  impl->store = std::fopen(filename.c_str(), "ab");
+
+  if (impl->store == nullptr) {
+    throw std::runtime_error("FunctionLookupTable::openStore(): could not open " + filename);
+  }
+}
+
+void FunctionLookupTable::closeStore() { impl->closeStore(); }
+
 bool FunctionLookupTable::containsEntry(const base::DataVector& x) {
-  auto it = impl->hashmap->find(x);
-  return it != impl->hashmap->end();
+  FunctionLookupTableShard& shard = impl->getShard(x);
+  std::lock_guard<std::mutex> guard(shard.mutex);
+  return shard.values.find(x) != shard.values.end();
 }
 
-size_t FunctionLookupTable::getNumEntries() const { return impl->hashmap->size(); }
+size_t FunctionLookupTable::getNumEntries() const {
+  size_t numEntries = 0;
+
+  for (auto& shard : impl->shards) {
+    std::lock_guard<std::mutex> guard(shard.mutex);
+    numEntries += shard.values.size();
+  }
+
+  return numEntries;
+}
 
 MultiFunction FunctionLookupTable::toMultiFunction() const { return MultiFunction(*this); }
 
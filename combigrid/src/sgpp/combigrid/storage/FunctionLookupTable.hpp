@@ -25,6 +25,11 @@ struct FunctionLookupTableImpl;
  * This class wraps a MultiFunction and stores computed values using a hashtable to avoid
  * reevaluating a function at points where it already has been evaluated. This means that only the
  * exact same parameter will allow retrieving the function value.
+ *
+ * The hashtable is split into shards with separate mutexes, so that threads accessing different
+ * parameters rarely block each other. Optionally, all new function values can be appended to a
+ * binary file (see openStore()), such that expensive evaluations survive program crashes and can
+ * be reused in later runs.
  */
 class FunctionLookupTable {
   std::shared_ptr<FunctionLookupTableImpl> impl;
@@ -44,9 +49,10 @@ class FunctionLookupTable {
   double eval(base::DataVector const &x);
 
   /**
-   * Does the same as eval(), but uses a mutex whenever the hashtable is accessed. Crucially, the
-   * mutex is not locked when evaluating the function, such that multiple function evaluations can
-   * be done in parallel.
+   * Does the same as eval(), but can be called from multiple threads concurrently. Crucially, no
+   * mutex is locked when evaluating the function, such that multiple function evaluations can be
+   * done in parallel. If another thread is currently evaluating the function at the same point,
+   * this waits for its result instead of evaluating the function again.
    */
   double evalThreadsafe(base::DataVector const &x);
 
@@ -56,7 +62,8 @@ class FunctionLookupTable {
   bool containsEntry(base::DataVector const &x);
 
   /**
-   * Adds a function value into the storage.
+   * Adds a function value into the storage (thread-safe). If a store is open, the value is also
+   * appended to the store.
    * @param x Parameter of the function.
    * @param y Result of the function evaluation.
    */
@@ -72,6 +79,25 @@ class FunctionLookupTable {
    */
   void deserialize(std::string const &value);
 
+  /**
+   * Opens a binary store file. All function values already contained in the file are loaded into
+   * the hashtable and all function values added afterwards (by evaluation or addEntry()) are
+   * appended to the file immediately. If the file does not exist, it is created. A record that has
+   * only been partially written (e.g., because the program was killed) is discarded. Throws a
+   * std::runtime_error if the file is not a valid store.
+   *
+   * The store is written in the byte order of the machine. This function must not be called
+   * concurrently with other member functions.
+   *
+   * @param filename name of the store file
+   */
+  void openStore(std::string const &filename);
+
+  /**
+   * Closes the store opened by openStore() (the destructor does this automatically).
+   */
+  void closeStore();
+
   /**
    * @return the number of stored function values.
    */
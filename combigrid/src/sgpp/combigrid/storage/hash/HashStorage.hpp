@@ -0,0 +1,317 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_HASH_HASHSTORAGE_HPP_
+#define COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_HASH_HASHSTORAGE_HPP_
+
+#include <sgpp/combigrid/storage/AbstractMultiStorage.hpp>
+#include <sgpp/combigrid/storage/hash/HashStorageGuidedIterator.hpp>
+#include <sgpp/combigrid/storage/hash/HashStorageStoredDataIterator.hpp>
+#include <sgpp/combigrid/storage/tree/AbstractTreeStorageNode.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace sgpp {
+namespace combigrid {
+
+/**
+ * Flat alternative to TreeStorage. Instead of a tree of nodes, the entries are kept in contiguous
+ * arrays (multi-index components as 32-bit integers, values and status flags) and located via an
+ * open-addressing hash table with linear probing. Compared to TreeStorage, this needs much less
+ * memory per entry and no node allocations if the stored multi-indices are sparse or the number
+ * of dimensions is high.
+ * Unlike TreeStorage, get() and set() only create the entry that is accessed, not the entries with
+ * smaller indices in the last dimension.
+ * References returned by get() or value() are invalidated when new entries are inserted.
+ * For more information see AbstractMultiStorage.
+ */
+template <typename T>
+class HashStorage : public AbstractMultiStorage<T> {
+ public:
+  typedef std::function<T(MultiIndex const &)> function_type;
+
+  /**
+   * Entry number returned by findEntry() if there is no entry for the given multi-index.
+   */
+  static const size_t npos = std::numeric_limits<size_t>::max();
+
+ private:
+  size_t numDimensions;
+  function_type func;
+
+  // numDimensions components per entry
+  std::vector<uint32_t> keys;
+  std::vector<T> elements;
+  std::vector<StorageStatus> statusVector;
+
+  // entry number + 1 for each occupied slot, 0 for empty slots; the size is a power of two
+  std::vector<size_t> slots;
+  size_t numStored;
+
+  HashStorage(HashStorage<T> const &) = delete;
+
+  template <typename Iterator>
+  static size_t hash(Iterator begin, size_t numComponents) {
+    // FNV-1a over the components followed by a final avalanche step
+    uint64_t h = 14695981039346656037ull;
+
+    for (size_t d = 0; d < numComponents; ++d, ++begin) {
+      h ^= static_cast<uint64_t>(*begin);
+      h *= 1099511628211ull;
+    }
+
+    h ^= h >> 29;
+    h *= 0xbf58476d1ce4e5b9ull;
+    h ^= h >> 32;
+    return static_cast<size_t>(h);
+  }
+
+  bool keyEquals(size_t entry, MultiIndex const &index) const {
+    uint32_t const *key = &keys[entry * numDimensions];
+
+    for (size_t d = 0; d < numDimensions; ++d) {
+      if (key[d] != index[d]) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  void insertSlot(size_t entry) {
+    size_t mask = slots.size() - 1;
+    size_t slot = hash(keys.begin() + entry * numDimensions, numDimensions) & mask;
+
+    while (slots[slot] != 0) {
+      slot = (slot + 1) & mask;
+    }
+
+    slots[slot] = entry + 1;
+  }
+
+  void rehash(size_t numSlots) {
+    slots.assign(numSlots, 0);
+
+    for (size_t entry = 0; entry < elements.size(); ++entry) {
+      insertSlot(entry);
+    }
+  }
+
+  void checkIndex(MultiIndex const &index) const {
+    if (index.size() != numDimensions) {
+      throw std::runtime_error("HashStorage: index.size() != numDimensions");
+    }
+  }
+
+ public:
+  /**
+   * Constructor.
+   * @param numDimensions number of dimensions of the multi-indices that the storage is addressed
+   * with
+   * @param func "Default-value-function" that is called to compute entries that are not already
+   * stored. If this parameter is not specified, func will be set to a function returning T().
+   */
+  explicit HashStorage(size_t numDimensions, function_type func = multiIndexToDefaultValue<T>())
+      : numDimensions(numDimensions),
+        func(func),
+        keys(),
+        elements(),
+        statusVector(),
+        slots(),
+        numStored(0) {}
+
+  virtual ~HashStorage() {}
+
+  virtual size_t getNumDimensions() const { return numDimensions; }
+
+  /**
+   * Returns the value for the given MultiIndex. If the value is not stored, it is computed using
+   * the function and then stored and returned.
+   */
+  virtual T &get(MultiIndex const &index) {
+    checkIndex(index);
+    size_t entry = findOrInsertEntry(index);
+
+    if (statusVector[entry] != StorageStatus::STORED) {
+      // func might insert into this storage, so the entry is only accessed afterwards
+      T value = func(index);
+      elements[entry] = value;
+      statusVector[entry] = StorageStatus::STORED;
+      ++numStored;
+    }
+
+    return elements[entry];
+  }
+
+  /**
+   * Changes the function that generates the entries.
+   */
+  virtual void setFunc(function_type func) { this->func = func; }
+
+  /**
+   * @return Returns the function that generates the entries.
+   */
+  function_type const &getFunc() const { return func; }
+
+  virtual void set(MultiIndex const &index, T const &value) {
+    checkIndex(index);
+    setValueAt(findOrInsertEntry(index), value);
+  }
+
+  virtual bool containsIndex(MultiIndex const &index) const {
+    size_t entry = findEntry(index);
+    return entry != npos && statusVector[entry] == StorageStatus::STORED;
+  }
+
+  virtual std::shared_ptr<AbstractMultiStorageIterator<T>> getStoredDataIterator() {
+    return std::make_shared<HashStorageStoredDataIterator<T>>(*this);
+  }
+
+  virtual std::shared_ptr<AbstractMultiStorageIterator<T>> getGuidedIterator(
+      MultiIndexIterator &indexIter, IterationPolicy const &policy = IterationPolicy::Default) {
+    return std::make_shared<HashStorageGuidedIterator<T>>(policy, *this, indexIter);
+  }
+
+  /**
+   * @return Returns the number of entries whose value is stored. This is an O(1) method.
+   */
+  size_t getNumStoredEntries() const { return numStored; }
+
+  /**
+   * Reserves memory such that numEntries entries can be held without reallocation or rehashing.
+   */
+  void reserve(size_t numEntries) {
+    keys.reserve(numEntries * numDimensions);
+    elements.reserve(numEntries);
+    statusVector.reserve(numEntries);
+
+    size_t numSlots = std::max(slots.size(), static_cast<size_t>(16));
+
+    while (numSlots < 2 * numEntries) {
+      numSlots *= 2;
+    }
+
+    if (numSlots != slots.size()) {
+      rehash(numSlots);
+    }
+  }
+
+  /**
+   * @return Returns the entry number for the given multi-index (regardless of whether the value
+   * has already been stored), or npos if there is no such entry.
+   */
+  size_t findEntry(MultiIndex const &index) const {
+    if (slots.empty() || index.size() != numDimensions) {
+      return npos;
+    }
+
+    size_t mask = slots.size() - 1;
+    size_t slot = hash(index.begin(), numDimensions) & mask;
+
+    while (slots[slot] != 0) {
+      size_t entry = slots[slot] - 1;
+
+      if (keyEquals(entry, index)) {
+        return entry;
+      }
+
+      slot = (slot + 1) & mask;
+    }
+
+    return npos;
+  }
+
+  /**
+   * @return Returns the entry number for the given multi-index. If there is no such entry, an
+   * entry with status StorageStatus::NOT_STORED is created.
+   */
+  size_t findOrInsertEntry(MultiIndex const &index) {
+    size_t entry = findEntry(index);
+
+    if (entry != npos) {
+      return entry;
+    }
+
+    for (size_t d = 0; d < numDimensions; ++d) {
+      if (index[d] > std::numeric_limits<uint32_t>::max()) {
+        throw std::runtime_error("HashStorage::findOrInsertEntry(): index component too large");
+      }
+    }
+
+    entry = elements.size();
+
+    if (2 * (entry + 1) > slots.size()) {
+      // keep the load factor at or below 1/2
+      rehash(std::max(static_cast<size_t>(16), 2 * slots.size()));
+    }
+
+    for (size_t d = 0; d < numDimensions; ++d) {
+      keys.push_back(static_cast<uint32_t>(index[d]));
+    }
+
+    elements.push_back(T());
+    statusVector.push_back(StorageStatus::NOT_STORED);
+    insertSlot(entry);
+
+    return entry;
+  }
+
+  /**
+   * @return Returns the number of entries including those whose value is not yet stored. Valid
+   * entry numbers are 0, ..., getNumAllocatedEntries() - 1.
+   */
+  size_t getNumAllocatedEntries() const { return elements.size(); }
+
+  /**
+   * @return Returns the index in dimension d of the given entry.
+   */
+  size_t indexAt(size_t entry, size_t d) const { return keys[entry * numDimensions + d]; }
+
+  /**
+   * @return Returns a pointer to the numDimensions (32-bit) index components of the given entry.
+   */
+  uint32_t const *keyAt(size_t entry) const { return &keys[entry * numDimensions]; }
+
+  T &valueAt(size_t entry) { return elements[entry]; }
+
+  StorageStatus statusAt(size_t entry) const { return statusVector[entry]; }
+
+  /**
+   * Sets the status of the given entry, e.g. to StorageStatus::REQUESTED. Use setValueAt() to
+   * mark an entry as stored.
+   */
+  void setStatusAt(size_t entry, StorageStatus status) {
+    if (statusVector[entry] == StorageStatus::STORED) {
+      --numStored;
+    }
+
+    statusVector[entry] = status;
+  }
+
+  /**
+   * Sets the value of the given entry and marks it as stored.
+   */
+  void setValueAt(size_t entry, T const &value) {
+    elements[entry] = value;
+
+    if (statusVector[entry] != StorageStatus::STORED) {
+      statusVector[entry] = StorageStatus::STORED;
+      ++numStored;
+    }
+  }
+};
+
+template <typename T>
+const size_t HashStorage<T>::npos;
+
+} /* namespace combigrid */
+} /* namespace sgpp*/
+
+#endif /* COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_HASH_HASHSTORAGE_HPP_ */
@@ -0,0 +1,126 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_HASH_HASHSTORAGEGUIDEDITERATOR_HPP_
+#define COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_HASH_HASHSTORAGEGUIDEDITERATOR_HPP_
+
+#include <sgpp/combigrid/common/MultiIndexIterator.hpp>
+#include <sgpp/combigrid/definitions.hpp>
+#include <sgpp/combigrid/storage/AbstractMultiStorageIterator.hpp>
+#include <sgpp/combigrid/storage/IterationPolicy.hpp>
+#include <sgpp/combigrid/storage/tree/AbstractTreeStorageNode.hpp>
+
+#include <cstddef>
+#include <functional>
+
+namespace sgpp {
+namespace combigrid {
+
+template <typename T>
+class HashStorage;
+
+/**
+ * Iterator class that travels "along" a MultiIndexIterator through a HashStorage.
+ * If entries are not already contained, they are created during iteration.
+ * The permuted multi-index is updated incrementally in the same way as in
+ * TreeStorageGuidedIterator; each access then costs one hash table lookup.
+ * For a detailed method description, see AbstractMultiStorageIterator.
+ */
+template <typename T>
+class HashStorageGuidedIterator final : public AbstractMultiStorageIterator<T> {
+  MultiIndexIterator &iterator;
+  HashStorage<T> &storage;
+  MultiIndex permutedIndex;
+  size_t lastDim;
+
+  IterationPolicy policy;
+
+  /**
+   * Updates the last component of permutedIndex, which is not maintained by moveToNext().
+   */
+  void updateLowestIndex() {
+    permutedIndex[lastDim] = policy.value(lastDim, iterator.indexAt(lastDim));
+  }
+
+ public:
+  HashStorageGuidedIterator(IterationPolicy const &policy, HashStorage<T> &storage,
+                            MultiIndexIterator &iterator)
+      : iterator(iterator),
+        storage(storage),
+        permutedIndex(storage.getNumDimensions(), 0),
+        lastDim(storage.getNumDimensions() - 1),
+        policy(policy) {
+    for (size_t d = 0; d < lastDim; ++d) {
+      permutedIndex[d] = this->policy.value(d, 0);
+    }
+  }
+
+  virtual ~HashStorageGuidedIterator() {}
+
+  /**
+   * @return Returns the difference of the greatest dimension and the lowest updated dimension,
+   * i. e. the lowest dimension where the corresponding multi-index changed.
+   * Returns -1 if the next entry is invalid.
+   */
+  virtual int moveToNext() {
+    int h = iterator.moveToNext();
+
+    if (h == 0) {
+      policy.moveToNext(lastDim);
+      return 0;
+    } else if (h < 0) {
+      return h;
+    }
+
+    policy.reset(lastDim);
+
+    size_t d = lastDim - h;
+    permutedIndex[d] = policy.moveAndGetValue(d, iterator.indexAt(d));
+
+    for (size_t dim = d + 1; dim < lastDim; ++dim) {
+      permutedIndex[dim] = policy.resetAndGetValue(dim, 0);
+    }
+
+    return h;
+  }
+
+  virtual T &value() {
+    updateLowestIndex();
+    return storage.get(permutedIndex);
+  }
+
+  virtual void setValue(T const &input) {
+    updateLowestIndex();
+    storage.set(permutedIndex, input);
+  }
+
+  virtual bool isValid() { return iterator.isValid(); }
+
+  virtual size_t indexAt(size_t d) const { return iterator.indexAt(d); }
+
+  virtual MultiIndex getMultiIndex() const { return iterator.getMultiIndex(); }
+
+  virtual bool computationRequested() {
+    updateLowestIndex();
+    size_t entry = storage.findEntry(permutedIndex);
+    return entry != HashStorage<T>::npos &&
+           storage.statusAt(entry) >= StorageStatus::REQUESTED;
+  }
+
+  virtual std::function<T()> requestComputationTask() {
+    updateLowestIndex();
+    size_t entry = storage.findOrInsertEntry(permutedIndex);
+    storage.setStatusAt(entry, StorageStatus::REQUESTED);
+
+    auto myStorage = &storage;
+    auto myPermutedIndex = permutedIndex;
+    return [myStorage, myPermutedIndex]() { return myStorage->getFunc()(myPermutedIndex); };
+  }
+};
+
+} /* namespace combigrid */
+} /* namespace sgpp*/
+
+#endif /* COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_HASH_HASHSTORAGEGUIDEDITERATOR_HPP_ */
@@ -0,0 +1,116 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_HASH_HASHSTORAGESTOREDDATAITERATOR_HPP_
+#define COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_HASH_HASHSTORAGESTOREDDATAITERATOR_HPP_
+
+#include <sgpp/combigrid/storage/AbstractMultiStorageIterator.hpp>
+#include <sgpp/combigrid/storage/tree/AbstractTreeStorageNode.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace sgpp {
+namespace combigrid {
+
+template <typename T>
+class HashStorage;
+
+/**
+ * Iterator for the HashStorage class that only traverses entries stored in the storage.
+ * As for TreeStorageStoredDataIterator, the entries are traversed in lexicographical order
+ * (lexicographically ascending multi-indices), so both storages can be used interchangeably.
+ * The order is determined once at construction; entries inserted afterwards are not visited.
+ * The class is final and can be constructed directly on the stack to avoid the shared_ptr
+ * allocation and the virtual calls of HashStorage::getStoredDataIterator().
+ * For a detailed method description, see AbstractMultiStorageIterator.
+ */
+template <typename T>
+class HashStorageStoredDataIterator final : public AbstractMultiStorageIterator<T> {
+  HashStorage<T> &storage;
+  size_t numDimensions;
+
+  // entry numbers of all stored entries, sorted lexicographically by their multi-index
+  std::vector<size_t> entries;
+  size_t position;
+
+ public:
+  explicit HashStorageStoredDataIterator(HashStorage<T> &storage)
+      : storage(storage), numDimensions(storage.getNumDimensions()), entries(), position(0) {
+    size_t numEntries = storage.getNumAllocatedEntries();
+    entries.reserve(storage.getNumStoredEntries());
+
+    for (size_t entry = 0; entry < numEntries; ++entry) {
+      if (storage.statusAt(entry) == StorageStatus::STORED) {
+        entries.push_back(entry);
+      }
+    }
+
+    size_t n = numDimensions;
+    std::sort(entries.begin(), entries.end(), [&storage, n](size_t a, size_t b) {
+      uint32_t const *keyA = storage.keyAt(a);
+      uint32_t const *keyB = storage.keyAt(b);
+      return std::lexicographical_compare(keyA, keyA + n, keyB, keyB + n);
+    });
+  }
+
+  virtual ~HashStorageStoredDataIterator() {}
+
+  /**
+   * @return Returns the difference of the greatest dimension and the lowest updated dimension,
+   * i. e. the lowest dimension where the corresponding multi-index changed.
+   * Returns -1 if the next entry is invalid.
+   */
+  virtual int moveToNext() {
+    ++position;
+
+    if (position >= entries.size()) {
+      return -1;
+    }
+
+    uint32_t const *previous = storage.keyAt(entries[position - 1]);
+    uint32_t const *current = storage.keyAt(entries[position]);
+    size_t d = 0;
+
+    while (d + 1 < numDimensions && previous[d] == current[d]) {
+      ++d;
+    }
+
+    return static_cast<int>(numDimensions - 1 - d);
+  }
+
+  virtual T &value() { return storage.valueAt(entries[position]); }
+
+  virtual void setValue(T const &input) { storage.setValueAt(entries[position], input); }
+
+  virtual bool isValid() { return position < entries.size(); }
+
+  virtual size_t indexAt(size_t d) const { return storage.indexAt(entries[position], d); }
+
+  virtual MultiIndex getMultiIndex() const {
+    uint32_t const *key = storage.keyAt(entries[position]);
+    return MultiIndex(key, key + numDimensions);
+  }
+
+  /**
+   * Returns true because the iterator only iterates over already stored data.
+   */
+  virtual bool computationRequested() { return true; }
+
+  /**
+   * Returns a dummy function because the values pointed to are already stored.
+   */
+  virtual std::function<T()> requestComputationTask() {
+    return []() { return T(); };  // no computation necessary
+  }
+};
+
+} /* namespace combigrid */
+} /* namespace sgpp*/
+
+#endif /* COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_HASH_HASHSTORAGESTOREDDATAITERATOR_HPP_ */
@@ -7,6 +7,7 @@
 
 #include <sgpp/combigrid/serialization/FloatSerializationStrategy.hpp>
 #include <sgpp/combigrid/serialization/TreeStorageSerializationStrategy.hpp>
+#include <sgpp/combigrid/storage/hash/HashStorage.hpp>
 #include <sgpp/combigrid/threading/PtrGuard.hpp>
 
 #include <iostream>
@@ -21,17 +22,53 @@ class CombigridTreeStorageImpl {
  public:
   CombigridTreeStorageImpl(
       std::vector<std::shared_ptr<AbstractPointHierarchy>> const &p_pointHierarchies,
-      MultiFunction p_func, bool exploitNesting)
+      MultiFunction p_func, bool exploitNesting, MultiStorageType storageType)
       : func(p_func),
         pointHierarchies(p_pointHierarchies),
         mutexPtr(nullptr),
-        exploitNesting(exploitNesting) {
-    storage = std::make_shared<TreeStorage<std::shared_ptr<TreeStorage<double>>>>(
-        p_pointHierarchies.size(),
-        [](MultiIndex const &level) { return std::shared_ptr<TreeStorage<double>>(nullptr); });
+        exploitNesting(exploitNesting),
+        storageType(storageType) {
+    storage = std::make_shared<TreeStorage<std::shared_ptr<AbstractMultiStorage<double>>>>(
+        p_pointHierarchies.size(), [](MultiIndex const &level) {
+          return std::shared_ptr<AbstractMultiStorage<double>>(nullptr);
+        });
     setFunctions();
   }
 
+  /**
+   * Creates an (inner) storage for the function values of a level according to storageType.
+   */
+  std::shared_ptr<AbstractMultiStorage<double>> createStorage(
+      size_t numDimensions,
+      std::function<double(MultiIndex const &)> storageFunc = multiIndexToDefaultValue<double>()) {
+    if (storageType == MultiStorageType::HASH) {
+      return std::make_shared<HashStorage<double>>(numDimensions, storageFunc);
+    }
+
+    return std::make_shared<TreeStorage<double>>(numDimensions, storageFunc);
+  }
+
+  /**
+   * @return Returns a serialization strategy for the outer storage that creates inner storages
+   * according to storageType.
+   */
+  TreeStorageSerializationStrategy<std::shared_ptr<AbstractMultiStorage<double>>>
+  getSerializationStrategy() {
+    typedef AbstractMultiStorage<double> InnerStorage;
+    typedef TreeStorageSerializationStrategy<double, InnerStorage> InnerStrategy;
+
+    std::shared_ptr<AbstractSerializationStrategy<double>> floatSerializationStrategy =
+        std::make_shared<FloatSerializationStrategy<double>>();
+
+    std::shared_ptr<AbstractSerializationStrategy<std::shared_ptr<InnerStorage>>>
+        innerSerializationStrategy = std::make_shared<InnerStrategy>(
+            pointHierarchies.size(), floatSerializationStrategy,
+            [this](size_t numDimensions) { return createStorage(numDimensions); });
+
+    return TreeStorageSerializationStrategy<std::shared_ptr<InnerStorage>>(
+        pointHierarchies.size(), innerSerializationStrategy);
+  }
+
   /**
    * Sets the computation functions for the storage and the storages it contains
    */
@@ -54,10 +91,10 @@ class CombigridTreeStorageImpl {
     auto outerLambda = [innerLambda, this](MultiIndex const &level) {
       // capture level by copy because the reference might not be valid anymore at the time the
       // lambda is called
-      return std::make_shared<TreeStorage<double>>(
-          pointHierarchies.size(), [innerLambda, level, this](MultiIndex const &index) -> double {
-            return innerLambda(index, level);
-          });
+      return createStorage(pointHierarchies.size(),
+                           [innerLambda, level, this](MultiIndex const &index) -> double {
+                             return innerLambda(index, level);
+                           });
     };
 
     storage->setFunc(outerLambda);
@@ -72,21 +109,24 @@ class CombigridTreeStorageImpl {
 
   std::function<double(base::DataVector const &)> func;
   std::vector<std::shared_ptr<AbstractPointHierarchy>> pointHierarchies;
-  std::shared_ptr<TreeStorage<std::shared_ptr<TreeStorage<double>>>> storage;
+  std::shared_ptr<TreeStorage<std::shared_ptr<AbstractMultiStorage<double>>>> storage;
   std::shared_ptr<std::recursive_mutex> mutexPtr;
   bool exploitNesting;
+  MultiStorageType storageType;
 };
 
 CombigridTreeStorage::CombigridTreeStorage(
     std::vector<std::shared_ptr<AbstractPointHierarchy>> const &p_pointHierarchies,
     MultiFunction p_func) {
-  impl = std::make_unique<CombigridTreeStorageImpl>(p_pointHierarchies, p_func, true);
+  impl = std::make_unique<CombigridTreeStorageImpl>(p_pointHierarchies, p_func, true,
+                                                    MultiStorageType::TREE);
 }
 
 CombigridTreeStorage::CombigridTreeStorage(
     std::vector<std::shared_ptr<AbstractPointHierarchy>> const &p_pointHierarchies,
-    bool exploitNesting, MultiFunction p_func) {
-  impl = std::make_unique<CombigridTreeStorageImpl>(p_pointHierarchies, p_func, exploitNesting);
+    bool exploitNesting, MultiFunction p_func, MultiStorageType storageType) {
+  impl = std::make_unique<CombigridTreeStorageImpl>(p_pointHierarchies, p_func, exploitNesting,
+                                                    storageType);
 }
 
 CombigridTreeStorage::~CombigridTreeStorage() {}
@@ -112,7 +152,8 @@ std::shared_ptr<AbstractMultiStorageIterator<double>> CombigridTreeStorage::getG
   return impl->storage->get(reducedLevel)->getGuidedIterator(iterator, policy);
 }
 
-std::shared_ptr<TreeStorage<double>> CombigridTreeStorage::getStorage(const MultiIndex &level) {
+std::shared_ptr<AbstractMultiStorage<double>> CombigridTreeStorage::getStorage(
+    const MultiIndex &level) {
   // set level to zero for all nested hierarchies
   MultiIndex reducedLevel = level;
   size_t numDimensions = impl->pointHierarchies.size();
@@ -133,6 +174,14 @@ size_t CombigridTreeStorage::getNumEntries() {
   auto it = impl->storage->getStoredDataIterator();
 
   while (it->isValid()) {
+    auto hashStorage = std::dynamic_pointer_cast<HashStorage<double>>(it->value());
+
+    if (hashStorage) {
+      result += hashStorage->getNumStoredEntries();
+      it->moveToNext();
+      continue;
+    }
+
     auto innerIt = it->value()->getStoredDataIterator();
 
     while (innerIt->isValid()) {
@@ -147,31 +196,11 @@ size_t CombigridTreeStorage::getNumEntries() {
 }
 
 std::string CombigridTreeStorage::serialize() {
-  std::shared_ptr<AbstractSerializationStrategy<double>> floatSerializationStrategy =
-      std::make_shared<FloatSerializationStrategy<double>>();
-
-  std::shared_ptr<AbstractSerializationStrategy<std::shared_ptr<TreeStorage<double>>>>
-      innerSerializationStrategy = std::make_shared<TreeStorageSerializationStrategy<double>>(
-          impl->pointHierarchies.size(), floatSerializationStrategy);
-
-  TreeStorageSerializationStrategy<std::shared_ptr<TreeStorage<double>>> outerSerializationStrategy(
-      impl->pointHierarchies.size(), innerSerializationStrategy);
-
-  return outerSerializationStrategy.serialize(impl->storage);
+  return impl->getSerializationStrategy().serialize(impl->storage);
 }
 
 void CombigridTreeStorage::deserialize(const std::string &str) {
-  std::shared_ptr<AbstractSerializationStrategy<double>> floatSerializationStrategy =
-      std::make_shared<FloatSerializationStrategy<double>>();
-
-  std::shared_ptr<AbstractSerializationStrategy<std::shared_ptr<TreeStorage<double>>>>
-      innerSerializationStrategy = std::make_shared<TreeStorageSerializationStrategy<double>>(
-          impl->pointHierarchies.size(), floatSerializationStrategy);
-
-  TreeStorageSerializationStrategy<std::shared_ptr<TreeStorage<double>>> outerSerializationStrategy(
-      impl->pointHierarchies.size(), innerSerializationStrategy);
-
-  impl->storage = outerSerializationStrategy.deserialize(str);
+  impl->storage = impl->getSerializationStrategy().deserialize(str);
 
   impl->setFunctions();
 }
@@ -198,6 +227,8 @@ double CombigridTreeStorage::get(MultiIndex const &level, MultiIndex const &inde
   return impl->storage->get(reducedLevel)->get(index);
 }
 
+MultiStorageType CombigridTreeStorage::getStorageType() const { return impl->storageType; }
+
 void CombigridTreeStorage::setMutex(std::shared_ptr<std::recursive_mutex> mutexPtr) {
   impl->mutexPtr = mutexPtr;
 }
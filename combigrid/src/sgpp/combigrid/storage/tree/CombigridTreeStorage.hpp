@@ -11,6 +11,7 @@
 #include <sgpp/combigrid/definitions.hpp>
 #include <sgpp/combigrid/grid/hierarchy/AbstractPointHierarchy.hpp>
 #include <sgpp/combigrid/storage/AbstractCombigridStorage.hpp>
+#include <sgpp/combigrid/storage/AbstractMultiStorage.hpp>
 #include <sgpp/combigrid/storage/tree/TreeStorage.hpp>
 
 #include <memory>
@@ -25,6 +26,8 @@ class CombigridTreeStorageImpl;
 /**
  * Implementation of the AbstractCombigridStorage using TreeStorage<TreeStorage<float_t>>. For
  * further information, refer to AbstractCombigridStorage.
+ * The storages holding the function values of each level can alternatively be HashStorage objects,
+ * which need less memory for many function values in high dimensions (see MultiStorageType).
  */
 class CombigridTreeStorage : public AbstractCombigridStorage {
   std::unique_ptr<CombigridTreeStorageImpl> impl;
@@ -46,22 +49,30 @@ class CombigridTreeStorage : public AbstractCombigridStorage {
    * @param exploitNesting If this is set to true, identical grid points on different levels can
    * have different values. This is e.g. relevant for PDE solving.
    * @param p_func Function generating the values that are stored in the storage.
+   * @param storageType Storage class that holds the function values of each level.
    */
   CombigridTreeStorage(
       std::vector<std::shared_ptr<AbstractPointHierarchy>> const &p_pointHierarchies,
       bool exploitNesting = true,
-      MultiFunction p_func = MultiFunction(constantFunction<base::DataVector const &, double>()));
+      MultiFunction p_func = MultiFunction(constantFunction<base::DataVector const &, double>()),
+      MultiStorageType storageType = MultiStorageType::TREE);
   virtual ~CombigridTreeStorage();
 
   virtual std::shared_ptr<AbstractMultiStorageIterator<double>> getGuidedIterator(
       MultiIndex const &level, MultiIndexIterator &iterator,
       std::vector<bool> orderingConfiguration);
 
-  std::shared_ptr<TreeStorage<double>> getStorage(const MultiIndex &level);
+  std::shared_ptr<AbstractMultiStorage<double>> getStorage(const MultiIndex &level);
+
+  /**
+   * @return Returns the storage class that holds the function values of each level.
+   */
+  MultiStorageType getStorageType() const;
 
   /**
    * Returns the number of entries (all level-index pairs) in the storage, which indicates the
-   * number of function evaluations that have been done. Currently, this is an O(n) method.
+   * number of function evaluations that have been done. Currently, this is an O(n) method for
+   * MultiStorageType::TREE.
    */
   virtual size_t getNumEntries();
 
@@ -6,103 +6,184 @@
 #include <sgpp/combigrid/definitions.hpp>
 #include <sgpp/combigrid/threading/ThreadPool.hpp>
 
-#include <chrono>
+#include <algorithm>
+#include <utility>
 #include <vector>
 
 namespace sgpp {
 namespace combigrid {
 
+namespace {
+
+// pool and queue index of the current thread (nullptr if it doesn't belong to a pool)
+thread_local ThreadPool *currentPool = nullptr;
+thread_local size_t currentQueue = 0;
+
+}  // namespace
+
+const size_t ThreadPool::NUM_PRIORITIES;
+
 ThreadPool::IdleCallback ThreadPool::terminateWhenIdle((ThreadPool::doTerminateWhenIdle));
 
 ThreadPool::ThreadPool(size_t numThreads)
     : numThreads(numThreads),
       threads(),
-      tasks(),
-      poolMutex(),
+      queues(),
+      numQueuedTasks(0),
+      nextQueue(0),
+      idleMutex(),
       terminateFlag(false),
       useIdleCallback(false),
-      idleCallback() {}
+      idleCallback() {
+  for (size_t i = 0; i < std::max<size_t>(numThreads, 1); ++i) {
+    queues.push_back(std::unique_ptr<WorkerQueue>(new WorkerQueue()));
 
-ThreadPool::ThreadPool(size_t numThreads, IdleCallback idleCallback)
-    : numThreads(numThreads),
-      threads(),
-      tasks(),
-      poolMutex(),
-      terminateFlag(false),
-      useIdleCallback(true),
-      idleCallback(idleCallback) {}
+    for (size_t p = 0; p < NUM_PRIORITIES; ++p) {
+      queues.back()->sizes[p] = 0;
+    }
+  }
+}
+
+ThreadPool::ThreadPool(size_t numThreads, IdleCallback idleCallback) : ThreadPool(numThreads) {
+  this->useIdleCallback = true;
+  this->idleCallback = idleCallback;
+}
 
 ThreadPool::~ThreadPool() {
   triggerTermination();
   join();
 }
 
-void ThreadPool::addTask(const Task& task) {
-  CGLOG_SURROUND(std::lock_guard<std::recursive_mutex> guard(poolMutex));
-  tasks.push_back(task);
+size_t ThreadPool::getTargetQueue() {
+  if (currentPool == this) {
+    return currentQueue;
+  }
+
+  return nextQueue.fetch_add(1) % queues.size();
 }
 
-void ThreadPool::addTasks(const std::vector<Task>& newTasks) {
-  CGLOG_SURROUND(std::lock_guard<std::recursive_mutex> guard(poolMutex));
-  tasks.insert(tasks.end(), newTasks.begin(), newTasks.end());
+void ThreadPool::pushTasks(size_t queueIndex, Task const *first, Task const *last,
+                           Priority priority) {
+  const size_t p = static_cast<size_t>(priority);
+  WorkerQueue &queue = *queues[queueIndex];
+  // count the tasks first, so that idle threads don't terminate while they are added
+  numQueuedTasks += last - first;
+
+  CGLOG_SURROUND(std::lock_guard<std::mutex> guard(queue.mutex));
+  queue.tasks[p].insert(queue.tasks[p].end(), first, last);
+  queue.sizes[p] += last - first;
 }
 
-void ThreadPool::start() {
-  for (size_t i = 0; i < numThreads; ++i) {
-    threads.push_back(std::make_shared<std::thread>([this]() {
-      while (true) {
-        Task nextTask;
-
-        // wait for terminate or next task
-        while (true) {
-          {
-            CGLOG_SURROUND(std::lock_guard<std::recursive_mutex> guard(this->poolMutex));
-            if (this->terminateFlag) {
-              return;
-            }
-            if (!this->tasks.empty()) {
-              nextTask = tasks.front();
-              tasks.pop_front();
-              break;
-            } else if (!useIdleCallback) {
-              return;
-            }
-            CGLOG("leave outer guard(this->poolMutex)");
-          }
-
-          // no tasks, so acquire tasks
-
-          if (useIdleCallback) {
-            CGLOG_SURROUND(std::lock_guard<std::recursive_mutex> idleLock(idleMutex));
-
-            {
-              CGLOG_SURROUND(std::lock_guard<std::recursive_mutex> guard(this->poolMutex));
-              if (this->terminateFlag || !this->tasks.empty()) {
-                CGLOG("leave inner guard(this->poolMutex)");
-                continue;
-              }
-              CGLOG("leave inner guard(this->poolMutex)");
-            }
-
-            idleCallback(*this);
-            CGLOG("leave idleLock(idleMutex)");
-          } else {
-            std::this_thread::sleep_for(std::chrono::milliseconds(5));
-          }
-        }
-
-        // execute next task
-        nextTask();
+bool ThreadPool::tryPopTask(size_t queueIndex, Task &task) {
+  for (size_t p = NUM_PRIORITIES; p-- > 0;) {
+    // own queue first, then steal from the others
+    for (size_t k = 0; k < queues.size(); ++k) {
+      WorkerQueue &queue = *queues[(queueIndex + k) % queues.size()];
+
+      if (queue.sizes[p] == 0) {
+        continue;
       }
-    }));
+
+      CGLOG_SURROUND(std::lock_guard<std::mutex> guard(queue.mutex));
+
+      if (!queue.tasks[p].empty()) {
+        task = std::move(queue.tasks[p].front());
+        queue.tasks[p].pop_front();
+        --queue.sizes[p];
+        --numQueuedTasks;
+        return true;
+      }
+    }
   }
+
+  return false;
 }
 
-void ThreadPool::triggerTermination() {
-  CGLOG_SURROUND(std::lock_guard<std::recursive_mutex> guard(poolMutex));
-  terminateFlag = true;
+void ThreadPool::addTask(const Task &task) { addTask(task, Priority::NORMAL); }
+
+void ThreadPool::addTask(const Task &task, Priority priority) {
+  pushTasks(getTargetQueue(), &task, &task + 1, priority);
+}
+
+void ThreadPool::addTasks(const std::vector<Task> &newTasks) {
+  addTasks(newTasks, Priority::NORMAL);
+}
+
+void ThreadPool::addTasks(const std::vector<Task> &newTasks, Priority priority) {
+  if (newTasks.empty()) {
+    return;
+  }
+
+  if (currentPool == this) {
+    // the other threads will steal from this queue if they are idle
+    pushTasks(currentQueue, newTasks.data(), newTasks.data() + newTasks.size(), priority);
+    return;
+  }
+
+  // distribute the tasks evenly
+  const size_t numQueues = std::min(queues.size(), newTasks.size());
+  const size_t firstQueue = nextQueue.fetch_add(numQueues);
+
+  for (size_t k = 0; k < numQueues; ++k) {
+    const size_t begin = newTasks.size() * k / numQueues;
+    const size_t end = newTasks.size() * (k + 1) / numQueues;
+    pushTasks((firstQueue + k) % queues.size(), newTasks.data() + begin, newTasks.data() + end,
+              priority);
+  }
 }
 
+void ThreadPool::run(size_t queueIndex) {
+  currentPool = this;
+  currentQueue = queueIndex;
+
+  while (true) {
+    Task nextTask;
+
+    // wait for terminate or next task
+    while (true) {
+      if (terminateFlag) {
+        return;
+      }
+
+      if (tryPopTask(queueIndex, nextTask)) {
+        break;
+      }
+
+      if (numQueuedTasks > 0) {
+        // another thread is adding tasks
+        std::this_thread::yield();
+        continue;
+      }
+
+      if (!useIdleCallback) {
+        return;
+      }
+
+      // no tasks, so acquire tasks
+      CGLOG_SURROUND(std::lock_guard<std::mutex> idleLock(idleMutex));
+
+      if (terminateFlag || (numQueuedTasks > 0)) {
+        CGLOG("leave idleLock(idleMutex)");
+        continue;
+      }
+
+      idleCallback(*this);
+      CGLOG("leave idleLock(idleMutex)");
+    }
+
+    // execute next task
+    nextTask();
+  }
+}
+
+void ThreadPool::start() {
+  for (size_t i = 0; i < numThreads; ++i) {
+    threads.push_back(std::make_shared<std::thread>([this, i]() { this->run(i); }));
+  }
+}
+
+void ThreadPool::triggerTermination() { terminateFlag = true; }
+
 void ThreadPool::join() {
   for (auto thread_ptr : threads) {
     thread_ptr->join();
@@ -111,8 +192,49 @@ void ThreadPool::join() {
   threads.clear();
 }
 
+size_t ThreadPool::getNumThreads() const { return numThreads; }
+
 // static
-void ThreadPool::doTerminateWhenIdle(ThreadPool& tp) { tp.triggerTermination(); }
+void ThreadPool::doTerminateWhenIdle(ThreadPool &tp) { tp.triggerTermination(); }
+
+// static
+void ThreadPool::parallelFor(size_t numThreads, size_t begin, size_t end,
+                             std::function<void(size_t)> const &body, size_t grainSize) {
+  if (end <= begin) {
+    return;
+  }
+
+  const size_t n = end - begin;
+
+  if (grainSize == 0) {
+    // a few chunks per thread, so that work stealing can balance the load
+    grainSize = std::max<size_t>(1, n / (8 * std::max<size_t>(numThreads, 1)));
+  }
+
+  if ((numThreads <= 1) || (n <= grainSize)) {
+    for (size_t i = begin; i < end; ++i) {
+      body(i);
+    }
+
+    return;
+  }
+
+  std::vector<Task> tasks;
+
+  for (size_t chunkBegin = begin; chunkBegin < end; chunkBegin += grainSize) {
+    const size_t chunkEnd = std::min(end, chunkBegin + grainSize);
+    tasks.push_back(Task([&body, chunkBegin, chunkEnd]() {
+      for (size_t i = chunkBegin; i < chunkEnd; ++i) {
+        body(i);
+      }
+    }));
+  }
+
+  ThreadPool pool(std::min(numThreads, tasks.size()));
+  pool.addTasks(tasks);
+  pool.start();
+  pool.join();
+}
 
 } /* namespace combigrid */
 } /* namespace sgpp*/
@@ -9,6 +9,7 @@
 #include <sgpp/combigrid/GeneralFunction.hpp>
 #include <sgpp/globaldef.hpp>
 
+#include <atomic>
 #include <deque>
 #include <functional>
 #include <memory>
@@ -22,6 +23,11 @@ namespace combigrid {
 /**
  * This implements a thread-pool with a pre-specified number of threads that process a list of
  * tasks.
+ *
+ * Each thread owns a task queue for each priority. Tasks added by a thread of the pool are put into
+ * its own queue, tasks added from outside are distributed round-robin. A thread without tasks
+ * steals tasks from the other queues, so the queues are only contended when the load is
+ * unbalanced. High-priority tasks of all queues are processed before normal tasks.
  */
 class ThreadPool {
  public:
@@ -30,16 +36,56 @@ class ThreadPool {
   typedef GeneralFunction1<void> Task;
   typedef GeneralFunction<void, ThreadPool &> IdleCallback;
 
+  /**
+   * Priority of a task
+   */
+  enum class Priority { NORMAL = 0, HIGH = 1 };
+
  private:
+  static const size_t NUM_PRIORITIES = 2;
+
+  /**
+   * Task queues of a single thread (one per priority).
+   */
+  struct WorkerQueue {
+    std::mutex mutex;
+    std::deque<Task> tasks[NUM_PRIORITIES];
+    // number of tasks per priority, allows skipping empty queues without locking
+    std::atomic<size_t> sizes[NUM_PRIORITIES];
+  };
+
   size_t numThreads;
   std::vector<std::shared_ptr<std::thread>> threads;
-  std::deque<Task> tasks;
-  std::recursive_mutex poolMutex;
-  std::recursive_mutex idleMutex;
-  bool terminateFlag;
+  std::vector<std::unique_ptr<WorkerQueue>> queues;
+  std::atomic<size_t> numQueuedTasks;
+  std::atomic<size_t> nextQueue;
+  std::mutex idleMutex;
+  std::atomic<bool> terminateFlag;
   bool useIdleCallback;
   IdleCallback idleCallback;
 
+  /**
+   * @return index of the queue new tasks of the calling thread are added to
+   */
+  size_t getTargetQueue();
+
+  /**
+   * Adds tasks to a queue.
+   */
+  void pushTasks(size_t queueIndex, Task const *first, Task const *last, Priority priority);
+
+  /**
+   * Takes the next task, preferring the queue with the given index.
+   *
+   * @return whether a task was found
+   */
+  bool tryPopTask(size_t queueIndex, Task &task);
+
+  /**
+   * Main loop of the threads.
+   */
+  void run(size_t queueIndex);
+
  public:
   /**
    * Creates a ThreadPool that processes available tasks. When no more tasks are available, the
@@ -63,11 +109,21 @@ class ThreadPool {
    */
   void addTask(Task const &task);
 
+  /**
+   * Adds a single task with the given priority to the task list (thread-safe).
+   */
+  void addTask(Task const &task, Priority priority);
+
   /**
    * Adds a list of tasks to the task list (thread-safe).
    */
   void addTasks(std::vector<Task> const &newTasks);
 
+  /**
+   * Adds a list of tasks with the given priority to the task list (thread-safe).
+   */
+  void addTasks(std::vector<Task> const &newTasks, Priority priority);
+
   /**
    * Starts the threads.
    */
@@ -84,6 +140,11 @@ class ThreadPool {
    */
   void join();
 
+  /**
+   * @return number of threads
+   */
+  size_t getNumThreads() const;
+
   static void doTerminateWhenIdle(ThreadPool &tp);
 
   /**
@@ -91,6 +152,19 @@ class ThreadPool {
    * soon as there are no tasks left.
    */
   static IdleCallback terminateWhenIdle;
+
+  /**
+   * Calls body(i) for all i in [begin, end) using numThreads threads. The range is split into
+   * chunks of grainSize indices, which are balanced between the threads by work stealing.
+   *
+   * @param numThreads number of threads (the loop is executed serially if this is at most 1)
+   * @param begin first index
+   * @param end end of the index range
+   * @param body loop body, has to be thread-safe
+   * @param grainSize number of indices per task, 0 for an automatic choice
+   */
+  static void parallelFor(size_t numThreads, size_t begin, size_t end,
+                          std::function<void(size_t)> const &body, size_t grainSize = 0);
 };
 
 } /* namespace combigrid */
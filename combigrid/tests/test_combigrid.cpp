@@ -313,4 +313,58 @@ BOOST_AUTO_TEST_CASE(testBsplinedeg3Interpolation) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(testBatchEvaluation) {
+  const size_t d = 3;
+  const size_t q = 4;
+  const size_t numPoints = 300;
+  auto func = MultiFunction(testFunction3);
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  sgpp::base::DataMatrix params(d, numPoints);
+
+  for (size_t i = 0; i < d; ++i) {
+    for (size_t j = 0; j < numPoints; ++j) {
+      params(i, j) = distribution(generator);
+    }
+  }
+
+  std::vector<std::shared_ptr<CombigridMultiOperation>> operations = {
+      CombigridMultiOperation::createExpUniformBoundaryLinearInterpolation(d, func),
+      CombigridMultiOperation::createExpClenshawCurtisPolynomialInterpolation(d, func),
+      CombigridMultiOperation::createExpUniformBoundaryBsplineInterpolation(d, func, 3)};
+
+  for (auto &operation : operations) {
+    DataVector expected = operation->evaluate(q, params);
+    DataVector result = operation->evaluate(params);
+    BOOST_REQUIRE_EQUAL(result.getSize(), numPoints);
+
+    for (size_t j = 0; j < numPoints; ++j) {
+      BOOST_CHECK_SMALL(result[j] - expected[j], 1e-12);
+    }
+  }
+
+  // quadrature does not need parameters
+  auto quadrature = CombigridMultiOperation::createExpClenshawCurtisQuadrature(d, func);
+  double integral = quadrature->evaluate(q)[0];
+  DataVector result = quadrature->evaluate(sgpp::base::DataMatrix(0, 5));
+
+  for (size_t j = 0; j < result.getSize(); ++j) {
+    BOOST_CHECK_SMALL(result[j] - integral, 1e-12);
+  }
+
+  // single evaluation
+  auto operation =
+      sgpp::combigrid::CombigridOperation::createExpClenshawCurtisPolynomialInterpolation(d, func);
+  operation->getLevelManager()->addRegularLevels(q);
+  result = operation->evaluate(params);
+
+  for (size_t j = 0; j < numPoints; ++j) {
+    DataVector x(d);
+    params.getColumn(j, x);
+    operation->setParameters(x);
+    operation->getLevelManager()->addRegularLevels(q);
+    BOOST_CHECK_SMALL(result[j] - operation->getResult(), 1e-12);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
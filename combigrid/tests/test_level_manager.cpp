@@ -142,6 +142,81 @@ BOOST_AUTO_TEST_CASE(testLevelManagerParallel) {
   //           << "\n";
 }
 
+BOOST_AUTO_TEST_CASE(testLevelManagerAdaptiveParallelStats) {
+  size_t numDimensions = 3;
+  auto func = testFunction2;
+  DataVector x(std::vector<double>{0.378934, 0.89340273, 0.1234});
+
+  auto createLevelManager = [&](std::shared_ptr<CombigridEvaluator<FloatScalarVector>>
+                                    &combiGridEval) {
+    std::vector<std::shared_ptr<AbstractPointHierarchy>> pointHierarchies(
+        numDimensions, std::make_shared<NestedPointHierarchy>(
+                           std::make_shared<LejaPointDistribution>(),
+                           std::make_shared<IdentityPointOrdering>(
+                               std::make_shared<LinearGrowthStrategy>(2), false)));
+    std::vector<std::shared_ptr<AbstractLinearEvaluator<FloatScalarVector>>> evaluators(
+        numDimensions, std::make_shared<PolynomialInterpolationEvaluator>());
+    auto storage = std::make_shared<CombigridTreeStorage>(pointHierarchies, MultiFunction(func));
+    auto fullGridEval =
+        std::make_shared<sgpp::combigrid::FullGridCallbackEvaluator<FloatScalarVector>>(
+            storage, evaluators, pointHierarchies);
+    combiGridEval =
+        std::make_shared<CombigridEvaluator<FloatScalarVector>>(numDimensions, fullGridEval);
+    std::vector<FloatScalarVector> parameters(numDimensions);
+
+    for (size_t d = 0; d < numDimensions; ++d) {
+      parameters[d] = FloatScalarVector(x[d]);
+    }
+
+    fullGridEval->setParameters(parameters);
+    return std::make_shared<AveragingLevelManager>(combiGridEval);
+  };
+
+  auto countLevels = [](CombigridEvaluator<FloatScalarVector> &combiGridEval) {
+    size_t numLevels = 0;
+    auto levelStructure = combiGridEval.getLevelStructure();
+
+    for (auto it = levelStructure->getStoredDataIterator(); it->isValid(); it->moveToNext()) {
+      ++numLevels;
+    }
+
+    return numLevels;
+  };
+
+  std::shared_ptr<CombigridEvaluator<FloatScalarVector>> sequentialEval;
+  auto sequentialManager = createLevelManager(sequentialEval);
+  sequentialManager->addLevelsAdaptive(500);
+
+  for (size_t numThreads : std::vector<size_t>{1, 4}) {
+    std::shared_ptr<CombigridEvaluator<FloatScalarVector>> combiGridEval;
+    auto levelManager = createLevelManager(combiGridEval);
+    levelManager->addLevelsAdaptiveParallel(500, numThreads);
+
+    // all started levels have been committed
+    auto stats = levelManager->getParallelRefinementStats();
+    BOOST_CHECK_EQUAL(stats.numLevelsCommitted, stats.numLevelsStarted);
+    BOOST_CHECK_GE(stats.numCommitBatches, 1);
+    BOOST_CHECK_LE(stats.numCommitBatches, stats.numLevelsCommitted);
+    BOOST_CHECK_GT(stats.numTasks, 0);
+    BOOST_CHECK_GE(stats.elapsedSeconds, 0.0);
+    BOOST_CHECK_GE(stats.busySeconds, 0.0);
+    BOOST_CHECK_EQUAL(countLevels(*combiGridEval), stats.numLevelsCommitted);
+
+    BOOST_CHECK_LE(levelManager->getUpperPointBound(), 500);
+
+    if (numThreads == 1) {
+      // with one thread, every level is committed before the next one is started, so the levels
+      // are the same as in the sequential refinement (with more threads, several levels are taken
+      // from the queue before the successors of the levels in flight are known)
+      BOOST_CHECK_EQUAL(countLevels(*combiGridEval), countLevels(*sequentialEval));
+      BOOST_CHECK_EQUAL(levelManager->getUpperPointBound(),
+                        sequentialManager->getUpperPointBound());
+    }
+
+    BOOST_CHECK_SMALL(combiGridEval->getValue().getValue() - func(x), 1e-4);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(testLevelManagerAdaptive) {
   size_t numDims = 6;
   sgpp::combigrid::Genz model;
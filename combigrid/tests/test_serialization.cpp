@@ -15,10 +15,16 @@
 #include <sgpp/combigrid/storage/tree/TreeStorage.hpp>
 #include <sgpp/globaldef.hpp>
 
+#include <atomic>
+#include <chrono>
 #include <cmath>
+#include <cstdio>
+#include <fstream>
 #include <iostream>
 #include <limits>
+#include <stdexcept>
 #include <string>
+#include <thread>
 #include <vector>
 
 using sgpp::combigrid::FloatSerializationStrategy;
@@ -31,6 +37,7 @@ using sgpp::combigrid::ExponentialLevelorderPointOrdering;
 using sgpp::combigrid::MultiIndexIterator;
 using sgpp::combigrid::MultiIndex;
 using sgpp::combigrid::CombigridTreeStorage;
+using sgpp::combigrid::MultiStorageType;
 
 double testFunc1(sgpp::base::DataVector const &x) { return std::sqrt(x[0]) * std::exp(x[1]); }
 
@@ -92,6 +99,99 @@ BOOST_AUTO_TEST_CASE(testFunctionLookupTableSerialization) {
   BOOST_CHECK_EQUAL(func(vec), table2(vec));
 }
 
+BOOST_AUTO_TEST_CASE(testFunctionLookupTableStore) {
+  const std::string filename = "test_FunctionLookupTable.store";
+  std::remove(filename.c_str());
+  auto func = testFunc1;
+
+  {
+    FunctionLookupTable table((MultiFunction(func)));
+    table.openStore(filename);
+    sgpp::base::DataVector vec(2);
+
+    for (size_t i = 0; i < 10; ++i) {
+      vec[0] = static_cast<double>(i) / 3.0;
+      vec[1] = 1.0;
+      BOOST_CHECK_EQUAL(func(vec), table.evalThreadsafe(vec));
+    }
+
+    vec[0] = 0.5;
+    table.addEntry(vec, 42.0);
+  }
+
+  // simulate a crash while writing a record
+  {
+    std::ofstream file(filename, std::ios::binary | std::ios::app);
+    file.write("\x02\0\0", 3);
+  }
+
+  // the values are restored without evaluating the function
+  FunctionLookupTable table2(MultiFunction([](sgpp::base::DataVector const &x) { return -1.0; }));
+  table2.openStore(filename);
+  BOOST_CHECK_EQUAL(table2.getNumEntries(), 11);
+  sgpp::base::DataVector vec(2);
+
+  for (size_t i = 0; i < 10; ++i) {
+    vec[0] = static_cast<double>(i) / 3.0;
+    vec[1] = 1.0;
+    BOOST_CHECK_EQUAL(func(vec), table2(vec));
+  }
+
+  vec[0] = 0.5;
+  BOOST_CHECK_EQUAL(table2(vec), 42.0);
+
+  // new values are appended after the discarded record
+  vec[0] = 7.0;
+  table2(vec);
+  table2.closeStore();
+
+  FunctionLookupTable table3(MultiFunction([](sgpp::base::DataVector const &x) { return 0.0; }));
+  table3.openStore(filename);
+  BOOST_CHECK_EQUAL(table3.getNumEntries(), 12);
+  BOOST_CHECK_EQUAL(table3(vec), -1.0);
+  table3.closeStore();
+
+  // not a store
+  {
+    std::ofstream file(filename);
+    file << table3.serialize();
+  }
+
+  FunctionLookupTable table4((MultiFunction(func)));
+  BOOST_CHECK_THROW(table4.openStore(filename), std::runtime_error);
+  std::remove(filename.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(testFunctionLookupTableConcurrent) {
+  std::atomic<size_t> numEvaluations(0);
+  FunctionLookupTable table(MultiFunction([&numEvaluations](sgpp::base::DataVector const &x) {
+    ++numEvaluations;
+    std::this_thread::sleep_for(std::chrono::microseconds(200));
+    return testFunc1(x);
+  }));
+
+  std::vector<std::thread> threads;
+
+  for (size_t t = 0; t < 4; ++t) {
+    threads.push_back(std::thread([&table]() {
+      sgpp::base::DataVector vec(2, 1.0);
+
+      for (size_t i = 0; i < 50; ++i) {
+        vec[0] = static_cast<double>(i);
+        BOOST_CHECK_EQUAL(table.evalThreadsafe(vec), testFunc1(vec));
+      }
+    }));
+  }
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  // each point has been evaluated exactly once
+  BOOST_CHECK_EQUAL(numEvaluations, 50);
+  BOOST_CHECK_EQUAL(table.getNumEntries(), 50);
+}
+
 BOOST_AUTO_TEST_CASE(testCombigridTreeStorageSerialization) {
   std::vector<std::shared_ptr<AbstractPointHierarchy>> hierarchies(
       2, std::make_shared<NonNestedPointHierarchy>(
@@ -140,3 +240,46 @@ BOOST_AUTO_TEST_CASE(testCombigridTreeStorageSerialization) {
     std::cout << "\n";  // prevent optimizing away
   }
 }
+
+BOOST_AUTO_TEST_CASE(testCombigridHashStorageSerialization) {
+  std::vector<std::shared_ptr<AbstractPointHierarchy>> hierarchies(
+      2, std::make_shared<NonNestedPointHierarchy>(
+             std::make_shared<ClenshawCurtisDistribution>(),
+             std::make_shared<ExponentialLevelorderPointOrdering>()));
+
+  MultiFunction testFunc1Multi(testFunc1);
+  CombigridTreeStorage treeStorage(hierarchies, true, testFunc1Multi, MultiStorageType::TREE);
+  CombigridTreeStorage hashStorage(hierarchies, true, testFunc1Multi, MultiStorageType::HASH);
+  BOOST_CHECK(hashStorage.getStorageType() == MultiStorageType::HASH);
+
+  MultiIndex bounds(2, 3);
+  std::vector<bool> orderingConfiguration(2, false);
+
+  for (auto const &level : std::vector<MultiIndex>{{1, 2}, {2, 1}, {2, 2}}) {
+    MultiIndexIterator treeMIt(bounds);
+    MultiIndexIterator hashMIt(bounds);
+    auto hashIt = hashStorage.getGuidedIterator(level, hashMIt, orderingConfiguration);
+
+    for (auto it = treeStorage.getGuidedIterator(level, treeMIt, orderingConfiguration);
+         it->isValid(); it->moveToNext(), hashIt->moveToNext()) {
+      BOOST_CHECK_EQUAL(it->value(), hashIt->value());
+    }
+  }
+
+  BOOST_CHECK_EQUAL(hashStorage.getNumEntries(), treeStorage.getNumEntries());
+
+  // both backends share the serialization format
+  std::string str = hashStorage.serialize();
+  BOOST_CHECK_EQUAL(str, treeStorage.serialize());
+
+  MultiFunction testFunc2Multi(testFunc2);
+  CombigridTreeStorage otherStorage(hierarchies, true, testFunc2Multi, MultiStorageType::HASH);
+  otherStorage.deserialize(str);
+
+  BOOST_CHECK_EQUAL(otherStorage.getNumEntries(), hashStorage.getNumEntries());
+  BOOST_CHECK_EQUAL(otherStorage.get(MultiIndex{2, 1}, MultiIndex{2, 1}),
+                    hashStorage.get(MultiIndex{2, 1}, MultiIndex{2, 1}));
+
+  // values that are not stored are computed with the function of the deserializing storage
+  BOOST_CHECK_EQUAL(otherStorage.get(MultiIndex{5, 0}, MultiIndex{0, 0}), -1.0);
+}
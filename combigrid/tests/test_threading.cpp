@@ -14,6 +14,7 @@
 #include <sgpp/globaldef.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <iostream>
 #include <memory>
@@ -83,3 +84,54 @@ BOOST_AUTO_TEST_CASE(testThreadingWithCallback) {
 
   checkCorrectness();
 }
+
+BOOST_AUTO_TEST_CASE(testThreadingPriorities) {
+  // with a single thread, all high-priority tasks have to be executed first
+  auto tp = std::make_shared<ThreadPool>(1);
+  data.clear();
+
+  for (int i = 0; i < 100; ++i) {
+    tp->addTask(ThreadPool::Task([i]() {
+                  std::lock_guard<std::recursive_mutex> guard(dataMutex);
+                  data.push_back(i);
+                }),
+                i < 50 ? ThreadPool::Priority::NORMAL : ThreadPool::Priority::HIGH);
+  }
+
+  tp->start();
+  tp->join();
+
+  BOOST_REQUIRE_EQUAL(data.size(), 100);
+
+  for (size_t i = 0; i < 50; ++i) {
+    BOOST_CHECK_GE(data[i], 50);
+    BOOST_CHECK_LT(data[i + 50], 50);
+  }
+
+  checkCorrectness();
+}
+
+BOOST_AUTO_TEST_CASE(testParallelFor) {
+  std::vector<size_t> visits(10000, 0);
+  ThreadPool::parallelFor(8, 0, visits.size(), [&visits](size_t i) { visits[i] += i; }, 7);
+
+  for (size_t i = 0; i < visits.size(); ++i) {
+    BOOST_CHECK_EQUAL(visits[i], i);
+  }
+
+  // nested tasks added from inside the pool are stolen by the other threads
+  std::atomic<size_t> sum(0);
+  auto tp = std::make_shared<ThreadPool>(4);
+  tp->addTask(ThreadPool::Task([&tp, &sum]() {
+    std::vector<ThreadPool::Task> tasks;
+
+    for (size_t i = 1; i <= 1000; ++i) {
+      tasks.push_back(ThreadPool::Task([&sum, i]() { sum += i; }));
+    }
+
+    tp->addTasks(tasks);
+  }));
+  tp->start();
+  tp->join();
+  BOOST_CHECK_EQUAL(sum, 500500);
+}
@@ -6,10 +6,13 @@
 #define BOOST_TEST_DYN_LINK
 #include <boost/test/unit_test.hpp>
 #include <sgpp/globaldef.hpp>
+#include <sgpp/combigrid/storage/hash/HashStorage.hpp>
 #include <sgpp/combigrid/storage/tree/TreeStorage.hpp>
 #include <sgpp/combigrid/common/MultiIndexIterator.hpp>
 #include <iostream>
 
+using sgpp::combigrid::HashStorage;
+using sgpp::combigrid::HashStorageStoredDataIterator;
 using sgpp::combigrid::TreeStorage;
 using sgpp::combigrid::MultiIndex;
 using sgpp::combigrid::MultiIndexIterator;
@@ -121,3 +124,143 @@ BOOST_AUTO_TEST_CASE(testTreeStorageGuidedIterator) {
   BOOST_CHECK_EQUAL(it->moveToNext(), -1);
   BOOST_CHECK_EQUAL(it->isValid(), false);
 }
+
+BOOST_AUTO_TEST_CASE(testHashStorageGetSet) {
+  HashStorage<int> storage(3, [](MultiIndex const &index) { return static_cast<int>(index[2]); });
+
+  MultiIndex index(3, 0);
+
+  BOOST_CHECK(!storage.containsIndex(index));
+
+  BOOST_CHECK_EQUAL(storage.get(index), 0);
+
+  BOOST_CHECK(storage.containsIndex(index));
+
+  storage.get(index) = 5;
+
+  BOOST_CHECK_EQUAL(storage.get(index), 5);
+
+  index[1] = 5;
+  index[2] = 5;
+
+  storage.set(index, 7);
+
+  BOOST_CHECK_EQUAL(storage.get(index), 7);
+
+  index[2] = 4;
+
+  // only the accessed entry is created
+  BOOST_CHECK(!storage.containsIndex(index));
+  BOOST_CHECK_EQUAL(storage.get(index), 4);
+  BOOST_CHECK_EQUAL(storage.getNumStoredEntries(), 3);
+
+  // enough entries to trigger several rehashes
+  MultiIndexIterator it(MultiIndex{20, 20, 20});
+
+  for (; it.isValid(); it.moveToNext()) {
+    storage.set(it.getMultiIndex(), static_cast<int>(it.indexAt(0) + 20 * it.indexAt(1)));
+  }
+
+  // the three entries from above lie inside the cube
+  BOOST_CHECK_EQUAL(storage.getNumStoredEntries(), 8000);
+
+  for (it.reset(); it.isValid(); it.moveToNext()) {
+    BOOST_CHECK_EQUAL(storage.get(it.getMultiIndex()),
+                      static_cast<int>(it.indexAt(0) + 20 * it.indexAt(1)));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testHashStorageDataIterator) {
+  HashStorage<int> storage(3);
+
+  MultiIndex index(3, 0);
+  index[0] = 2;
+  storage.set(index, 3);
+
+  index[0] = 0;
+  storage.set(index, 1);
+
+  index[2] = 2;
+  storage.set(index, 2);
+
+  // the iterator returned through the interface and the one on the stack visit the entries in the
+  // same (lexicographical) order as TreeStorageStoredDataIterator
+  auto it = storage.getStoredDataIterator();
+  HashStorageStoredDataIterator<int> stackIt(storage);
+
+  BOOST_CHECK(it->isValid());
+  BOOST_CHECK(stackIt.isValid());
+
+  BOOST_CHECK_EQUAL(it->indexAt(0), 0);
+  BOOST_CHECK_EQUAL(it->indexAt(1), 0);
+  BOOST_CHECK_EQUAL(it->indexAt(2), 0);
+
+  BOOST_CHECK_EQUAL(it->value(), 1);
+  BOOST_CHECK_EQUAL(stackIt.value(), 1);
+
+  BOOST_CHECK_EQUAL(it->moveToNext(), 0);
+  BOOST_CHECK_EQUAL(it->value(), 2);
+  BOOST_CHECK_EQUAL(stackIt.moveToNext(), 0);
+
+  BOOST_CHECK_EQUAL(it->moveToNext(), 2);
+  BOOST_CHECK_EQUAL(it->value(), 3);
+  BOOST_CHECK_EQUAL(stackIt.moveToNext(), 2);
+  BOOST_CHECK(stackIt.getMultiIndex() == MultiIndex({2, 0, 0}));
+
+  BOOST_CHECK_EQUAL(it->moveToNext(), -1);
+  BOOST_CHECK_EQUAL(stackIt.moveToNext(), -1);
+
+  BOOST_CHECK(!it->isValid());
+  BOOST_CHECK(!stackIt.isValid());
+}
+
+BOOST_AUTO_TEST_CASE(testHashStorageGuidedIterator) {
+  HashStorage<int> hashStorage(3);
+  TreeStorage<int> treeStorage(3);
+
+  MultiIndex index(3, 0);
+  hashStorage.set(index, 1);
+  treeStorage.set(index, 1);
+
+  index[2] = 2;
+  hashStorage.set(index, 2);
+  treeStorage.set(index, 2);
+
+  index[0] = 1;
+  index[2] = 1;
+  hashStorage.set(index, 3);
+  treeStorage.set(index, 3);
+
+  MultiIndex bounds(3, 2);
+  MultiIndexIterator hashMultiIter(bounds);
+  MultiIndexIterator treeMultiIter(bounds);
+
+  auto hashIt = hashStorage.getGuidedIterator(hashMultiIter);
+  auto treeIt = treeStorage.getGuidedIterator(treeMultiIter);
+
+  while (treeIt->isValid()) {
+    BOOST_CHECK(hashIt->isValid());
+    BOOST_CHECK(hashIt->getMultiIndex() == treeIt->getMultiIndex());
+    BOOST_CHECK_EQUAL(hashIt->value(), treeIt->value());
+    BOOST_CHECK_EQUAL(hashIt->moveToNext(), treeIt->moveToNext());
+  }
+
+  BOOST_CHECK(!hashIt->isValid());
+
+  // requesting a computation marks the entry, but does not store it
+  HashStorage<int> funcStorage(3, [](MultiIndex const &index) { return 42; });
+  MultiIndexIterator funcMultiIter(MultiIndex{1, 1, 3});
+  auto funcIt = funcStorage.getGuidedIterator(funcMultiIter);
+  funcIt->moveToNext();
+
+  BOOST_CHECK(!funcIt->computationRequested());
+  auto task = funcIt->requestComputationTask();
+  BOOST_CHECK(funcIt->computationRequested());
+  BOOST_CHECK(!funcStorage.containsIndex(MultiIndex({0, 0, 1})));
+  BOOST_CHECK_EQUAL(funcStorage.getNumStoredEntries(), 0);
+
+  funcIt->setValue(task());
+  BOOST_CHECK(funcStorage.containsIndex(MultiIndex({0, 0, 1})));
+  BOOST_CHECK_EQUAL(funcStorage.get(MultiIndex({0, 0, 1})), 42);
+  BOOST_CHECK_EQUAL(funcStorage.getNumStoredEntries(), 1);
+}
@@ -8,6 +8,7 @@
 %shared_ptr(sgpp::datadriven::DMSystemMatrix)
 %shared_ptr(sgpp::datadriven::DensitySystemMatrix)
 %shared_ptr(sgpp::datadriven::OperationRegularizationDiagonal)
+%shared_ptr(sgpp::datadriven::DBMatBinaryFile)
 
 %{
 #include <sgpp/solver/TypesSolver.hpp>
@@ -50,6 +51,9 @@
 %include "datadriven/src/sgpp/datadriven/algorithm/DBMatDMSDenseIChol.hpp"
 %include "datadriven/src/sgpp/datadriven/algorithm/DBMatDMSOrthoAdapt.hpp"
 %ignore *::operator=;
+%ignore sgpp::datadriven::DBMatBinaryFile::Section;
+%ignore sgpp::datadriven::DBMatBinaryFile::write;
+%include "datadriven/src/sgpp/datadriven/algorithm/DBMatBinaryFile.hpp"
 %include "datadriven/src/sgpp/datadriven/algorithm/DBMatOffline.hpp"
 %include "datadriven/src/sgpp/datadriven/algorithm/DBMatOfflineGE.hpp"
 %include "datadriven/src/sgpp/datadriven/algorithm/DBMatOfflineChol.hpp"
@@ -161,6 +165,7 @@
 %include "datadriven/src/sgpp/datadriven/datamining/modules/fitting/FitterConfigurationClassification.hpp"
 %include "datadriven/src/sgpp/datadriven/datamining/modules/fitting/FitterTypeParser.hpp"
 %include "datadriven/src/sgpp/datadriven/datamining/modules/fitting/ModelFittingBase.hpp"
+%newobject sgpp::datadriven::ModelFittingBase::cloneUntrained;
 %include "datadriven/src/sgpp/datadriven/datamining/modules/fitting/ModelFittingBaseSingleGrid.hpp"
 %include "datadriven/src/sgpp/datadriven/datamining/modules/fitting/ModelFittingLeastSquares.hpp"
 %include "datadriven/src/sgpp/datadriven/datamining/modules/fitting/ModelFittingClassification.hpp"
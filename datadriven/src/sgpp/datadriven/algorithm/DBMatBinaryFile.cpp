@@ -0,0 +1,453 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/algorithm/DBMatBinaryFile.hpp>
+
+#include <sgpp/base/exception/file_exception.hpp>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+using sgpp::base::DataMatrix;
+using sgpp::base::file_exception;
+
+namespace {
+
+const char MAGIC[8] = {'S', 'G', 'P', 'P', 'D', 'B', 'M', 'O'};
+const uint32_t BYTE_ORDER_MARK = 0x01020304;
+const size_t SECTION_ALIGNMENT = 64;
+
+/// number of temporary files created by this process
+std::atomic<uint64_t> temporaryFileCounter(0);
+
+/**
+ * @param fileName  path of the file to write
+ * @return          path of a temporary file next to it that is unique across
+ *                  processes, threads and calls
+ */
+std::string temporaryFileName(const std::string& fileName) {
+#ifdef _WIN32
+  const int pid = _getpid();
+#else
+  const pid_t pid = getpid();
+#endif
+  return fileName + ".tmp." + std::to_string(pid) + "." +
+         std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) + "." +
+         std::to_string(temporaryFileCounter++);
+}
+
+/// header at the beginning of every binary DBMatOffline file
+struct BinaryHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t byteOrderMark;
+  uint32_t decompositionType;
+  uint32_t sectionCount;
+  uint64_t fileSize;
+  /// checksum of the header (with this field set to zero) and the section table
+  uint64_t headerChecksum;
+  uint64_t reserved[3];
+};
+
+/// entry of the section table following the header, all offsets are in bytes
+struct BinarySectionHeader {
+  uint64_t offset;
+  uint64_t rows;
+  uint64_t cols;
+  uint32_t elementType;
+  uint32_t reserved0;
+  uint64_t checksum;
+  uint64_t reserved[3];
+};
+
+static_assert(sizeof(BinaryHeader) == 64, "unexpected padding in BinaryHeader");
+static_assert(sizeof(BinarySectionHeader) == 64, "unexpected padding in BinarySectionHeader");
+static_assert(sizeof(double) == 8, "the binary format requires 64 bit doubles");
+
+inline size_t alignSection(size_t offset) {
+  return (offset + SECTION_ALIGNMENT - 1) / SECTION_ALIGNMENT * SECTION_ALIGNMENT;
+}
+
+void writePadding(std::ofstream& file, size_t from, size_t to) {
+  const char zeros[SECTION_ALIGNMENT] = {};
+  file.write(zeros, static_cast<std::streamsize>(to - from));
+}
+
+inline uint64_t rotateLeft(uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+
+const uint64_t PRIME1 = 0x9E3779B185EBCA87ULL;
+const uint64_t PRIME2 = 0xC2B2AE3D27D4EB4FULL;
+const uint64_t PRIME3 = 0x165667B19E3779F9ULL;
+
+inline uint64_t checksumRound(uint64_t hash, uint64_t word) {
+  return rotateLeft(hash + word * PRIME2, 31) * PRIME1;
+}
+
+/**
+ * Checksum of the header and the section table.
+ */
+uint64_t computeHeaderChecksum(BinaryHeader header, const BinarySectionHeader* table) {
+  header.headerChecksum = 0;
+  const uint64_t headerHash = DBMatBinaryFile::computeChecksum(&header, sizeof(header));
+  const uint64_t tableHash = DBMatBinaryFile::computeChecksum(
+      table, static_cast<size_t>(header.sectionCount) * sizeof(BinarySectionHeader));
+  return checksumRound(headerHash, tableHash);
+}
+
+size_t getElementSize(DBMatBinaryFile::ElementType elementType) {
+  switch (elementType) {
+    case DBMatBinaryFile::ElementType::Double:
+      return sizeof(double);
+    case DBMatBinaryFile::ElementType::UInt64:
+      return sizeof(uint64_t);
+    default:
+      throw file_exception("DBMatBinaryFile : unknown element type");
+  }
+}
+
+}  // namespace
+
+DBMatBinaryFile::Section::Section(const DataMatrix& matrix)
+    : elementType(ElementType::Double),
+      rows(matrix.getNrows()),
+      cols(matrix.getNcols()),
+      data(matrix.data()) {}
+
+DBMatBinaryFile::Section::Section(const size_t* indices, size_t size)
+    : elementType(ElementType::UInt64), rows(1), cols(size), data(indices) {
+  static_assert(sizeof(size_t) == sizeof(uint64_t),
+                "index sections can only be written from 64 bit size_t");
+}
+
+uint64_t DBMatBinaryFile::computeChecksum(const void* data, size_t size) {
+  // four independent lanes of 64 bit words (similar to xxHash64), such that
+  // checksumming is limited by the memory bandwidth and not by the latency
+  // of the multiplications
+  const unsigned char* bytes = static_cast<const unsigned char*>(data);
+  uint64_t lanes[4] = {PRIME1 + PRIME2, PRIME2, 0, 0 - PRIME1};
+  size_t i = 0;
+
+  for (; i + 32 <= size; i += 32) {
+    uint64_t words[4];
+    std::memcpy(words, bytes + i, sizeof(words));
+
+    for (size_t k = 0; k < 4; k++) {
+      lanes[k] = checksumRound(lanes[k], words[k]);
+    }
+  }
+
+  uint64_t hash = rotateLeft(lanes[0], 1) + rotateLeft(lanes[1], 7) + rotateLeft(lanes[2], 12) +
+                  rotateLeft(lanes[3], 18) + static_cast<uint64_t>(size);
+
+  for (; i + 8 <= size; i += 8) {
+    uint64_t word;
+    std::memcpy(&word, bytes + i, sizeof(word));
+    hash = checksumRound(hash, word) + PRIME3;
+  }
+
+  for (; i < size; i++) {
+    hash = rotateLeft(hash ^ (static_cast<uint64_t>(bytes[i]) * PRIME3), 11) * PRIME1;
+  }
+
+  // final avalanche
+  hash ^= hash >> 33;
+  hash *= PRIME2;
+  hash ^= hash >> 29;
+  hash *= PRIME3;
+  hash ^= hash >> 32;
+  return hash;
+}
+
+void DBMatBinaryFile::write(const std::string& fileName, MatrixDecompositionType decompositionType,
+                            const std::vector<std::vector<size_t>>& interactions,
+                            const std::vector<Section>& sections) {
+  // the interaction terms are stored as the first section:
+  // number of terms, followed by the size and the dimensions of every term
+  std::vector<uint64_t> encodedInteractions(1, interactions.size());
+
+  for (const std::vector<size_t>& term : interactions) {
+    encodedInteractions.push_back(term.size());
+    encodedInteractions.insert(encodedInteractions.end(), term.begin(), term.end());
+  }
+
+  std::vector<const void*> sectionData(1, encodedInteractions.data());
+  std::vector<BinarySectionHeader> table(sections.size() + 1, BinarySectionHeader());
+  table[0].rows = 1;
+  table[0].cols = encodedInteractions.size();
+  table[0].elementType = static_cast<uint32_t>(ElementType::UInt64);
+
+  for (size_t i = 0; i < sections.size(); i++) {
+    sectionData.push_back(sections[i].data);
+    table[i + 1].rows = sections[i].rows;
+    table[i + 1].cols = sections[i].cols;
+    table[i + 1].elementType = static_cast<uint32_t>(sections[i].elementType);
+  }
+
+  size_t end = sizeof(BinaryHeader) + table.size() * sizeof(BinarySectionHeader);
+
+  for (size_t i = 0; i < table.size(); i++) {
+    const size_t size = static_cast<size_t>(table[i].rows * table[i].cols) *
+                        getElementSize(static_cast<ElementType>(table[i].elementType));
+    table[i].offset = alignSection(end);
+    table[i].checksum = computeChecksum(sectionData[i], size);
+    end = table[i].offset + size;
+  }
+
+  BinaryHeader header = {};
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.version = VERSION;
+  header.byteOrderMark = BYTE_ORDER_MARK;
+  header.decompositionType = static_cast<uint32_t>(decompositionType);
+  header.sectionCount = static_cast<uint32_t>(table.size());
+  header.fileSize = end;
+  header.headerChecksum = computeHeaderChecksum(header, table.data());
+
+  // write to a temporary file first, such that other processes never see
+  // (or map) a partially written file; concurrent writers of the same file
+  // use different temporary files, the last rename wins
+  const std::string tmpFileName = temporaryFileName(fileName);
+
+  {
+    std::ofstream file(tmpFileName, std::ios::binary | std::ios::trunc);
+
+    if (!file) {
+      throw file_exception("DBMatBinaryFile::write : could not open file for writing");
+    }
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(table.data()),
+               static_cast<std::streamsize>(table.size() * sizeof(BinarySectionHeader)));
+    size_t position = sizeof(BinaryHeader) + table.size() * sizeof(BinarySectionHeader);
+
+    for (size_t i = 0; i < table.size(); i++) {
+      const size_t size = static_cast<size_t>(table[i].rows * table[i].cols) *
+                          getElementSize(static_cast<ElementType>(table[i].elementType));
+      writePadding(file, position, table[i].offset);
+      file.write(static_cast<const char*>(sectionData[i]), static_cast<std::streamsize>(size));
+      position = table[i].offset + size;
+    }
+
+    file.close();
+
+    if (!file) {
+      std::remove(tmpFileName.c_str());
+      throw file_exception("DBMatBinaryFile::write : error while writing file");
+    }
+  }
+
+  // rename replaces existing files atomically on POSIX systems; on other systems,
+  // the existing file has to be removed first
+  if ((std::rename(tmpFileName.c_str(), fileName.c_str()) != 0) &&
+      ((std::remove(fileName.c_str()) != 0) ||
+       (std::rename(tmpFileName.c_str(), fileName.c_str()) != 0))) {
+    std::remove(tmpFileName.c_str());
+    throw file_exception("DBMatBinaryFile::write : could not replace file");
+  }
+}
+
+bool DBMatBinaryFile::isBinaryFile(const std::string& fileName) {
+  std::ifstream file(fileName, std::ios::binary);
+  char magic[sizeof(MAGIC)];
+
+  if (!file.read(magic, sizeof(magic))) {
+    return false;
+  }
+
+  return std::memcmp(magic, MAGIC, sizeof(MAGIC)) == 0;
+}
+
+DBMatBinaryFile::DBMatBinaryFile(const std::string& fileName, bool verifyChecksums)
+    : fileName(fileName),
+      file(fileName),
+      data(file.getData()),
+      decompositionType(MatrixDecompositionType::Chol),
+      interactions(),
+      sections() {
+  parse(verifyChecksums);
+}
+
+void DBMatBinaryFile::parse(bool verifyChecksums) {
+  const size_t fileSize = file.getSize();
+  BinaryHeader header;
+
+  if (fileSize < sizeof(header)) {
+    throw file_exception("DBMatBinaryFile : file is too small to be a binary DBMatOffline file");
+  }
+
+  std::memcpy(&header, data, sizeof(header));
+
+  if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+    throw file_exception("DBMatBinaryFile : file is not a binary DBMatOffline file");
+  }
+
+  if (header.byteOrderMark != BYTE_ORDER_MARK) {
+    throw file_exception("DBMatBinaryFile : file was written with a different byte order");
+  }
+
+  if ((header.version < 1) || (header.version > VERSION)) {
+    throw file_exception("DBMatBinaryFile : unsupported version of the binary format");
+  }
+
+  if (header.fileSize != fileSize) {
+    throw file_exception("DBMatBinaryFile : file is truncated");
+  }
+
+  if ((header.sectionCount < 1) ||
+      (header.sectionCount > (fileSize - sizeof(header)) / sizeof(BinarySectionHeader))) {
+    throw file_exception("DBMatBinaryFile : corrupt section table");
+  }
+
+  std::vector<BinarySectionHeader> table(header.sectionCount);
+  std::memcpy(table.data(), data + sizeof(header), table.size() * sizeof(BinarySectionHeader));
+
+  if (computeHeaderChecksum(header, table.data()) != header.headerChecksum) {
+    throw file_exception("DBMatBinaryFile : checksum mismatch in header or section table");
+  }
+
+  if (verifyChecksums) {
+    file.adviseSequential();
+  }
+
+  sections.clear();
+
+  for (size_t i = 0; i < table.size(); i++) {
+    const BinarySectionHeader& entry = table[i];
+    const ElementType elementType = static_cast<ElementType>(entry.elementType);
+    const size_t elementSize = getElementSize(elementType);
+
+    // check that the section lies within the file (the number of entries is
+    // bounded by the file size before computing the size to rule out overflows)
+    if ((entry.offset > fileSize) || (entry.offset % SECTION_ALIGNMENT != 0) ||
+        (entry.rows > fileSize) || ((entry.rows > 0) && (entry.cols > fileSize / entry.rows)) ||
+        (entry.rows * entry.cols * elementSize > fileSize - entry.offset)) {
+      throw file_exception("DBMatBinaryFile : corrupt section table");
+    }
+
+    const size_t size = static_cast<size_t>(entry.rows * entry.cols) * elementSize;
+
+    if (verifyChecksums && (computeChecksum(data + entry.offset, size) != entry.checksum)) {
+      throw file_exception("DBMatBinaryFile : checksum mismatch, file is corrupted");
+    }
+
+    SectionInfo info;
+    info.elementType = elementType;
+    info.rows = static_cast<size_t>(entry.rows);
+    info.cols = static_cast<size_t>(entry.cols);
+    info.offset = static_cast<size_t>(entry.offset);
+    sections.push_back(info);
+  }
+
+  decompositionType = static_cast<MatrixDecompositionType>(header.decompositionType);
+
+  // decode the interaction terms (first section)
+  const SectionInfo interactionSection = sections.front();
+  sections.erase(sections.begin());
+
+  if (interactionSection.elementType != ElementType::UInt64) {
+    throw file_exception("DBMatBinaryFile : corrupt interaction terms");
+  }
+
+  const uint64_t* encoded = reinterpret_cast<const uint64_t*>(data + interactionSection.offset);
+  const size_t encodedSize = interactionSection.rows * interactionSection.cols;
+  size_t position = 1;
+
+  if ((encodedSize < 1) || (encoded[0] > encodedSize)) {
+    throw file_exception("DBMatBinaryFile : corrupt interaction terms");
+  }
+
+  interactions.clear();
+  interactions.reserve(static_cast<size_t>(encoded[0]));
+
+  for (uint64_t k = 0; k < encoded[0]; k++) {
+    if ((position >= encodedSize) || (encoded[position] > encodedSize - position - 1)) {
+      throw file_exception("DBMatBinaryFile : corrupt interaction terms");
+    }
+
+    const size_t termSize = static_cast<size_t>(encoded[position]);
+    interactions.emplace_back(encoded + position + 1, encoded + position + 1 + termSize);
+    position += termSize + 1;
+  }
+}
+
+const std::string& DBMatBinaryFile::getFileName() const { return fileName; }
+
+MatrixDecompositionType DBMatBinaryFile::getDecompositionType() const {
+  return decompositionType;
+}
+
+const std::vector<std::vector<size_t>>& DBMatBinaryFile::getInteractions() const {
+  return interactions;
+}
+
+size_t DBMatBinaryFile::getSectionCount() const { return sections.size(); }
+
+DBMatBinaryFile::ElementType DBMatBinaryFile::getElementType(size_t i) const {
+  if (i >= sections.size()) {
+    throw file_exception("DBMatBinaryFile : section does not exist");
+  }
+
+  return sections[i].elementType;
+}
+
+size_t DBMatBinaryFile::getRows(size_t i) const {
+  return getSection(i, getElementType(i)).rows;
+}
+
+size_t DBMatBinaryFile::getCols(size_t i) const {
+  return getSection(i, getElementType(i)).cols;
+}
+
+const double* DBMatBinaryFile::getMatrixData(size_t i) const {
+  return reinterpret_cast<const double*>(data + getSection(i, ElementType::Double).offset);
+}
+
+const uint64_t* DBMatBinaryFile::getIndexData(size_t i) const {
+  return reinterpret_cast<const uint64_t*>(data + getSection(i, ElementType::UInt64).offset);
+}
+
+void DBMatBinaryFile::copyMatrix(size_t i, DataMatrix& matrix) const {
+  const SectionInfo& section = getSection(i, ElementType::Double);
+  const double* entries = reinterpret_cast<const double*>(data + section.offset);
+  matrix.resizeRowsCols(section.rows, section.cols);
+  std::copy(entries, entries + section.rows * section.cols, matrix.data());
+}
+
+void DBMatBinaryFile::copyIndices(size_t i, std::vector<size_t>& indices) const {
+  const SectionInfo& section = getSection(i, ElementType::UInt64);
+  const uint64_t* entries = reinterpret_cast<const uint64_t*>(data + section.offset);
+  indices.assign(entries, entries + section.rows * section.cols);
+}
+
+const DBMatBinaryFile::SectionInfo& DBMatBinaryFile::getSection(size_t i,
+                                                                ElementType elementType) const {
+  if (i >= sections.size()) {
+    throw file_exception("DBMatBinaryFile : section does not exist");
+  }
+
+  if (sections[i].elementType != elementType) {
+    throw file_exception("DBMatBinaryFile : section has another element type");
+  }
+
+  return sections[i];
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
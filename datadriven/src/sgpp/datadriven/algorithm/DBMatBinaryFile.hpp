@@ -0,0 +1,227 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/tools/MemoryMappedFile.hpp>
+#include <sgpp/datadriven/configuration/DensityEstimationConfiguration.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Binary on-disk format of serialized DBMatOffline objects.
+ *
+ * A file consists of a fixed-size header (magic number, format version, byte order mark,
+ * decomposition type), a table of sections and the raw data of the sections. Each section
+ * is a dense row-major matrix of doubles or 64 bit unsigned integers (e.g., permutations)
+ * and is aligned to 64 bytes. The header and the section table as well as the data of every
+ * section are protected by 64 bit checksums. The interaction terms of the offline object are
+ * stored in an additional (hidden) section.
+ *
+ * Files are opened via MemoryMappedFile, i.e., opening a file only reads and checks the header
+ * and the section table (and the section checksums, if requested). The sections are not parsed,
+ * but copied in bulk into the matrices of the offline object (see copyMatrix()), as DBMatOffline
+ * and the online objects own and modify their matrices. Hence, processes that load the same file
+ * only share the mapped pages while copying; every process holds its own copy of the matrices
+ * afterwards. Files are written to a temporary file
+ * with a unique name first, which is then renamed, such that processes never map partially
+ * written files. The file has to be read on a machine with the same byte order as the one it
+ * was written on.
+ */
+class DBMatBinaryFile {
+ public:
+  /// type of the entries of a section
+  enum class ElementType : uint32_t { Double = 1, UInt64 = 2 };
+
+  /// current version of the file format
+  static const uint32_t VERSION = 1;
+
+  /**
+   * Section of a file that is written (data is not copied, i.e., it has to be valid
+   * until DBMatBinaryFile::write returns).
+   */
+  struct Section {
+    /**
+     * @param matrix  dense matrix
+     */
+    explicit Section(const sgpp::base::DataMatrix& matrix);
+
+    /**
+     * @param indices pointer to the indices
+     * @param size    number of indices
+     */
+    Section(const size_t* indices, size_t size);
+
+    /// type of the entries
+    ElementType elementType;
+    /// number of rows
+    size_t rows;
+    /// number of columns
+    size_t cols;
+    /// pointer to the (row-major) entries
+    const void* data;
+  };
+
+  /**
+   * Opens a file and maps it read-only into memory.
+   * Throws a file_exception if the file cannot be opened, is not a binary
+   * DBMatOffline file, was written with another byte order, or is corrupted.
+   *
+   * @param fileName        path of the file
+   * @param verifyChecksums whether to verify the checksums of all sections (the checksum of the
+   *                        header and the section table is always verified)
+   */
+  explicit DBMatBinaryFile(const std::string& fileName, bool verifyChecksums = true);
+
+  DBMatBinaryFile(const DBMatBinaryFile&) = delete;
+  DBMatBinaryFile& operator=(const DBMatBinaryFile&) = delete;
+
+  /**
+   * Writes a file. The file is replaced atomically if it already exists.
+   *
+   * @param fileName          path of the file
+   * @param decompositionType decomposition type of the offline object
+   * @param interactions      interaction terms of the offline object
+   * @param sections          sections (matrices and index vectors) to write
+   */
+  static void write(const std::string& fileName, MatrixDecompositionType decompositionType,
+                    const std::vector<std::vector<size_t>>& interactions,
+                    const std::vector<Section>& sections);
+
+  /**
+   * @param fileName  path of the file
+   * @return          whether the file starts with the magic number of the binary format
+   *                  (legacy text files do not)
+   */
+  static bool isBinaryFile(const std::string& fileName);
+
+  /**
+   * @return path of the file
+   */
+  const std::string& getFileName() const;
+
+  /**
+   * @return decomposition type of the stored offline object
+   */
+  MatrixDecompositionType getDecompositionType() const;
+
+  /**
+   * @return interaction terms of the stored offline object
+   */
+  const std::vector<std::vector<size_t>>& getInteractions() const;
+
+  /**
+   * @return number of sections (without the interaction terms)
+   */
+  size_t getSectionCount() const;
+
+  /**
+   * @param i index of the section
+   * @return  type of the entries of the section
+   */
+  ElementType getElementType(size_t i) const;
+
+  /**
+   * @param i index of the section
+   * @return  number of rows of the section
+   */
+  size_t getRows(size_t i) const;
+
+  /**
+   * @param i index of the section
+   * @return  number of columns of the section
+   */
+  size_t getCols(size_t i) const;
+
+  /**
+   * @param i index of the section
+   * @return  pointer to the mapped (row-major) entries of a section of doubles
+   *          (valid as long as this object exists)
+   */
+  const double* getMatrixData(size_t i) const;
+
+  /**
+   * @param i index of the section
+   * @return  pointer to the mapped entries of a section of 64 bit unsigned integers
+   *          (valid as long as this object exists)
+   */
+  const uint64_t* getIndexData(size_t i) const;
+
+  /**
+   * Copies a section of doubles into a matrix (one bulk copy, no parsing).
+   *
+   * @param       i       index of the section
+   * @param[out]  matrix  matrix (resized accordingly)
+   */
+  void copyMatrix(size_t i, sgpp::base::DataMatrix& matrix) const;
+
+  /**
+   * Copies a section of 64 bit unsigned integers into a vector.
+   *
+   * @param       i       index of the section
+   * @param[out]  indices vector (resized accordingly)
+   */
+  void copyIndices(size_t i, std::vector<size_t>& indices) const;
+
+  /**
+   * 64 bit checksum used by the format.
+   *
+   * @param data  pointer to the data
+   * @param size  number of bytes
+   * @return      checksum
+   */
+  static uint64_t computeChecksum(const void* data, size_t size);
+
+ private:
+  /// information about a section
+  struct SectionInfo {
+    /// type of the entries
+    ElementType elementType;
+    /// number of rows
+    size_t rows;
+    /// number of columns
+    size_t cols;
+    /// offset of the entries in the file
+    size_t offset;
+  };
+
+  /// path of the file
+  std::string fileName;
+  /// the mapped file
+  sgpp::base::MemoryMappedFile file;
+  /// start of the file
+  const char* data;
+  /// decomposition type
+  MatrixDecompositionType decompositionType;
+  /// interaction terms
+  std::vector<std::vector<size_t>> interactions;
+  /// sections (without the interaction terms)
+  std::vector<SectionInfo> sections;
+
+  /**
+   * Checks the header and the section table and sets the members.
+   *
+   * @param verifyChecksums whether to verify the checksums of all sections
+   */
+  void parse(bool verifyChecksums);
+
+  /**
+   * @param i             index of the section
+   * @param elementType   expected type of the entries
+   * @return              information about the section (throws a file_exception if the
+   *                      section does not exist or has another type)
+   */
+  const SectionInfo& getSection(size_t i, ElementType elementType) const;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
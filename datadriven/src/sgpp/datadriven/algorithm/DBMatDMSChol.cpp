@@ -7,22 +7,42 @@
 
 #include <sgpp/base/exception/algorithm_exception.hpp>
 #include <sgpp/base/exception/data_exception.hpp>
-#include <sgpp/base/exception/not_implemented_exception.hpp>
 #include <sgpp/datadriven/scalapack/DataMatrixDistributed.hpp>
 #include <sgpp/datadriven/scalapack/DataVectorDistributed.hpp>
 
-#ifdef USE_GSL
-#include <gsl/gsl_blas.h>
-#include <gsl/gsl_matrix_double.h>
-#endif /* USE_GSL */
-
 #include <math.h>
+#include <cmath>
 #include <ctime>
 #include <iostream>
 
 namespace sgpp {
 namespace datadriven {
 
+namespace {
+/**
+ * Constructs a Givens rotation (as drotg of the BLAS) such that
+ * [c s; -s c] * [a; b] = [r; 0].
+ *
+ * @param[in,out] a   first entry, overwritten by r
+ * @param         b   second entry
+ * @param[out]    c   cosine of the rotation
+ * @param[out]    s   sine of the rotation
+ */
+void givensRotation(double& a, double b, double& c, double& s) {
+  if ((a == 0.0) && (b == 0.0)) {
+    c = 1.0;
+    s = 0.0;
+    return;
+  }
+
+  // the sign of r is the sign of the entry with the larger absolute value
+  const double r = std::copysign(std::hypot(a, b), (std::abs(b) > std::abs(a)) ? b : a);
+  c = a / r;
+  s = b / r;
+  a = r;
+}
+}  // namespace
+
 void DBMatDMSChol::solve(sgpp::base::DataMatrix& decompMatrix, sgpp::base::DataVector& alpha,
                          const sgpp::base::DataVector& b, double lambda_old,
                          double lambda_new) const {
@@ -86,9 +106,6 @@ void DBMatDMSChol::solveParallel(DataMatrixDistributed& decompMatrix, DataVector
 // Implement cholesky Update for given Decomposition and update vector
 void DBMatDMSChol::choleskyUpdate(sgpp::base::DataMatrix& decompMatrix,
                                   const sgpp::base::DataVector& update, bool do_cv) const {
-#ifdef USE_GSL
-  // int i;
-
   size_t size = decompMatrix.getNrows();
 
   if (update.getSize() != size) {
@@ -97,55 +114,48 @@ void DBMatDMSChol::choleskyUpdate(sgpp::base::DataMatrix& decompMatrix,
         "match...");
   }
 
-  // Create GSL matrix view for update procedures
-  gsl_matrix_view m = gsl_matrix_view_array(decompMatrix.getPointer(), size, size);
-  gsl_vector_const_view vvec = gsl_vector_const_view_array(update.getPointer(), update.getSize());
+  double* m = decompMatrix.getPointer();
 
   // Define and declare Workingvector, Cosine- and Sinevector
-  gsl_vector* wkvec = gsl_vector_calloc(update.getSize());
-  gsl_vector* svec = gsl_vector_calloc(update.getSize());
-  gsl_vector* cvec = gsl_vector_calloc(update.getSize());
-
-  // Generate Givens rotations, update L
   // Copy Values of updateVector into WorkingVector
-  gsl_blas_dcopy(&vvec.vector, wkvec);
+  sgpp::base::DataVector wkvec(update);
+  sgpp::base::DataVector svec(size, 0.0);
+  sgpp::base::DataVector cvec(size, 0.0);
 
+  // Generate Givens rotations, update L
   double temp;
-  double* tbuff = m.matrix.data;
+  double* tbuff = m;
   bool first_notZero = true;
   for (size_t i = 0; i < size - 1; i++) {
-    if (*tbuff == 0.0 && wkvec->data[i] == 0.0) {
+    if (*tbuff == 0.0 && wkvec[i] == 0.0) {
       throw sgpp::base::data_exception("choleskyUpdate::Matrix not numerical positive definite");
-    } else if (wkvec->data[i] == 0.0 && do_cv == true) {
+    } else if (wkvec[i] == 0.0 && do_cv == true) {
       // If cross validation is applied the first (n-1) entries in
       // the n-th step are zero and therefore can be skipped.
       tbuff += (size + 1);
       continue;
-    } else if (wkvec->data[i] == 0.0 && first_notZero == true) {
+    } else if (wkvec[i] == 0.0 && first_notZero == true) {
       first_notZero = false;
       tbuff += (size + 1);
       continue;
     }
     // Determine givens rotation
-    gsl_blas_drotg(tbuff, wkvec->data + i, cvec->data + i, svec->data + i);
+    givensRotation(*tbuff, wkvec[i], cvec[i], svec[i]);
     if ((temp = *tbuff) < 0.0) {
       *tbuff = -temp;
-      cvec->data[i] = -cvec->data[i];
-      svec->data[i] = -svec->data[i];
+      cvec[i] = -cvec[i];
+      svec[i] = -svec[i];
     } else if (temp == 0.0) {
       throw sgpp::base::data_exception("choleskyUpdate::Matrix not numerical positive definite");
     }
 
-    // Access columns to modify via Givens rotations
-    gsl_vector_view mat_sub = gsl_matrix_subcolumn(&m.matrix, i, i + 1, size - i - 1);
-    gsl_vector_view wkvec_sub = gsl_vector_subvector(wkvec, i + 1, size - i - 1);
-
-    // Allpy Givens rotation to mat_sub und wkvec_sub
-    for (size_t j = 0; j < size - i - 1; j++) {
-      double x = mat_sub.vector.data[mat_sub.vector.stride * j];
-      double y = wkvec_sub.vector.data[j];
-      mat_sub.vector.data[mat_sub.vector.stride * j] = cvec->data[i] * x + svec->data[i] * y;
-      wkvec_sub.vector.data[j] = -svec->data[i] * x + cvec->data[i] * y;
+    // Apply Givens rotation to the i-th column of L below the diagonal
+    // and to the corresponding entries of the working vector
+    for (size_t j = i + 1; j < size; j++) {
+      double x = m[j * size + i];
+      double y = wkvec[j];
+      m[j * size + i] = cvec[i] * x + svec[i] * y;
+      wkvec[j] = -svec[i] * x + cvec[i] * y;
     }
     tbuff += (size + 1);
   }
@@ -153,30 +163,23 @@ void DBMatDMSChol::choleskyUpdate(sgpp::base::DataMatrix& decompMatrix,
   size_t i_N = size - 1;
   // Apply changes to N-th (last) diagonal element
   // Is outsourced, since only the diagonal element is modified.
-  if (*tbuff != 0.0 || wkvec->data[size - 1] != 0.0) {
-    gsl_blas_drotg(tbuff, wkvec->data + (size - 1), cvec->data + i_N, svec->data + i_N);
+  if (*tbuff != 0.0 || wkvec[size - 1] != 0.0) {
+    givensRotation(*tbuff, wkvec[size - 1], cvec[i_N], svec[i_N]);
     if ((temp = *tbuff) < 0.0) {
       *tbuff = -temp;
-      cvec->data[i_N] = -cvec->data[i_N];
-      svec->data[i_N] = -svec->data[i_N];
+      cvec[i_N] = -cvec[i_N];
+      svec[i_N] = -svec[i_N];
     } else if (temp == 0.0) {
       throw sgpp::base::data_exception("choleskyUpdate::Matrix not numerical positive definite");
     }
   } else {
     throw sgpp::base::data_exception("choleskyUpdate::Matrix not numerical positive definite");
   }
-  gsl_vector_free(wkvec);
-  gsl_vector_free(svec);
-  gsl_vector_free(cvec);
-#else
-  throw base::not_implemented_exception("built withot GSL");
-#endif /* USE_GSL */
 }
 
 // Implement cholesky Downdate for given Decomposition and update vector
 void DBMatDMSChol::choleskyDowndate(sgpp::base::DataMatrix& decompMatrix,
                                     const sgpp::base::DataVector& downdate, bool do_cv) const {
-#ifdef USE_GSL
   size_t size = decompMatrix.getNrows();
 
   if (downdate.getSize() != size) {
@@ -184,27 +187,20 @@ void DBMatDMSChol::choleskyDowndate(sgpp::base::DataMatrix& decompMatrix,
         "choleskyDowndate::Size of DecomposedMatrix and updateVector don´t "
         "match...");
   }
-  // Create GSL matrix view for update procedures
-  gsl_matrix_view m = gsl_matrix_view_array(decompMatrix.getPointer(), size, size);
-  gsl_vector_const_view vvec =
-      gsl_vector_const_view_array(downdate.getPointer(), downdate.getSize());
+
+  double* m = decompMatrix.getPointer();
 
   // Define and declare Workingvector, Cosine- and Sinevector
-  gsl_vector* wkvec = gsl_vector_calloc(downdate.getSize());
-  gsl_vector* svec = gsl_vector_calloc(downdate.getSize());
-  gsl_vector* cvec = gsl_vector_calloc(downdate.getSize());
+  sgpp::base::DataVector wkvec(size);
+  sgpp::base::DataVector svec(size, 0.0);
+  sgpp::base::DataVector cvec(size, 0.0);
 
   // Compute p (if not given)
-  // Copy Values of updateVector into WorkingVector
-  gsl_blas_dcopy(&vvec.vector, wkvec);
-
-  // Solve La = downdate and save a in vvec.vector
-  gsl_blas_dtrsv(CblasLower, CblasNoTrans, CblasNonUnit, &m.matrix, wkvec);
+  // Solve La = downdate and save a in wkvec
+  choleskyForwardSolve(decompMatrix, downdate, wkvec);
 
   // Generate Givens rotations
-  double rho;
-  gsl_blas_ddot(wkvec, wkvec, &rho);
-  rho = 1 - rho;
+  double rho = 1 - wkvec.dotProduct(wkvec);
 
   // Represents first index of downdate vector with entrie unequal to zero
   size_t cv_first_zero = 0;
@@ -215,56 +211,57 @@ void DBMatDMSChol::choleskyDowndate(sgpp::base::DataMatrix& decompMatrix,
     for (int i = static_cast<int>(size) - 1; i >= 0; i--) {
       // If this method is applied in cross-validation do_cv == true and
       // shortcuts can be used
-      if (wkvec->data[i] == 0 && do_cv == true) {
+      if (wkvec[i] == 0 && do_cv == true) {
         cv_first_zero = i + 1;
         break;
       }
       // Determine Givens rotation
-      gsl_blas_drotg(&rho, wkvec->data + i, cvec->data + i, svec->data + i);
+      givensRotation(rho, wkvec[i], cvec[i], svec[i]);
       // rho must remain positive
       if (rho < 0.0) {
         rho = -rho;
-        cvec->data[i] = -cvec->data[i];
-        svec->data[i] = -svec->data[i];
+        cvec[i] = -cvec[i];
+        svec[i] = -svec[i];
       }
     }
   }
 
   // rho should be 1 now
-  gsl_vector_set_zero(wkvec);
+  wkvec.setAll(0.0);
 
-  double* tbuff = m.matrix.data + ((size - 1) * (size + 1));
+  double* tbuff = m + ((size - 1) * (size + 1));
 
   // Apply calculated Givens rotations to current Cholesky factor
   for (size_t i = size - 1; i >= cv_first_zero; i--) {
     if (*tbuff <= 0.0) {
       throw sgpp::base::data_exception("choleskyDowndate::Matrix not numerical positive definite");
     }
-    // Access corresponding columns
-    gsl_vector_view mat_sub = gsl_matrix_subcolumn(&m.matrix, i, i, size - i);
-    gsl_vector_view wkvec_sub = gsl_vector_subvector(wkvec, i, size - i);
 
-    // Apply Givens rotation to mat_sub and wkvec_sub
-    gsl_blas_drot(&wkvec_sub.vector, &mat_sub.vector, cvec->data[i], svec->data[i]);
-    double diag = gsl_matrix_get(&m.matrix, i, i);
+    // Apply Givens rotation to the i-th column of L (starting at the diagonal)
+    // and to the corresponding entries of the working vector
+    for (size_t j = i; j < size; j++) {
+      double x = wkvec[j];
+      double y = m[j * size + i];
+      wkvec[j] = cvec[i] * x + svec[i] * y;
+      m[j * size + i] = cvec[i] * y - svec[i] * x;
+    }
+
+    double diag = m[i * size + i];
     // Ensure diagonal stays positive
     if (diag < 0.0) {
       rho = -1.0;
-      gsl_matrix_set(&m.matrix, i, i, rho * diag);
+      m[i * size + i] = rho * diag;
     } else if (diag == 0.0) {
       throw sgpp::base::data_exception("choleskyDowndate::Matrix not numerical positive definite");
     }
     tbuff -= (size + 1);
+
+    if (i == 0) {
+      break;
+    }
   }
 
   // Workingvector should equal v now
-
-  gsl_vector_free(wkvec);
-  gsl_vector_free(svec);
-  gsl_vector_free(cvec);
-#else
-  throw base::not_implemented_exception("built withot GSL");
-#endif /* USE_GSL */
 }
 
 void DBMatDMSChol::choleskyUpdateLambda(sgpp::base::DataMatrix& decompMatrix,
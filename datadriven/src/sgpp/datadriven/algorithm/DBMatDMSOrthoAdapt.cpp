@@ -5,15 +5,8 @@
 
 #include <sgpp/datadriven/algorithm/DBMatDMSOrthoAdapt.hpp>
 
-#ifdef USE_GSL
-#include <gsl/gsl_blas.h>
-#include <gsl/gsl_linalg.h>
-#include <gsl/gsl_math.h>
-#include <gsl/gsl_matrix.h>
-#include <gsl/gsl_vector.h>
-#endif /* USE_GSL */
-
 #include <sgpp/base/exception/algorithm_exception.hpp>
+#include <sgpp/datadriven/algorithm/DBMatDenseDecomposition.hpp>
 
 #include <iostream>
 
@@ -23,7 +16,6 @@ namespace datadriven {
 void DBMatDMSOrthoAdapt::solve(sgpp::base::DataMatrix& T_inv, sgpp::base::DataMatrix& Q,
                                sgpp::base::DataMatrix& B, sgpp::base::DataVector& b,
                                sgpp::base::DataVector& alpha) {
-#ifdef USE_GSL
   // assert dimensions
   bool prior_refined = (B.getNcols() > 1);  // if B.getNcols <= 1, then no refining yet
 
@@ -43,40 +35,31 @@ void DBMatDMSOrthoAdapt::solve(sgpp::base::DataMatrix& T_inv, sgpp::base::DataMa
    * size of offline.dimA(), which is the size of the original non refined grid,
    * so the operations Q * T_inv * Q_t * b will be capped to size dimA()
    */
-
-  // creating gsl_matrix_views to be able to use BLAS operations
-  gsl_matrix_view q_view = gsl_matrix_view_array(Q.getPointer(), Q.getNrows(), Q.getNcols());
-  gsl_matrix_view t_inv_view =
-      gsl_matrix_view_array(T_inv.getPointer(), T_inv.getNrows(), T_inv.getNcols());
-  gsl_matrix_view b_matrix_view = gsl_matrix_view_array(B.getPointer(), B.getNrows(), B.getNcols());
-
-  gsl_vector_view b_vector_view_cut = gsl_vector_view_array(b.getPointer(), Q.getNrows());
-  gsl_vector_view b_vector_view = gsl_vector_view_array(b.getPointer(), b.getSize());
-  gsl_vector_view alpha_view_cut = gsl_vector_view_array(alpha.getPointer(), Q.getNrows());
-  gsl_vector_view alpha_view = gsl_vector_view_array(alpha.getPointer(), alpha.getSize());
-
-  gsl_vector* interim2 = gsl_vector_alloc(Q.getNrows());
+  const size_t dima = Q.getNrows();
+  sgpp::base::DataVector interim(dima);
 
   // calculating Q^t * b
-  gsl_blas_dgemv(CblasTrans, 1.0, &q_view.matrix, &b_vector_view_cut.vector, 0.0,
-                 &alpha_view_cut.vector);
+  DBMatDenseDecomposition::matrixVectorProduct(Q, dima, Q.getNcols(), true, b.getPointer(), 0.0,
+                                               alpha.getPointer());
 
   // calculating T^{-1} * Q^t * b
-  gsl_blas_dgemv(CblasNoTrans, 1.0, &t_inv_view.matrix, &alpha_view_cut.vector, 0.0, interim2);
+  DBMatDenseDecomposition::matrixVectorProduct(T_inv, T_inv.getNrows(), T_inv.getNcols(), false,
+                                               alpha.getPointer(), 0.0, interim.getPointer());
 
   // calculating Q * T^{-1} * Q^t * b
-  gsl_blas_dgemv(CblasNoTrans, 1.0, &q_view.matrix, interim2, 0.0, &alpha_view_cut.vector);
+  DBMatDenseDecomposition::matrixVectorProduct(Q, dima, Q.getNcols(), false, interim.getPointer(),
+                                               0.0, alpha.getPointer());
 
   // if B should not be considered
   if (!prior_refined || B.getNcols() == Q.getNcols()) {
-    if (interim2->size != alpha.getSize()) {
+    if (interim.getSize() != alpha.getSize()) {
       throw sgpp::base::algorithm_exception(
           "In DBMatDMSOrthoAdapt::solve: vector alpha does not match Q * T^{-1} * Q^t * b");
     }
   } else {
     // add the B*b term: alpha = alpha + B*b
-    gsl_blas_dgemv(CblasNoTrans, 1.0, &b_matrix_view.matrix, &b_vector_view.vector, 1.0,
-                   &alpha_view.vector);  // gsl_blas allows to add to the target after mult.
+    DBMatDenseDecomposition::matrixVectorProduct(B, B.getNrows(), B.getNcols(), false,
+                                                 b.getPointer(), 1.0, alpha.getPointer());
   }
 
   // DEBUG: print alpha after solving
@@ -85,11 +68,6 @@ void DBMatDMSOrthoAdapt::solve(sgpp::base::DataMatrix& T_inv, sgpp::base::DataMa
   //   std::cout << alpha.get(i) << "   ";
   // }
   // std::cout << std::endl;
-
-  gsl_vector_free(interim2);
-#else
-  throw sgpp::base::algorithm_exception("USE_GSL not set");
-#endif /* USE_GSL */
 }
 
 void DBMatDMSOrthoAdapt::solveParallel(DataMatrixDistributed& T_inv, DataMatrixDistributed& Q,
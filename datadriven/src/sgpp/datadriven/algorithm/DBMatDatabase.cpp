@@ -14,6 +14,7 @@
 #include <sgpp/datadriven/algorithm/DBMatOfflineFactory.hpp>
 
 #include <algorithm>
+#include <memory>
 #include <string>
 
 namespace sgpp {
@@ -70,6 +71,15 @@ std::string& DBMatDatabase::getDataMatrix(
   }
 }
 
+std::unique_ptr<DBMatBinaryFile> DBMatDatabase::openDataMatrix(
+    sgpp::base::GeneralGridConfiguration& gridConfig,
+    sgpp::base::AdaptivityConfiguration& adaptivityConfig,
+    sgpp::datadriven::RegularizationConfiguration& regularizationConfig,
+    sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig) {
+  return std::make_unique<DBMatBinaryFile>(getDataMatrix(gridConfig, adaptivityConfig,
+      regularizationConfig, densityEstimationConfig));
+}
+
 void DBMatDatabase::putDataMatrix(sgpp::base::GeneralGridConfiguration& gridConfig,
     sgpp::base::AdaptivityConfiguration& adaptivityConfig,
     sgpp::datadriven::RegularizationConfiguration& regularizationConfig,
@@ -7,9 +7,11 @@
 
 #include <sgpp/base/tools/json/JSON.hpp>
 #include <sgpp/base/tools/json/ListNode.hpp>
+#include <sgpp/datadriven/algorithm/DBMatBinaryFile.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOffline.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineFactory.hpp>
 
+#include <memory>
 #include <string>
 
 namespace sgpp {
@@ -55,6 +57,26 @@ class DBMatDatabase{
       sgpp::datadriven::RegularizationConfiguration& regularizationConfig,
       sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig);
 
+  /**
+   * Scans the entire database, finds the first entry that matches the configurations and opens
+   * the matrix decomposition, which has to be stored in the binary format (see DBMatBinaryFile).
+   * The file is mapped read-only into memory and not parsed. Use
+   * DBMatOfflineFactory::buildFromFile(const DBMatBinaryFile&) to create an offline object, which
+   * copies the matrices in bulk, and release the file afterwards (the offline object does not
+   * keep a view of the mapped file).
+   * @param gridConfig the grid configuration the matrix must match
+   * @param adaptivityConfig the adaptivity configuration the matrix must match
+   * @param regularizationConfig the regularization configuration the matrix must match
+   * @param densityEstimationConfig the density estimation configuration the matrix must match
+   * @return the opened file, throws an exception if no entry matches or if the file is not a
+   * valid binary file
+   */
+  std::unique_ptr<DBMatBinaryFile> openDataMatrix(
+      sgpp::base::GeneralGridConfiguration& gridConfig,
+      sgpp::base::AdaptivityConfiguration& adaptivityConfig,
+      sgpp::datadriven::RegularizationConfiguration& regularizationConfig,
+      sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig);
+
   /**
    * Puts a filepath for a given configuration in the database. The filepath refers to the matrix
    * file. If for this configuration a filepath is already present in the database the filepath
@@ -0,0 +1,1186 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/algorithm/DBMatDenseDecomposition.hpp>
+
+#include <sgpp/base/exception/algorithm_exception.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#ifdef USE_LAPACK
+// LAPACK/BLAS routines (Fortran interface, column-major storage)
+extern "C" {
+void dpotrf_(const char* uplo, const int* n, double* a, const int* lda, int* info);
+void dtrsm_(const char* side, const char* uplo, const char* transa, const char* diag,
+            const int* m, const int* n, const double* alpha, const double* a, const int* lda,
+            double* b, const int* ldb);
+void dsyrk_(const char* uplo, const char* trans, const int* n, const int* k, const double* alpha,
+            const double* a, const int* lda, const double* beta, double* c, const int* ldc);
+void dsytrd_(const char* uplo, const int* n, double* a, const int* lda, double* d, double* e,
+             double* tau, double* work, const int* lwork, int* info);
+void dorgtr_(const char* uplo, const int* n, double* a, const int* lda, const double* tau,
+             double* work, const int* lwork, int* info);
+void dsyevd_(const char* jobz, const char* uplo, const int* n, double* a, const int* lda,
+             double* w, double* work, const int* lwork, int* iwork, const int* liwork, int* info);
+void dgemv_(const char* trans, const int* m, const int* n, const double* alpha, const double* a,
+            const int* lda, const double* x, const int* incx, const double* beta, double* y,
+            const int* incy);
+}
+#endif /* USE_LAPACK */
+
+namespace sgpp {
+namespace datadriven {
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::algorithm_exception;
+
+bool DBMatDenseDecomposition::isLapackUsed() {
+#ifdef USE_LAPACK
+  return true;
+#else
+  return false;
+#endif /* USE_LAPACK */
+}
+
+void DBMatDenseDecomposition::choleskyDecomposition(DataMatrix& matrix, size_t blockSize) {
+  const size_t n = matrix.getNrows();
+
+  if (matrix.getNcols() != n) {
+    throw algorithm_exception("Matrix has to be square");
+  }
+
+  if (n == 0) {
+    return;
+  }
+
+  double* a = matrix.getPointer();
+
+#ifdef USE_LAPACK
+  // row-major lower triangular L is column-major upper triangular L^T
+  const int nInt = static_cast<int>(n);
+  int info = 0;
+  dpotrf_("U", &nInt, a, &nInt, &info);
+
+  if (info != 0) {
+    throw algorithm_exception("Matrix is not positive definite");
+  }
+#else
+  blockSize = std::max(blockSize, static_cast<size_t>(1));
+
+  for (size_t k = 0; k < n; k += blockSize) {
+    const size_t kEnd = std::min(k + blockSize, n);
+
+    // factorize diagonal block (contributions of previous blocks are already subtracted)
+    for (size_t j = k; j < kEnd; j++) {
+      double* rowJ = a + j * n;
+      double s = rowJ[j];
+
+      for (size_t p = k; p < j; p++) {
+        s -= rowJ[p] * rowJ[p];
+      }
+
+      if (s <= 0.0) {
+        throw algorithm_exception("Matrix is not positive definite");
+      }
+
+      rowJ[j] = std::sqrt(s);
+
+      for (size_t i = j + 1; i < kEnd; i++) {
+        double* rowI = a + i * n;
+        double t = rowI[j];
+
+        for (size_t p = k; p < j; p++) {
+          t -= rowI[p] * rowJ[p];
+        }
+
+        rowI[j] = t / rowJ[j];
+      }
+    }
+
+    if (kEnd == n) {
+      break;
+    }
+
+    // panel below the diagonal block: L21 = A21 * L11^{-t} (rows are independent)
+#pragma omp parallel for schedule(static)
+    for (size_t i = kEnd; i < n; i++) {
+      double* rowI = a + i * n;
+
+      for (size_t j = k; j < kEnd; j++) {
+        const double* rowJ = a + j * n;
+        double t = rowI[j];
+
+        for (size_t p = k; p < j; p++) {
+          t -= rowI[p] * rowJ[p];
+        }
+
+        rowI[j] = t / rowJ[j];
+      }
+    }
+
+    // trailing update A22 = A22 - L21 * L21^t (lower triangle, tile by tile)
+    std::vector<std::pair<size_t, size_t>> tiles;
+
+    for (size_t iBegin = kEnd; iBegin < n; iBegin += blockSize) {
+      for (size_t jBegin = kEnd; jBegin <= iBegin; jBegin += blockSize) {
+        tiles.emplace_back(iBegin, jBegin);
+      }
+    }
+
+#pragma omp parallel for schedule(dynamic)
+    for (size_t tile = 0; tile < tiles.size(); tile++) {
+      const size_t iBegin = tiles[tile].first;
+      const size_t jBegin = tiles[tile].second;
+      const size_t iEnd = std::min(iBegin + blockSize, n);
+      const size_t jEnd = std::min(jBegin + blockSize, n);
+
+      for (size_t i = iBegin; i < iEnd; i++) {
+        double* rowI = a + i * n;
+        const size_t jMax = std::min(jEnd, i + 1);
+
+        for (size_t j = jBegin; j < jMax; j++) {
+          const double* rowJ = a + j * n;
+          double t = 0.0;
+
+#pragma omp simd reduction(+ : t)
+          for (size_t p = k; p < kEnd; p++) {
+            t += rowI[p] * rowJ[p];
+          }
+
+          rowI[j] -= t;
+        }
+      }
+    }
+  }
+#endif /* USE_LAPACK */
+
+  // isolate lower triangular matrix
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < n; i++) {
+    std::fill(a + i * n + i + 1, a + (i + 1) * n, 0.0);
+  }
+}
+
+void DBMatDenseDecomposition::choleskyAppend(DataMatrix& factor, const DataMatrix& newColumns,
+                                             size_t blockSize) {
+  const size_t n = factor.getNrows();
+  const size_t k = newColumns.getNcols();
+
+  if (factor.getNcols() != n) {
+    throw algorithm_exception("Cholesky factor has to be square");
+  }
+
+  if (newColumns.getNrows() != n + k) {
+    throw algorithm_exception("New columns have to match the size of the enlarged matrix");
+  }
+
+  if (k == 0) {
+    return;
+  }
+
+  const double* l = factor.getPointer();
+  const double* a = newColumns.getPointer();
+
+  // x = L21 = A21 * L11^{-t}, stored row-major (k x n), i.e. row j solves L11 * x_j = a_j
+  std::vector<double> x(k * n);
+
+#pragma omp parallel for schedule(static)
+  for (size_t j = 0; j < k; j++) {
+    for (size_t i = 0; i < n; i++) {
+      x[j * n + i] = a[i * k + j];
+    }
+  }
+
+  // Schur complement s = A22 - L21 * L21^t (lower triangular part)
+  DataMatrix schur(k, k);
+  double* s = schur.getPointer();
+
+  for (size_t i = 0; i < k; i++) {
+    for (size_t j = 0; j <= i; j++) {
+      s[i * k + j] = a[(n + i) * k + j];
+    }
+  }
+
+  if (n > 0) {
+#ifdef USE_LAPACK
+    // row-major L11 is column-major L11^t and row-major x is column-major x^t (n x k)
+    const int nInt = static_cast<int>(n);
+    const int kInt = static_cast<int>(k);
+    const double one = 1.0;
+    const double minusOne = -1.0;
+    dtrsm_("L", "U", "T", "N", &nInt, &kInt, &one, l, &nInt, x.data(), &nInt);
+    // column-major upper triangular part is row-major lower triangular part
+    dsyrk_("U", "T", &kInt, &nInt, &minusOne, x.data(), &nInt, &one, s, &kInt);
+#else
+    blockSize = std::max(blockSize, static_cast<size_t>(1));
+
+    for (size_t p = 0; p < n; p += blockSize) {
+      const size_t pEnd = std::min(p + blockSize, n);
+
+      // forward substitution with the diagonal block of L11
+#pragma omp parallel for schedule(static)
+      for (size_t j = 0; j < k; j++) {
+        double* rowJ = x.data() + j * n;
+
+        for (size_t i = p; i < pEnd; i++) {
+          const double* rowI = l + i * n;
+          double t = rowJ[i];
+
+          for (size_t q = p; q < i; q++) {
+            t -= rowI[q] * rowJ[q];
+          }
+
+          rowJ[i] = t / rowI[i];
+        }
+      }
+
+      // update of the remaining entries with the panel below the diagonal block
+      // (rows of L11 are independent)
+#pragma omp parallel for schedule(dynamic, 16)
+      for (size_t i = pEnd; i < n; i++) {
+        const double* rowI = l + i * n;
+
+        for (size_t j = 0; j < k; j++) {
+          double* rowJ = x.data() + j * n;
+          double t = 0.0;
+
+#pragma omp simd reduction(+ : t)
+          for (size_t q = p; q < pEnd; q++) {
+            t += rowI[q] * rowJ[q];
+          }
+
+          rowJ[i] -= t;
+        }
+      }
+    }
+
+#pragma omp parallel for schedule(dynamic)
+    for (size_t i = 0; i < k; i++) {
+      const double* rowI = x.data() + i * n;
+
+      for (size_t j = 0; j <= i; j++) {
+        const double* rowJ = x.data() + j * n;
+        double t = 0.0;
+
+#pragma omp simd reduction(+ : t)
+        for (size_t q = 0; q < n; q++) {
+          t += rowI[q] * rowJ[q];
+        }
+
+        s[i * k + j] -= t;
+      }
+    }
+#endif /* USE_LAPACK */
+  }
+
+  // L22 (the Schur complement is positive definite iff the enlarged matrix is)
+  choleskyDecomposition(schur, blockSize);
+
+  const size_t size = n + k;
+  DataMatrix result(size, size, 0.0);
+  double* r = result.getPointer();
+
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < size; i++) {
+    if (i < n) {
+      std::copy(l + i * n, l + i * n + i + 1, r + i * size);
+    } else {
+      std::copy(x.data() + (i - n) * n, x.data() + (i - n + 1) * n, r + i * size);
+      std::copy(s + (i - n) * k, s + (i - n) * k + (i - n) + 1, r + i * size + n);
+    }
+  }
+
+  factor = std::move(result);
+}
+
+void DBMatDenseDecomposition::choleskyRemove(DataMatrix& factor,
+                                             const std::vector<size_t>& removedIndices,
+                                             size_t blockSize) {
+  const size_t n = factor.getNrows();
+  const size_t d = removedIndices.size();
+
+  if (factor.getNcols() != n) {
+    throw algorithm_exception("Cholesky factor has to be square");
+  }
+
+  if (d == 0) {
+    return;
+  }
+
+  for (size_t t = 0; t < d; t++) {
+    if ((removedIndices[t] >= n) || ((t > 0) && (removedIndices[t] <= removedIndices[t - 1]))) {
+      throw algorithm_exception("Removed indices have to be strictly increasing and in range");
+    }
+  }
+
+  blockSize = std::max(blockSize, static_cast<size_t>(1));
+
+  // rows/columns before the first removed index are not affected
+  const size_t m = removedIndices[0];
+  const size_t size = n - d;
+  const size_t r = size - m;
+  const double* l = factor.getPointer();
+
+  // remaining rows/columns behind m
+  std::vector<size_t> kept;
+  kept.reserve(r);
+
+  for (size_t i = m, t = 0; i < n; i++) {
+    if ((t < d) && (removedIndices[t] == i)) {
+      t++;
+    } else {
+      kept.push_back(i);
+    }
+  }
+
+  // result = [L(kept, kept), 0] (c = trailing r x r block, lower triangular),
+  // e = L(kept, removed) (r x d); the new trailing block g satisfies
+  // g * g^t = c * c^t + e * e^t, i.e. [c, e] * Q = [g, 0] (LQ decomposition)
+  DataMatrix result(size, size, 0.0);
+  double* res = result.getPointer();
+  std::vector<double> e(r * d);
+
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < size; i++) {
+    if (i < m) {
+      std::copy(l + i * n, l + i * n + i + 1, res + i * size);
+    } else {
+      const double* rowL = l + kept[i - m] * n;
+      double* rowR = res + i * size;
+      std::copy(rowL, rowL + m, rowR);
+
+      for (size_t j = 0; j <= i - m; j++) {
+        rowR[m + j] = rowL[kept[j]];
+      }
+
+      for (size_t t = 0; t < d; t++) {
+        e[(i - m) * d + t] = rowL[removedIndices[t]];
+      }
+    }
+  }
+
+  // Householder vectors v_i = [1, w_i] (acting on column i of c and all columns of e),
+  // scaling factors and triangular factor of the compact WY representation of a block
+  std::vector<double> w(blockSize * d);
+  std::vector<double> tau(blockSize);
+  std::vector<double> tri(blockSize * blockSize);
+
+  for (size_t b = 0; b < r; b += blockSize) {
+    const size_t bEnd = std::min(b + blockSize, r);
+    const size_t nb = bEnd - b;
+
+    for (size_t i = b; i < bEnd; i++) {
+      double* rowC = res + (m + i) * size + m;
+      double* rowE = e.data() + i * d;
+      double* wI = w.data() + (i - b) * d;
+
+      // reflection mapping [c_ii, e_i] to [mu, 0] with mu > 0
+      double sigma = 0.0;
+
+      for (size_t t = 0; t < d; t++) {
+        sigma += rowE[t] * rowE[t];
+      }
+
+      const double alpha = rowC[i];
+
+      if (sigma == 0.0) {
+        tau[i - b] = 0.0;
+        std::fill(wI, wI + d, 0.0);
+
+        if (alpha <= 0.0) {
+          throw algorithm_exception("Matrix is not positive definite");
+        }
+
+        continue;
+      }
+
+      const double mu = std::sqrt(alpha * alpha + sigma);
+      const double v0 = (alpha <= 0.0) ? (alpha - mu) : (-sigma / (alpha + mu));
+      tau[i - b] = 2.0 * v0 * v0 / (sigma + v0 * v0);
+
+      for (size_t t = 0; t < d; t++) {
+        wI[t] = rowE[t] / v0;
+        rowE[t] = 0.0;
+      }
+
+      rowC[i] = mu;
+
+      // apply the reflection to the remaining rows of the block
+      for (size_t p = i + 1; p < bEnd; p++) {
+        double* rowCP = res + (m + p) * size + m;
+        double* rowEP = e.data() + p * d;
+        double t = rowCP[i];
+
+        for (size_t q = 0; q < d; q++) {
+          t += rowEP[q] * wI[q];
+        }
+
+        t *= tau[i - b];
+        rowCP[i] -= t;
+
+        for (size_t q = 0; q < d; q++) {
+          rowEP[q] -= t * wI[q];
+        }
+      }
+    }
+
+    if (bEnd == r) {
+      break;
+    }
+
+    // H_b * ... * H_{bEnd - 1} = I - V * T * V^t with upper triangular T
+    for (size_t j = 0; j < nb; j++) {
+      const double* wJ = w.data() + j * d;
+
+      for (size_t p = 0; p < j; p++) {
+        const double* wP = w.data() + p * d;
+        double t = 0.0;
+
+        for (size_t q = 0; q < d; q++) {
+          t += wP[q] * wJ[q];
+        }
+
+        tri[p * blockSize + j] = t;
+      }
+
+      // T(0:j, j) = -tau_j * T(0:j, 0:j) * (V(:, 0:j)^t * v_j)
+      for (size_t p = 0; p < j; p++) {
+        double t = 0.0;
+
+        for (size_t q = p; q < j; q++) {
+          t += tri[p * blockSize + q] * tri[q * blockSize + j];
+        }
+
+        tri[p * blockSize + j] = t;
+      }
+
+      for (size_t p = 0; p < j; p++) {
+        tri[p * blockSize + j] *= -tau[j];
+      }
+
+      tri[j * blockSize + j] = tau[j];
+    }
+
+    // apply the block reflection to the trailing rows: y = y - (y * V) * T * V^t
+#pragma omp parallel
+    {
+      std::vector<double> y(nb);
+      std::vector<double> z(nb);
+
+#pragma omp for schedule(static)
+      for (size_t i = bEnd; i < r; i++) {
+        double* rowC = res + (m + i) * size + m + b;
+        double* rowE = e.data() + i * d;
+
+        for (size_t j = 0; j < nb; j++) {
+          const double* wJ = w.data() + j * d;
+          double t = rowC[j];
+
+#pragma omp simd reduction(+ : t)
+          for (size_t q = 0; q < d; q++) {
+            t += rowE[q] * wJ[q];
+          }
+
+          y[j] = t;
+        }
+
+        for (size_t j = 0; j < nb; j++) {
+          double t = 0.0;
+
+          for (size_t p = 0; p <= j; p++) {
+            t += y[p] * tri[p * blockSize + j];
+          }
+
+          z[j] = t;
+        }
+
+        for (size_t j = 0; j < nb; j++) {
+          const double* wJ = w.data() + j * d;
+          const double zJ = z[j];
+          rowC[j] -= zJ;
+
+#pragma omp simd
+          for (size_t q = 0; q < d; q++) {
+            rowE[q] -= zJ * wJ[q];
+          }
+        }
+      }
+    }
+  }
+
+  factor = std::move(result);
+}
+
+void DBMatDenseDecomposition::tridiagonalDecomposition(DataMatrix& matrix, DataMatrix& q,
+                                                       DataVector& diag, DataVector& subdiag,
+                                                       size_t blockSize) {
+  const size_t n = matrix.getNrows();
+
+  if (matrix.getNcols() != n) {
+    throw algorithm_exception("Matrix has to be square");
+  }
+
+  diag.resize(n);
+  subdiag.resize((n > 0) ? (n - 1) : 0);
+  q.resizeQuadratic(n);
+
+  if (n == 0) {
+    return;
+  }
+
+#ifdef USE_LAPACK
+  // the matrix is symmetric, i.e., row-major and column-major storage coincide
+  const int nInt = static_cast<int>(n);
+  int info = 0;
+  std::vector<double> e(std::max(n - 1, static_cast<size_t>(1)));
+  std::vector<double> tau(std::max(n - 1, static_cast<size_t>(1)));
+  double workSize = 0.0;
+  int lwork = -1;
+
+  dsytrd_("L", &nInt, matrix.getPointer(), &nInt, diag.getPointer(), e.data(), tau.data(),
+          &workSize, &lwork, &info);
+  lwork = static_cast<int>(workSize);
+  std::vector<double> work(std::max(lwork, 1));
+  dsytrd_("L", &nInt, matrix.getPointer(), &nInt, diag.getPointer(), e.data(), tau.data(),
+          work.data(), &lwork, &info);
+
+  if (info != 0) {
+    throw algorithm_exception("Tridiagonalization failed");
+  }
+
+  lwork = -1;
+  dorgtr_("L", &nInt, matrix.getPointer(), &nInt, tau.data(), &workSize, &lwork, &info);
+  lwork = static_cast<int>(workSize);
+  work.resize(std::max(lwork, 1));
+  dorgtr_("L", &nInt, matrix.getPointer(), &nInt, tau.data(), work.data(), &lwork, &info);
+
+  if (info != 0) {
+    throw algorithm_exception("Tridiagonalization failed");
+  }
+
+  std::copy(e.begin(), e.begin() + (n - 1), subdiag.getPointer());
+
+  // Q is stored column-major
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = 0; j < n; j++) {
+      q.set(i, j, matrix.get(j, i));
+    }
+  }
+#else
+  DataVector tau((n > 0) ? (n - 1) : 0);
+  reduceToTridiagonal(matrix, diag, subdiag, tau, blockSize);
+  accumulateReflections(matrix, tau, q, blockSize);
+#endif /* USE_LAPACK */
+}
+
+void DBMatDenseDecomposition::eigenDecomposition(DataMatrix& matrix, DataVector& eigenvalues,
+                                                 DataMatrix& eigenvectors, size_t blockSize) {
+  const size_t n = matrix.getNrows();
+
+  if (matrix.getNcols() != n) {
+    throw algorithm_exception("Matrix has to be square");
+  }
+
+  eigenvalues.resize(n);
+  eigenvectors.resizeQuadratic(n);
+
+  if (n == 0) {
+    return;
+  }
+
+#ifdef USE_LAPACK
+  const int nInt = static_cast<int>(n);
+  int info = 0;
+  double workSize = 0.0;
+  int iworkSize = 0;
+  int lwork = -1;
+  int liwork = -1;
+
+  dsyevd_("V", "L", &nInt, matrix.getPointer(), &nInt, eigenvalues.getPointer(), &workSize,
+          &lwork, &iworkSize, &liwork, &info);
+  lwork = static_cast<int>(workSize);
+  liwork = iworkSize;
+  std::vector<double> work(std::max(lwork, 1));
+  std::vector<int> iwork(std::max(liwork, 1));
+  dsyevd_("V", "L", &nInt, matrix.getPointer(), &nInt, eigenvalues.getPointer(), work.data(),
+          &lwork, iwork.data(), &liwork, &info);
+
+  if (info != 0) {
+    throw algorithm_exception("Eigen decomposition did not converge");
+  }
+
+  // eigenvectors are stored column-major
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = 0; j < n; j++) {
+      eigenvectors.set(i, j, matrix.get(j, i));
+    }
+  }
+#else
+  DataVector subdiag;
+  tridiagonalDecomposition(matrix, eigenvectors, eigenvalues, subdiag, blockSize);
+  tridiagonalQL(eigenvalues, subdiag, eigenvectors);
+#endif /* USE_LAPACK */
+}
+
+void DBMatDenseDecomposition::invertSymmetricTridiagonal(const DataVector& diag,
+                                                         const DataVector& subdiag,
+                                                         DataMatrix& inverse) {
+  const size_t n = diag.getSize();
+  inverse.resizeQuadratic(n);
+
+  if (n == 0) {
+    return;
+  }
+
+  // T = L * D * L^t with unit lower bidiagonal L
+  DataVector d(n);
+  DataVector l((n > 0) ? (n - 1) : 0);
+  d[0] = diag[0];
+
+  for (size_t i = 0; i + 1 < n; i++) {
+    if (d[i] == 0.0) {
+      throw algorithm_exception("Tridiagonal matrix is singular");
+    }
+
+    l[i] = subdiag[i] / d[i];
+    d[i + 1] = diag[i + 1] - l[i] * subdiag[i];
+  }
+
+  if (d[n - 1] == 0.0) {
+    throw algorithm_exception("Tridiagonal matrix is singular");
+  }
+
+  // column k of T^{-1} is the solution of T * x = e_k
+  // (as T^{-1} is symmetric, it is stored as row k)
+#pragma omp parallel for schedule(static)
+  for (size_t k = 0; k < n; k++) {
+    double* x = inverse.getPointer() + k * n;
+
+    // forward substitution L * y = e_k (y vanishes before k)
+    std::fill(x, x + k, 0.0);
+    x[k] = 1.0;
+
+    for (size_t i = k + 1; i < n; i++) {
+      x[i] = -l[i - 1] * x[i - 1];
+    }
+
+    // D * z = y, backward substitution L^t * x = z
+    x[n - 1] /= d[n - 1];
+
+    for (size_t i = n - 1; i-- > 0;) {
+      x[i] = x[i] / d[i] - l[i] * x[i + 1];
+    }
+  }
+}
+
+void DBMatDenseDecomposition::matrixVectorProduct(const DataMatrix& matrix, size_t rows,
+                                                  size_t cols, bool transpose, const double* x,
+                                                  double beta, double* y) {
+  if ((rows == 0) || (cols == 0)) {
+    const size_t m = (transpose ? cols : rows);
+
+    for (size_t i = 0; i < m; i++) {
+      y[i] = ((beta == 0.0) ? 0.0 : (beta * y[i]));
+    }
+
+    return;
+  }
+
+  const size_t stride = matrix.getNcols();
+  const double* a = matrix.getPointer();
+
+#ifdef USE_LAPACK
+  // the row-major block is the transposed column-major block
+  const int m = static_cast<int>(cols);
+  const int n = static_cast<int>(rows);
+  const int lda = static_cast<int>(stride);
+  const int inc = 1;
+  const double one = 1.0;
+  dgemv_(transpose ? "N" : "T", &m, &n, &one, a, &lda, x, &inc, &beta, y, &inc);
+#else
+  if (!transpose) {
+#pragma omp parallel for schedule(static)
+    for (size_t i = 0; i < rows; i++) {
+      const double* row = a + i * stride;
+      double sum = 0.0;
+
+      for (size_t j = 0; j < cols; j++) {
+        sum += row[j] * x[j];
+      }
+
+      y[i] = ((beta == 0.0) ? sum : (beta * y[i] + sum));
+    }
+  } else {
+    // traverse A row by row, every thread accumulates chunks of y
+    const size_t chunkSize = 256;
+
+#pragma omp parallel for schedule(static)
+    for (size_t jBegin = 0; jBegin < cols; jBegin += chunkSize) {
+      const size_t jEnd = std::min(jBegin + chunkSize, cols);
+
+      for (size_t j = jBegin; j < jEnd; j++) {
+        y[j] = ((beta == 0.0) ? 0.0 : (beta * y[j]));
+      }
+
+      for (size_t i = 0; i < rows; i++) {
+        const double* row = a + i * stride;
+        const double xi = x[i];
+
+        for (size_t j = jBegin; j < jEnd; j++) {
+          y[j] += row[j] * xi;
+        }
+      }
+    }
+  }
+#endif /* USE_LAPACK */
+}
+
+void DBMatDenseDecomposition::reduceToTridiagonal(DataMatrix& matrix, DataVector& diag,
+                                                  DataVector& subdiag, DataVector& tau,
+                                                  size_t blockSize) {
+  const size_t n = matrix.getNrows();
+  double* a = matrix.getPointer();
+  blockSize = std::max(blockSize, static_cast<size_t>(1));
+
+  // Householder reflections H_k = I - tau_k * v_k * v_k^t for k = 0, ..., n - 3,
+  // where v_k vanishes in the first k + 1 entries and has entry 1 at k + 1;
+  // the reflections are computed in panels of blockSize columns, the trailing
+  // matrix is updated once per panel by a rank-(2 * blockSize) update
+  // A = A - V * W^t - W * V^t (only the lower triangle of A is referenced)
+  for (size_t kb = 0; kb + 2 < n; kb += blockSize) {
+    const size_t kbEnd = std::min(kb + blockSize, n - 2);
+    const size_t nb = kbEnd - kb;
+    std::vector<double> v(n * nb, 0.0);
+    std::vector<double> w(n * nb, 0.0);
+    std::vector<double> y(n);
+    std::vector<double> vj(n);
+
+    for (size_t jj = 0; jj < nb; jj++) {
+      const size_t j = kb + jj;
+
+      // apply the previous reflections of the panel to column j
+      for (size_t i = j; i < n; i++) {
+        double t = 0.0;
+
+        for (size_t q = 0; q < jj; q++) {
+          t += v[i * nb + q] * w[j * nb + q] + w[i * nb + q] * v[j * nb + q];
+        }
+
+        a[i * n + j] -= t;
+      }
+
+      diag[j] = a[j * n + j];
+
+      // Householder vector annihilating A(j+2:n, j)
+      const double alpha = a[(j + 1) * n + j];
+      double xNorm = 0.0;
+
+      for (size_t i = j + 2; i < n; i++) {
+        xNorm += a[i * n + j] * a[i * n + j];
+      }
+
+      xNorm = std::sqrt(xNorm);
+
+      double beta = 0.0;
+      v[(j + 1) * nb + jj] = 1.0;
+
+      if (xNorm == 0.0) {
+        subdiag[j] = alpha;
+
+        for (size_t i = j + 2; i < n; i++) {
+          a[i * n + j] = 0.0;
+        }
+      } else {
+        const double mu = (alpha >= 0.0 ? -1.0 : 1.0) * std::hypot(alpha, xNorm);
+        const double scale = 1.0 / (alpha - mu);
+        beta = (mu - alpha) / mu;
+        subdiag[j] = mu;
+
+        for (size_t i = j + 2; i < n; i++) {
+          a[i * n + j] *= scale;
+          v[i * nb + jj] = a[i * n + j];
+        }
+      }
+
+      tau[j] = beta;
+
+      if (beta == 0.0) {
+        continue;
+      }
+
+      // y = A(j+1:n, j+1:n) * v (the trailing matrix is not yet updated by this panel);
+      // only the lower triangle is read, each thread accumulates the contributions
+      // of the upper triangle in its own vector
+      for (size_t i = j + 1; i < n; i++) {
+        vj[i] = v[i * nb + jj];
+        y[i] = 0.0;
+      }
+
+#pragma omp parallel
+      {
+        std::vector<double> yLocal(n, 0.0);
+
+#pragma omp for schedule(dynamic, 16)
+        for (size_t i = j + 1; i < n; i++) {
+          const double* rowI = a + i * n;
+          const double vi = vj[i];
+          double t = 0.0;
+
+#pragma omp simd reduction(+ : t)
+          for (size_t l = j + 1; l < i; l++) {
+            t += rowI[l] * vj[l];
+            yLocal[l] += rowI[l] * vi;
+          }
+
+          yLocal[i] += t + rowI[i] * vi;
+        }
+
+#pragma omp critical
+        {
+          for (size_t i = j + 1; i < n; i++) {
+            y[i] += yLocal[i];
+          }
+        }
+      }
+
+      // w = beta * (y - V * (W^t * v) - W * (V^t * v)), w = w - (beta / 2 * w^t * v) * v
+      std::vector<double> wv(jj, 0.0);
+      std::vector<double> vv(jj, 0.0);
+
+      for (size_t i = j + 1; i < n; i++) {
+        for (size_t q = 0; q < jj; q++) {
+          wv[q] += w[i * nb + q] * v[i * nb + jj];
+          vv[q] += v[i * nb + q] * v[i * nb + jj];
+        }
+      }
+
+      double wTv = 0.0;
+
+      for (size_t i = j + 1; i < n; i++) {
+        double t = y[i];
+
+        for (size_t q = 0; q < jj; q++) {
+          t -= v[i * nb + q] * wv[q] + w[i * nb + q] * vv[q];
+        }
+
+        w[i * nb + jj] = beta * t;
+        wTv += w[i * nb + jj] * v[i * nb + jj];
+      }
+
+      const double gamma = -0.5 * beta * wTv;
+
+      for (size_t i = j + 1; i < n; i++) {
+        w[i * nb + jj] += gamma * v[i * nb + jj];
+      }
+    }
+
+    // update lower triangle of trailing matrix (rows are independent)
+#pragma omp parallel for schedule(dynamic, 16)
+    for (size_t i = kbEnd; i < n; i++) {
+      double* rowI = a + i * n;
+      const double* vI = &v[i * nb];
+      const double* wI = &w[i * nb];
+
+      for (size_t l = kbEnd; l <= i; l++) {
+        const double* vL = &v[l * nb];
+        const double* wL = &w[l * nb];
+        double t = 0.0;
+
+#pragma omp simd reduction(+ : t)
+        for (size_t q = 0; q < nb; q++) {
+          t += vI[q] * wL[q] + wI[q] * vL[q];
+        }
+
+        rowI[l] -= t;
+      }
+    }
+  }
+
+  // last 2 x 2 block (or 1 x 1 matrix)
+  if (n >= 2) {
+    diag[n - 2] = a[(n - 2) * n + (n - 2)];
+    subdiag[n - 2] = a[(n - 1) * n + (n - 2)];
+    tau[n - 2] = 0.0;
+  }
+
+  diag[n - 1] = a[(n - 1) * n + (n - 1)];
+}
+
+void DBMatDenseDecomposition::accumulateReflections(const DataMatrix& matrix,
+                                                    const DataVector& tau, DataMatrix& q,
+                                                    size_t blockSize) {
+  const size_t n = matrix.getNrows();
+  const double* a = matrix.getPointer();
+  double* qData = q.getPointer();
+  blockSize = std::max(blockSize, static_cast<size_t>(1));
+
+  // Q = H_0 * ... * H_{n-3} is accumulated backwards, panel by panel
+  // with the compact WY representation H_kb * ... * H_{kbEnd-1} = I - V * T * V^t
+  q.setAll(0.0);
+
+  for (size_t i = 0; i < n; i++) {
+    qData[i * n + i] = 1.0;
+  }
+
+  if (n < 3) {
+    return;
+  }
+
+  std::vector<size_t> panelStarts;
+
+  for (size_t kb = 0; kb + 2 < n; kb += blockSize) {
+    panelStarts.push_back(kb);
+  }
+
+  for (size_t panel = panelStarts.size(); panel-- > 0;) {
+    const size_t kb = panelStarts[panel];
+    const size_t kbEnd = std::min(kb + blockSize, n - 2);
+    const size_t nb = kbEnd - kb;
+    // the reflections of the panel act on rows and columns kb+1, ..., n-1
+    const size_t offset = kb + 1;
+    const size_t m = n - offset;
+
+    // V (m x nb)
+    std::vector<double> v(m * nb, 0.0);
+
+    for (size_t jj = 0; jj < nb; jj++) {
+      const size_t j = kb + jj;
+      v[(j + 1 - offset) * nb + jj] = 1.0;
+
+      for (size_t i = j + 2; i < n; i++) {
+        v[(i - offset) * nb + jj] = a[i * n + j];
+      }
+    }
+
+    // upper triangular T (nb x nb)
+    std::vector<double> t(nb * nb, 0.0);
+    std::vector<double> z(nb);
+
+    for (size_t jj = 0; jj < nb; jj++) {
+      const double tauJ = tau[kb + jj];
+
+      for (size_t r = 0; r < jj; r++) {
+        z[r] = 0.0;
+
+        for (size_t i = 0; i < m; i++) {
+          z[r] += v[i * nb + r] * v[i * nb + jj];
+        }
+      }
+
+      for (size_t r = 0; r < jj; r++) {
+        double s = 0.0;
+
+        for (size_t c = r; c < jj; c++) {
+          s += t[r * nb + c] * z[c];
+        }
+
+        t[r * nb + jj] = -tauJ * s;
+      }
+
+      t[jj * nb + jj] = tauJ;
+    }
+
+    // Y = T * (V^t * Q(offset:n, offset:n)) (nb x m), column tiles are independent
+    std::vector<double> yMat(nb * m, 0.0);
+
+#pragma omp parallel for schedule(static)
+    for (size_t cBegin = 0; cBegin < m; cBegin += blockSize) {
+      const size_t width = std::min(blockSize, m - cBegin);
+      std::vector<double> vTq(nb * width, 0.0);
+
+      for (size_t i = 0; i < m; i++) {
+        const double* rowQ = qData + (i + offset) * n + offset + cBegin;
+
+        for (size_t r = 0; r < nb; r++) {
+          const double vir = v[i * nb + r];
+
+          if (vir == 0.0) {
+            continue;
+          }
+
+          double* rowVTQ = &vTq[r * width];
+
+#pragma omp simd
+          for (size_t c = 0; c < width; c++) {
+            rowVTQ[c] += vir * rowQ[c];
+          }
+        }
+      }
+
+      for (size_t r = 0; r < nb; r++) {
+        for (size_t r2 = r; r2 < nb; r2++) {
+          const double trr2 = t[r * nb + r2];
+
+          for (size_t c = 0; c < width; c++) {
+            yMat[r * m + cBegin + c] += trr2 * vTq[r2 * width + c];
+          }
+        }
+      }
+    }
+
+    // Q(offset:n, offset:n) = Q(offset:n, offset:n) - V * Y (rows are independent)
+#pragma omp parallel for schedule(static)
+    for (size_t i = 0; i < m; i++) {
+      double* rowQ = qData + (i + offset) * n + offset;
+
+      for (size_t r = 0; r < nb; r++) {
+        const double vir = v[i * nb + r];
+
+        if (vir == 0.0) {
+          continue;
+        }
+
+        const double* rowY = &yMat[r * m];
+
+#pragma omp simd
+        for (size_t c = 0; c < m; c++) {
+          rowQ[c] -= vir * rowY[c];
+        }
+      }
+    }
+  }
+}
+
+void DBMatDenseDecomposition::tridiagonalQL(DataVector& diag, const DataVector& subdiag,
+                                            DataMatrix& q) {
+  const size_t n = diag.getSize();
+  const size_t maxIterationCount = 30 * n;
+  const double eps = std::numeric_limits<double>::epsilon();
+  // the rotations act on columns of Q, i.e., on rows of Q^t (contiguous)
+  DataMatrix qTransposed(n, n);
+
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < n; i++) {
+    for (size_t k = 0; k < n; k++) {
+      qTransposed.set(i, k, q.get(k, i));
+    }
+  }
+
+  double* qData = qTransposed.getPointer();
+  // width of the column chunks of Q^t to which the rotations are applied in parallel
+  const size_t chunkSize = 256;
+
+  std::vector<double> e(n, 0.0);
+  std::copy(subdiag.getPointer(), subdiag.getPointer() + subdiag.getSize(), e.begin());
+
+  // Givens rotations of the current sweep
+  std::vector<double> cosines(n);
+  std::vector<double> sines(n);
+  size_t iterationCount = 0;
+  double f = 0.0;
+  double tst1 = 0.0;
+
+  for (size_t l = 0; l < n; l++) {
+    // find small subdiagonal element
+    tst1 = std::max(tst1, std::abs(diag[l]) + std::abs(e[l]));
+    size_t m = l;
+
+    while (m + 1 < n) {
+      if (std::abs(e[m]) <= eps * tst1) {
+        break;
+      }
+
+      m++;
+    }
+
+    // if m == l, diag[l] is already an eigenvalue, otherwise iterate
+    if (m > l) {
+      do {
+        if (++iterationCount > maxIterationCount) {
+          throw algorithm_exception("Eigen decomposition did not converge");
+        }
+
+        // compute implicit shift
+        double g = diag[l];
+        double p = (diag[l + 1] - g) / (2.0 * e[l]);
+        double r = std::hypot(p, 1.0);
+
+        if (p < 0.0) {
+          r = -r;
+        }
+
+        diag[l] = e[l] / (p + r);
+        diag[l + 1] = e[l] * (p + r);
+        const double dl1 = diag[l + 1];
+        double h = g - diag[l];
+
+        for (size_t i = l + 2; i < n; i++) {
+          diag[i] -= h;
+        }
+
+        f += h;
+
+        // implicit QL transformation
+        p = diag[m];
+        double c = 1.0;
+        double c2 = c;
+        double c3 = c;
+        const double el1 = e[l + 1];
+        double s = 0.0;
+        double s2 = 0.0;
+
+        for (size_t i = m; i-- > l;) {
+          c3 = c2;
+          c2 = c;
+          s2 = s;
+          g = c * e[i];
+          h = c * p;
+          r = std::hypot(p, e[i]);
+          e[i + 1] = s * r;
+          s = e[i] / r;
+          c = p / r;
+          p = c * diag[i] - s * g;
+          diag[i + 1] = h + s * (c * g + s * diag[i]);
+          cosines[i] = c;
+          sines[i] = s;
+        }
+
+        // accumulate transformation
+#pragma omp parallel for schedule(static)
+        for (size_t kBegin = 0; kBegin < n; kBegin += chunkSize) {
+          const size_t kEnd = std::min(kBegin + chunkSize, n);
+
+          for (size_t i = m; i-- > l;) {
+            const double ci = cosines[i];
+            const double si = sines[i];
+            double* rowI = qData + i * n;
+            double* rowNext = qData + (i + 1) * n;
+
+#pragma omp simd
+            for (size_t k = kBegin; k < kEnd; k++) {
+              const double qNext = rowNext[k];
+              rowNext[k] = si * rowI[k] + ci * qNext;
+              rowI[k] = ci * rowI[k] - si * qNext;
+            }
+          }
+        }
+
+        p = -s * s2 * c3 * el1 * e[l] / dl1;
+        e[l] = s * p;
+        diag[l] = c * p;
+      } while (std::abs(e[l]) > eps * tst1);
+    }
+
+    diag[l] += f;
+    e[l] = 0.0;
+  }
+
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < n; i++) {
+    for (size_t k = 0; k < n; k++) {
+      q.set(i, k, qTransposed.get(k, i));
+    }
+  }
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,180 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Dense decompositions of symmetric matrices used by the offline phase of the
+ * DBMatOffline* classes (shared memory).
+ *
+ * If SG++ was configured with LAPACK (USE_LAPACK), the decompositions are
+ * delegated to the corresponding LAPACK routines, which are usually tuned and
+ * multithreaded by the underlying BLAS. Otherwise, built-in blocked
+ * implementations are used, which work on tiles of blockSize x blockSize
+ * entries and are parallelized with OpenMP.
+ *
+ * All matrices are stored row-major (as in DataMatrix).
+ */
+class DBMatDenseDecomposition {
+ public:
+  /// default block (tile) size of the built-in implementations
+  static const size_t DEFAULT_BLOCK_SIZE = 64;
+
+  /**
+   * @return whether the decompositions are delegated to LAPACK
+   */
+  static bool isLapackUsed();
+
+  /**
+   * Cholesky decomposition A = L * L^T of a symmetric positive definite matrix.
+   * Throws an algorithm_exception if the matrix is not positive definite.
+   *
+   * @param[in,out] matrix    before: matrix A, after: lower triangular matrix L
+   *                          (the strictly upper triangular part is set to zero)
+   * @param         blockSize tile size of the built-in implementation
+   */
+  static void choleskyDecomposition(sgpp::base::DataMatrix& matrix,
+                                    size_t blockSize = DEFAULT_BLOCK_SIZE);
+
+  /**
+   * Rank-k update of a Cholesky factor when k rows/columns are appended to the matrix
+   * (e.g. refinement). All new rows are computed together: L21 = A21 * L11^{-t} by a blocked
+   * triangular solve, the Schur complement A22 - L21 * L21^t by a symmetric rank-k product
+   * (both parallelized over rows) and L22 by a Cholesky decomposition.
+   * Throws an algorithm_exception if the enlarged matrix is not positive definite.
+   *
+   * @param[in,out] factor      before: lower triangular n x n matrix L11,
+   *                            after: lower triangular (n + k) x (n + k) factor
+   * @param         newColumns  (n + k) x k matrix containing the appended columns of the
+   *                            enlarged matrix, i.e. A21^t above A22 (only the lower
+   *                            triangular part of A22 is used)
+   * @param         blockSize   tile size of the built-in implementation
+   */
+  static void choleskyAppend(sgpp::base::DataMatrix& factor,
+                             const sgpp::base::DataMatrix& newColumns,
+                             size_t blockSize = DEFAULT_BLOCK_SIZE);
+
+  /**
+   * Rank-k downdate of a Cholesky factor when k rows/columns are removed from the matrix
+   * (e.g. coarsening). The rows of the factor that belong to removed columns are eliminated
+   * by a blocked Householder LQ decomposition, whose reflections are applied to the trailing
+   * rows in compact WY form (parallelized over rows). The remaining rows/columns keep their
+   * relative order.
+   *
+   * @param[in,out] factor          before: lower triangular n x n matrix L,
+   *                                after: lower triangular (n - k) x (n - k) factor
+   * @param         removedIndices  strictly increasing indices of the removed rows/columns
+   * @param         blockSize       number of reflections that are applied at once
+   */
+  static void choleskyRemove(sgpp::base::DataMatrix& factor,
+                             const std::vector<size_t>& removedIndices,
+                             size_t blockSize = DEFAULT_BLOCK_SIZE);
+
+  /**
+   * Householder tridiagonalization A = Q * T * Q^t of a symmetric matrix.
+   *
+   * @param[in,out] matrix    before: matrix A, after: undefined
+   * @param[out]    q         orthogonal matrix Q
+   * @param[out]    diag      diagonal entries of T (size n)
+   * @param[out]    subdiag   sub- and superdiagonal entries of T (size n - 1)
+   * @param         blockSize panel size of the built-in implementation
+   */
+  static void tridiagonalDecomposition(sgpp::base::DataMatrix& matrix, sgpp::base::DataMatrix& q,
+                                       sgpp::base::DataVector& diag,
+                                       sgpp::base::DataVector& subdiag,
+                                       size_t blockSize = DEFAULT_BLOCK_SIZE);
+
+  /**
+   * Eigen decomposition A = Q * diag(e) * Q^t of a symmetric matrix.
+   * The eigenvalues are not sorted.
+   *
+   * @param[in,out] matrix        before: matrix A, after: undefined
+   * @param[out]    eigenvalues   eigenvalues e
+   * @param[out]    eigenvectors  orthogonal matrix Q whose columns are the eigenvectors
+   * @param         blockSize     panel size of the built-in tridiagonalization
+   */
+  static void eigenDecomposition(sgpp::base::DataMatrix& matrix,
+                                 sgpp::base::DataVector& eigenvalues,
+                                 sgpp::base::DataMatrix& eigenvectors,
+                                 size_t blockSize = DEFAULT_BLOCK_SIZE);
+
+  /**
+   * Inverts a symmetric positive definite tridiagonal matrix T
+   * (one LDL^t decomposition, columns of the inverse are computed in parallel).
+   *
+   * @param       diag      diagonal entries of T (size n)
+   * @param       subdiag   sub- and superdiagonal entries of T (size n - 1)
+   * @param[out]  inverse   T^{-1}
+   */
+  static void invertSymmetricTridiagonal(const sgpp::base::DataVector& diag,
+                                         const sgpp::base::DataVector& subdiag,
+                                         sgpp::base::DataMatrix& inverse);
+
+  /**
+   * Matrix-vector product y = op(A) * x + beta * y with the leading rows x cols
+   * block of a matrix A, where op(A) is A or A^t (dgemv of the BLAS with USE_LAPACK).
+   *
+   * @param           matrix      matrix A (the row stride is its number of columns)
+   * @param           rows        number of rows of the block
+   * @param           cols        number of columns of the block
+   * @param           transpose   whether op(A) = A^t
+   * @param           x           vector of size cols (rows if transposed)
+   * @param           beta        factor of y (if zero, y is not read)
+   * @param[in,out]   y           vector of size rows (cols if transposed)
+   */
+  static void matrixVectorProduct(const sgpp::base::DataMatrix& matrix, size_t rows, size_t cols,
+                                  bool transpose, const double* x, double beta, double* y);
+
+ protected:
+  /**
+   * Built-in blocked Householder tridiagonalization (the Householder vectors are
+   * stored in the strictly lower triangular part below the subdiagonal of matrix).
+   *
+   * @param[in,out] matrix    before: matrix A, after: Householder vectors
+   * @param[out]    diag      diagonal entries of T
+   * @param[out]    subdiag   subdiagonal entries of T
+   * @param[out]    tau       scaling factors of the Householder reflections
+   * @param         blockSize panel size
+   */
+  static void reduceToTridiagonal(sgpp::base::DataMatrix& matrix, sgpp::base::DataVector& diag,
+                                  sgpp::base::DataVector& subdiag, sgpp::base::DataVector& tau,
+                                  size_t blockSize);
+
+  /**
+   * Accumulates the Householder reflections of reduceToTridiagonal() blockwise
+   * to the orthogonal matrix Q.
+   *
+   * @param       matrix    Householder vectors
+   * @param       tau       scaling factors of the Householder reflections
+   * @param[out]  q         orthogonal matrix Q
+   * @param       blockSize panel size
+   */
+  static void accumulateReflections(const sgpp::base::DataMatrix& matrix,
+                                    const sgpp::base::DataVector& tau, sgpp::base::DataMatrix& q,
+                                    size_t blockSize);
+
+  /**
+   * Implicit QL iteration for symmetric tridiagonal matrices. The Givens rotations of
+   * each sweep are applied to column chunks of Q^t in parallel.
+   *
+   * @param[in,out] diag      before: diagonal entries of T, after: eigenvalues
+   * @param         subdiag   subdiagonal entries of T
+   * @param[in,out] q         before: Q of the tridiagonalization, after: eigenvectors
+   */
+  static void tridiagonalQL(sgpp::base::DataVector& diag, const sgpp::base::DataVector& subdiag,
+                            sgpp::base::DataMatrix& q);
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
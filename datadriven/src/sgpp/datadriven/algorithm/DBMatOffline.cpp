@@ -7,6 +7,7 @@
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/exception/algorithm_exception.hpp>
 #include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
 #include <sgpp/base/exception/not_implemented_exception.hpp>
 #include <sgpp/base/exception/operation_exception.hpp>
 #include <sgpp/base/grid/type/LinearGrid.hpp>
@@ -17,10 +18,6 @@
 #include <sgpp/datadriven/datamining/base/StringTokenizer.hpp>
 #include <sgpp/pde/operation/PdeOpFactory.hpp>
 
-#ifdef USE_GSL
-#include <gsl/gsl_matrix_double.h>
-#endif /* USE_GSL */
-
 #include <math.h>
 #include <stdio.h>
 #include <algorithm>
@@ -68,6 +65,11 @@ DBMatOffline& sgpp::datadriven::DBMatOffline::operator=(const DBMatOffline& rhs)
 
 DBMatOffline::DBMatOffline(const std::string& filepath)
     : lhsMatrix(), isConstructed(true), isDecomposed(true) {
+  // binary files are loaded by the subclass constructors (via loadSections())
+  if (DBMatBinaryFile::isBinaryFile(filepath)) {
+    return;
+  }
+
   // Parse the interactions
   parseInter(filepath, interactions);
 
@@ -128,47 +130,32 @@ void DBMatOffline::buildMatrix(Grid* grid, RegularizationConfiguration& regulari
 }
 
 void DBMatOffline::store(const std::string& fileName) {
-#ifdef USE_GSL
   if (!isDecomposed) {
     throw algorithm_exception("Matrix not decomposed yet");
-    return;
   }
 
-  // Write configuration
-  std::ofstream outputFile(fileName, std::ofstream::out);
-
-  if (!outputFile) {
-    throw algorithm_exception{"cannot open file for writing"};
-  }
+  std::vector<DBMatBinaryFile::Section> sections;
+  collectSections(sections);
+  DBMatBinaryFile::write(fileName, getDecompositionType(), interactions, sections);
+}
 
-  std::string inter = "," + std::to_string(interactions.size());
-  for (std::vector<size_t> i : interactions) {
-    inter.append("," + std::to_string(i.size()));
-    for (size_t j : i) {
-      inter.append("," + std::to_string(j));
-    }
+void DBMatOffline::load(const DBMatBinaryFile& file) {
+  if (file.getDecompositionType() != getDecompositionType()) {
+    throw base::file_exception("DBMatOffline::load : file stores another decomposition type");
   }
 
-  outputFile << lhsMatrix.getNrows() << "," << lhsMatrix.getNcols() << ","
-             << static_cast<int>(getDecompositionType()) << inter << "\n";
-  outputFile.close();
+  loadSections(file);
+}
 
-  // write matrix
-  // switch to c FILE API for GSL
-  FILE* outputCFile = fopen(fileName.c_str(), "ab");
-  if (!outputCFile) {
-    throw algorithm_exception{"cannot open file for writing"};
-  }
-  gsl_matrix_view matrixView =
-      gsl_matrix_view_array(lhsMatrix.getPointer(), lhsMatrix.getNrows(), lhsMatrix.getNcols());
-  gsl_matrix_fwrite(outputCFile, &matrixView.matrix);
+void DBMatOffline::collectSections(std::vector<DBMatBinaryFile::Section>& sections) {
+  sections.emplace_back(lhsMatrix);
+}
 
-  fclose(outputCFile);
-  std::cout << "Stored " << lhsMatrix.getNrows() << "x" << lhsMatrix.getNcols() << " matrix"
-            << std::endl;
-#else
-  throw base::not_implemented_exception("built withot GSL");
-#endif /* USE_GSL */
+void DBMatOffline::loadSections(const DBMatBinaryFile& file) {
+  interactions = file.getInteractions();
+  file.copyMatrix(0, lhsMatrix);
+  isConstructed = true;
+  isDecomposed = true;
 }
 
 void DBMatOffline::printMatrix() {
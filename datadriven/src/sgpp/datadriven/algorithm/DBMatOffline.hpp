@@ -6,6 +6,7 @@
 #pragma once
 
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/datadriven/algorithm/DBMatBinaryFile.hpp>
 #include <sgpp/datadriven/configuration/DensityEstimationConfiguration.hpp>
 #include <sgpp/datadriven/configuration/ParallelConfiguration.hpp>
 #include <sgpp/datadriven/configuration/RegularizationConfiguration.hpp>
@@ -37,6 +38,7 @@ class DBMatOffline {
   /**
    * Constructor
    * Create offline object from serialized offline object
+   * (binary files are loaded by the subclasses, see load())
    *
    * @param fileName path to the file that stores serialized offline object
    */
@@ -133,11 +135,21 @@ class DBMatOffline {
   void printMatrix();
 
   /**
-   * Serialize the DBMatOffline Object
+   * Serialize the DBMatOffline Object in the binary format (see DBMatBinaryFile).
+   * Subclasses that store more than the decomposed matrix override collectSections() and
+   * loadSections().
    * @param fileName path where to store the file.
    */
   virtual void store(const std::string& fileName);
 
+  /**
+   * Load the decomposition from a file in the binary format. The matrices are copied
+   * from the mapped file in bulk, the file is not parsed.
+   * Throws a file_exception if the file stores another decomposition type.
+   * @param file opened binary file
+   */
+  void load(const DBMatBinaryFile& file);
+
   /**
    * Returns the dimensionality of the quadratic lhs matrix (i.e. the number of rows)
    * @return the grid size
@@ -171,6 +183,20 @@ class DBMatOffline {
    */
   void parseInter(const std::string& fileName,
                   std::vector<std::vector<size_t>>& interactions) const;
+
+  /**
+   * Collect the matrices (and index vectors) that are written by store().
+   * The first section is always the decomposed matrix.
+   * @param[out] sections sections of the binary file (referring to the members of this object)
+   */
+  virtual void collectSections(std::vector<DBMatBinaryFile::Section>& sections);
+
+  /**
+   * Copy the interactions and the sections written by collectSections() from a binary file
+   * (without checking the decomposition type, such that it can be called by the constructors).
+   * @param file opened binary file
+   */
+  virtual void loadSections(const DBMatBinaryFile& file);
 };
 
 }  // namespace datadriven
@@ -52,7 +52,9 @@ class DBMatOfflineChol : public DBMatOfflineGE {
 
   /**
    * Updates offline cholesky factorization based on coarsed (deletedPoints)
-   * and refined (newPoints) gridPoints
+   * and refined (newPoints) gridPoints. All points of a coarsening/refinement step are
+   * processed together by one blocked rank-k downdate/update of the factor
+   * (see DBMatDenseDecomposition::choleskyRemove and DBMatDenseDecomposition::choleskyAppend).
    *
    * @param grid the underlying grid
    * @param densityEstimationConfig configuration for the density estimation
@@ -63,31 +65,6 @@ class DBMatOfflineChol : public DBMatOfflineGE {
   virtual void choleskyModification(Grid& grid,
       datadriven::DensityEstimationConfiguration& densityEstimationConfig, size_t newPoints,
       std::list<size_t> deletedPoints, double lambda);
-
- protected:
-  /**
-   * Permutes the rows of the cholesky factor based on permutations
-   * of the system matrix (e.g. coarsening)
-   *
-   * @param k "left" column to permutate
-   * @param l "right" column to permutate
-   * @param job = 2        => left circular shift
-   *	  1,...,k-1,k,k+1, ..., l-1,l,l+1, ..,size  => 1,...,k-1,k+1, ...,
-   *l-1,l,k,l+1,..., size
-   * 	  job = 1       => right circular shift
-   * 	  1,...,k-1,k,k+1, ..., l-1,l,l+1,...size  => 1,...,k-1,l,k,k+1, ...,
-   *l-1,l+1,...size
-   */
-  void choleskyPermutation(size_t k, size_t l, size_t job);
-
-  /**
-   * Updates the cholesky factor when a new grid point is added (e.g. refine)
-   *
-   * @param newCol DataVector with column to add to the system matrix
-   * @param size columns/rows of current Cholesky factor, necessary since the
-            allocated memory is increased before the Cholesky factor is modified
-   */
-  void choleskyAddPoint(DataVector& newCol, size_t size);
 };
 
 } /* namespace datadriven */
@@ -11,6 +11,7 @@
 
 #ifdef USE_GSL
 #include <sgpp/datadriven/algorithm/DBMatOfflineEigen.hpp>
+#include <sgpp/datadriven/algorithm/DBMatDenseDecomposition.hpp>
 
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/exception/application_exception.hpp>
@@ -20,17 +21,17 @@
 #include <sgpp/pde/operation/PdeOpFactory.hpp>
 #include <sgpp/datadriven/datamining/base/StringTokenizer.hpp>
 
-#include <gsl/gsl_blas.h>
-#include <gsl/gsl_eigen.h>
-#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_matrix_double.h>
 
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace sgpp {
 namespace datadriven {
 
 using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
 using sgpp::base::application_exception;
 using sgpp::base::data_exception;
 using sgpp::base::algorithm_exception;
@@ -40,6 +41,11 @@ DBMatOfflineEigen::DBMatOfflineEigen() {}
 
 sgpp::datadriven::DBMatOfflineEigen::DBMatOfflineEigen(const std::string& fileName)
     : DBMatOffline{fileName} {
+  if (DBMatBinaryFile::isBinaryFile(fileName)) {
+    loadSections(DBMatBinaryFile(fileName));
+    return;
+  }
+
   // Read grid size from header (number of rows in lhsMatrix)
   std::ifstream filestream(fileName, std::istream::in);
   // Read configuration
@@ -92,27 +98,15 @@ void DBMatOfflineEigen::decomposeMatrix(RegularizationConfiguration& regularizat
     }
     size_t n = lhsMatrix.getNrows();
 
-    gsl_matrix_view m = gsl_matrix_view_array(lhsMatrix.getPointer(), n,
-                                              n);  // Create GSL matrix view for decomposition
-
-    auto q = std::unique_ptr<gsl_matrix>{gsl_matrix_alloc(n, n)};  // Stores the eigenvectors
-    auto e = std::unique_ptr<gsl_vector>{gsl_vector_alloc(n)};     // Stores the eigenvalues
+    DataMatrix q;  // Stores the eigenvectors
+    DataVector e;  // Stores the eigenvalues
 
-    gsl_eigen_symmv_workspace* ws = gsl_eigen_symmv_alloc(n);
-    gsl_eigen_symmv(&m.matrix, e.get(), q.get(), ws);
-    gsl_eigen_symmv_free(ws);
+    // Perform (blocked, multithreaded) eigen decomposition
+    DBMatDenseDecomposition::eigenDecomposition(lhsMatrix, e, q);
 
     // Create an (n+1)*n matrix to store eigenvalues and -vectors:
-    lhsMatrix = DataMatrix(n + 1, n);
-
-    for (size_t r = 0; r < n; r++) {
-      for (size_t c = 0; c < n; c++) {
-        lhsMatrix.set(r, c, gsl_matrix_get(q.get(), r, c));
-      }
-    }
-    for (size_t c = 0; c < n; c++) {
-      lhsMatrix.set(n, c, gsl_vector_get(e.get(), c));
-    }
+    q.appendRow(e);
+    lhsMatrix = std::move(q);
 
     isDecomposed = true;
   } else {
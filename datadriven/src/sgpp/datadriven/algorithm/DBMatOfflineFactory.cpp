@@ -19,6 +19,7 @@
 #include <sgpp/datadriven/algorithm/DBMatOfflineOrthoAdapt.hpp>
 #include <sgpp/datadriven/datamining/base/StringTokenizer.hpp>
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -53,11 +54,7 @@ DBMatOffline* DBMatOfflineFactory::buildOfflineObject(
       break;
 
     case (MatrixDecompositionType::Chol):
-#ifdef USE_GSL
       return new DBMatOfflineChol();
-#else
-      throw factory_exception("built without GSL");
-#endif /* USE_GSL */
       break;
 
     case (MatrixDecompositionType::DenseIchol):
@@ -65,12 +62,8 @@ DBMatOffline* DBMatOfflineFactory::buildOfflineObject(
       break;
 
     case (MatrixDecompositionType::OrthoAdapt):
-#ifdef USE_GSL
       return new DBMatOfflineOrthoAdapt();
       break;
-#else
-      throw factory_exception("built without GSL");
-#endif /* USE_GSL */
 
     default:
       throw factory_exception("Trying to build offline object from unknown decomposition type");
@@ -79,7 +72,10 @@ DBMatOffline* DBMatOfflineFactory::buildOfflineObject(
 }
 
 DBMatOffline* DBMatOfflineFactory::buildFromFile(const std::string& fileName) {
-#ifdef USE_GSL
+  if (DBMatBinaryFile::isBinaryFile(fileName)) {
+    return buildFromFile(DBMatBinaryFile(fileName));
+  }
+
   std::ifstream file(fileName, std::istream::in);
 
   if (!file) {
@@ -105,10 +101,18 @@ DBMatOffline* DBMatOfflineFactory::buildFromFile(const std::string& fileName) {
 
   switch (type) {
     case (MatrixDecompositionType::Eigen):
+#ifdef USE_GSL
       return new DBMatOfflineEigen(fileName);
+#else
+      throw factory_exception("built without GSL");
+#endif /* USE_GSL */
       break;
     case (MatrixDecompositionType::LU):
+#ifdef USE_GSL
       return new DBMatOfflineLU(fileName);
+#else
+      throw factory_exception("built without GSL");
+#endif /* USE_GSL */
       break;
     case (MatrixDecompositionType::Chol):
       return new DBMatOfflineChol(fileName);
@@ -123,9 +127,46 @@ DBMatOffline* DBMatOfflineFactory::buildFromFile(const std::string& fileName) {
       throw factory_exception("Trying to build offline object from unknown decomposition type");
       return nullptr;
   }
+}
+
+DBMatOffline* DBMatOfflineFactory::buildFromFile(const DBMatBinaryFile& file) {
+  std::unique_ptr<DBMatOffline> offline;
+
+  switch (file.getDecompositionType()) {
+    case (MatrixDecompositionType::Eigen):
+#ifdef USE_GSL
+      offline.reset(new DBMatOfflineEigen());
 #else
-  throw factory_exception("built withot GSL");
+      throw factory_exception("built without GSL");
+#endif /* USE_GSL */
+      break;
+
+    case (MatrixDecompositionType::LU):
+#ifdef USE_GSL
+      offline.reset(new DBMatOfflineLU());
+#else
+      throw factory_exception("built without GSL");
 #endif /* USE_GSL */
+      break;
+
+    case (MatrixDecompositionType::Chol):
+      offline.reset(new DBMatOfflineChol());
+      break;
+
+    case (MatrixDecompositionType::DenseIchol):
+      offline.reset(new DBMatOfflineDenseIChol());
+      break;
+
+    case (MatrixDecompositionType::OrthoAdapt):
+      offline.reset(new DBMatOfflineOrthoAdapt());
+      break;
+
+    default:
+      throw factory_exception("Trying to build offline object from unknown decomposition type");
+  }
+
+  offline->load(file);
+  return offline.release();
 }
 
 } /* namespace datadriven */
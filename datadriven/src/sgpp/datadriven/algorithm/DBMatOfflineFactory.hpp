@@ -39,11 +39,21 @@ DBMatOffline* buildOfflineObject(
 
 /**
  * Read a serialized DBMatOffline object and construct a new object with the information.
+ * Both the binary format (see DBMatBinaryFile) and the legacy text format are supported.
  * @param fname Path to the serialized DBMatOffline object.
  * @return new instance of DBMatOffline implementor owned by caller.
  */
 DBMatOffline* buildFromFile(const std::string& fname);
 
+/**
+ * Construct a new DBMatOffline object from an opened binary file (e.g., opened by
+ * DBMatDatabase::openDataMatrix). The matrices are copied from the file in bulk, i.e.,
+ * the file can be closed afterwards.
+ * @param file opened binary file
+ * @return new instance of DBMatOffline implementor owned by caller.
+ */
+DBMatOffline* buildFromFile(const DBMatBinaryFile& file);
+
 } /* namespace DBMatOfflineFactory */
 } /* namespace datadriven */
 } /* namespace sgpp */
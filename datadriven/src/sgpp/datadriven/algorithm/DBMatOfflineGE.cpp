@@ -39,6 +39,11 @@ DBMatOfflineGE::DBMatOfflineGE() : DBMatOffline() {}
 
 sgpp::datadriven::DBMatOfflineGE::DBMatOfflineGE(const std::string& fileName)
     : DBMatOffline{fileName} {
+  if (DBMatBinaryFile::isBinaryFile(fileName)) {
+    loadSections(DBMatBinaryFile(fileName));
+    return;
+  }
+
   // Read grid size from header (number of rows in lhsMatrix)
   std::ifstream filestream(fileName, std::istream::in);
   // Read configuration
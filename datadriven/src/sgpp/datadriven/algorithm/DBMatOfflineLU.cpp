@@ -22,6 +22,7 @@
 #include <gsl/gsl_permutation.h>
 #include <gsl/gsl_permute.h>
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -81,6 +82,11 @@ void DBMatOfflineLU::decomposeMatrix(RegularizationConfiguration& regularization
 
 DBMatOfflineLU::DBMatOfflineLU(const std::string& fileName)
     : DBMatOfflineGE(), permutation{nullptr} {
+  if (DBMatBinaryFile::isBinaryFile(fileName)) {
+    loadSections(DBMatBinaryFile(fileName));
+    return;
+  }
+
   isConstructed = true;
   isDecomposed = true;
 
@@ -135,17 +141,18 @@ void DBMatOfflineLU::permuteVector(DataVector& b) {
   }
 }
 
-void DBMatOfflineLU::store(const std::string& fileName) {
-  // first store header and matrix
-  DBMatOffline::store(fileName);
-  // then store permutation.
-  // c file API needed for GSL
-  FILE* outputCFile = fopen(fileName.c_str(), "ab");
-  if (!outputCFile) {
-    throw algorithm_exception{"cannot open file for writing"};
-  }
-  gsl_permutation_fwrite(outputCFile, permutation.get());
-  fclose(outputCFile);
+void DBMatOfflineLU::collectSections(std::vector<DBMatBinaryFile::Section>& sections) {
+  // first the matrix, then the permutation
+  DBMatOffline::collectSections(sections);
+  sections.emplace_back(permutation->data, permutation->size);
+}
+
+void DBMatOfflineLU::loadSections(const DBMatBinaryFile& file) {
+  DBMatOffline::loadSections(file);
+  const size_t size = file.getCols(1);
+  const uint64_t* indices = file.getIndexData(1);
+  permutation = std::unique_ptr<gsl_permutation>{gsl_permutation_alloc(size)};
+  std::copy(indices, indices + size, permutation->data);
 }
 
 sgpp::datadriven::MatrixDecompositionType DBMatOfflineLU::getDecompositionType() {
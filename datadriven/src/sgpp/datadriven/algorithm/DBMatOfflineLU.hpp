@@ -17,6 +17,7 @@
 #include <gsl/gsl_permutation.h>
 
 #include <string>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -71,7 +72,20 @@ class DBMatOfflineLU : public DBMatOfflineGE {
    */
   void permuteVector(DataVector& b);
 
-  void store(const std::string& fname) override;
+ protected:
+  /**
+   * Adds the permutation to the serialized sections
+   *
+   * @param[out] sections sections of the binary file
+   */
+  void collectSections(std::vector<DBMatBinaryFile::Section>& sections) override;
+
+  /**
+   * Reads the permutation in addition to the decomposed matrix
+   *
+   * @param file opened binary file
+   */
+  void loadSections(const DBMatBinaryFile& file) override;
 
  private:
   /**
@@ -4,12 +4,10 @@
 // sgpp.sparsegrids.org
 
 #ifdef USE_GSL
-#include <gsl/gsl_linalg.h>
-#include <gsl/gsl_math.h>
 #include <gsl/gsl_matrix.h>
-#include <gsl/gsl_vector.h>
 #endif /* USE_GSL */
 
+#include <sgpp/datadriven/algorithm/DBMatDenseDecomposition.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineOrthoAdapt.hpp>
 #include <sgpp/datadriven/datamining/base/StringTokenizer.hpp>
 #include <string>
@@ -27,6 +25,11 @@ DBMatOfflineOrthoAdapt::DBMatOfflineOrthoAdapt() : DBMatOffline() {
 
 DBMatOfflineOrthoAdapt::DBMatOfflineOrthoAdapt(const std::string& fileName)
     : DBMatOffline(fileName) {
+  if (DBMatBinaryFile::isBinaryFile(fileName)) {
+    loadSections(DBMatBinaryFile(fileName));
+    return;
+  }
+
   // Read grid size from header (number of rows in lhsMatrix)
   std::ifstream filestream(fileName, std::istream::in);
   // Read configuration
@@ -95,7 +98,6 @@ void DBMatOfflineOrthoAdapt::buildMatrix(Grid* grid,
 void DBMatOfflineOrthoAdapt::decomposeMatrix(
     RegularizationConfiguration& regularizationConfig,
     DensityEstimationConfiguration& densityEstimationConfig) {
-#ifdef USE_GSL
   size_t dim_a = lhsMatrix.getNrows();
   // allocating subdiagonal and diagonal vectors of T
   sgpp::base::DataVector diag(dim_a);
@@ -114,76 +116,31 @@ void DBMatOfflineOrthoAdapt::decomposeMatrix(
 
   // decomposed matrix: (lhs+lambda*I) = Q * T^{-1} * Q^t
   this->isDecomposed = true;
-#endif /* USE_GSL */
 }
 
 void DBMatOfflineOrthoAdapt::hessenberg_decomposition(sgpp::base::DataVector& diag,
                                                       sgpp::base::DataVector& subdiag) {
-#ifdef USE_GSL
-  size_t dim_a = lhsMatrix.getNrows();
-  gsl_vector* tau = gsl_vector_alloc(dim_a - 1);
-  gsl_matrix_view gsl_lhs = gsl_matrix_view_array(lhsMatrix.getPointer(), dim_a, dim_a);
-  gsl_matrix_view gsl_q = gsl_matrix_view_array(q_ortho_matrix_.getPointer(), dim_a, dim_a);
-  gsl_vector_view gsl_diag = gsl_vector_view_array(diag.getPointer(), dim_a);
-  gsl_vector_view gsl_subdiag = gsl_vector_view_array(subdiag.getPointer(), dim_a - 1);
-
-  // does the decomposition
-  gsl_linalg_symmtd_decomp(&gsl_lhs.matrix, tau);
-
-  // unpacks information out of matrix to explicitly create Q, and T
-  gsl_linalg_symmtd_unpack(&gsl_lhs.matrix, tau, &gsl_q.matrix, &gsl_diag.vector,
-                           &gsl_subdiag.vector);
-
-  gsl_vector_free(tau);
-#endif /* USE_GSL */
+  // does the (blocked, multithreaded) decomposition and
+  // explicitly creates Q, and T
+  DBMatDenseDecomposition::tridiagonalDecomposition(lhsMatrix, q_ortho_matrix_, diag, subdiag);
 }
 
 void DBMatOfflineOrthoAdapt::invert_symmetric_tridiag(sgpp::base::DataVector& diag,
                                                       sgpp::base::DataVector& subdiag) {
-#ifdef USE_GSL
-  size_t dim_a = lhsMatrix.getNrows();
-  gsl_vector* e = gsl_vector_calloc(diag.getSize());  // calloc sets all values to zero
-  gsl_vector* x = gsl_vector_alloc(diag.getSize());   // target of solving
-
-  gsl_vector_view gsl_diag = gsl_vector_view_array(diag.getPointer(), dim_a);
-  gsl_vector_view gsl_subdiag = gsl_vector_view_array(subdiag.getPointer(), dim_a - 1);
-
-  // loops columns of T_inv
-  for (size_t k = 0; k < t_tridiag_inv_matrix_.getNcols(); k++) {
-    e->data[k] = 1;
-    gsl_linalg_solve_symm_tridiag(&gsl_diag.vector, &gsl_subdiag.vector, e, x);
-    for (size_t i = 0; i < t_tridiag_inv_matrix_.getNrows(); i++) {
-      this->t_tridiag_inv_matrix_.set(k, i, x->data[i]);
-    }
-    e->data[k] = 0;
-  }
-
-  gsl_vector_free(e);
-  gsl_vector_free(x);
-#endif /* USE_GSL */
+  // solves T * x_k = e_k for every k-th column x_k of T_inv in parallel
+  DBMatDenseDecomposition::invertSymmetricTridiagonal(diag, subdiag, t_tridiag_inv_matrix_);
 }
 
-void DBMatOfflineOrthoAdapt::store(const std::string& fileName) {
-#ifdef USE_GSL
-  DBMatOffline::store(fileName);
-
-  FILE* outCFile = fopen(fileName.c_str(), "ab");
-  if (!outCFile) {
-    throw sgpp::base::algorithm_exception{"cannot open file for writing"};
-  }
-
-  auto dim_a = getGridSize();
-  // store q_ortho_matrix_
-  gsl_matrix_view q_view = gsl_matrix_view_array(this->q_ortho_matrix_.getPointer(), dim_a, dim_a);
-  gsl_matrix_fwrite(outCFile, &q_view.matrix);
-
-  // store t_inv_tridiag_
-  gsl_matrix_view t_inv_view =
-      gsl_matrix_view_array(this->t_tridiag_inv_matrix_.getPointer(), dim_a, dim_a);
-  gsl_matrix_fwrite(outCFile, &t_inv_view.matrix);
+void DBMatOfflineOrthoAdapt::collectSections(std::vector<DBMatBinaryFile::Section>& sections) {
+  DBMatOffline::collectSections(sections);
+  sections.emplace_back(this->q_ortho_matrix_);
+  sections.emplace_back(this->t_tridiag_inv_matrix_);
+}
 
-  fclose(outCFile);
-#endif /* USE_GSL */
+void DBMatOfflineOrthoAdapt::loadSections(const DBMatBinaryFile& file) {
+  DBMatOffline::loadSections(file);
+  file.copyMatrix(1, this->q_ortho_matrix_);
+  file.copyMatrix(2, this->t_tridiag_inv_matrix_);
 }
 
 void DBMatOfflineOrthoAdapt::syncDistributedDecomposition(
@@ -9,6 +9,7 @@
 #include <sgpp/datadriven/algorithm/DBMatOffline.hpp>
 
 #include <string>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -77,17 +78,6 @@ class DBMatOfflineOrthoAdapt : public DBMatOffline {
    */
   void invert_symmetric_tridiag(sgpp::base::DataVector& diag, sgpp::base::DataVector& subdiag);
 
-  /**
-   * Serializes the DBMatOfflineOrthoAdapt object
-   *
-   * q_ortho_matrix_ and t_inv_tridiag_ are stored into the specified file,
-   * which is the explicit representation of the decomposition needed for the
-   * online phase
-   *
-   * @param fileName path where to store the file
-   */
-  void store(const std::string& fileName);
-
   /**
    * Override to sync Q and Tinv
    */
@@ -109,6 +99,22 @@ class DBMatOfflineOrthoAdapt : public DBMatOffline {
   // distributed matrices, only initialized if scalapack is used
   DataMatrixDistributed q_ortho_matrix_distributed_;
   DataMatrixDistributed t_tridiag_inv_matrix_distributed_;
+
+  /**
+   * Adds q_ortho_matrix_ and t_tridiag_inv_matrix_ to the serialized sections,
+   * which is the explicit representation of the decomposition needed for the
+   * online phase
+   *
+   * @param[out] sections sections of the binary file
+   */
+  void collectSections(std::vector<DBMatBinaryFile::Section>& sections) override;
+
+  /**
+   * Reads q_ortho_matrix_ and t_tridiag_inv_matrix_ in addition to the decomposed matrix
+   *
+   * @param file opened binary file
+   */
+  void loadSections(const DBMatBinaryFile& file) override;
 };
 }  // namespace datadriven
 }  // namespace sgpp
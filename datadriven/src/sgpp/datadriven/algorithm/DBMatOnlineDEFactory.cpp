@@ -46,12 +46,8 @@ DBMatOnlineDE* DBMatOnlineDEFactory::buildDBMatOnlineDE(DBMatOffline& offline, G
       return new DBMatOnlineDEChol(offline, grid, lambda, beta);
       break;
     case MatrixDecompositionType::OrthoAdapt:
-#ifdef USE_GSL
       return new DBMatOnlineDEOrthoAdapt(offline, grid, lambda, beta);
       break;
-#else
-      throw factory_exception("built without GSL");
-#endif
     default:
       throw factory_exception{"Unknown decomposition type."};
   }
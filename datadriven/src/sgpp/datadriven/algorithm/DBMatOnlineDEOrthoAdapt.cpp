@@ -5,16 +5,9 @@
 
 #include <sgpp/datadriven/algorithm/DBMatOnlineDEOrthoAdapt.hpp>
 
-#ifdef USE_GSL
-#include <gsl/gsl_blas.h>
-#include <gsl/gsl_linalg.h>
-#include <gsl/gsl_math.h>
-#include <gsl/gsl_matrix.h>
-#include <gsl/gsl_vector.h>
-#endif /* USE_GSL */
-
 #include <sgpp/base/exception/algorithm_exception.hpp>
 #include <sgpp/datadriven/algorithm/DBMatDMSOrthoAdapt.hpp>
+#include <sgpp/datadriven/algorithm/DBMatDenseDecomposition.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineOrthoAdapt.hpp>
 
 #include <algorithm>
@@ -116,7 +109,6 @@ void DBMatOnlineDEOrthoAdapt::solveSLEParallel(
 
 void DBMatOnlineDEOrthoAdapt::sherman_morrison_adapt(size_t newPoints, bool refine,
                                                      std::vector<size_t> coarsenIndices) {
-#ifdef USE_GSL
   sgpp::datadriven::DBMatOfflineOrthoAdapt* offlinePtr =
       static_cast<sgpp::datadriven::DBMatOfflineOrthoAdapt*>(&this->offlineObject);
 
@@ -144,11 +136,6 @@ void DBMatOnlineDEOrthoAdapt::sherman_morrison_adapt(size_t newPoints, bool refi
     }
   }
 
-  // create view of the whole matrix b_adapt, needed to later create submatrix_view
-  gsl_matrix_view b_adapt_full_view =
-      gsl_matrix_view_array(this->b_adapt_matrix_.getPointer(), this->b_adapt_matrix_.getNrows(),
-                            this->b_adapt_matrix_.getNcols());
-
   // apply sherman morrison formula k times (one for each point refining/coarsening)
   for (size_t k = 0; k < adaptSteps; k++) {
     // fetch point with according size
@@ -180,31 +167,20 @@ void DBMatOnlineDEOrthoAdapt::sherman_morrison_adapt(size_t newPoints, bool refi
     // e[unit_index] = 1 when refining, -1 when coarsening
     size_t unit_index = refine ? current_size - 1 : coarsenIndices[k];
 
-    // view of T^{-1} of the offline object
-    gsl_matrix_view t_inv_view =
-        gsl_matrix_view_array(offlinePtr->getTinv().getPointer(), dima, dima);
-
-    // view of Q of the offline object
-    gsl_matrix_view q_view = gsl_matrix_view_array(offlinePtr->getQ().getPointer(), dima, dima);
-
-    // view of B of the online object, which holds all information of refinement/coarsening
-    gsl_matrix_view b_adapt_view =
-        gsl_matrix_submatrix(&b_adapt_full_view.matrix, 0, 0, current_size, current_size);
+    // T^{-1} and Q of the offline object
+    const sgpp::base::DataMatrix& t_inv = offlinePtr->getTinv();
+    const sgpp::base::DataMatrix& q = offlinePtr->getQ();
 
-    // view of current point to refine/coarsen
-    gsl_vector_view x_view = gsl_vector_view_array(x.getPointer(), current_size);
+    // buffer
+    sgpp::base::DataVector buffer(dima);
 
-    // view of current point to refine/coarsen cut to offline objects matrix size
-    gsl_vector_view x_cut_view = gsl_vector_view_array(x.getPointer(), dima);
+    // the term: Q*T^{-1}*Q^t * x_cut, where x_cut is the current point
+    // cut to the offline object's matrix size
+    sgpp::base::DataVector x_term(dima);
 
-    // allocating space for buffer
-    gsl_vector* buffer = gsl_vector_alloc(dima);
-
-    // allocating space for the term: Q*T^{-1}*Q^t * x_cut
-    gsl_vector* x_term = gsl_vector_alloc(dima);
-
-    // allocating space for the term: B * x
-    gsl_vector* bx_term = gsl_vector_alloc(current_size);
+    // the term: B * x, where B is the leading current_size x current_size block of
+    // b_adapt_matrix_, which holds all information of refinement/coarsening
+    sgpp::base::DataVector bx_term(current_size);
 
     //##########################################################################
     //
@@ -213,29 +189,32 @@ void DBMatOnlineDEOrthoAdapt::sherman_morrison_adapt(size_t newPoints, bool refi
     //##########################################################################
 
     // calculating bx_term = B * x, (B is symmetric)
-    gsl_blas_dgemv(CblasNoTrans, 1.0, &b_adapt_view.matrix, &x_view.vector, 0.0, bx_term);
+    DBMatDenseDecomposition::matrixVectorProduct(this->b_adapt_matrix_, current_size, current_size,
+                                                 false, x.getPointer(), 0.0, bx_term.getPointer());
 
     // calculating x_term = Q*T^{-1}*Q^t * x_cut (the whole matrix term is symmetric)
-    gsl_blas_dgemv(CblasTrans, 1.0, &q_view.matrix, &x_cut_view.vector, 0.0,
-                   x_term);  // x_term = Q^t * x_cut
+    DBMatDenseDecomposition::matrixVectorProduct(q, dima, dima, true, x.getPointer(), 0.0,
+                                                 x_term.getPointer());  // x_term = Q^t * x_cut
 
-    gsl_blas_dgemv(CblasNoTrans, 1.0, &t_inv_view.matrix, x_term, 0.0,
-                   buffer);  // buffer = T^{-1} * Q^t * x_cut
+    DBMatDenseDecomposition::matrixVectorProduct(
+        t_inv, dima, dima, false, x_term.getPointer(), 0.0,
+        buffer.getPointer());  // buffer = T^{-1} * Q^t * x_cut
 
-    gsl_blas_dgemv(CblasNoTrans, 1.0, &q_view.matrix, buffer, 0.0,
-                   x_term);  // x_term = Q*T^{-1}*Q^t * x_cut
+    DBMatDenseDecomposition::matrixVectorProduct(
+        q, dima, dima, false, buffer.getPointer(), 0.0,
+        x_term.getPointer());  // x_term = Q*T^{-1}*Q^t * x_cut
 
     // calculating the divisor of the sherman-morrison-formula: 1 + e^t * x_term + e^t * bx_term
     // note: the term e^t * Q * T^{-1} * Q^t * x is always zero,
     // because initial gridpoints cannot be refined
-    double eBx = (refine ? 1.0 : -1.0) * gsl_vector_get(bx_term, unit_index);
+    double eBx = (refine ? 1.0 : -1.0) * bx_term[unit_index];
     double divisor = 1 + eBx;
     divisor = 1.0 / divisor;  // optional optimization
 
     // calculating: bx_term + x_term, where x_term is "filled" with zero to fit dimensions
     // the result is stored in bx_term, as x_term is later needed
     for (size_t i = 0; i < dima; i++) {
-      bx_term->data[i] += x_term->data[i];
+      bx_term[i] += x_term[i];
     }
 
     // subtracting the matrices B - ( x_term * e_term ) / divisor
@@ -249,7 +228,7 @@ void DBMatOnlineDEOrthoAdapt::sherman_morrison_adapt(size_t newPoints, bool refi
       for (size_t j = 0; j < current_size; j++) {
         // calculate matrix entry new value according to Sherman-Morrison-formula
         double final_value = this->b_adapt_matrix_.get(i, j) -
-                             (bx_term->data[i] * (refine ? 1.0 : -1.0) * b_row.get(j) * divisor);
+                             (bx_term[i] * (refine ? 1.0 : -1.0) * b_row.get(j) * divisor);
 
         // by algorithm, the column of B at the index of coarsening
         // should be zero, except for the diagonal entry
@@ -270,16 +249,17 @@ void DBMatOnlineDEOrthoAdapt::sherman_morrison_adapt(size_t newPoints, bool refi
 
     // calculating new bx_term = x^t * B_tilde = (B_tilde^t * x)^t
     // note: B is symmetric, but B_tilde is never symmetric
-    gsl_blas_dgemv(CblasTrans, 1.0, &b_adapt_view.matrix, &x_view.vector, 0.0, bx_term);
+    DBMatDenseDecomposition::matrixVectorProduct(this->b_adapt_matrix_, current_size, current_size,
+                                                 true, x.getPointer(), 0.0, bx_term.getPointer());
 
     // calculating the divisor of sherman-morrison-formula: 1 + e^t * b_tilde_x_term
-    eBx = (refine ? 1.0 : -1.0) * gsl_vector_get(bx_term, unit_index);
+    eBx = (refine ? 1.0 : -1.0) * bx_term[unit_index];
     divisor = 1 + eBx;
     divisor = 1.0 / divisor;
 
     // calculating: bx_tilde_term + x_term
     for (size_t i = 0; i < dima; i++) {
-      bx_term->data[i] += x_term->data[i];
+      bx_term[i] += x_term[i];
     }
 
     // subtracting the matrices B_final - ( x_term * b_tilde_term ) / divisor
@@ -294,7 +274,7 @@ void DBMatOnlineDEOrthoAdapt::sherman_morrison_adapt(size_t newPoints, bool refi
     for (size_t i = 0; i < current_size; i++) {
       for (size_t j = 0; j < current_size; j++) {
         double final_value = this->b_adapt_matrix_.get(i, j) -
-                             (bx_term->data[j] * (refine ? 1.0 : -1.0) * b_col.get(i)) * divisor;
+                             (bx_term[j] * (refine ? 1.0 : -1.0) * b_col.get(i)) * divisor;
 
         // By algorithm, the row of B at the index of coarsening
         // should be now the unit vector, and can be discarded after coarsening.
@@ -308,10 +288,6 @@ void DBMatOnlineDEOrthoAdapt::sherman_morrison_adapt(size_t newPoints, bool refi
         this->b_adapt_matrix_.set(i, j, final_value);
       }
     }
-
-    gsl_vector_free(buffer);
-    gsl_vector_free(x_term);
-    gsl_vector_free(bx_term);
   }
 
   //##########################################################################
@@ -364,7 +340,6 @@ void DBMatOnlineDEOrthoAdapt::sherman_morrison_adapt(size_t newPoints, bool refi
   // determine, if any refined information now is contained in matrix b_adapt
   this->b_is_refined = this->b_adapt_matrix_.getNcols() > dima;
   return;
-#endif /* USE_GSL */
 }
 
 /**
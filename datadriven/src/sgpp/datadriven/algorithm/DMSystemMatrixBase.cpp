@@ -4,6 +4,8 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/datadriven/algorithm/DMSystemMatrixBase.hpp>
+#include <sgpp/solver/sle/PreconditionedConjugateGradients.hpp>
+#include <sgpp/solver/sle/preconditioner/ProbingJacobiPreconditioner.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -16,7 +18,9 @@ DMSystemMatrixBase::DMSystemMatrixBase(sgpp::base::DataMatrix& trainData, double
       completeTimeMult_(0.0),
       computeTimeMult_(0.0),
       completeTimeMultTrans_(0.0),
-      computeTimeMultTrans_(0.0) {
+      computeTimeMultTrans_(0.0),
+      preconditionerStorage_(nullptr),
+      preconditionerModificationCount_(0) {
   myTimer_ = new sgpp::base::SGppStopwatch();
 }
 
@@ -24,6 +28,26 @@ DMSystemMatrixBase::~DMSystemMatrixBase() { delete myTimer_; }
 
 void DMSystemMatrixBase::prepareGrid() {}
 
+void DMSystemMatrixBase::preconditionSolver(solver::SLESolver& solver,
+                                            base::GridStorage& storage) {
+  auto preconditionedSolver = dynamic_cast<solver::PreconditionedConjugateGradients*>(&solver);
+
+  if (preconditionedSolver == nullptr) {
+    return;
+  }
+
+  // probing costs one multiplication per subspace, so the diagonal is only probed again if
+  // the grid has changed
+  if ((preconditioner_ == nullptr) || (preconditionerStorage_ != &storage) ||
+      (preconditionerModificationCount_ != storage.getModificationCount())) {
+    preconditioner_ = std::make_unique<solver::ProbingJacobiPreconditioner>(*this, storage);
+    preconditionerStorage_ = &storage;
+    preconditionerModificationCount_ = storage.getModificationCount();
+  }
+
+  preconditionedSolver->setPreconditioner(preconditioner_.get());
+}
+
 void DMSystemMatrixBase::resetTimers() {
   completeTimeMult_ = 0.0;
   computeTimeMult_ = 0.0;
@@ -7,11 +7,15 @@
 
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
 #include <sgpp/base/tools/SGppStopwatch.hpp>
+#include <sgpp/solver/SLESolver.hpp>
 
 #include <sgpp/globaldef.hpp>
 
+#include <memory>
+
 namespace sgpp {
 namespace datadriven {
 
@@ -35,6 +39,12 @@ class DMSystemMatrixBase : public base::OperationMatrix {
   double computeTimeMultTrans_;
   /// Stopwatch needed to determine the durations of mult and mult transposed
   base::SGppStopwatch* myTimer_;
+  /// Jacobi preconditioner set by preconditionSolver
+  std::unique_ptr<base::OperationMatrix> preconditioner_;
+  /// grid storage the preconditioner was built for
+  const base::GridStorage* preconditionerStorage_;
+  /// modification count of the grid storage when the preconditioner was built
+  size_t preconditionerModificationCount_;
 
  public:
   /**
@@ -70,6 +80,20 @@ class DMSystemMatrixBase : public base::OperationMatrix {
    */
   virtual void prepareGrid();
 
+  /**
+   * Sets a Jacobi preconditioner for this system matrix on the solver if it is a
+   * solver::PreconditionedConjugateGradients (or solver::PipelinedConjugateGradients);
+   * other solvers are left unchanged. The diagonal is probed with one multiplication per
+   * subspace of the grid (see solver::ProbingJacobiPreconditioner), so this has to be called
+   * again after the grid (and prepareGrid) has changed. The preconditioner is only built
+   * again if the grid storage or its modification count have changed since the last call.
+   * It is owned by this system matrix, which therefore has to outlive its use by the solver.
+   *
+   * @param solver solver that is used for this system matrix
+   * @param storage grid storage the unknowns belong to
+   */
+  void preconditionSolver(solver::SLESolver& solver, base::GridStorage& storage);
+
   /**
    * resets all timers to 0
    */
@@ -8,6 +8,7 @@
 #include <sgpp/datadriven/operation/hash/simple/OperationRosenblattTransformationKDE.hpp>
 #include <sgpp/datadriven/operation/hash/simple/OperationInverseRosenblattTransformationKDE.hpp>
 #include <sgpp/datadriven/operation/hash/simple/OperationDensityMarginalizeKDE.hpp>
+#include <sgpp/base/exception/application_exception.hpp>
 #include <sgpp/base/exception/data_exception.hpp>
 #include <sgpp/datadriven/DatadrivenOpFactory.hpp>
 
@@ -29,6 +30,32 @@
 namespace sgpp {
 namespace datadriven {
 
+namespace {
+/// number of samples that are evaluated together, small enough to keep the buffer in L1
+const size_t kdeBlockSize = 256;
+/// maximal number of samples in a leaf of the sample tree
+const size_t kdeLeafSize = 64;
+}  // namespace
+
+struct KernelDensityEstimator::SampleTree {
+  struct Node {
+    size_t begin;
+    size_t end;
+    /// children, zero for leaves (the root is never a child)
+    size_t left;
+    size_t right;
+  };
+
+  std::vector<Node> nodes;
+  /// bounding boxes of the nodes, ndim values per node
+  std::vector<double> lower;
+  std::vector<double> upper;
+  /// samples and conditionalization factors in tree order
+  std::vector<std::vector<double>> samples;
+  std::vector<const double*> samplePointers;
+  std::vector<double> weights;
+};
+
 // -------------------- constructors and desctructors --------------------
 KernelDensityEstimator::KernelDensityEstimator(KernelType kernelType,
                                                BandwidthOptimizationType bandwidthOptimizationType)
@@ -38,7 +65,10 @@ KernelDensityEstimator::KernelDensityEstimator(KernelType kernelType,
       norm(0),
       cond(0),
       sumCondInv(1.0),
-      bandwidthOptimizationType(bandwidthOptimizationType) {
+      bandwidthOptimizationType(bandwidthOptimizationType),
+      invBandwidths(0),
+      normProduct(1.0),
+      approximationTolerance(0.0) {
   initializeKernel(kernelType);
 }
 
@@ -51,7 +81,10 @@ KernelDensityEstimator::KernelDensityEstimator(
       norm(samplesVec.size()),
       cond(0.0),
       sumCondInv(0.0),
-      bandwidthOptimizationType(bandwidthOptimizationType) {
+      bandwidthOptimizationType(bandwidthOptimizationType),
+      invBandwidths(0),
+      normProduct(1.0),
+      approximationTolerance(0.0) {
   initializeKernel(kernelType);
   initialize(samplesVec);
 }
@@ -64,7 +97,10 @@ KernelDensityEstimator::KernelDensityEstimator(base::DataMatrix& samples, Kernel
       norm(samples.getNcols()),
       cond(samples.getNrows()),
       sumCondInv(0.0),
-      bandwidthOptimizationType(bandwidthOptimizationType) {
+      bandwidthOptimizationType(bandwidthOptimizationType),
+      invBandwidths(0),
+      normProduct(1.0),
+      approximationTolerance(0.0) {
   initializeKernel(kernelType);
   initialize(samples);
 }
@@ -78,6 +114,9 @@ KernelDensityEstimator::KernelDensityEstimator(const KernelDensityEstimator& kde
   cond = base::DataVector(kde.cond);
   sumCondInv = kde.sumCondInv;
   bandwidthOptimizationType = kde.bandwidthOptimizationType;
+  invBandwidths = base::DataVector(kde.invBandwidths);
+  normProduct = kde.normProduct;
+  approximationTolerance = kde.approximationTolerance;
 
   initializeKernel(kde.kernel->getType());
 }
@@ -214,41 +253,268 @@ void KernelDensityEstimator::getBandwidths(base::DataVector& sigma) {
 }
 
 void KernelDensityEstimator::setBandwidths(const base::DataVector& sigma) {
+  invBandwidths.resize(bandwidths.getSize());
+
   for (size_t i = 0; i < sigma.getSize(); i++) {
     bandwidths[i] = sigma[i];
+    invBandwidths[i] = 1. / bandwidths[i];
     norm[i] = kernel->norm() / bandwidths[i];
   }
+
+  normProduct = 1.0;
+
+  for (size_t i = 0; i < norm.getSize(); i++) {
+    normProduct *= norm[i];
+  }
+
+  sampleTree.reset();
 }
 
+void KernelDensityEstimator::setApproximationTolerance(double tolerance) {
+  if (tolerance < 0.0 || tolerance >= 1.0) {
+    throw base::application_exception(
+        "KernelDensityEstimator::setApproximationTolerance : tolerance has to be in [0, 1)");
+  }
+
+  approximationTolerance = tolerance;
+}
+
+double KernelDensityEstimator::getApproximationTolerance() { return approximationTolerance; }
+
 void KernelDensityEstimator::pdf(base::DataMatrix& data, base::DataVector& res) {
-  // init variables
-  base::DataVector x(ndim);
+  size_t numData = data.getNrows();
+  size_t numCols = data.getNcols();
+  bool approximate = approximationTolerance > 0.0;
 
   // resize result vector
-  res.resize(data.getNrows());
-  res.setAll(0.0);
+  res.resize(numData);
+
+  // the tree is shared by all threads, build it before the parallel region
+  if (approximate && !sampleTree) {
+    buildSampleTree();
+  }
+
+  std::vector<const double*> samples(ndim);
+
+  for (size_t idim = 0; idim < ndim; idim++) {
+    samples[idim] = samplesVec[idim]->getPointer();
+  }
+
+#pragma omp parallel
+  {
+    std::vector<double> buffer(kdeBlockSize);
+
+    // run over all data points
+#pragma omp for schedule(dynamic, 16)
+    for (size_t idata = 0; idata < numData; idata++) {
+      const double* x = data.getPointer() + idata * numCols;
+      double sum = approximate ? sumKernelsApproximate(x, buffer.data())
+                               : sumKernels(x, samples.data(), cond.getPointer(), 0, nsamples,
+                                            buffer.data());
+      res[idata] = sum * normProduct * sumCondInv;
+    }
+  }
+}
+
+double KernelDensityEstimator::pdf(base::DataVector& x) {
+  double buffer[kdeBlockSize];
+  std::vector<const double*> samples(ndim);
+
+  for (size_t idim = 0; idim < ndim; idim++) {
+    samples[idim] = samplesVec[idim]->getPointer();
+  }
+
+  return sumKernels(x.getPointer(), samples.data(), cond.getPointer(), 0, nsamples, buffer) *
+         normProduct * sumCondInv;
+}
+
+double KernelDensityEstimator::sumKernels(const double* x, const double* const* samples,
+                                          const double* weights, size_t begin, size_t end,
+                                          double* buffer) {
+  KernelType kernelType = kernel->getType();
+  double res = 0.0;
+
+  for (size_t blockStart = begin; blockStart < end; blockStart += kdeBlockSize) {
+    size_t n = std::min(kdeBlockSize, end - blockStart);
+    const double* w = weights + blockStart;
+
+    if (kernelType == KernelType::GAUSSIAN) {
+      // the product of the 1d kernels is the exponential of the summed exponents
+      std::fill(buffer, buffer + n, 0.0);
+
+      for (size_t idim = 0; idim < ndim; idim++) {
+        const double xi = x[idim];
+        const double hInv = invBandwidths[idim];
+        const double* s = samples[idim] + blockStart;
+
+#pragma omp simd
+        for (size_t i = 0; i < n; i++) {
+          double y = (xi - s[i]) * hInv;
+          buffer[i] += y * y;
+        }
+      }
+
+#pragma omp simd reduction(+ : res)
+      for (size_t i = 0; i < n; i++) {
+        res += w[i] * std::exp(-0.5 * buffer[i]);
+      }
+    } else {
+      std::fill(buffer, buffer + n, 1.0);
+
+      for (size_t idim = 0; idim < ndim; idim++) {
+        const double xi = x[idim];
+        const double hInv = invBandwidths[idim];
+        const double* s = samples[idim] + blockStart;
+
+        if (kernelType == KernelType::EPANECHNIKOV) {
+#pragma omp simd
+          for (size_t i = 0; i < n; i++) {
+            double y = (xi - s[i]) * hInv;
+            buffer[i] *= std::max(0.0, 1.0 - y * y);
+          }
+        } else {
+          for (size_t i = 0; i < n; i++) {
+            buffer[i] *= kernel->eval((xi - s[i]) * hInv);
+          }
+        }
+      }
+
+#pragma omp simd reduction(+ : res)
+      for (size_t i = 0; i < n; i++) {
+        res += w[i] * buffer[i];
+      }
+    }
+  }
+
+  return res;
+}
+
+void KernelDensityEstimator::buildSampleTree() {
+  sampleTree.reset(new SampleTree());
+  SampleTree& tree = *sampleTree;
+
+  std::vector<size_t> order(nsamples);
+
+  for (size_t i = 0; i < nsamples; i++) {
+    order[i] = i;
+  }
+
+  // split the samples recursively at the median of the dimension with the largest extent
+  // relative to the bandwidth
+  std::vector<size_t> stack;
+  tree.nodes.push_back({0, nsamples, 0, 0});
+  stack.push_back(0);
+
+  while (!stack.empty()) {
+    size_t inode = stack.back();
+    stack.pop_back();
+    size_t begin = tree.nodes[inode].begin;
+    size_t end = tree.nodes[inode].end;
+
+    tree.lower.resize(tree.nodes.size() * ndim);
+    tree.upper.resize(tree.nodes.size() * ndim);
+    double* lower = &tree.lower[inode * ndim];
+    double* upper = &tree.upper[inode * ndim];
+    size_t splitDim = 0;
+    double maxExtent = -1.0;
 
-  // run over all data points
-  for (size_t idata = 0; idata < data.getNrows(); idata++) {
-    // copy samples
     for (size_t idim = 0; idim < ndim; idim++) {
-      x[idim] = data.get(idata, idim);
+      const base::DataVector& s = *samplesVec[idim];
+      lower[idim] = std::numeric_limits<double>::infinity();
+      upper[idim] = -std::numeric_limits<double>::infinity();
+
+      for (size_t i = begin; i < end; i++) {
+        lower[idim] = std::min(lower[idim], s[order[i]]);
+        upper[idim] = std::max(upper[idim], s[order[i]]);
+      }
+
+      double extent = (upper[idim] - lower[idim]) * invBandwidths[idim];
+
+      if (extent > maxExtent) {
+        maxExtent = extent;
+        splitDim = idim;
+      }
     }
 
-    res[idata] = pdf(x);
+    if (end - begin <= kdeLeafSize) {
+      continue;
+    }
+
+    size_t mid = begin + (end - begin) / 2;
+    const base::DataVector& s = *samplesVec[splitDim];
+    std::nth_element(order.begin() + begin, order.begin() + mid, order.begin() + end,
+                     [&s](size_t i, size_t j) { return s[i] < s[j]; });
+
+    size_t left = tree.nodes.size();
+    tree.nodes.push_back({begin, mid, 0, 0});
+    tree.nodes.push_back({mid, end, 0, 0});
+    tree.nodes[inode].left = left;
+    tree.nodes[inode].right = left + 1;
+    stack.push_back(left + 1);
+    stack.push_back(left);
+  }
+
+  // store the samples in tree order such that the leaves are contiguous
+  tree.samples.resize(ndim);
+  tree.samplePointers.resize(ndim);
+  tree.weights.resize(nsamples);
+
+  for (size_t idim = 0; idim < ndim; idim++) {
+    tree.samples[idim].resize(nsamples);
+
+    for (size_t i = 0; i < nsamples; i++) {
+      tree.samples[idim][i] = samplesVec[idim]->get(order[i]);
+    }
+
+    tree.samplePointers[idim] = tree.samples[idim].data();
+  }
+
+  for (size_t i = 0; i < nsamples; i++) {
+    tree.weights[i] = cond[order[i]];
   }
 }
 
-double KernelDensityEstimator::pdf(base::DataVector& x) {
-  // init variables
+double KernelDensityEstimator::sumKernelsApproximate(const double* x, double* buffer) {
+  const SampleTree& tree = *sampleTree;
+  bool gaussian = kernel->getType() == KernelType::GAUSSIAN;
+  // the Gaussian kernel drops below tolerance * K(0) at this squared (scaled) distance
+  double cutoff = gaussian ? -2.0 * std::log(approximationTolerance) : 1.0;
   double res = 0.0;
 
-  // run over all data points
-  for (size_t isample = 0; isample < nsamples; isample++) {
-    res += evalKernel(x, isample);
+  // the tree is balanced, hence its depth is bounded by log2(nsamples)
+  size_t stack[128];
+  size_t stackSize = 0;
+  stack[stackSize++] = 0;
+
+  while (stackSize > 0) {
+    size_t inode = stack[--stackSize];
+    const SampleTree::Node& node = tree.nodes[inode];
+    const double* lower = &tree.lower[inode * ndim];
+    const double* upper = &tree.upper[inode * ndim];
+    double distance = 0.0;
+
+    // scaled distance between x and the bounding box of the node, squared Euclidean for the
+    // Gaussian and maximum norm for kernels with compact support
+    for (size_t idim = 0; idim < ndim; idim++) {
+      double gap = std::max(0.0, std::max(lower[idim] - x[idim], x[idim] - upper[idim])) *
+                   invBandwidths[idim];
+      distance = gaussian ? distance + gap * gap : std::max(distance, gap);
+    }
+
+    if ((gaussian && distance > cutoff) || (!gaussian && distance >= cutoff)) {
+      continue;
+    }
+
+    if (node.left == 0) {
+      res += sumKernels(x, tree.samplePointers.data(), tree.weights.data(), node.begin, node.end,
+                        buffer);
+    } else {
+      stack[stackSize++] = node.right;
+      stack[stackSize++] = node.left;
+    }
   }
 
-  return res * sumCondInv;
+  return res;
 }
 
 double KernelDensityEstimator::evalSubset(base::DataVector& x, std::vector<size_t> skipElements) {
@@ -336,10 +602,11 @@ void KernelDensityEstimator::cov(base::DataMatrix& cov, base::DataMatrix* bounds
 }
 
 double KernelDensityEstimator::mean() {
-  double res = 0, kernelMean = 1.;
+  double res = 0;
 
+#pragma omp parallel for reduction(+ : res)
   for (size_t isample = 0; isample < nsamples; isample++) {
-    kernelMean = 1.;
+    double kernelMean = 1.;
 
     for (size_t idim = 0; idim < ndim; idim++) {
       kernelMean *= samplesVec[idim]->get(isample);
@@ -352,12 +619,14 @@ double KernelDensityEstimator::mean() {
 }
 
 double KernelDensityEstimator::variance() {
-  double meansquared = 0, kernelVariance = 1., x = 0.0, sigma = 0.0;
+  double meansquared = 0, sigma = 0.0, kernelVar = kernel->variance();
+
+#pragma omp parallel for reduction(+ : meansquared)
   for (size_t isample = 0; isample < nsamples; isample++) {
-    kernelVariance = 1.;
+    double kernelVariance = 1.;
     for (size_t idim = 0; idim < ndim; idim++) {
-      x = samplesVec[idim]->get(isample);
-      kernelVariance *= sigma * sigma * kernel->variance() + x * x;
+      double x = samplesVec[idim]->get(isample);
+      kernelVariance *= sigma * sigma * kernelVar + x * x;
     }
 
     meansquared += cond[isample] * kernelVariance;
@@ -412,6 +681,7 @@ void KernelDensityEstimator::setConditionalizationFactor(base::DataVector& pcond
   }
 
   sumCondInv = 1. / sumCond;
+  sampleTree.reset();
 }
 
 void KernelDensityEstimator::updateConditionalizationFactors(base::DataVector& x,
@@ -13,6 +13,7 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <memory>
 #include <vector>
 #include <random>
 
@@ -94,8 +95,29 @@ class KernelDensityEstimator : public DensityEstimator {
   void cov(base::DataMatrix& cov, base::DataMatrix* bounds = nullptr) override;
 
   double pdf(base::DataVector& x) override;
+
+  /**
+   * Evaluates the density at all rows of points. The points are distributed over the OpenMP
+   * threads and the kernels are evaluated blockwise over the samples, which is considerably
+   * faster than calling pdf(x) for each point.
+   *
+   * @param points evaluation points (one per row)
+   * @param res density values
+   */
   void pdf(base::DataMatrix& points, base::DataVector& res) override;
 
+  /**
+   * Enables the approximate evaluation for the batched pdf. The samples are sorted into a
+   * k-d tree and kernels whose value is below tolerance times their maximum are skipped, i.e.,
+   * the absolute error at each point is at most tolerance times the peak value of a single
+   * normalized kernel. As the Epanechnikov kernel has compact support, only kernels that
+   * vanish are skipped for it.
+   *
+   * @param tolerance relative kernel cutoff in [0, 1), 0 switches back to exact evaluation
+   */
+  void setApproximationTolerance(double tolerance);
+  double getApproximationTolerance();
+
   double evalSubset(base::DataVector& x, std::vector<size_t> skipElements);
 
   /// getter and setter functions
@@ -118,8 +140,18 @@ class KernelDensityEstimator : public DensityEstimator {
   size_t getNsamples() override;
 
  private:
+  /// k-d tree over the samples for the approximate evaluation
+  struct SampleTree;
+
   double evalKernel(base::DataVector& x, size_t i);
 
+  /// sum of the weighted (unnormalized) kernels of the samples [begin, end) at x
+  double sumKernels(const double* x, const double* const* samples, const double* weights,
+                    size_t begin, size_t end, double* buffer);
+  /// like sumKernels, but skips the tree nodes that are too far away from x
+  double sumKernelsApproximate(const double* x, double* buffer);
+  void buildSampleTree();
+
   /// samples
   std::vector<std::shared_ptr<base::DataVector>> samplesVec;
 
@@ -140,6 +172,15 @@ class KernelDensityEstimator : public DensityEstimator {
   /// bandwith optimization type
   BandwidthOptimizationType bandwidthOptimizationType;
 
+  /// inverse bandwidths
+  base::DataVector invBandwidths;
+  /// product of the normalization factors
+  double normProduct;
+  /// relative kernel cutoff for the approximate evaluation (0 = exact)
+  double approximationTolerance;
+  /// lazily built, reset whenever samples, bandwidths or conditionalization factors change
+  std::unique_ptr<SampleTree> sampleTree;
+
   void computeAndSetOptKDEbdwth();
   void computeNormalizationFactors();
 };
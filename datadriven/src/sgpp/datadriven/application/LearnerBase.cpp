@@ -21,6 +21,8 @@
 #include "sgpp/globaldef.hpp"
 #include "sgpp/solver/sle/BiCGStab.hpp"
 #include "sgpp/solver/sle/ConjugateGradients.hpp"
+#include "sgpp/solver/sle/PipelinedConjugateGradients.hpp"
+#include "sgpp/solver/sle/PreconditionedConjugateGradients.hpp"
 
 namespace sgpp {
 namespace datadriven {
@@ -171,6 +173,12 @@ LearnerTiming LearnerBase::train(sgpp::base::DataMatrix& trainDataset,
   } else if (SolverConfigRefine.type_ == sgpp::solver::SLESolverType::BiCGSTAB) {
     myCG = std::make_unique<sgpp::solver::BiCGStab>(SolverConfigRefine.maxIterations_,
                                                     SolverConfigRefine.eps_);
+  } else if (SolverConfigRefine.type_ == sgpp::solver::SLESolverType::PCG) {
+    myCG = std::make_unique<sgpp::solver::PreconditionedConjugateGradients>(
+        SolverConfigRefine.maxIterations_, SolverConfigRefine.eps_);
+  } else if (SolverConfigRefine.type_ == sgpp::solver::SLESolverType::PipelinedCG) {
+    myCG = std::make_unique<sgpp::solver::PipelinedConjugateGradients>(
+        SolverConfigRefine.maxIterations_, SolverConfigRefine.eps_);
   } else {
     throw base::application_exception(
         "LearnerBase::train: An unsupported SLE solver type was chosen!");
@@ -240,6 +248,8 @@ LearnerTiming LearnerBase::train(sgpp::base::DataMatrix& trainDataset,
       myCG->setEpsilon(SolverConfigFinal.eps_);
     }
 
+    // the preconditioner depends on the grid, so it is set up again after every refinement
+    DMSystem->preconditionSolver(*myCG, grid->getStorage());
     myCG->solve(*DMSystem, *alpha, b, reuseCoefficients, solverVerbose, 0.0);
 
     double stopTime = myStopwatch->stop();
@@ -16,6 +16,8 @@
 
 #include <sgpp/solver/sle/BiCGStab.hpp>
 #include <sgpp/solver/sle/ConjugateGradients.hpp>
+#include <sgpp/solver/sle/PipelinedConjugateGradients.hpp>
+#include <sgpp/solver/sle/PreconditionedConjugateGradients.hpp>
 #include <sgpp/solver/sle/fista/ElasticNetFunction.hpp>
 #include <sgpp/solver/sle/fista/Fista.hpp>
 #include <sgpp/solver/sle/fista/GroupLassoFunction.hpp>
@@ -103,6 +105,8 @@ void RegressionLearner::fit(Solver& solver, base::DataVector& classes) {
     case Solver::solverCategory::cg: {
       auto b = base::DataVector(weights.getSize());
       systemMatrix->generateb(classes, b);
+      // the preconditioner depends on the grid, so it is set up again after every refinement
+      solver.preconditionCG(*systemMatrix, grid->getStorage());
       solver.solveCG(*systemMatrix, weights, b, true, false, solverConfig.threshold_);
       break;
     }
@@ -223,6 +227,12 @@ RegressionLearner::Solver RegressionLearner::createSolver(size_t n_rows) {
     case SLESolverType::BiCGSTAB:
       return Solver(std::move(
           std::make_unique<solver::BiCGStab>(solverConfig.maxIterations_, solverConfig.eps_)));
+    case SLESolverType::PCG:
+      return Solver(std::move(std::make_unique<solver::PreconditionedConjugateGradients>(
+          solverConfig.maxIterations_, solverConfig.eps_)));
+    case SLESolverType::PipelinedCG:
+      return Solver(std::move(std::make_unique<solver::PipelinedConjugateGradients>(
+          solverConfig.maxIterations_, solverConfig.eps_)));
     case SLESolverType::FISTA:
       return createSolverFista(n_rows);
     default:
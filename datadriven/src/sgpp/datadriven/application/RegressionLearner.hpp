@@ -53,6 +53,13 @@ class RegressionLearner {
       }
       solverCG->solve(systemMatrix, alpha, b, reuse, verbose, maxTreshold);
     }
+    void preconditionCG(datadriven::DMSystemMatrixBase& systemMatrix,
+                        sgpp::base::GridStorage& storage) {
+      if (type != solverCategory::cg) {
+        throw sgpp::base::application_exception("Tried to precondition incorrect solver!");
+      }
+      systemMatrix.preconditionSolver(*solverCG, storage);
+    }
     void solveFista(sgpp::base::OperationMultipleEval& op, sgpp::base::DataVector& weights,
                     const sgpp::base::DataVector& classes, size_t maxIt, double treshold,
                     double L) {
@@ -38,6 +38,11 @@ struct CrossvalidationConfiguration {
   // must be > 1
   size_t lambdaSteps_;
   bool logScale_;  // search the optimization interval on a log-scale
+
+  // parallel execution of the folds (see TrialScheduler); every concurrently trained fold holds
+  // its own copy of the training and validation data, i.e. memory grows with concurrentFolds
+  size_t concurrentFolds_ = 1;  // number of folds that are trained concurrently
+  size_t threadsPerFold_ = 0;   // OpenMP threads per fold (0: split threads evenly)
 };
 
 }  // namespace datadriven
@@ -16,6 +16,7 @@
 #include <sgpp/datadriven/tools/Dataset.hpp>
 
 #include <iostream>
+#include <mutex>
 #include <string>
 
 namespace sgpp {
@@ -38,6 +39,9 @@ void SparseGridMiner::print(const std::string& message) {
 #ifdef USE_SCALAPACK
   if (BlacsProcessGrid::getCurrentProcess() == 0) {
 #endif
+    // miners may run concurrently (see TrialScheduler)
+    static std::mutex outputMutex;
+    std::lock_guard<std::mutex> lock(outputMutex);
     std::cout << message << std::endl;
 #ifdef USE_SCALAPACK
   }
@@ -14,9 +14,14 @@
 
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/datadriven/algorithm/RefinementMonitorFactory.hpp>
+#include <sgpp/datadriven/datamining/base/TrialScheduler.hpp>
 #include <sgpp/datadriven/tools/Dataset.hpp>
 
+#include <cmath>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <utility>
 #include <vector>
 
 namespace sgpp {
@@ -29,8 +34,10 @@ SparseGridMinerCrossValidation::SparseGridMinerCrossValidation(
 double SparseGridMinerCrossValidation::learn(bool verbose) {
   // todo(fuchsgdk): see below
 
+  bool scalapackEnabled = false;
 #ifdef USE_SCALAPACK
-  if (fitter->getFitterConfiguration().getParallelConfig().scalapackEnabled_) {
+  scalapackEnabled = fitter->getFitterConfiguration().getParallelConfig().scalapackEnabled_;
+  if (scalapackEnabled) {
     auto processGrid = fitter->getProcessGrid();
     if (!processGrid->isProcessInGrid()) {
       return 0.0;
@@ -42,97 +49,70 @@ double SparseGridMinerCrossValidation::learn(bool verbose) {
       dataSource->getCrossValidationConfig();
 
   std::vector<double> scores;
-  scores.reserve(crossValidationConfig.kfold_);
 
-  for (size_t fold = 0; fold < crossValidationConfig.kfold_; fold++) {
-    dataSource->setFold(fold);
+  // folds are only trained concurrently in shared memory (ScaLAPACK based fitters share one
+  // process grid)
+  if ((crossValidationConfig.concurrentFolds_ > 1) && (crossValidationConfig.kfold_ > 1) &&
+      !scalapackEnabled) {
+    scores = learnFoldsConcurrently(verbose);
+  } else {
+    scores.reserve(crossValidationConfig.kfold_);
 
-    // todo(fuchsgdk):
-    // This is the kind of cv implemented by Lettrich in the scorer class and it was
-    // merely moved to fit into the data source. Conceptual changes might be done in order to
-    // really support batch based learning with cv and not only regression.
-    // What should be done is reimplementing the data source such that it provides batches
+    for (size_t fold = 0; fold < crossValidationConfig.kfold_; fold++) {
+      dataSource->setFold(fold);
 
-    std::ostringstream out;
-    out << "###############"
-        << "Fold #" << fold;
-    print(out);
+      // todo(fuchsgdk):
+      // This is the kind of cv implemented by Lettrich in the scorer class and it was
+      // merely moved to fit into the data source. Conceptual changes might be done in order to
+      // really support batch based learning with cv and not only regression.
+      // What should be done is reimplementing the data source such that it provides batches
 
-    // Create a refinement monitor for this fold
-    RefinementMonitorFactory monitorFactory;
-    RefinementMonitor* monitor = monitorFactory.createRefinementMonitor(
-        fitter->getFitterConfiguration().getRefinementConfig());
-
-    // Reset the fitter
-    fitter->reset();
-
-    for (size_t epoch = 0; epoch < dataSource->getConfig().epochs; epoch++) {
-      if (verbose) {
-        std::ostringstream out;
-        out << "###############"
-            << "Starting training epoch #" << epoch;
-        print(out);
-      }
-      dataSource->reset();
-      Dataset* validationData = dataSource->getValidationData();
-      size_t validationSize = validationData->getNumberInstances();
+      std::ostringstream out;
+      out << "###############"
+          << "Fold #" << fold;
+      print(out);
 
-      if (verbose) {
-        std::ostringstream out;
-        out << "Validation data size: " << validationSize;
-        print(out);
-      }
-      // Process dataset iteratively
-      size_t iteration = 0;
-      while (true) {
-        std::unique_ptr<Dataset> dataset(dataSource->getNextSamples());
-        size_t numInstances = dataset->getNumberInstances();
-        if (numInstances == 0) {
-          // The source does not provide any more samples
-          break;
-        }
+      // Create a refinement monitor for this fold
+      RefinementMonitorFactory monitorFactory;
+      std::unique_ptr<RefinementMonitor> monitor(monitorFactory.createRefinementMonitor(
+          fitter->getFitterConfiguration().getRefinementConfig()));
+
+      // Reset the fitter
+      fitter->reset();
 
+      for (size_t epoch = 0; epoch < dataSource->getConfig().epochs; epoch++) {
         if (verbose) {
           std::ostringstream out;
           out << "###############"
-              << "Itertation #" << (iteration++) << std::endl
-              << "Batch size: " << numInstances;
+              << "Starting training epoch #" << epoch;
           print(out);
         }
-
-        // Train model on new batch
-        fitter->update(*dataset);
-
-        // Evaluate the score on the training and validation data
-        double scoreTrain = scorer->test(*fitter, *dataset);
-        double scoreVal = scorer->test(*fitter, *validationData);
+        dataSource->reset();
+        Dataset* validationData = dataSource->getValidationData();
 
         if (verbose) {
           std::ostringstream out;
-          out << "Score on batch: " << scoreTrain << std::endl
-              << "Score on validation data: " << scoreVal;
+          out << "Validation data size: " << validationData->getNumberInstances();
           print(out);
         }
+        // Process dataset iteratively
+        size_t iteration = 0;
+        while (true) {
+          std::unique_ptr<Dataset> dataset(dataSource->getNextSamples());
+          if (dataset->getNumberInstances() == 0) {
+            // The source does not provide any more samples
+            break;
+          }
 
-        // Refine the model if neccessary
-        monitor->pushToBuffer(numInstances, scoreVal, scoreTrain);
-        size_t refinements = monitor->refinementsNecessary();
-        while (refinements--) {
-          fitter->refine();
-        }
-
-        if (verbose) {
-          std::ostringstream out;
-          out << "###############"
-              << "Iteration finished.";
-          print(out);
+          trainOnBatch(*fitter, *scorer, *monitor, *dataset, *validationData, iteration++,
+                       verbose);
         }
       }
+      // Evaluate the final score on the validation data
+      dataSource->reset();
+      Dataset* validationData = dataSource->getValidationData();
+      scores.push_back(scorer->test(*fitter, *validationData));
     }
-    // Evaluate the final score on the validation data
-    dataSource->reset();
-    Dataset* validationData = dataSource->getValidationData();
-    scores.push_back(scorer->test(*fitter, *validationData));
   }
 
   // Calculate mean score and std deviation
@@ -154,5 +134,133 @@ double SparseGridMinerCrossValidation::learn(bool verbose) {
   print(out);
   return meanScore;
 }
+
+std::vector<double> SparseGridMinerCrossValidation::learnFoldsConcurrently(bool verbose) {
+  const CrossvalidationConfiguration& crossValidationConfig =
+      dataSource->getCrossValidationConfig();
+  const size_t kfold = crossValidationConfig.kfold_;
+  const size_t epochs = dataSource->getConfig().epochs;
+
+  // The data source is not thread-safe, hence a fold reads its validation data and training
+  // batches under a lock when it starts. Thus, only the data of the folds that are currently
+  // trained is held in memory. The shuffling is deterministic, i.e. every epoch of a fold would
+  // read the same batches.
+  std::mutex dataSourceMutex;
+
+  // The last fold is trained by the fitter of the miner (such that the miner provides the model of
+  // the last fold as in the sequential case), all other folds by untrained clones.
+  std::vector<std::unique_ptr<ModelFittingBase>> models(kfold - 1);
+  for (auto& model : models) {
+    model.reset(fitter->cloneUntrained());
+  }
+  fitter->reset();
+
+  std::vector<double> scores(kfold);
+  TrialScheduler scheduler(crossValidationConfig.concurrentFolds_,
+                           crossValidationConfig.threadsPerFold_);
+
+  std::ostringstream out;
+  out << "###############"
+      << "Training " << kfold << " folds, " << scheduler.getSlots(kfold)
+      << " concurrently with " << scheduler.getThreadsPerTrial(kfold) << " threads each";
+  print(out);
+
+  scheduler.run(kfold, [&](size_t fold, size_t) {
+    std::unique_ptr<Dataset> validationData;
+    std::vector<std::unique_ptr<Dataset>> batches;
+    {
+      std::lock_guard<std::mutex> lock(dataSourceMutex);
+      dataSource->setFold(fold);
+      dataSource->reset();
+      validationData = std::make_unique<Dataset>(*dataSource->getValidationData());
+
+      if (epochs > 0) {
+        while (true) {
+          std::unique_ptr<Dataset> dataset(dataSource->getNextSamples());
+          if (dataset->getNumberInstances() == 0) {
+            break;
+          }
+          batches.push_back(std::move(dataset));
+        }
+      }
+    }
+
+    ModelFittingBase& model = (fold + 1 < kfold) ? *models[fold] : *fitter;
+    // every fold uses its own scorer and refinement monitor
+    Scorer foldScorer(*scorer);
+    RefinementMonitorFactory monitorFactory;
+    std::unique_ptr<RefinementMonitor> monitor(monitorFactory.createRefinementMonitor(
+        model.getFitterConfiguration().getRefinementConfig()));
+
+    std::ostringstream out;
+    out << "###############"
+        << "Fold #" << fold;
+    print(out);
+
+    for (size_t epoch = 0; epoch < epochs; epoch++) {
+      size_t iteration = 0;
+      for (auto& batch : batches) {
+        // train on a copy, as fitters may keep or modify the dataset
+        Dataset dataset(*batch);
+        trainOnBatch(model, foldScorer, *monitor, dataset, *validationData, iteration++,
+                     verbose);
+      }
+    }
+
+    // Evaluate the final score on the validation data
+    scores[fold] = foldScorer.test(model, *validationData);
+
+    // release the model of the fold right away, such that only the models of the folds that are
+    // currently trained are held in memory
+    if (fold + 1 < kfold) {
+      models[fold].reset();
+    }
+  });
+
+  return scores;
+}
+
+void SparseGridMinerCrossValidation::trainOnBatch(ModelFittingBase& model, Scorer& batchScorer,
+                                                  RefinementMonitor& monitor, Dataset& dataset,
+                                                  Dataset& validationData, size_t iteration,
+                                                  bool verbose) {
+  size_t numInstances = dataset.getNumberInstances();
+
+  if (verbose) {
+    std::ostringstream out;
+    out << "###############"
+        << "Itertation #" << iteration << std::endl
+        << "Batch size: " << numInstances;
+    print(out);
+  }
+
+  // Train model on new batch
+  model.update(dataset);
+
+  // Evaluate the score on the training and validation data
+  double scoreTrain = batchScorer.test(model, dataset);
+  double scoreVal = batchScorer.test(model, validationData);
+
+  if (verbose) {
+    std::ostringstream out;
+    out << "Score on batch: " << scoreTrain << std::endl
+        << "Score on validation data: " << scoreVal;
+    print(out);
+  }
+
+  // Refine the model if neccessary
+  monitor.pushToBuffer(numInstances, scoreVal, scoreTrain);
+  size_t refinements = monitor.refinementsNecessary();
+  while (refinements--) {
+    model.refine();
+  }
+
+  if (verbose) {
+    std::ostringstream out;
+    out << "###############"
+        << "Iteration finished.";
+    print(out);
+  }
+}
 } /* namespace datadriven */
 } /* namespace sgpp */
@@ -12,10 +12,12 @@
 
 #pragma once
 
+#include <sgpp/datadriven/algorithm/RefinementMonitor.hpp>
 #include <sgpp/datadriven/datamining/base/SparseGridMiner.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/DataSourceCrossValidation.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -73,11 +75,34 @@ class SparseGridMinerCrossValidation : public SparseGridMiner {
   /**
    * Perform Learning cycle: Get samples from data source and based on the scoring procedure,
    * generalize data by fitting and asses quality of the fit. Each cycle is performed once per
-   * fold.
+   * fold. If crossValidation[concurrentFolds] is larger than one, the folds are trained
+   * concurrently (see TrialScheduler).
    */
   double learn(bool verbose) override;
 
  private:
+  /**
+   * Trains all folds concurrently on untrained clones of the fitter. Every fold reads its data
+   * from the data source when it starts, so each concurrently trained fold holds a copy of its
+   * training and validation data, i.e. up to concurrentFolds copies of the dataset are in memory.
+   * @param verbose whether to print the progress of each batch
+   * @return validation scores of the folds
+   */
+  std::vector<double> learnFoldsConcurrently(bool verbose);
+
+  /**
+   * Trains a model on a batch, scores it and refines it if necessary.
+   * @param model the model to train
+   * @param batchScorer scorer used to assess the model
+   * @param monitor refinement monitor of the fold
+   * @param dataset the batch
+   * @param validationData the validation data of the fold
+   * @param iteration index of the batch (for output only)
+   * @param verbose whether to print the progress
+   */
+  void trainOnBatch(ModelFittingBase& model, Scorer& batchScorer, RefinementMonitor& monitor,
+                    Dataset& dataset, Dataset& validationData, size_t iteration, bool verbose);
+
   /**
    * DataSource provides samples that will be used by fitter to generalize data and scorer to
    * validate and assess model robustness.
@@ -0,0 +1,123 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/datamining/base/TrialScheduler.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+TrialScheduler::TrialScheduler(size_t concurrentTrials, size_t threadsPerTrial)
+    : concurrentTrials{std::max(concurrentTrials, static_cast<size_t>(1))},
+      threadsPerTrial{threadsPerTrial} {}
+
+size_t TrialScheduler::getSlots(size_t numTrials) const {
+  return std::max(std::min(concurrentTrials, numTrials), static_cast<size_t>(1));
+}
+
+size_t TrialScheduler::getThreadsPerTrial(size_t numTrials) const {
+  if (threadsPerTrial > 0) {
+    return threadsPerTrial;
+  }
+
+#ifdef _OPENMP
+  const size_t maxThreads = static_cast<size_t>(omp_get_max_threads());
+#else
+  const size_t maxThreads = 1;
+#endif
+  return std::max(maxThreads / getSlots(numTrials), static_cast<size_t>(1));
+}
+
+void TrialScheduler::run(size_t numTrials,
+                         const std::function<void(size_t trial, size_t slot)>& trial) const {
+  if (numTrials == 0) {
+    return;
+  }
+
+  const size_t slots = getSlots(numTrials);
+  const size_t threads = getThreadsPerTrial(numTrials);
+
+  if (slots == 1) {
+    // run in the calling thread, only restrict the number of threads if requested
+#ifdef _OPENMP
+    const int previousThreads = omp_get_max_threads();
+    if (threadsPerTrial > 0) {
+      omp_set_num_threads(static_cast<int>(threads));
+    }
+#endif
+
+    try {
+      for (size_t i = 0; i < numTrials; i++) {
+        trial(i, 0);
+      }
+    } catch (...) {
+#ifdef _OPENMP
+      omp_set_num_threads(previousThreads);
+#endif
+      throw;
+    }
+
+#ifdef _OPENMP
+    omp_set_num_threads(previousThreads);
+#endif
+    return;
+  }
+
+  std::atomic<size_t> nextTrial{0};
+  std::atomic<bool> failed{false};
+  std::exception_ptr exception;
+  std::mutex exceptionMutex;
+
+  auto worker = [&](size_t slot) {
+#ifdef _OPENMP
+    // the number of OpenMP threads is an internal control variable of each (worker) thread
+    omp_set_num_threads(static_cast<int>(threads));
+#endif
+    while (!failed) {
+      const size_t i = nextTrial++;
+      if (i >= numTrials) {
+        break;
+      }
+
+      try {
+        trial(i, slot);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(exceptionMutex);
+        if (!exception) {
+          exception = std::current_exception();
+        }
+        failed = true;
+      }
+    }
+  };
+
+  std::vector<std::thread> workers;
+  workers.reserve(slots);
+
+  for (size_t slot = 0; slot < slots; slot++) {
+    workers.emplace_back(worker, slot);
+  }
+
+  for (auto& thread : workers) {
+    thread.join();
+  }
+
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
+}
+
+} /* namespace datadriven */
+} /* namespace sgpp */
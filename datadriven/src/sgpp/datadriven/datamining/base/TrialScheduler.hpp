@@ -0,0 +1,68 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * TrialScheduler runs independent trials of a model selection process (e.g. the folds of a cross
+ * validation or the configurations of a hyperparameter optimization) concurrently.
+ *
+ * The available cores are split into a number of concurrently running trials and a number of
+ * OpenMP threads per trial. Each concurrently running trial occupies one slot, i.e. one worker
+ * thread. Objects that are not thread-safe (fitters, data sources, ...) have to be provided per
+ * slot or per trial by the caller.
+ */
+class TrialScheduler {
+ public:
+  /**
+   * Constructor
+   * @param concurrentTrials maximal number of trials that run at the same time (1 runs all trials
+   * one after another in the calling thread)
+   * @param threadsPerTrial number of OpenMP threads used by each trial (0 splits the maximal number
+   * of OpenMP threads evenly among the concurrently running trials)
+   */
+  TrialScheduler(size_t concurrentTrials, size_t threadsPerTrial);
+
+  /**
+   * Runs the trials 0, ..., numTrials - 1. Trials are started in ascending order. If a trial
+   * throws, no further trials are started and the first exception is rethrown after all running
+   * trials have finished.
+   * @param numTrials number of trials
+   * @param trial function that runs a single trial, its arguments are the index of the trial and
+   * the index of the slot (in {0, ..., getSlots(numTrials) - 1}) it runs in
+   */
+  void run(size_t numTrials, const std::function<void(size_t trial, size_t slot)>& trial) const;
+
+  /**
+   * @param numTrials number of trials
+   * @return number of slots used to run the given number of trials
+   */
+  size_t getSlots(size_t numTrials) const;
+
+  /**
+   * @param numTrials number of trials
+   * @return number of OpenMP threads each trial runs with
+   */
+  size_t getThreadsPerTrial(size_t numTrials) const;
+
+ private:
+  /**
+   * Maximal number of trials that run at the same time
+   */
+  size_t concurrentTrials;
+  /**
+   * Number of OpenMP threads per trial (0: automatic)
+   */
+  size_t threadsPerTrial;
+};
+
+} /* namespace datadriven */
+} /* namespace sgpp */
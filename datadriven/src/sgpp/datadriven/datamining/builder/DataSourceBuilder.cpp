@@ -60,6 +60,11 @@ DataSourceBuilder& DataSourceBuilder::withCompression(bool isCompressed) {
   return *this;
 }
 
+DataSourceBuilder& DataSourceBuilder::withStreaming(bool streaming) {
+  config.streaming = streaming;
+  return *this;
+}
+
 DataSourceBuilder& DataSourceBuilder::withPath(const std::string& filePath) {
   config.filePath = filePath;
   if (config.fileType == DataSourceFileType::NONE) {
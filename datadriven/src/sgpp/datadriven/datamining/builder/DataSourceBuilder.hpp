@@ -48,6 +48,14 @@ class DataSourceBuilder {
    */
   DataSourceBuilder& withCompression(bool isCompressed);
 
+  /**
+   * Optionally specify if the file should be streamed in batches instead of being read into
+   * memory at once. This is set to false by default.
+   * @param streaming true if the file should be streamed, false otherwise.
+   * @return Reference to this object, used for chaining.
+   */
+  DataSourceBuilder& withStreaming(bool streaming);
+
   /**
    * Optionally Specify the file type if files are used. If data source does not use any files,
    * this is set to none by default.
@@ -43,11 +43,15 @@ ModelFittingBase *DensityEstimationMinerFactory::createFitter(
 HyperparameterOptimizer *DensityEstimationMinerFactory::buildHPO(const std::string &path) const {
   DataMiningConfigParser parser(path);
   if (parser.getHPOMethod("bayesian") == "harmonica") {
-    return new HarmonicaHyperparameterOptimizer(buildMiner(path),
-                                                new DensityEstimationFitterFactory(parser), parser);
+    return addConcurrentMiners(
+        new HarmonicaHyperparameterOptimizer(buildMiner(path),
+                                             new DensityEstimationFitterFactory(parser), parser),
+        path);
   } else {
-    return new BoHyperparameterOptimizer(buildMiner(path),
-                                         new DensityEstimationFitterFactory(parser), parser);
+    return addConcurrentMiners(
+        new BoHyperparameterOptimizer(buildMiner(path), new DensityEstimationFitterFactory(parser),
+                                      parser),
+        path);
   }
 }
 FitterFactory *DensityEstimationMinerFactory::createFitterFactory(
@@ -43,13 +43,23 @@ SparseGridMiner* MinerFactory::buildMiner(const std::string& path) const {
 sgpp::datadriven::HyperparameterOptimizer* MinerFactory::buildHPO(const std::string& path) const {
   DataMiningConfigParser parser(path);
   if (parser.getHPOMethod("bayesian") == "harmonica") {
-    return new HarmonicaHyperparameterOptimizer(buildMiner(path), createFitterFactory(parser),
-                                                parser);
+    return addConcurrentMiners(
+        new HarmonicaHyperparameterOptimizer(buildMiner(path), createFitterFactory(parser), parser),
+        path);
   } else {
-    return new BoHyperparameterOptimizer(buildMiner(path), createFitterFactory(parser), parser);
+    return addConcurrentMiners(
+        new BoHyperparameterOptimizer(buildMiner(path), createFitterFactory(parser), parser), path);
   }
 }
 
+HyperparameterOptimizer* MinerFactory::addConcurrentMiners(HyperparameterOptimizer* hpo,
+                                                           const std::string& path) const {
+  for (size_t i = 1; i < hpo->getConcurrentTrials(); i++) {
+    hpo->addMiner(buildMiner(path));
+  }
+  return hpo;
+}
+
 DataSourceSplitting* MinerFactory::createDataSourceSplitting(
     const DataMiningConfigParser& parser) const {
   DataSourceConfig config{};
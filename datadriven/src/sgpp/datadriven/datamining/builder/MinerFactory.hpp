@@ -84,6 +84,16 @@ class MinerFactory {
    * @return the scorer instance
    */
   virtual Scorer* createScorer(const DataMiningConfigParser& parser) const;
+
+  /**
+   * Provides a hyperparameter optimizer with one additional miner per concurrently running trial
+   * (see HPOConfig::getConcurrentTrials()), as miners can not be shared between trials.
+   * @param hpo the hyperparameter optimizer
+   * @param path path to the configuration file the miners are built from
+   * @return the hyperparameter optimizer
+   */
+  HyperparameterOptimizer* addConcurrentMiners(HyperparameterOptimizer* hpo,
+                                               const std::string& path) const;
 };
 } /* namespace datadriven */
 } /* namespace sgpp */
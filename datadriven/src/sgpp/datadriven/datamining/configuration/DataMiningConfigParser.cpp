@@ -104,6 +104,8 @@ bool DataMiningConfigParser::getDataSourceConfig(DataSourceConfig &config,
     config.filePath = parseString(*dataSourceConfig, "filePath", defaults.filePath, "dataSource");
     config.isCompressed =
         parseBool(*dataSourceConfig, "compression", defaults.isCompressed, "dataSource");
+    config.streaming =
+        parseBool(*dataSourceConfig, "streaming", defaults.streaming, "dataSource");
     config.numBatches =
         parseUInt(*dataSourceConfig, "numBatches", defaults.numBatches, "dataSource");
     config.batchSize = parseUInt(*dataSourceConfig, "batchSize", defaults.batchSize, "dataSource");
@@ -329,6 +331,10 @@ bool DataMiningConfigParser::getFitterCrossvalidationConfig(
         parseUInt(*crossvalidationConfig, "lambdaSteps", defaults.lambdaSteps_, "crossValidation");
     config.logScale_ =
         parseBool(*crossvalidationConfig, "logScale", defaults.logScale_, "crossValidation");
+    config.concurrentFolds_ = parseUInt(*crossvalidationConfig, "concurrentFolds",
+                                        defaults.concurrentFolds_, "crossValidation");
+    config.threadsPerFold_ = parseUInt(*crossvalidationConfig, "threadsPerFold",
+                                       defaults.threadsPerFold_, "crossValidation");
   } else {
     std::cout << "# Could not find specification  of fitter[crossvalidationConfig]. Falling "
                  "Back to default values."
@@ -726,6 +732,10 @@ void DataMiningConfigParser::getHPOConfig(HPOConfig &config) {
     auto node = static_cast<DictNode *>(&(*configFile)["hpo"]);
     config.setSeed(parseInt(*node, "randomSeed", config.getSeed(), "hpo"));
     config.setNTrainSamples(parseInt(*node, "trainSize", config.getNTrainSamples(), "hpo"));
+    config.setConcurrentTrials(
+        parseUInt(*node, "concurrentTrials", config.getConcurrentTrials(), "hpo"));
+    config.setThreadsPerTrial(
+        parseUInt(*node, "threadsPerTrial", config.getThreadsPerTrial(), "hpo"));
     if (node->contains("harmonica")) {
       auto harmonica = static_cast<DictNode *>(&(*node)["harmonica"]);
       config.setLambda(parseDouble(*harmonica, "lambda", config.getLambda(), "hpo"));
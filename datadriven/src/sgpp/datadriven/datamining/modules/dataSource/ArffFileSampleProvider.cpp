@@ -15,8 +15,10 @@
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/exception/data_exception.hpp>
 #include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/shuffling/DataShufflingFunctorSequential.hpp>
 #include <sgpp/datadriven/tools/ARFFTools.hpp>
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -25,13 +27,24 @@ namespace sgpp {
 namespace datadriven {
 
 ArffFileSampleProvider::ArffFileSampleProvider(DataShufflingFunctor *shuffling)
-    : shuffling{shuffling}, dataset(Dataset{}), counter(0) {}
+    : shuffling{shuffling}, dataset(Dataset{}), counter(0), reader(nullptr) {}
 
 SampleProvider* ArffFileSampleProvider::clone() const {
-  return dynamic_cast<SampleProvider*>(new ArffFileSampleProvider{*this});
+  ArffFileSampleProvider* copy = new ArffFileSampleProvider{*this};
+
+  if (reader != nullptr) {
+    // the copy shares the mapped file, but needs its own read position
+    copy->reader = std::make_shared<DataFileReader>(*reader);
+  }
+
+  return dynamic_cast<SampleProvider*>(copy);
 }
 
 size_t ArffFileSampleProvider::getDim() const {
+  if (reader != nullptr) {
+    return reader->getDimension();
+  }
+
   if (dataset.getDimension() != 0) {
     return dataset.getDimension();
   } else {
@@ -40,6 +53,10 @@ size_t ArffFileSampleProvider::getDim() const {
 }
 
 size_t ArffFileSampleProvider::getNumSamples() const {
+  if (reader != nullptr) {
+    return reader->getNumberInstances();
+  }
+
   if (dataset.getDimension() != 0) {
     return dataset.getNumberInstances();
   } else {
@@ -52,6 +69,8 @@ void ArffFileSampleProvider::readFile(const std::string& fileName,
                                       size_t readinCutoff,
                                       std::vector<size_t> readinColumns,
                                       std::vector<double> readinClasses) {
+  reader = nullptr;
+
   try {
     dataset = ARFFTools::readARFFFromFile(fileName, hasTargets, readinCutoff,
         readinColumns, readinClasses);
@@ -63,6 +82,10 @@ void ArffFileSampleProvider::readFile(const std::string& fileName,
 }
 
 Dataset* ArffFileSampleProvider::getNextSamples(size_t howMany) {
+  if (reader != nullptr) {
+    return reader->readNext(howMany);
+  }
+
   if (dataset.getDimension() != 0) {
     return splitDataset(howMany);
   } else {
@@ -71,6 +94,10 @@ Dataset* ArffFileSampleProvider::getNextSamples(size_t howMany) {
 }
 
 Dataset* ArffFileSampleProvider::getAllSamples() {
+  if (reader != nullptr) {
+    return reader->readNext(reader->getNumberInstances());
+  }
+
   if (dataset.getDimension() != 0) {
     return this->getNextSamples(dataset.getNumberInstances());
   } else {
@@ -83,6 +110,8 @@ void ArffFileSampleProvider::readString(const std::string& input,
                                         size_t readinCutoff,
                                         std::vector<size_t> readinColumns,
                                         std::vector<double> readinClasses) {
+  reader = nullptr;
+
   try {
     dataset = ARFFTools::readARFFFromString(input, hasTargets, readinCutoff,
         readinColumns, readinClasses);
@@ -120,8 +149,34 @@ Dataset* ArffFileSampleProvider::splitDataset(size_t howMany) {
   return tmpDataset.release();
 }
 
+void ArffFileSampleProvider::openFile(const std::string& fileName,
+                                      bool hasTargets,
+                                      size_t readinCutoff,
+                                      std::vector<size_t> readinColumns,
+                                      std::vector<double> readinClasses) {
+  if ((shuffling != nullptr) &&
+      (dynamic_cast<DataShufflingFunctorSequential*>(shuffling) == nullptr)) {
+    throw base::data_exception{"Streaming ARFF files requires sequential shuffling."};
+  }
+
+  try {
+    reader = std::make_shared<DataFileReader>(fileName, DataFileReader::Format::ARFF, false,
+                                              hasTargets, readinCutoff, readinColumns,
+                                              readinClasses);
+  } catch (...) {
+    throw base::data_exception{"Failed to open ARFF File."};
+  }
+
+  dataset = Dataset{};
+  counter = 0;
+}
+
 void ArffFileSampleProvider::reset() {
   counter = 0;
+
+  if (reader != nullptr) {
+    reader->reset();
+  }
 }
 
 } /* namespace datadriven */
@@ -12,13 +12,14 @@
 #pragma once
 
 #include <sgpp/datadriven/datamining/modules/dataSource/FileSampleProvider.hpp>
+#include <sgpp/datadriven/tools/DataFileReader.hpp>
 
+#include <memory>
 #include <string>
 #include <vector>
 
 // TODO(lettrich): allow different splitting techniques e.g. proportional splitting for
 // classification
-// TODO(lettrich): save memory by only storing the dataset if data is accessed in batches.
 namespace sgpp {
 namespace datadriven {
 
@@ -81,6 +82,23 @@ class ArffFileSampleProvider : public FileSampleProvider {
                   std::vector<size_t> readinColumns = std::vector<size_t>(),
                   std::vector<double> readinClasses = std::vector<double>()) override;
 
+  /**
+   * Open an existing ARFF file for streaming: the file is mapped into memory and
+   * #getNextSamples parses the requested samples from it in the order of the file, so the whole
+   * dataset is never stored inside this class. Requires sequential shuffling. Throws if the file
+   * can not be opened.
+   * @param filePath Path to an existing file.
+   * @param hasTargets whether the file has targest (i.e. supervised learning)
+   * @param readinCutoff see FileSampleProvider.hpp
+   * @param readinColumns see FileSampleProvider.hpp
+   * @param readinClasses see FileSampleProvider.hpp
+   */
+  void openFile(const std::string &filePath,
+                bool hasTargets,
+                size_t readinCutoff = -1,
+                std::vector<size_t> readinColumns = std::vector<size_t>(),
+                std::vector<double> readinClasses = std::vector<double>()) override;
+
   /**
    * Resets the state of the sample provider (e.g. to start a new epoch)
    */
@@ -104,6 +122,11 @@ class ArffFileSampleProvider : public FileSampleProvider {
    */
   size_t counter;
 
+  /**
+   * Reader of the file if it was opened for streaming (see #openFile), nullptr otherwise.
+   */
+  std::shared_ptr<DataFileReader> reader;
+
   /**
    * Helper member function for #getNextSamples. Linearly walks through dataset, beginning at
    * counter and returns a pointer to a new instance of #sgpp::datadriven::Dataset containing the
@@ -15,8 +15,10 @@
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/exception/data_exception.hpp>
 #include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/shuffling/DataShufflingFunctorSequential.hpp>
 #include <sgpp/datadriven/tools/CSVTools.hpp>
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -25,13 +27,24 @@ namespace sgpp {
 namespace datadriven {
 
 CSVFileSampleProvider::CSVFileSampleProvider(DataShufflingFunctor *shuffling)
-    : shuffling{shuffling}, dataset(Dataset{}), counter(0) {}
+    : shuffling{shuffling}, dataset(Dataset{}), counter(0), reader(nullptr) {}
 
 SampleProvider* CSVFileSampleProvider::clone() const {
-  return dynamic_cast<SampleProvider*>(new CSVFileSampleProvider{*this});
+  CSVFileSampleProvider* copy = new CSVFileSampleProvider{*this};
+
+  if (reader != nullptr) {
+    // the copy shares the mapped file, but needs its own read position
+    copy->reader = std::make_shared<DataFileReader>(*reader);
+  }
+
+  return dynamic_cast<SampleProvider*>(copy);
 }
 
 size_t CSVFileSampleProvider::getDim() const {
+  if (reader != nullptr) {
+    return reader->getDimension();
+  }
+
   if (dataset.getDimension() != 0) {
     return dataset.getDimension();
   } else {
@@ -40,6 +53,10 @@ size_t CSVFileSampleProvider::getDim() const {
 }
 
 size_t CSVFileSampleProvider::getNumSamples() const {
+  if (reader != nullptr) {
+    return reader->getNumberInstances();
+  }
+
   if (dataset.getDimension() != 0) {
     return dataset.getNumberInstances();
   } else {
@@ -52,6 +69,8 @@ void CSVFileSampleProvider::readFile(const std::string& fileName,
                                      size_t readinCutoff,
                                      std::vector<size_t> readinColumns,
                                      std::vector<double> readinClasses) {
+  reader = nullptr;
+
   try {
     // call readCSV with skipfirstline set to true
     dataset = CSVTools::readCSVFromFile(fileName, true, hasTargets, readinCutoff,
@@ -64,6 +83,10 @@ void CSVFileSampleProvider::readFile(const std::string& fileName,
 }
 
 Dataset* CSVFileSampleProvider::getNextSamples(size_t howMany) {
+  if (reader != nullptr) {
+    return reader->readNext(howMany);
+  }
+
   if (dataset.getDimension() != 0) {
     return splitDataset(howMany);
   } else {
@@ -72,6 +95,10 @@ Dataset* CSVFileSampleProvider::getNextSamples(size_t howMany) {
 }
 
 Dataset* CSVFileSampleProvider::getAllSamples() {
+  if (reader != nullptr) {
+    return reader->readNext(reader->getNumberInstances());
+  }
+
   if (dataset.getDimension() != 0) {
     return this->getNextSamples(dataset.getNumberInstances());
   } else {
@@ -120,8 +147,34 @@ Dataset* CSVFileSampleProvider::splitDataset(size_t howMany) {
   return tmpDataset.release();
 }
 
+void CSVFileSampleProvider::openFile(const std::string& fileName,
+                                     bool hasTargets,
+                                     size_t readinCutoff,
+                                     std::vector<size_t> readinColumns,
+                                     std::vector<double> readinClasses) {
+  if ((shuffling != nullptr) &&
+      (dynamic_cast<DataShufflingFunctorSequential*>(shuffling) == nullptr)) {
+    throw base::data_exception{"Streaming CSV files requires sequential shuffling."};
+  }
+
+  try {
+    reader = std::make_shared<DataFileReader>(fileName, DataFileReader::Format::CSV, true,
+                                              hasTargets, readinCutoff, readinColumns,
+                                              readinClasses);
+  } catch (...) {
+    throw base::data_exception{"Failed to open CSV File."};
+  }
+
+  dataset = Dataset{};
+  counter = 0;
+}
+
 void CSVFileSampleProvider::reset() {
   counter = 0;
+
+  if (reader != nullptr) {
+    reader->reset();
+  }
 }
 
 } /* namespace datadriven */
@@ -29,10 +29,20 @@ DataSource::DataSource(DataSourceConfig conf, SampleProvider* sp)
     : config(conf), currentIteration(0), sampleProvider(std::unique_ptr<SampleProvider>(sp)) {
   // if a file name was specified, we are reading from a file, so we need to open it.
   if (!this->config.filePath.empty()) {
-    std::cout << "Read file " << config.filePath << std::endl;
-    dynamic_cast<FileSampleProvider*>(sampleProvider.get())
-        ->readFile(this->config.filePath, this->config.hasTargets, this->config.readinCutoff,
-                   this->config.readinColumns, this->config.readinClasses);
+    FileSampleProvider* fileSampleProvider =
+        dynamic_cast<FileSampleProvider*>(sampleProvider.get());
+
+    if (this->config.streaming) {
+      std::cout << "Stream file " << config.filePath << std::endl;
+      fileSampleProvider->openFile(this->config.filePath, this->config.hasTargets,
+                                   this->config.readinCutoff, this->config.readinColumns,
+                                   this->config.readinClasses);
+    } else {
+      std::cout << "Read file " << config.filePath << std::endl;
+      fileSampleProvider->readFile(this->config.filePath, this->config.hasTargets,
+                                   this->config.readinCutoff, this->config.readinColumns,
+                                   this->config.readinClasses);
+    }
   }
   // Build data transformation
   DataTransformationBuilder dataTrBuilder;
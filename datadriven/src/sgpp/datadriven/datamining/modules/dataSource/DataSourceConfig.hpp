@@ -48,6 +48,11 @@ struct DataSourceConfig {
    * The dataset is gzip compressed
    */
   bool isCompressed = false;
+  /**
+   * Stream the file in batches instead of reading it into memory at once (only for uncompressed
+   * files with sequential shuffling)
+   */
+  bool streaming = false;
   /**
    * How many batches should the dataset be split into for batch learning - if 1, take the
    * entire dataset
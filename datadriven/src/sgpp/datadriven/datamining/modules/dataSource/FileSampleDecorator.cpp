@@ -60,5 +60,13 @@ void FileSampleDecorator::readString(const std::string &input,
                                      std::vector<double> readinClasses) {
   fileSampleProvider->readString(input, hasTargets, readinCutoff, readinColumns, readinClasses);
 }
+
+void FileSampleDecorator::openFile(const std::string &fileName,
+                                   bool hasTargets,
+                                   size_t readinCutoff,
+                                   std::vector<size_t> readinColumns,
+                                   std::vector<double> readinClasses) {
+  fileSampleProvider->openFile(fileName, hasTargets, readinCutoff, readinColumns, readinClasses);
+}
 } /* namespace datadriven */
 } /* namespace sgpp */
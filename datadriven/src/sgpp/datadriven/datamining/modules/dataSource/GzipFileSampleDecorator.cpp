@@ -63,6 +63,14 @@ void GzipFileSampleDecorator::readFile(const std::string& fileName,
     readinCutoff, readinColumns, readinClasses);
 }
 
+void GzipFileSampleDecorator::openFile(const std::string& fileName,
+                                       bool hasTargets,
+                                       size_t readinCutoff,
+                                       std::vector<size_t> readinColumns,
+                                       std::vector<double> readinClasses) {
+  readFile(fileName, hasTargets, readinCutoff, readinColumns, readinClasses);
+}
+
 void GzipFileSampleDecorator::reset() {
 }
 
@@ -50,6 +50,21 @@ class GzipFileSampleDecorator : public FileSampleDecorator {
                 std::vector<size_t> readinColumns = std::vector<size_t>(),
                 std::vector<double> readinClasses = std::vector<double>()) override;
 
+  /**
+   * Compressed files can't be streamed, so this decompresses and reads the whole file (see
+   * #readFile).
+   * @param fileName path to the compressed file
+   * @param hasTargets whether the file has targets (i.e. supervised learning)
+   * @param readinCutoff see FileSampleProvider.hpp
+   * @param readinColumns see FileSampleProvider.hpp
+   * @param readinClasses see FileSampleProvider.hpp
+   */
+  void openFile(const std::string &fileName,
+                bool hasTargets,
+                size_t readinCutoff = -1,
+                std::vector<size_t> readinColumns = std::vector<size_t>(),
+                std::vector<double> readinClasses = std::vector<double>()) override;
+
   /**
    * Resets the state of the sample provider (e.g. to start a new epoch)
    */
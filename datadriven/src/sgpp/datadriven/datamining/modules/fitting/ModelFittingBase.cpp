@@ -17,6 +17,8 @@
 #include <sgpp/pde/operation/PdeOpFactory.hpp>
 #include <sgpp/solver/sle/BiCGStab.hpp>
 #include <sgpp/solver/sle/ConjugateGradients.hpp>
+#include <sgpp/solver/sle/PipelinedConjugateGradients.hpp>
+#include <sgpp/solver/sle/PreconditionedConjugateGradients.hpp>
 #include <string>
 #include <vector>
 
@@ -35,6 +37,8 @@ using sgpp::solver::SLESolver;
 using sgpp::solver::SLESolverType;
 using sgpp::solver::ConjugateGradients;
 using sgpp::solver::BiCGStab;
+using sgpp::solver::PipelinedConjugateGradients;
+using sgpp::solver::PreconditionedConjugateGradients;
 using sgpp::solver::SLESolverConfiguration;
 
 ModelFittingBase::ModelFittingBase()
@@ -90,6 +94,10 @@ SLESolver *ModelFittingBase::buildSolver(const SLESolverConfiguration &sleConfig
     return new ConjugateGradients(sleConfig.maxIterations_, sleConfig.eps_);
   } else if (sleConfig.type_ == SLESolverType::BiCGSTAB) {
     return new BiCGStab(sleConfig.maxIterations_, sleConfig.eps_);
+  } else if (sleConfig.type_ == SLESolverType::PCG) {
+    return new PreconditionedConjugateGradients(sleConfig.maxIterations_, sleConfig.eps_);
+  } else if (sleConfig.type_ == SLESolverType::PipelinedCG) {
+    return new PipelinedConjugateGradients(sleConfig.maxIterations_, sleConfig.eps_);
   } else {
     throw factory_exception(
         "ModelFittingBase: An unsupported SLE solver type was "
@@ -137,6 +137,16 @@ class ModelFittingBase {
     throw sgpp::base::not_implemented_exception("getProcessGrid() not implemented in this fitter");
   }
 
+  /**
+   * Creates a new model with the same configuration, e.g. to train several folds or
+   * hyperparameter configurations concurrently. In contrast to a deep copy, the state of the
+   * model (grid, coefficients, ...) is not copied, i.e. the new model is in the state after reset().
+   * @return new untrained model. New object is owned by caller.
+   */
+  virtual ModelFittingBase *cloneUntrained() const {
+    throw sgpp::base::not_implemented_exception("cloneUntrained() not implemented in this fitter");
+  }
+
   /**
    * Get the configuration of the fitter object.
    * @return configuration of the fitter object
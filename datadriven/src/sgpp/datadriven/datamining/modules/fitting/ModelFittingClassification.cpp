@@ -316,6 +316,16 @@ void ModelFittingClassification::update(Dataset& newDataset) {
   }
 }
 
+ModelFittingBase* ModelFittingClassification::cloneUntrained() const {
+  // the configuration is stored as density estimation configuration
+  FitterConfigurationClassification classificationConfig;
+  static_cast<FitterConfigurationDensityEstimation&>(classificationConfig) =
+      static_cast<const FitterConfigurationDensityEstimation&>(*config);
+  auto clone = new ModelFittingClassification(classificationConfig);
+  clone->verboseSolver = verboseSolver;
+  return clone;
+}
+
 void ModelFittingClassification::reset() {
   models.clear();
   classNumberInstances.clear();
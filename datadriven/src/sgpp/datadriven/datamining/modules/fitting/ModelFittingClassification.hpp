@@ -86,6 +86,12 @@ class ModelFittingClassification : public ModelFittingBase {
    */
   void reset() override;
 
+  /**
+   * Creates a new, untrained model with the same configuration
+   * @return new model. New object is owned by caller.
+   */
+  ModelFittingBase* cloneUntrained() const override;
+
   /*
    * store Fitter into text file in folder /datadriven/classificator/
    */
@@ -166,6 +166,13 @@ void ModelFittingDensityEstimationCG::update(DataMatrix& newDataset) {
 
 bool ModelFittingDensityEstimationCG::isRefinable() { return true; }
 
+ModelFittingBase* ModelFittingDensityEstimationCG::cloneUntrained() const {
+  auto clone = new ModelFittingDensityEstimationCG(
+      static_cast<const FitterConfigurationDensityEstimation&>(*config));
+  clone->verboseSolver = verboseSolver;
+  return clone;
+}
+
 void ModelFittingDensityEstimationCG::reset() {
   // Clear model
   grid.reset();
@@ -105,6 +105,12 @@ class ModelFittingDensityEstimationCG : public ModelFittingDensityEstimation {
    */
   void reset() override;
 
+  /**
+   * Creates a new, untrained model with the same configuration
+   * @return new model. New object is owned by caller.
+   */
+  ModelFittingBase* cloneUntrained() const override;
+
  private:
   /**
    * Creates the regularization operation matrix for the model settings.
@@ -95,7 +95,14 @@ void ModelFittingDensityEstimationOnOff::fit(DataMatrix& newDataset) {
                                densityEstimationConfig)) {
       std::string offlineFilepath = database.getDataMatrix(
           gridConfig, refinementConfig, regularizationConfig, densityEstimationConfig);
-      offline = DBMatOfflineFactory::buildFromFile(offlineFilepath);
+      if (DBMatBinaryFile::isBinaryFile(offlineFilepath)) {
+        // the matrices are copied from the mapped file in bulk (without parsing),
+        // the file is unmapped right afterwards
+        offline = DBMatOfflineFactory::buildFromFile(*database.openDataMatrix(
+            gridConfig, refinementConfig, regularizationConfig, densityEstimationConfig));
+      } else {
+        offline = DBMatOfflineFactory::buildFromFile(offlineFilepath);
+      }
     }
   }
 
@@ -173,6 +180,13 @@ bool ModelFittingDensityEstimationOnOff::isRefinable() {
   return false;
 }
 
+ModelFittingBase* ModelFittingDensityEstimationOnOff::cloneUntrained() const {
+  auto clone = new ModelFittingDensityEstimationOnOff(
+      static_cast<const FitterConfigurationDensityEstimation&>(*config));
+  clone->verboseSolver = verboseSolver;
+  return clone;
+}
+
 void ModelFittingDensityEstimationOnOff::reset() {
   grid.reset();
   online.reset();
@@ -112,6 +112,12 @@ class ModelFittingDensityEstimationOnOff : public ModelFittingDensityEstimation
    */
   void reset() override;
 
+  /**
+   * Creates a new, untrained model with the same configuration
+   * @return new model. New object is owned by caller.
+   */
+  ModelFittingBase* cloneUntrained() const override;
+
  private:
   // The online object
   std::unique_ptr<DBMatOnlineDE> online;
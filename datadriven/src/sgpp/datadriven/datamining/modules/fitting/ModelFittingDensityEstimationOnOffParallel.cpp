@@ -113,7 +113,14 @@ void ModelFittingDensityEstimationOnOffParallel::fit(DataMatrix& newDataset) {
                                densityEstimationConfig)) {
       std::string offlineFilepath = database.getDataMatrix(
           gridConfig, refinementConfig, regularizationConfig, densityEstimationConfig);
-      offline = DBMatOfflineFactory::buildFromFile(offlineFilepath);
+      if (DBMatBinaryFile::isBinaryFile(offlineFilepath)) {
+        // the matrices are copied from the mapped file in bulk (without parsing),
+        // the file is unmapped right afterwards
+        offline = DBMatOfflineFactory::buildFromFile(*database.openDataMatrix(
+            gridConfig, refinementConfig, regularizationConfig, densityEstimationConfig));
+      } else {
+        offline = DBMatOfflineFactory::buildFromFile(offlineFilepath);
+      }
     }
   }
 
@@ -211,6 +218,14 @@ bool ModelFittingDensityEstimationOnOffParallel::isRefinable() {
   return false;
 }
 
+ModelFittingBase* ModelFittingDensityEstimationOnOffParallel::cloneUntrained() const {
+  // the clone shares the BLACS process grid
+  auto clone = new ModelFittingDensityEstimationOnOffParallel(
+      static_cast<const FitterConfigurationDensityEstimation&>(*config), processGrid);
+  clone->verboseSolver = verboseSolver;
+  return clone;
+}
+
 void ModelFittingDensityEstimationOnOffParallel::reset() {
   grid.reset();
   online.reset();
@@ -128,6 +128,12 @@ class ModelFittingDensityEstimationOnOffParallel : public ModelFittingDensityEst
    */
   void reset() override;
 
+  /**
+   * Creates a new, untrained model with the same configuration
+   * @return new model. New object is owned by caller.
+   */
+  ModelFittingBase* cloneUntrained() const override;
+
   /**
    * @returns the BLACS process grid
    */
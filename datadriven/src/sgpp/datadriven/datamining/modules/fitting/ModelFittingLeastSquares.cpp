@@ -113,6 +113,13 @@ DMSystemMatrixBase *ModelFittingLeastSquares::buildSystemMatrix(
   return systemMatrix;
 }
 
+ModelFittingBase *ModelFittingLeastSquares::cloneUntrained() const {
+  auto clone = new ModelFittingLeastSquares(
+      static_cast<const FitterConfigurationLeastSquares &>(*config));
+  clone->verboseSolver = verboseSolver;
+  return clone;
+}
+
 void ModelFittingLeastSquares::reset() {
   grid.reset();
   refinementsPerformed = 0;
@@ -128,6 +135,7 @@ void ModelFittingLeastSquares::assembleSystemAndSolve(const SLESolverConfigurati
   systemMatrix->generateb(dataset->getTargets(), b);
 
   reconfigureSolver(*solver, solverConfig);
+  systemMatrix->preconditionSolver(*solver, grid->getStorage());
   solver->solve(*systemMatrix, alpha, b, true, verboseSolver, DEFAULT_RES_THRESHOLD);
 }
 }  // namespace datadriven
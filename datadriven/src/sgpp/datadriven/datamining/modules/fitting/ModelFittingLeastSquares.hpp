@@ -78,6 +78,12 @@ class ModelFittingLeastSquares : public ModelFittingBaseSingleGrid {
    */
   void reset() override;
 
+  /**
+   * Creates a new, untrained model with the same configuration
+   * @return new model. New object is owned by caller.
+   */
+  ModelFittingBase *cloneUntrained() const override;
+
  private:
   /**
    * Count the amount of refinement operations performed on the current dataset.
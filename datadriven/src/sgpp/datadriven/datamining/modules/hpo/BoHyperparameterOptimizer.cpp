@@ -68,16 +68,23 @@ double BoHyperparameterOptimizer::run(bool writeToFile) {
   initialConfigs.reserve(static_cast<size_t>(config.getNRandom()));
   std::mt19937 generator(static_cast<size_t>(config.getSeed()));
 
-  // random warmup phase
+  // random warmup phase: the fitters are built one after another, as the fitter factory is not
+  // thread-safe, and trained concurrently if configured
+  std::vector<ModelFittingBase*> fitters(static_cast<size_t>(config.getNRandom()));
+  std::vector<std::string> configStrings(fitters.size());
   for (int i = 0; i < config.getNRandom(); ++i) {
     initialConfigs.emplace_back(prototype);
     initialConfigs[i].randomize(generator);
     fitterFactory->setBO(initialConfigs[i]);
-    std::string configString = fitterFactory->printConfig();
-    // std::unique_ptr<ModelFittingBase> fitter(fitterFactory->buildFitter());
-    miner->setModel(fitterFactory->buildFitter());
-    double result = miner->learn(false);
-    // hpoScorer->calculateScore(*fitter, *trainData, &stdDeviation);
+    configStrings[i] = fitterFactory->printConfig();
+    fitters[i] = fitterFactory->buildFitter();
+  }
+  std::vector<double> results;
+  learnConcurrently(fitters, results);
+
+  for (int i = 0; i < config.getNRandom(); ++i) {
+    const std::string& configString = configStrings[i];
+    double result = results[i];
     initialConfigs[i].setScore(transformScore(result));
     std::cout << (i + 1) << configString << ", " << result;
     if (writeToFile) {
@@ -111,7 +118,12 @@ double BoHyperparameterOptimizer::run(bool writeToFile) {
     double result = miner->learn(false);
     nextConfig.setScore(transformScore(result));
     bo.updateGP(nextConfig, true);
-    bo.setScales(bo.fitScales(), 0.1);
+    // fitting the scales rebuilds the Gaussian Process for every likelihood evaluation, so it is
+    // only done periodically and after a new best result (which changes the normalized scores
+    // the most); otherwise, the incrementally updated Gaussian Process is used
+    if (((q + 1) % SCALE_REFIT_INTERVAL == 0) || (result < best)) {
+      bo.setScales(bo.fitScales(), SCALE_REFIT_FACTOR);
+    }
     std::cout << (q + config.getNRandom() + 1) << configString << ", " << result;
     if (writeToFile) {
       myfile.open(fn.str(), std::ios_base::app);
@@ -81,6 +81,17 @@ class BoHyperparameterOptimizer : public HyperparameterOptimizer {
    * @return transformed value
    */
   double transformScore(double original);
+
+ protected:
+  /**
+   * number of iterations after which the scales of the Gaussian Process are fitted again
+   * (in between, the Gaussian Process is only updated incrementally)
+   */
+  static const int SCALE_REFIT_INTERVAL = 5;
+  /**
+   * weight of newly fitted scales when they are blended with the current ones
+   */
+  static constexpr double SCALE_REFIT_FACTOR = 0.4;
 };
 } /* namespace datadriven */
 } /* namespace sgpp */
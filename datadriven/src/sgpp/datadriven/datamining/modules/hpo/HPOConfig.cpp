@@ -25,6 +25,8 @@ void HPOConfig::setupDefaults() {
   constraints = {2, 2};
   lambda = 1;
   nRandom = 10;
+  concurrentTrials = 1;
+  threadsPerTrial = 0;
 }
 
 int64_t HPOConfig::getSeed() const {
@@ -82,5 +84,21 @@ int64_t HPOConfig::getNTrainSamples() const {
 void HPOConfig::setNTrainSamples(int64_t nTrainSamples) {
   HPOConfig::nTrainSamples = nTrainSamples;
 }
+
+size_t HPOConfig::getConcurrentTrials() const {
+  return concurrentTrials;
+}
+
+void HPOConfig::setConcurrentTrials(size_t concurrentTrials) {
+  HPOConfig::concurrentTrials = concurrentTrials;
+}
+
+size_t HPOConfig::getThreadsPerTrial() const {
+  return threadsPerTrial;
+}
+
+void HPOConfig::setThreadsPerTrial(size_t threadsPerTrial) {
+  HPOConfig::threadsPerTrial = threadsPerTrial;
+}
 } /* namespace datadriven */
 } /* namespace sgpp */
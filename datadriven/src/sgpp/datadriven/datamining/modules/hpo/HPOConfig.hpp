@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 
@@ -55,6 +56,14 @@ class HPOConfig {
 
   void setNTrainSamples(int64_t nTrainSamples);
 
+  size_t getConcurrentTrials() const;
+
+  void setConcurrentTrials(size_t concurrentTrials);
+
+  size_t getThreadsPerTrial() const;
+
+  void setThreadsPerTrial(size_t threadsPerTrial);
+
  private:
   /**
    * Seed for random sampling in both harmonica and bayesian optimization
@@ -84,6 +93,14 @@ class HPOConfig {
    * number of samples bayesian optimization is run for
    */
   int64_t nRuns;
+  /**
+   * Number of trials (configurations) that are evaluated concurrently
+   */
+  size_t concurrentTrials;
+  /**
+   * Number of OpenMP threads per trial (0: split threads evenly among concurrent trials)
+   */
+  size_t threadsPerTrial;
 };
 } /* namespace datadriven */
 } /* namespace sgpp */
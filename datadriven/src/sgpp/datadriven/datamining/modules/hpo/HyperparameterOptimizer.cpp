@@ -12,10 +12,12 @@
 
 #include <sgpp/datadriven/datamining/modules/hpo/HyperparameterOptimizer.hpp>
 
+#include <sgpp/datadriven/datamining/base/TrialScheduler.hpp>
 
-#include <vector>
-#include <string>
+#include <algorithm>
 #include <limits>
+#include <string>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -27,5 +29,28 @@ HyperparameterOptimizer::HyperparameterOptimizer(SparseGridMiner* miner,
   config.setupDefaults();
   parser.getHPOConfig(config);
 }
+
+void HyperparameterOptimizer::addMiner(SparseGridMiner* additionalMiner) {
+  additionalMiners.emplace_back(additionalMiner);
+}
+
+size_t HyperparameterOptimizer::getConcurrentTrials() const {
+  return config.getConcurrentTrials();
+}
+
+void HyperparameterOptimizer::learnConcurrently(std::vector<ModelFittingBase*>& fitters,
+                                                std::vector<double>& scores) {
+  scores.assign(fitters.size(), 0.0);
+
+  // only as many trials as there are miners can run at the same time
+  TrialScheduler scheduler(std::min(config.getConcurrentTrials(), additionalMiners.size() + 1),
+                           config.getThreadsPerTrial());
+
+  scheduler.run(fitters.size(), [&](size_t trial, size_t slot) {
+    SparseGridMiner& slotMiner = (slot == 0) ? *miner : *additionalMiners[slot - 1];
+    slotMiner.setModel(fitters[trial]);
+    scores[trial] = slotMiner.learn(false);
+  });
+}
 } /* namespace datadriven */
 } /* namespace sgpp */
@@ -18,7 +18,9 @@
 #include <sgpp/datadriven/datamining/modules/hpo/FitterFactory.hpp>
 #include <sgpp/datadriven/datamining/base/SparseGridMiner.hpp>
 
+#include <functional>
 #include <memory>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -76,6 +78,20 @@ class HyperparameterOptimizer {
    */
   virtual double run(bool writeToFile) = 0;
 
+  /**
+   * Adds a miner that is used to run trials concurrently to the miner passed to the constructor.
+   * Every concurrently running trial needs its own miner, i.e. up to
+   * getConcurrentTrials() - 1 miners should be added. All miners have to be configured alike.
+   * @param additionalMiner configured instance of SGMiner object. The HyperparameterOptimizer
+   * instance will take ownership of the passed object.
+   */
+  void addMiner(SparseGridMiner* additionalMiner);
+
+  /**
+   * @return number of trials that are run concurrently as requested by the configuration
+   */
+  size_t getConcurrentTrials() const;
+
 
  protected:
   /**
@@ -83,6 +99,11 @@ class HyperparameterOptimizer {
    */
   std::unique_ptr<SparseGridMiner> miner;
 
+  /**
+   * Further miners to run trials concurrently, one per additional slot of the TrialScheduler.
+   */
+  std::vector<std::unique_ptr<SparseGridMiner>> additionalMiners;
+
   /**
    * FitterFactory to provide fitters for running different hyperparameter configurations.
    */
@@ -92,6 +113,15 @@ class HyperparameterOptimizer {
    * Configuration for all hpo details.
    */
   HPOConfig config;
+
+  /**
+   * Trains the given fitters and computes their scores. Up to getConcurrentTrials() fitters are
+   * trained concurrently, each by its own miner. The fitters have to be built beforehand, as the
+   * fitter factory is not thread-safe.
+   * @param fitters fitters to train, the miners take ownership of them
+   * @param scores the scores of the fitters in the same order
+   */
+  void learnConcurrently(std::vector<ModelFittingBase*>& fitters, std::vector<double>& scores);
 };
 } /* namespace datadriven */
 } /* namespace sgpp */
@@ -17,7 +17,13 @@
 #include <sgpp/optimization/sle/solver/GaussianElimination.hpp>
 #include <sgpp/optimization/function/scalar/WrapperScalarFunction.hpp>
 #include <sgpp/optimization/optimizer/unconstrained/MultiStart.hpp>
+#include <sgpp/optimization/optimizer/unconstrained/NelderMead.hpp>
+#include <sgpp/optimization/tools/RandomNumberGenerator.hpp>
+#include <sgpp/base/exception/algorithm_exception.hpp>
+#include <sgpp/datadriven/algorithm/DBMatDenseDecomposition.hpp>
 
+#include <algorithm>
+#include <numeric>
 #include <vector>
 #include <iostream>
 #include <limits>
@@ -31,7 +37,6 @@ BayesianOptimization::BayesianOptimization(const std::vector<BOConfig> &initialC
       transformedOutput(),
       rawScores(initialConfigs.size()),
       screwedvar(false),
-      maxofmax(0),
       allConfigs(initialConfigs) {
   for (size_t i = 0; i < allConfigs.size(); ++i) {
     rawScores[i] = allConfigs[i].getScore();
@@ -63,44 +68,70 @@ double BayesianOptimization::mean(base::DataVector &knew) {
 }
 
 double BayesianOptimization::var(base::DataVector &knew, double kself) {
+  // k^t K^{-1} k = |L^{-1} k|^2, i.e. one triangular solve with the cached factor suffices
   base::DataVector tmp(knew);
-  solveCholeskySystem(gleft, tmp);
-
-  base::DataVector check(tmp.size());
-  kernelmatrix.mult(tmp, check);
-  check.sub(knew);
-  double max = check.maxNorm();
-  maxofmax = std::fmax(max, maxofmax);
-  double var = kself - knew.dotProduct(tmp);
-  if (var > 1 || var < 0) {
-    screwedvar = true;
+  solveForward(gleft, tmp);
+  return checkVariance(kself - tmp.dotProduct(tmp), screwedvar);
+}
+
+double BayesianOptimization::checkVariance(double var, bool &screwed) {
+  // tiny negative values are round-off errors at (or close to) existing samples
+  if (var > 1 || var < -1e-12) {
+    screwed = true;
     return 0;
   }
-  return var;
+  return std::fmax(var, 0);
 }
 
 BOConfig BayesianOptimization::main(BOConfig &prototype) {
   BOConfig nextconfig(prototype);
-  optimization::WrapperScalarFunction wrapper(prototype.getContSize(),
+  const size_t contSize = prototype.getContSize();
+  optimization::WrapperScalarFunction wrapper(contSize,
                                               std::bind(&BayesianOptimization::acquisitionOuter,
                                                         this,
                                                         std::placeholders::_1));
   double min = std::numeric_limits<double>::infinity();
   BOConfig bestConfig;
+  base::DataMatrix candidates(CANDIDATE_COUNT, contSize);
+  base::DataVector values(CANDIDATE_COUNT);
+  std::vector<size_t> order(CANDIDATE_COUNT);
   do {
     for (auto &config : allConfigs) {
       config.calcDiscDistance(nextconfig, scales);
     }
-    optimization::optimizer::MultiStart optimizer(wrapper, 1000, 5);
-    optimizer.optimize();
-    double optv = optimizer.getOptimalValue();
-    if (prototype.getContSize() == 0) {
+    double optv;
+    base::DataVector optimalPoint(contSize);
+    if (contSize == 0) {
       optv = acquisitionOuter(base::DataVector());
+    } else {
+      // screen pseudorandom candidates in one batch ...
+      for (size_t i = 0; i < candidates.getSize(); i++) {
+        candidates[i] = optimization::RandomNumberGenerator::getInstance().getUniformRN();
+      }
+      acquisitionBatch(candidates, values);
+      std::iota(order.begin(), order.end(), 0);
+      std::partial_sort(order.begin(), order.begin() + LOCAL_STARTS, order.end(),
+                        [&values](size_t a, size_t b) { return values[a] < values[b]; });
+      optv = values[order[0]];
+      candidates.getRow(order[0], optimalPoint);
+
+      // ... and refine the most promising ones locally
+      base::DataVector start(contSize);
+      for (size_t k = 0; k < LOCAL_STARTS; k++) {
+        candidates.getRow(order[k], start);
+        optimization::optimizer::NelderMead optimizer(wrapper, LOCAL_FCN_EVAL_COUNT);
+        optimizer.setStartingPoint(start);
+        optimizer.optimize();
+        if (optimizer.getOptimalValue() < optv) {
+          optv = optimizer.getOptimalValue();
+          optimalPoint = optimizer.getOptimalPoint();
+        }
+      }
     }
     if (optv < min) {
       min = optv;
       bestConfig = BOConfig(nextconfig);
-      bestConfig.setCont(optimizer.getOptimalPoint());
+      bestConfig.setCont(optimalPoint);
     }
   } while (nextconfig.nextDisc());
   // std::cout << "Acquistion: " << min << std::endl;
@@ -117,6 +148,36 @@ double BayesianOptimization::acquisitionOuter(const base::DataVector &inp) {
   return acquisitionEI(m, v, bestsofar);
 }
 
+void BayesianOptimization::acquisitionBatch(const base::DataMatrix &candidates,
+                                            base::DataVector &values) {
+  const size_t n = allConfigs.size();
+  const size_t m = candidates.getNrows();
+  values.resize(m);
+  bool screwed = false;
+
+#pragma omp parallel reduction(|| : screwed)
+  {
+    base::DataVector point(candidates.getNcols());
+    base::DataVector kernelrow(n);
+    base::DataVector tmp(n);
+
+#pragma omp for schedule(static)
+    for (size_t c = 0; c < m; c++) {
+      candidates.getRow(c, point);
+      for (size_t i = 0; i < n; i++) {
+        kernelrow[i] = kernel(allConfigs[i].getTotalDistance(point, scales));
+      }
+      double mean = kernelrow.dotProduct(transformedOutput);
+      tmp.copyFrom(kernelrow);
+      solveForward(gleft, tmp);
+      double var = checkVariance(1 - tmp.dotProduct(tmp), screwed);
+      values[c] = acquisitionEI(mean, var, bestsofar);
+    }
+  }
+
+  screwedvar = screwedvar || screwed;
+}
+
 void BayesianOptimization::setScales(base::DataVector nscales, double factor) {
   nscales.mult(factor);   // factor for smooth updating of GP
   scales.mult(1-factor);
@@ -163,13 +224,14 @@ double BayesianOptimization::likelihood(const base::DataVector &inp) {
   base::DataMatrix gnew;
   decomposeCholesky(km, gnew);
 
+  // s^t K^{-1} s = |L^{-1} s|^2
   base::DataVector transformed(rawScores);
-  solveCholeskySystem(gnew, transformed);
+  solveForward(gnew, transformed);
   double tmp = 0;
   for (size_t i = 0; i < allConfigs.size(); ++i) {
     tmp += std::log(gnew.get(i, i));
   }
-  return 2 * tmp + rawScores.dotProduct(transformed);
+  return 2 * tmp + transformed.dotProduct(transformed);
 }
 
 void BayesianOptimization::updateGP(BOConfig &newConfig, bool normalize) {
@@ -178,16 +240,29 @@ void BayesianOptimization::updateGP(BOConfig &newConfig, bool normalize) {
   size_t size = kernelmatrix.getNcols();
   kernelmatrix.appendRow();
   kernelmatrix.appendCol(base::DataVector(size + 1));
+  base::DataVector newRow(size);
   for (size_t i = 0; i < size; ++i) {
     double tmp = kernel(allConfigs[i].getScaledDistance(newConfig, scales));
     kernelmatrix.set(size, i, tmp);
     kernelmatrix.set(i, size, tmp);
+    newRow[i] = tmp;
     rawScores[i] = allConfigs[i].getScore();
   }
   kernelmatrix.set(size, size, 1 + noise);
   rawScores.push_back(newConfig.getScore());
 
-  decomposeCholesky(kernelmatrix, gleft);
+  // rank-one append to the Cholesky factor: l = L^{-1} k, d = sqrt(k_self - l^t l)
+  solveForward(gleft, newRow);
+  double sum = 1 + noise - newRow.dotProduct(newRow);
+  double diag = 10e-8;
+  if (sum > 0) {
+    diag = std::sqrt(sum);
+  } else {
+    decomFailed = true;
+  }
+  newRow.push_back(diag);
+  gleft.appendCol(base::DataVector(size, 0.0));
+  gleft.appendRow(newRow);
   if (normalize) {
     if (rawScores.min() < rawScores.max()) {
       rawScores.normalize();
@@ -200,7 +275,6 @@ void BayesianOptimization::updateGP(BOConfig &newConfig, bool normalize) {
   solveCholeskySystem(gleft, transformedOutput);
 
 
-  // std::cout << "Maxofmax: " << maxofmax << std::endl;
   base::DataVector check2(transformedOutput.size());
   kernelmatrix.mult(transformedOutput, check2);
   check2.sub(rawScores);
@@ -209,15 +283,23 @@ void BayesianOptimization::updateGP(BOConfig &newConfig, bool normalize) {
   // std::cout<<transformedOutput.toString()<<std::endl;
 
   // std::cout << "Var Screwed: " << screwedvar << std::endl;
-  if (decomFailed || screwedvar || maxofmax > 0.1 || max > 0.1) {
+  if (decomFailed || screwedvar || max > 0.1) {
     std::cout << "Numerical instabilities occured. This could lead to bad sampling.";
   }
-  maxofmax = 0;
   screwedvar = false;
   decomFailed = false;
 }
 
 void BayesianOptimization::decomposeCholesky(base::DataMatrix &km, base::DataMatrix &gnew) {
+  // blocked (and multithreaded) decomposition, the element-wise one below is only needed to
+  // regularize matrices that are not positive definite numerically
+  gnew = km;
+  try {
+    DBMatDenseDecomposition::choleskyDecomposition(gnew);
+    return;
+  } catch (const base::algorithm_exception &) {
+  }
+
   size_t n = km.getNrows();
   gnew = base::DataMatrix(n, n, 0);
 
@@ -241,13 +323,19 @@ void BayesianOptimization::decomposeCholesky(base::DataMatrix &km, base::DataMat
   }
 }
 
-void BayesianOptimization::solveCholeskySystem(base::DataMatrix &gmatrix, base::DataVector &x) {
+void BayesianOptimization::solveForward(const base::DataMatrix &gmatrix, base::DataVector &x) {
   for (size_t i = 0; i < x.size(); i++) {
-    x[i] = x[i] / gmatrix.get(i, i);
-    for (size_t k = i + 1; k < x.size(); k++) {
-      x[k] = x[k] - gmatrix.get(k, i) * x[i];
+    const double *row = gmatrix.getPointer() + i * gmatrix.getNcols();
+    double sum = x[i];
+    for (size_t k = 0; k < i; k++) {
+      sum -= row[k] * x[k];
     }
+    x[i] = sum / row[i];
   }
+}
+
+void BayesianOptimization::solveCholeskySystem(base::DataMatrix &gmatrix, base::DataVector &x) {
+  solveForward(gmatrix, x);
 
   for (int i = static_cast<int>(x.size()) - 1; i >= 0; i--) {
     x[i] = x[i] / gmatrix.get(static_cast<size_t>(i), static_cast<size_t>(i));
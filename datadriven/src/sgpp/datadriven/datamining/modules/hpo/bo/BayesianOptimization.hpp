@@ -40,8 +40,17 @@ class BayesianOptimization {
    */
   double acquisitionOuter(const base::DataVector &inp);
 
+  /**
+   * Evaluates the acquisition function at many points of the continuous optimization space at
+   * once (in parallel, using the cached Cholesky factor of the Gaussian Process)
+   * @param candidates points in continuous optimization space (one per row)
+   * @param values acquisition function values of the candidates
+   */
+  void acquisitionBatch(const base::DataMatrix &candidates, base::DataVector &values);
+
   /**
    * Gaussian Process update step. Incorporates most recent sample into Gaussian Process.
+   * The Cholesky factor of the Gram matrix is extended by one row instead of being recomputed.
    */
   void updateGP(BOConfig &newConfig, bool normalize);
 
@@ -65,7 +74,24 @@ class BayesianOptimization {
   void solveCholeskySystem(base::DataMatrix &gmatrix, base::DataVector &x);
 
   /**
-   * main routine to find new sample point
+   * Solve a lower triangular system of linear equations (forward substitution)
+   * @param gmatrix lower triangular (decomposed) matrix
+   * @param x target vector, overwritten by the solution
+   */
+  static void solveForward(const base::DataMatrix &gmatrix, base::DataVector &x);
+
+  /**
+   * Validates a variance computed by the Gaussian Process
+   * @param var the variance
+   * @param screwed set to true if the variance is invalid due to numerical instabilities
+   * @return the variance, or 0 if it is invalid
+   */
+  static double checkVariance(double var, bool &screwed);
+
+  /**
+   * main routine to find new sample point. For every discrete configuration, CANDIDATE_COUNT
+   * pseudorandom points are screened in one batch and the LOCAL_STARTS best ones are refined
+   * by local optimization.
    * @param prototype baseline BOConfig
    * @return new sample point
    */
@@ -99,6 +125,18 @@ class BayesianOptimization {
   void setScales(base::DataVector nscales, double factor);
 
  protected:
+  /**
+   * number of pseudorandom points screened per discrete configuration in main()
+   */
+  static const size_t CANDIDATE_COUNT = 200;
+  /**
+   * number of screened points that are refined by local optimization in main()
+   */
+  static const size_t LOCAL_STARTS = 5;
+  /**
+   * maximal number of acquisition function evaluations of each local optimization
+   */
+  static const size_t LOCAL_FCN_EVAL_COUNT = 160;
   /**
    * Gram matrix containing all kernel values between all existing samples
    */
@@ -131,10 +169,6 @@ class BayesianOptimization {
    * debugging variable for numerical instabilities
    */
   bool decomFailed = false;
-  /**
-   * debugging variable for numerical instabilities
-   */
-  double maxofmax;
 
   /**
    * existing sample points in the Gaussian Process
@@ -23,6 +23,15 @@ namespace datadriven {
 
 Scorer::Scorer(Metric* metric) : metric{std::unique_ptr<Metric>{metric}} {}
 
+Scorer::Scorer(const Scorer& rhs) : metric{std::unique_ptr<Metric>{rhs.metric->clone()}} {}
+
+Scorer& Scorer::operator=(const Scorer& rhs) {
+  if (this != &rhs) {
+    metric.reset(rhs.metric->clone());
+  }
+  return *this;
+}
+
 double Scorer::test(ModelFittingBase& model, Dataset& testDataset) {
 #ifdef USE_SCALAPACK
   if (model.getFitterConfiguration().getParallelConfig().scalapackEnabled_) {
@@ -38,6 +38,12 @@ class Scorer {
    */
   explicit Scorer(Metric* metric);
 
+  /**
+   * Copy constructor (clones the metric, e.g. to score concurrently running trials)
+   * @param rhs const reference to the scorer object to copy from.
+   */
+  Scorer(const Scorer& rhs);
+
   /**
    * Move constructor
    * @param rhs R-value reference to a scorer object to moved from.
@@ -49,7 +55,7 @@ class Scorer {
    * @param rhs const reference to the scorer object to copy from.
    * @return rerefernce to this with updated values.
    */
-  Scorer& operator=(const Scorer& rhs) = default;
+  Scorer& operator=(const Scorer& rhs);
 
   /**
    * Move assign operator
@@ -0,0 +1,362 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalBsplineStreaming/OperationMultiEvalBsplineStreaming.hpp>
+
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/operation/hash/common/basis/BsplineBasis.hpp>
+#include <sgpp/base/tools/CPUFeatures.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+namespace {
+
+/// index of the uniform B-spline in the coefficient table
+const int32_t UNIFORM_BSPLINE = 0;
+/// index of the modified B-spline in the coefficient table
+const int32_t MODIFIED_BSPLINE = 1;
+/// index of the constant one in the coefficient table
+const int32_t CONSTANT_ONE = 2;
+
+double binomial(size_t n, size_t k) {
+  double result = 1.0;
+
+  for (size_t i = 1; i <= k; i++) {
+    result = result * static_cast<double>(n - k + i) / static_cast<double>(i);
+  }
+
+  return result;
+}
+
+inline double evalPiecewise(double x, double scale, double shift, int32_t offset,
+                            const double* coefficients, size_t numberOfPieces, size_t degree) {
+  const double t = x * scale - shift;
+  const double piece = std::floor(t);
+
+  if ((piece < 0.0) || (piece >= static_cast<double>(numberOfPieces))) {
+    return 0.0;
+  }
+
+  const double u = t - piece;
+  const double* c = coefficients + offset + static_cast<size_t>(piece) * (degree + 1);
+  double result = c[0];
+
+  for (size_t m = 1; m <= degree; m++) {
+    result = result * u + c[m];
+  }
+
+  return result;
+}
+
+}  // namespace
+
+OperationMultiEvalBsplineStreaming::OperationMultiEvalBsplineStreaming(base::Grid& grid,
+                                                                       base::DataMatrix& dataset)
+    : OperationMultipleEval(grid, dataset),
+      preparedDataset(dataset),
+      numberOfDataPoints(dataset.getNrows()),
+      storage(grid.getStorage()),
+      degree(grid.getBasis().getDegree()),
+      isModified(grid.getType() == base::GridType::ModBspline),
+      numberOfPieces(degree + 1),
+      kernelType(getBestKernelType()),
+      myTimer_(base::SGppStopwatch()),
+      duration(-1.0) {
+  if ((grid.getType() != base::GridType::Bspline) &&
+      (grid.getType() != base::GridType::BsplineBoundary) &&
+      (grid.getType() != base::GridType::ModBspline)) {
+    throw base::operation_exception(
+        "OperationMultiEvalBsplineStreaming: grid type has to be Bspline, BsplineBoundary or "
+        "ModBspline");
+  }
+
+  storage.getBoundingBox()->transformPointsToUnitCube(preparedDataset);
+
+  // pad by repeating the last data point, the padded results are discarded
+  const size_t remainder = numberOfDataPoints % getChunkDataPoints();
+
+  if ((numberOfDataPoints > 0) && (remainder != 0)) {
+    base::DataVector lastRow(preparedDataset.getNcols());
+    preparedDataset.getRow(numberOfDataPoints - 1, lastRow);
+    preparedDataset.resize(numberOfDataPoints + getChunkDataPoints() - remainder);
+
+    for (size_t i = numberOfDataPoints; i < preparedDataset.getNrows(); i++) {
+      preparedDataset.setRow(i, lastRow);
+    }
+  }
+
+  preparedDataset.transpose();
+
+  calculateCoefficients();
+  prepare();
+}
+
+OperationMultiEvalBsplineStreaming::~OperationMultiEvalBsplineStreaming() {}
+
+OperationMultiEvalBsplineStreaming::KernelType
+OperationMultiEvalBsplineStreaming::getBestKernelType() {
+  if (base::CPUFeatures::hasAVX512F()) {
+    return KernelType::AVX512;
+  } else if (base::CPUFeatures::hasAVX2()) {
+    return KernelType::AVX2;
+  } else {
+    return KernelType::SCALAR;
+  }
+}
+
+void OperationMultiEvalBsplineStreaming::setKernelType(KernelType kernelType) {
+  if (((kernelType == KernelType::AVX2) && !base::CPUFeatures::hasAVX2()) ||
+      ((kernelType == KernelType::AVX512) && !base::CPUFeatures::hasAVX512F())) {
+    throw base::operation_exception(
+        "OperationMultiEvalBsplineStreaming: instruction set not supported by the CPU");
+  }
+
+  this->kernelType = kernelType;
+}
+
+void OperationMultiEvalBsplineStreaming::calculateCoefficients() {
+  const size_t p = degree;
+  const size_t polynomialSize = numberOfPieces * (p + 1);
+  base::SBsplineBase bsplineBasis(p);
+  double factorial = 1.0;
+
+  for (size_t k = 2; k <= p; k++) {
+    factorial *= static_cast<double>(k);
+  }
+
+  coefficients.assign(3 * polynomialSize, 0.0);
+
+  // uniform B-spline via truncated powers: on [k, k+1) with t = k + u,
+  // N(t) = 1/p! * sum_{j <= k} (-1)^j binom(p+1, j) (u + k - j)^p
+  double* uniform = &coefficients[UNIFORM_BSPLINE * polynomialSize];
+
+  for (size_t k = 0; k < numberOfPieces; k++) {
+    for (size_t e = 0; e <= p; e++) {
+      double sum = 0.0;
+
+      for (size_t j = 0; j <= k; j++) {
+        const double sign = (j % 2 == 0) ? 1.0 : -1.0;
+        sum += sign * binomial(p + 1, j) *
+               std::pow(static_cast<double>(k - j), static_cast<double>(p - e));
+      }
+
+      // highest power first
+      uniform[k * (p + 1) + (p - e)] = binomial(p, e) / factorial * sum;
+    }
+  }
+
+  // modified B-spline (see BsplineModifiedBasis::modifiedBSpline):
+  // sum_{k <= (p+2)/2} (k+1) N(t + (p+1)/2 + k - 1), i.e. a sum of shifted uniform pieces
+  double* modified = &coefficients[MODIFIED_BSPLINE * polynomialSize];
+
+  for (size_t q = 0; q < numberOfPieces; q++) {
+    for (size_t k = 0; k <= (p + 2) / 2; k++) {
+      const size_t uniformPiece = q + (p + 1) / 2 + k - 1;
+
+      if (uniformPiece >= numberOfPieces) {
+        continue;
+      }
+
+      for (size_t m = 0; m <= p; m++) {
+        modified[q * (p + 1) + m] +=
+            static_cast<double>(k + 1) * uniform[uniformPiece * (p + 1) + m];
+      }
+    }
+  }
+
+  // the constant one is evaluated with scale = shift = 0 on the first piece
+  coefficients[CONSTANT_ONE * polynomialSize + p] = 1.0;
+}
+
+void OperationMultiEvalBsplineStreaming::prepare() {
+  const size_t gridSize = storage.getSize();
+  const size_t dims = storage.getDimension();
+  const int32_t polynomialSize = static_cast<int32_t>(numberOfPieces * (degree + 1));
+  const double halfSupport = static_cast<double>(degree + 1) / 2.0;
+
+  scale.resize(gridSize * dims);
+  shift.resize(gridSize * dims);
+  polynomialOffset.resize(gridSize * dims);
+
+  for (size_t j = 0; j < gridSize; j++) {
+    const base::GridPoint& gp = storage[j];
+
+    for (size_t d = 0; d < dims; d++) {
+      const base::GridPoint::level_type l = gp.getLevel(d);
+      const base::GridPoint::index_type i = gp.getIndex(d);
+      const base::GridPoint::index_type hInv = static_cast<base::GridPoint::index_type>(1) << l;
+      const double hInvDbl = static_cast<double>(hInv);
+      const size_t k = j * dims + d;
+
+      if (isModified && (l == 1)) {
+        scale[k] = 0.0;
+        shift[k] = 0.0;
+        polynomialOffset[k] = CONSTANT_ONE * polynomialSize;
+      } else if (isModified && (i == hInv - 1)) {
+        // mirrored at x = 0.5: t = (1 - x) * hInv
+        scale[k] = -hInvDbl;
+        shift[k] = -hInvDbl;
+        polynomialOffset[k] = MODIFIED_BSPLINE * polynomialSize;
+      } else if (isModified && (i == 1)) {
+        scale[k] = hInvDbl;
+        shift[k] = 0.0;
+        polynomialOffset[k] = MODIFIED_BSPLINE * polynomialSize;
+      } else {
+        scale[k] = hInvDbl;
+        shift[k] = static_cast<double>(i) - halfSupport;
+        polynomialOffset[k] = UNIFORM_BSPLINE * polynomialSize;
+      }
+    }
+  }
+
+  isPrepared = true;
+}
+
+void OperationMultiEvalBsplineStreaming::mult(base::DataVector& alpha,
+                                              base::DataVector& result) {
+  this->myTimer_.start();
+
+  if (alpha.getSize() != storage.getSize()) {
+    throw base::operation_exception(
+        "OperationMultiEvalBsplineStreaming::mult: alpha has the wrong size");
+  }
+
+  const size_t paddedSize = preparedDataset.getNcols();
+  const size_t chunkSize = getChunkDataPoints();
+  base::DataVector paddedResult(paddedSize);
+  const double* ptrAlpha = alpha.getPointer();
+  double* ptrResult = paddedResult.getPointer();
+
+#pragma omp parallel for schedule(static)
+  for (size_t c = 0; c < paddedSize; c += chunkSize) {
+    if (kernelType == KernelType::AVX512) {
+      multAVX512(ptrAlpha, ptrResult, c, c + chunkSize);
+    } else if (kernelType == KernelType::AVX2) {
+      multAVX2(ptrAlpha, ptrResult, c, c + chunkSize);
+    } else {
+      multScalar(ptrAlpha, ptrResult, c, c + chunkSize);
+    }
+  }
+
+  result.resize(numberOfDataPoints);
+
+  for (size_t i = 0; i < numberOfDataPoints; i++) {
+    result[i] = paddedResult[i];
+  }
+
+  this->duration = this->myTimer_.stop();
+}
+
+void OperationMultiEvalBsplineStreaming::multTranspose(base::DataVector& source,
+                                                       base::DataVector& result) {
+  this->myTimer_.start();
+
+  if (source.getSize() != numberOfDataPoints) {
+    throw base::operation_exception(
+        "OperationMultiEvalBsplineStreaming::multTranspose: source has the wrong size");
+  }
+
+  const size_t gridSize = storage.getSize();
+  // the padded data points get zero weight
+  base::DataVector paddedSource(preparedDataset.getNcols(), 0.0);
+
+  for (size_t i = 0; i < numberOfDataPoints; i++) {
+    paddedSource[i] = source[i];
+  }
+
+  result.resize(gridSize);
+
+  const double* ptrSource = paddedSource.getPointer();
+  double* ptrResult = result.getPointer();
+  const size_t chunkSize = 16;
+
+#pragma omp parallel for schedule(dynamic)
+  for (size_t c = 0; c < gridSize; c += chunkSize) {
+    const size_t end = std::min(c + chunkSize, gridSize);
+
+    if (kernelType == KernelType::AVX512) {
+      multTransposeAVX512(ptrSource, ptrResult, c, end);
+    } else if (kernelType == KernelType::AVX2) {
+      multTransposeAVX2(ptrSource, ptrResult, c, end);
+    } else {
+      multTransposeScalar(ptrSource, ptrResult, c, end);
+    }
+  }
+
+  this->duration = this->myTimer_.stop();
+}
+
+double OperationMultiEvalBsplineStreaming::getDuration() { return this->duration; }
+
+void OperationMultiEvalBsplineStreaming::multScalar(const double* alpha, double* result,
+                                                    size_t startData, size_t endData) {
+  const size_t gridSize = storage.getSize();
+  const size_t dims = storage.getDimension();
+  const size_t paddedSize = preparedDataset.getNcols();
+  const double* data = preparedDataset.getPointer();
+
+  for (size_t i = startData; i < endData; i++) {
+    double value = 0.0;
+
+    for (size_t j = 0; j < gridSize; j++) {
+      double curValue = alpha[j];
+
+      for (size_t d = 0; d < dims; d++) {
+        const size_t k = j * dims + d;
+        curValue *= evalPiecewise(data[d * paddedSize + i], scale[k], shift[k],
+                                  polynomialOffset[k], coefficients.data(), numberOfPieces,
+                                  degree);
+
+        if (curValue == 0.0) {
+          break;
+        }
+      }
+
+      value += curValue;
+    }
+
+    result[i] = value;
+  }
+}
+
+void OperationMultiEvalBsplineStreaming::multTransposeScalar(const double* source,
+                                                             double* result, size_t startGrid,
+                                                             size_t endGrid) {
+  const size_t dims = storage.getDimension();
+  const size_t paddedSize = preparedDataset.getNcols();
+  const double* data = preparedDataset.getPointer();
+
+  for (size_t j = startGrid; j < endGrid; j++) {
+    double value = 0.0;
+
+    for (size_t i = 0; i < paddedSize; i++) {
+      double curValue = source[i];
+
+      for (size_t d = 0; d < dims; d++) {
+        const size_t k = j * dims + d;
+        curValue *= evalPiecewise(data[d * paddedSize + i], scale[k], shift[k],
+                                  polynomialOffset[k], coefficients.data(), numberOfPieces,
+                                  degree);
+
+        if (curValue == 0.0) {
+          break;
+        }
+      }
+
+      value += curValue;
+    }
+
+    result[j] = value;
+  }
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
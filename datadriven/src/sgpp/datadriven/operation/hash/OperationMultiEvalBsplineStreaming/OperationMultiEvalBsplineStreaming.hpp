@@ -0,0 +1,135 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/tools/SGppStopwatch.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Streaming multiple evaluation for B-spline grids (BsplineGrid,
+ * BsplineBoundaryGrid and ModBsplineGrid).
+ *
+ * Every 1D basis function is an affine transformation t = x * scale - shift
+ * of one of three piecewise polynomials on unit intervals (the uniform
+ * B-spline, the modified B-spline of the boundary-adjacent functions of
+ * ModBsplineGrid, and the constant function of ModBsplineGrid's level 1).
+ * The monomial coefficients of all polynomial pieces are tabulated in
+ * prepare(), so the kernels evaluate a basis function for a whole SIMD vector
+ * of data points by computing the piece, gathering its coefficients and
+ * applying Horner's scheme. Products stop early as soon as all lanes are zero.
+ *
+ * Kernels exist for AVX-512, AVX2 (with FMA) and plain C++. The fastest one
+ * supported by the CPU is selected at runtime (see base::CPUFeatures), so the
+ * vector kernels are available independent of the ARCH the library was
+ * compiled for.
+ */
+class OperationMultiEvalBsplineStreaming : public base::OperationMultipleEval {
+ public:
+  /**
+   * Instruction set used by the kernels.
+   */
+  enum class KernelType { SCALAR, AVX2, AVX512 };
+
+  /**
+   * Constructor.
+   *
+   * @param grid    B-spline grid (Bspline, BsplineBoundary or ModBspline)
+   * @param dataset data points (row-wise), transformed to the unit cube
+   *                according to the bounding box of the grid
+   */
+  OperationMultiEvalBsplineStreaming(base::Grid& grid, base::DataMatrix& dataset);
+
+  ~OperationMultiEvalBsplineStreaming() override;
+
+  void mult(base::DataVector& alpha, base::DataVector& result) override;
+
+  void multTranspose(base::DataVector& source, base::DataVector& result) override;
+
+  /**
+   * Updates the tabulated basis functions after the grid changed.
+   */
+  void prepare() override;
+
+  double getDuration() override;
+
+  /**
+   * @return instruction set used by the kernels
+   */
+  KernelType getKernelType() const { return kernelType; }
+
+  /**
+   * Selects the instruction set used by the kernels,
+   * throws base::operation_exception if the CPU doesn't support it.
+   *
+   * @param kernelType instruction set
+   */
+  void setKernelType(KernelType kernelType);
+
+  /**
+   * @return fastest instruction set supported by the CPU
+   */
+  static KernelType getBestKernelType();
+
+  /**
+   * @return number of data points the dataset is padded to a multiple of
+   */
+  static size_t getChunkDataPoints() { return 16; }
+
+ protected:
+  /// data points (dimension-major, padded to a multiple of getChunkDataPoints())
+  base::DataMatrix preparedDataset;
+  /// number of data points without padding
+  size_t numberOfDataPoints;
+  /// storage of the grid
+  base::GridStorage& storage;
+  /// B-spline degree
+  size_t degree;
+  /// whether the modified basis of ModBsplineGrid is used
+  bool isModified;
+  /// number of unit intervals of every tabulated polynomial
+  size_t numberOfPieces;
+  /// monomial coefficients (highest power first) of all pieces of all polynomials
+  std::vector<double> coefficients;
+  /// per grid point and dimension: scale of the affine transformation
+  std::vector<double> scale;
+  /// per grid point and dimension: shift of the affine transformation
+  std::vector<double> shift;
+  /// per grid point and dimension: offset of the polynomial in coefficients
+  std::vector<int32_t> polynomialOffset;
+  /// instruction set used by the kernels
+  KernelType kernelType;
+  /// timer object to handle time measurements
+  base::SGppStopwatch myTimer_;
+  /// duration of the last mult or multTranspose
+  double duration;
+
+ private:
+  /// tabulates the pieces of the uniform and the modified B-spline and the constant one
+  void calculateCoefficients();
+
+  void multScalar(const double* alpha, double* result, size_t startData, size_t endData);
+  void multTransposeScalar(const double* source, double* result, size_t startGrid,
+                           size_t endGrid);
+
+  void multAVX2(const double* alpha, double* result, size_t startData, size_t endData);
+  void multTransposeAVX2(const double* source, double* result, size_t startGrid,
+                         size_t endGrid);
+
+  void multAVX512(const double* alpha, double* result, size_t startData, size_t endData);
+  void multTransposeAVX512(const double* source, double* result, size_t startGrid,
+                           size_t endGrid);
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,180 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalBsplineStreaming/OperationMultiEvalBsplineStreaming.hpp>
+
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/tools/CPUFeatures.hpp>
+#include <sgpp/globaldef.hpp>
+
+#if defined(SGPP_CPU_DISPATCH) || (defined(__AVX2__) && defined(__FMA__))
+#include <immintrin.h>
+
+#ifdef SGPP_CPU_DISPATCH
+#define SGPP_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#else
+#define SGPP_TARGET_AVX2
+#endif
+#endif
+
+namespace sgpp {
+namespace datadriven {
+
+#if defined(SGPP_CPU_DISPATCH) || (defined(__AVX2__) && defined(__FMA__))
+
+namespace {
+
+/**
+ * Evaluates the tabulated piecewise polynomial at x * scale - shift for 4 data points.
+ */
+SGPP_TARGET_AVX2 inline __m256d evalPiecewiseAVX2(__m256d x, __m256d scale, __m256d shift,
+                                                  __m128i offset, const double* coefficients,
+                                                  __m256d numberOfPieces, __m128i stride,
+                                                  size_t degree) {
+  const __m256d zero = _mm256_setzero_pd();
+  const __m256d t = _mm256_fmsub_pd(x, scale, shift);
+  const __m256d piece = _mm256_floor_pd(t);
+  const __m256d valid = _mm256_and_pd(_mm256_cmp_pd(piece, zero, _CMP_GE_OQ),
+                                      _mm256_cmp_pd(piece, numberOfPieces, _CMP_LT_OQ));
+  const __m256d u = _mm256_sub_pd(t, piece);
+  const __m128i index =
+      _mm_add_epi32(_mm_mullo_epi32(_mm256_cvttpd_epi32(piece), stride), offset);
+
+  // invalid lanes are not loaded and stay zero
+  __m256d result = _mm256_mask_i32gather_pd(zero, coefficients, index, valid, 8);
+
+  for (size_t m = 1; m <= degree; m++) {
+    result = _mm256_fmadd_pd(result, u,
+                             _mm256_mask_i32gather_pd(zero, coefficients + m, index, valid, 8));
+  }
+
+  return result;
+}
+
+SGPP_TARGET_AVX2 inline double horizontalSumAVX2(__m256d x) {
+  const __m128d sum = _mm_add_pd(_mm256_castpd256_pd128(x), _mm256_extractf128_pd(x, 1));
+  return _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+}
+
+}  // namespace
+
+SGPP_TARGET_AVX2 void OperationMultiEvalBsplineStreaming::multAVX2(const double* alpha,
+                                                                   double* result,
+                                                                   size_t startData,
+                                                                   size_t endData) {
+  const size_t gridSize = storage.getSize();
+  const size_t dims = storage.getDimension();
+  const size_t paddedSize = preparedDataset.getNcols();
+  const double* data = preparedDataset.getPointer();
+  const __m256d zero = _mm256_setzero_pd();
+  const __m256d pieces = _mm256_set1_pd(static_cast<double>(numberOfPieces));
+  const __m128i stride = _mm_set1_epi32(static_cast<int>(degree + 1));
+
+  for (size_t i = startData; i < endData; i += 8) {
+    __m256d sum0 = _mm256_setzero_pd();
+    __m256d sum1 = _mm256_setzero_pd();
+
+    for (size_t j = 0; j < gridSize; j++) {
+      __m256d value0 = _mm256_set1_pd(alpha[j]);
+      __m256d value1 = value0;
+
+      for (size_t d = 0; d < dims; d++) {
+        const size_t k = j * dims + d;
+        const __m256d s = _mm256_set1_pd(scale[k]);
+        const __m256d sh = _mm256_set1_pd(shift[k]);
+        const __m128i offset = _mm_set1_epi32(polynomialOffset[k]);
+        const double* x = data + d * paddedSize + i;
+
+        value0 = _mm256_mul_pd(value0, evalPiecewiseAVX2(_mm256_loadu_pd(x), s, sh, offset,
+                                                         coefficients.data(), pieces, stride,
+                                                         degree));
+        value1 = _mm256_mul_pd(value1, evalPiecewiseAVX2(_mm256_loadu_pd(x + 4), s, sh, offset,
+                                                         coefficients.data(), pieces, stride,
+                                                         degree));
+
+        const __m256d nonZero = _mm256_or_pd(_mm256_cmp_pd(value0, zero, _CMP_NEQ_UQ),
+                                             _mm256_cmp_pd(value1, zero, _CMP_NEQ_UQ));
+
+        if (_mm256_movemask_pd(nonZero) == 0) {
+          break;
+        }
+      }
+
+      sum0 = _mm256_add_pd(sum0, value0);
+      sum1 = _mm256_add_pd(sum1, value1);
+    }
+
+    _mm256_storeu_pd(result + i, sum0);
+    _mm256_storeu_pd(result + i + 4, sum1);
+  }
+}
+
+SGPP_TARGET_AVX2 void OperationMultiEvalBsplineStreaming::multTransposeAVX2(const double* source,
+                                                                            double* result,
+                                                                            size_t startGrid,
+                                                                            size_t endGrid) {
+  const size_t dims = storage.getDimension();
+  const size_t paddedSize = preparedDataset.getNcols();
+  const double* data = preparedDataset.getPointer();
+  const __m256d zero = _mm256_setzero_pd();
+  const __m256d pieces = _mm256_set1_pd(static_cast<double>(numberOfPieces));
+  const __m128i stride = _mm_set1_epi32(static_cast<int>(degree + 1));
+
+  for (size_t j = startGrid; j < endGrid; j++) {
+    __m256d sum0 = _mm256_setzero_pd();
+    __m256d sum1 = _mm256_setzero_pd();
+
+    for (size_t i = 0; i < paddedSize; i += 8) {
+      __m256d value0 = _mm256_loadu_pd(source + i);
+      __m256d value1 = _mm256_loadu_pd(source + i + 4);
+
+      for (size_t d = 0; d < dims; d++) {
+        const size_t k = j * dims + d;
+        const __m256d s = _mm256_set1_pd(scale[k]);
+        const __m256d sh = _mm256_set1_pd(shift[k]);
+        const __m128i offset = _mm_set1_epi32(polynomialOffset[k]);
+        const double* x = data + d * paddedSize + i;
+
+        value0 = _mm256_mul_pd(value0, evalPiecewiseAVX2(_mm256_loadu_pd(x), s, sh, offset,
+                                                         coefficients.data(), pieces, stride,
+                                                         degree));
+        value1 = _mm256_mul_pd(value1, evalPiecewiseAVX2(_mm256_loadu_pd(x + 4), s, sh, offset,
+                                                         coefficients.data(), pieces, stride,
+                                                         degree));
+
+        const __m256d nonZero = _mm256_or_pd(_mm256_cmp_pd(value0, zero, _CMP_NEQ_UQ),
+                                             _mm256_cmp_pd(value1, zero, _CMP_NEQ_UQ));
+
+        if (_mm256_movemask_pd(nonZero) == 0) {
+          break;
+        }
+      }
+
+      sum0 = _mm256_add_pd(sum0, value0);
+      sum1 = _mm256_add_pd(sum1, value1);
+    }
+
+    result[j] = horizontalSumAVX2(_mm256_add_pd(sum0, sum1));
+  }
+}
+
+#else
+
+void OperationMultiEvalBsplineStreaming::multAVX2(const double* alpha, double* result,
+                                                  size_t startData, size_t endData) {
+  throw base::operation_exception(
+      "OperationMultiEvalBsplineStreaming: library wasn't compiled with AVX2 support");
+}
+
+void OperationMultiEvalBsplineStreaming::multTransposeAVX2(const double* source, double* result,
+                                                           size_t startGrid, size_t endGrid) {
+  throw base::operation_exception(
+      "OperationMultiEvalBsplineStreaming: library wasn't compiled with AVX2 support");
+}
+
+#endif
+
+}  // namespace datadriven
+}  // namespace sgpp
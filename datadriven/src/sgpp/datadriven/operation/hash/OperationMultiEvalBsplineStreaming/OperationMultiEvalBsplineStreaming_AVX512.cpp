@@ -0,0 +1,177 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalBsplineStreaming/OperationMultiEvalBsplineStreaming.hpp>
+
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/tools/CPUFeatures.hpp>
+#include <sgpp/globaldef.hpp>
+
+#if defined(SGPP_CPU_DISPATCH) || defined(__AVX512F__)
+#include <immintrin.h>
+
+#ifdef SGPP_CPU_DISPATCH
+#define SGPP_TARGET_AVX512 __attribute__((target("avx512f")))
+#else
+#define SGPP_TARGET_AVX512
+#endif
+#endif
+
+namespace sgpp {
+namespace datadriven {
+
+#if defined(SGPP_CPU_DISPATCH) || defined(__AVX512F__)
+
+namespace {
+
+/**
+ * Evaluates the tabulated piecewise polynomial at x * scale - shift for 8 data points.
+ */
+SGPP_TARGET_AVX512 inline __m512d evalPiecewiseAVX512(__m512d x, __m512d scale, __m512d shift,
+                                                      __m256i offset, const double* coefficients,
+                                                      __m512d numberOfPieces, __m256i stride,
+                                                      size_t degree) {
+  const __m512d zero = _mm512_setzero_pd();
+  const __m512d t = _mm512_fmsub_pd(x, scale, shift);
+  // (masked variants avoid the undefined source operands of the unmasked intrinsics)
+  const __m512d piece =
+      _mm512_mask_roundscale_pd(t, 0xFF, t, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+  const __mmask8 valid = _mm512_cmp_pd_mask(piece, zero, _CMP_GE_OQ) &
+                         _mm512_cmp_pd_mask(piece, numberOfPieces, _CMP_LT_OQ);
+  const __m512d u = _mm512_sub_pd(t, piece);
+  const __m256i index =
+      _mm256_add_epi32(_mm256_mullo_epi32(
+                           _mm512_mask_cvttpd_epi32(_mm256_setzero_si256(), 0xFF, piece), stride),
+                       offset);
+
+  // invalid lanes are not loaded and stay zero
+  __m512d result = _mm512_mask_i32gather_pd(zero, valid, index, coefficients, 8);
+
+  for (size_t m = 1; m <= degree; m++) {
+    result = _mm512_fmadd_pd(result, u,
+                             _mm512_mask_i32gather_pd(zero, valid, index, coefficients + m, 8));
+  }
+
+  return result;
+}
+
+}  // namespace
+
+SGPP_TARGET_AVX512 void OperationMultiEvalBsplineStreaming::multAVX512(const double* alpha,
+                                                                       double* result,
+                                                                       size_t startData,
+                                                                       size_t endData) {
+  const size_t gridSize = storage.getSize();
+  const size_t dims = storage.getDimension();
+  const size_t paddedSize = preparedDataset.getNcols();
+  const double* data = preparedDataset.getPointer();
+  const __m512d zero = _mm512_setzero_pd();
+  const __m512d pieces = _mm512_set1_pd(static_cast<double>(numberOfPieces));
+  const __m256i stride = _mm256_set1_epi32(static_cast<int>(degree + 1));
+
+  for (size_t i = startData; i < endData; i += 16) {
+    __m512d sum0 = _mm512_setzero_pd();
+    __m512d sum1 = _mm512_setzero_pd();
+
+    for (size_t j = 0; j < gridSize; j++) {
+      __m512d value0 = _mm512_set1_pd(alpha[j]);
+      __m512d value1 = value0;
+
+      for (size_t d = 0; d < dims; d++) {
+        const size_t k = j * dims + d;
+        const __m512d s = _mm512_set1_pd(scale[k]);
+        const __m512d sh = _mm512_set1_pd(shift[k]);
+        const __m256i offset = _mm256_set1_epi32(polynomialOffset[k]);
+        const double* x = data + d * paddedSize + i;
+
+        value0 = _mm512_mul_pd(value0, evalPiecewiseAVX512(_mm512_loadu_pd(x), s, sh, offset,
+                                                           coefficients.data(), pieces, stride,
+                                                           degree));
+        value1 = _mm512_mul_pd(value1, evalPiecewiseAVX512(_mm512_loadu_pd(x + 8), s, sh, offset,
+                                                           coefficients.data(), pieces, stride,
+                                                           degree));
+
+        if ((_mm512_cmp_pd_mask(value0, zero, _CMP_NEQ_UQ) |
+             _mm512_cmp_pd_mask(value1, zero, _CMP_NEQ_UQ)) == 0) {
+          break;
+        }
+      }
+
+      sum0 = _mm512_add_pd(sum0, value0);
+      sum1 = _mm512_add_pd(sum1, value1);
+    }
+
+    _mm512_storeu_pd(result + i, sum0);
+    _mm512_storeu_pd(result + i + 8, sum1);
+  }
+}
+
+SGPP_TARGET_AVX512 void OperationMultiEvalBsplineStreaming::multTransposeAVX512(
+    const double* source, double* result, size_t startGrid, size_t endGrid) {
+  const size_t dims = storage.getDimension();
+  const size_t paddedSize = preparedDataset.getNcols();
+  const double* data = preparedDataset.getPointer();
+  const __m512d zero = _mm512_setzero_pd();
+  const __m512d pieces = _mm512_set1_pd(static_cast<double>(numberOfPieces));
+  const __m256i stride = _mm256_set1_epi32(static_cast<int>(degree + 1));
+
+  for (size_t j = startGrid; j < endGrid; j++) {
+    __m512d sum0 = _mm512_setzero_pd();
+    __m512d sum1 = _mm512_setzero_pd();
+
+    for (size_t i = 0; i < paddedSize; i += 16) {
+      __m512d value0 = _mm512_loadu_pd(source + i);
+      __m512d value1 = _mm512_loadu_pd(source + i + 8);
+
+      for (size_t d = 0; d < dims; d++) {
+        const size_t k = j * dims + d;
+        const __m512d s = _mm512_set1_pd(scale[k]);
+        const __m512d sh = _mm512_set1_pd(shift[k]);
+        const __m256i offset = _mm256_set1_epi32(polynomialOffset[k]);
+        const double* x = data + d * paddedSize + i;
+
+        value0 = _mm512_mul_pd(value0, evalPiecewiseAVX512(_mm512_loadu_pd(x), s, sh, offset,
+                                                           coefficients.data(), pieces, stride,
+                                                           degree));
+        value1 = _mm512_mul_pd(value1, evalPiecewiseAVX512(_mm512_loadu_pd(x + 8), s, sh, offset,
+                                                           coefficients.data(), pieces, stride,
+                                                           degree));
+
+        if ((_mm512_cmp_pd_mask(value0, zero, _CMP_NEQ_UQ) |
+             _mm512_cmp_pd_mask(value1, zero, _CMP_NEQ_UQ)) == 0) {
+          break;
+        }
+      }
+
+      sum0 = _mm512_add_pd(sum0, value0);
+      sum1 = _mm512_add_pd(sum1, value1);
+    }
+
+    double sums[8];
+    _mm512_storeu_pd(sums, _mm512_add_pd(sum0, sum1));
+    result[j] = ((sums[0] + sums[1]) + (sums[2] + sums[3])) +
+                ((sums[4] + sums[5]) + (sums[6] + sums[7]));
+  }
+}
+
+#else
+
+void OperationMultiEvalBsplineStreaming::multAVX512(const double* alpha, double* result,
+                                                    size_t startData, size_t endData) {
+  throw base::operation_exception(
+      "OperationMultiEvalBsplineStreaming: library wasn't compiled with AVX-512 support");
+}
+
+void OperationMultiEvalBsplineStreaming::multTransposeAVX512(const double* source,
+                                                             double* result, size_t startGrid,
+                                                             size_t endGrid) {
+  throw base::operation_exception(
+      "OperationMultiEvalBsplineStreaming: library wasn't compiled with AVX-512 support");
+}
+
+#endif
+
+}  // namespace datadriven
+}  // namespace sgpp
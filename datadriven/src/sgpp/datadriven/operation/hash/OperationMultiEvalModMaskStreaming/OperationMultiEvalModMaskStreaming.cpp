@@ -5,6 +5,7 @@
 
 #include <sgpp/datadriven/operation/hash/OperationMultiEvalModMaskStreaming/OperationMultiEvalModMaskStreaming.hpp>
 
+#include <sgpp/base/tools/CPUFeatures.hpp>
 #include <sgpp/globaldef.hpp>
 
 #include <vector>
@@ -18,6 +19,12 @@ OperationMultiEvalModMaskStreaming::OperationMultiEvalModMaskStreaming(base::Gri
       preparedDataset(dataset),
       myTimer_(sgpp::base::SGppStopwatch()),
       duration(-1.0) {
+#if defined(SGPP_CPU_DISPATCH) && !defined(__AVX512F__) && !defined(__MIC__)
+  // the library was built for an older ARCH, pick the AVX-512 kernels if the CPU has them
+  this->useAVX512Kernels = base::CPUFeatures::hasAVX512F();
+#else
+  this->useAVX512Kernels = false;
+#endif
   this->storage = &grid.getStorage();
   this->padDataset(this->preparedDataset);
   this->preparedDataset.transpose();
@@ -103,8 +110,13 @@ void OperationMultiEvalModMaskStreaming::mult(sgpp::base::DataVector& alpha,
     getOpenMPPartitionSegment(0, this->preparedDataset.getNcols(), &start, &end,
                               getChunkDataPoints());
 
-    this->multImpl(this->level, this->index, this->mask, this->offset, &this->preparedDataset,
-                   alpha, result, 0, alpha.getSize(), start, end);
+    if (this->useAVX512Kernels) {
+      this->multImplAVX512(this->level, this->index, this->mask, this->offset,
+                           &this->preparedDataset, alpha, result, 0, alpha.getSize(), start, end);
+    } else {
+      this->multImpl(this->level, this->index, this->mask, this->offset, &this->preparedDataset,
+                     alpha, result, 0, alpha.getSize(), start, end);
+    }
   }
   result.resize(originalSize);
   this->duration = this->myTimer_.stop();
@@ -132,9 +144,15 @@ void OperationMultiEvalModMaskStreaming::multTranspose(sgpp::base::DataVector& s
 
     getOpenMPPartitionSegment(0, this->storage->getSize(), &start, &end, 1);
 
-    this->multTransposeImpl(this->level, this->index, this->mask, this->offset,
-                            &this->preparedDataset, source, result, start, end, 0,
-                            this->preparedDataset.getNcols());
+    if (this->useAVX512Kernels) {
+      this->multTransposeImplAVX512(this->level, this->index, this->mask, this->offset,
+                                    &this->preparedDataset, source, result, start, end, 0,
+                                    this->preparedDataset.getNcols());
+    } else {
+      this->multTransposeImpl(this->level, this->index, this->mask, this->offset,
+                              &this->preparedDataset, source, result, start, end, 0,
+                              this->preparedDataset.getNcols());
+    }
   }
   source.resize(originalSize);
   this->duration = this->myTimer_.stop();
@@ -163,6 +181,8 @@ size_t OperationMultiEvalModMaskStreaming::padDataset(sgpp::base::DataMatrix& da
 
 double OperationMultiEvalModMaskStreaming::getDuration() { return this->duration; }
 
+bool OperationMultiEvalModMaskStreaming::usesAVX512Kernels() const { return this->useAVX512Kernels; }
+
 void OperationMultiEvalModMaskStreaming::prepare() { this->recalculateLevelIndexMask(); }
 
 void OperationMultiEvalModMaskStreaming::recalculateLevelIndexMask() {
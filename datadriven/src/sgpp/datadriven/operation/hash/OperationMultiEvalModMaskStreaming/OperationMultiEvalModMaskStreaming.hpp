@@ -40,6 +40,9 @@ class OperationMultiEvalModMaskStreaming : public base::OperationMultipleEval {
 
   double duration;
 
+  /// use the runtime-dispatched AVX-512 kernels instead of the ones selected by ARCH
+  bool useAVX512Kernels;
+
  public:
   OperationMultiEvalModMaskStreaming(base::Grid& grid,
                                      base::DataMatrix& dataset);
@@ -60,6 +63,11 @@ class OperationMultiEvalModMaskStreaming : public base::OperationMultipleEval {
 
   double getDuration() override;
 
+  /**
+   * @return whether the runtime-dispatched AVX-512 kernels are used
+   */
+  bool usesAVX512Kernels() const;
+
  private:
   void getPartitionSegment(size_t start, size_t end, size_t segmentCount,
                            size_t segmentNumber, size_t* segmentStart,
@@ -87,6 +95,23 @@ class OperationMultiEvalModMaskStreaming : public base::OperationMultipleEval {
                          const size_t start_index_data,
                          const size_t end_index_data);
 
+  void multImplAVX512(std::vector<double>& level, std::vector<double>& index,
+                      std::vector<double>& mask, std::vector<double>& offset,
+                      sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& alpha,
+                      sgpp::base::DataVector& result, const size_t start_index_grid,
+                      const size_t end_index_grid, const size_t start_index_data,
+                      const size_t end_index_data);
+
+  void multTransposeImplAVX512(std::vector<double>& level, std::vector<double>& index,
+                               std::vector<double>& mask, std::vector<double>& offset,
+                               sgpp::base::DataMatrix* dataset,
+                               sgpp::base::DataVector& source,
+                               sgpp::base::DataVector& result,
+                               const size_t start_index_grid,
+                               const size_t end_index_grid,
+                               const size_t start_index_data,
+                               const size_t end_index_data);
+
   void recalculateLevelIndexMask();
 };
 }  // namespace datadriven
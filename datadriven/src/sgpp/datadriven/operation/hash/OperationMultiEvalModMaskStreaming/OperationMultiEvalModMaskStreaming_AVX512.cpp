@@ -0,0 +1,201 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+// AVX-512 kernels that are selected at runtime (see OperationMultiEvalModMaskStreaming::mult)
+// if the library was compiled for an older ARCH, but the CPU supports AVX-512.
+// They process 24 data points per step, i.e., they work on the dataset padded
+// for the compiled-in kernels.
+
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalModMaskStreaming/OperationMultiEvalModMaskStreaming.hpp>
+
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/tools/CPUFeatures.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#if defined(SGPP_CPU_DISPATCH) || defined(__AVX512F__)
+#include <immintrin.h>
+
+#ifdef SGPP_CPU_DISPATCH
+#define SGPP_TARGET_AVX512 __attribute__((target("avx512f")))
+#else
+#define SGPP_TARGET_AVX512
+#endif
+#endif
+
+namespace sgpp {
+namespace datadriven {
+
+#if defined(SGPP_CPU_DISPATCH) || defined(__AVX512F__)
+
+SGPP_TARGET_AVX512 void OperationMultiEvalModMaskStreaming::multImplAVX512(
+    std::vector<double>& level, std::vector<double>& index, std::vector<double>& mask,
+    std::vector<double>& offset, sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& alpha,
+    sgpp::base::DataVector& result, const size_t start_index_grid,
+    const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
+  double* ptrLevel = level.data();
+  double* ptrIndex = index.data();
+  double* ptrMask = mask.data();
+  double* ptrOffset = offset.data();
+  double* ptrAlpha = alpha.getPointer();
+  double* ptrData = dataset->getPointer();
+  double* ptrResult = result.getPointer();
+  size_t result_size = result.getSize();
+  size_t dims = dataset->getNrows();
+
+  const __m512d zero = _mm512_setzero_pd();
+
+  for (size_t i = start_index_data; i < end_index_data; i += 24) {
+    __m512d res_0 = zero;
+    __m512d res_1 = zero;
+    __m512d res_2 = zero;
+
+    for (size_t j = start_index_grid; j < end_index_grid; j++) {
+      __m512d support_0 = _mm512_set1_pd(ptrAlpha[j]);
+      __m512d support_1 = support_0;
+      __m512d support_2 = support_0;
+
+      for (size_t d = 0; d < dims; d++) {
+        __m512d eval_0 = _mm512_loadu_pd(&(ptrData[(d * result_size) + i]));
+        __m512d eval_1 = _mm512_loadu_pd(&(ptrData[(d * result_size) + i + 8]));
+        __m512d eval_2 = _mm512_loadu_pd(&(ptrData[(d * result_size) + i + 16]));
+
+        __m512d level = _mm512_set1_pd(ptrLevel[(j * dims) + d]);
+        __m512d index = _mm512_set1_pd(ptrIndex[(j * dims) + d]);
+
+        eval_0 = _mm512_fmsub_pd(eval_0, level, index);
+        eval_1 = _mm512_fmsub_pd(eval_1, level, index);
+        eval_2 = _mm512_fmsub_pd(eval_2, level, index);
+
+        // a set sign bit in the mask turns x * level - index into -|x * level - index|
+        __m512i mask = _mm512_castpd_si512(_mm512_set1_pd(ptrMask[(j * dims) + d]));
+        __m512d offset = _mm512_set1_pd(ptrOffset[(j * dims) + d]);
+
+        eval_0 = _mm512_castsi512_pd(_mm512_or_si512(mask, _mm512_castpd_si512(eval_0)));
+        eval_1 = _mm512_castsi512_pd(_mm512_or_si512(mask, _mm512_castpd_si512(eval_1)));
+        eval_2 = _mm512_castsi512_pd(_mm512_or_si512(mask, _mm512_castpd_si512(eval_2)));
+
+        eval_0 = _mm512_max_pd(zero, _mm512_add_pd(offset, eval_0));
+        eval_1 = _mm512_max_pd(zero, _mm512_add_pd(offset, eval_1));
+        eval_2 = _mm512_max_pd(zero, _mm512_add_pd(offset, eval_2));
+
+        support_0 = _mm512_mul_pd(support_0, eval_0);
+        support_1 = _mm512_mul_pd(support_1, eval_1);
+        support_2 = _mm512_mul_pd(support_2, eval_2);
+      }
+
+      res_0 = _mm512_add_pd(res_0, support_0);
+      res_1 = _mm512_add_pd(res_1, support_1);
+      res_2 = _mm512_add_pd(res_2, support_2);
+    }
+
+    _mm512_storeu_pd(&(ptrResult[i]), res_0);
+    _mm512_storeu_pd(&(ptrResult[i + 8]), res_1);
+    _mm512_storeu_pd(&(ptrResult[i + 16]), res_2);
+  }
+}
+
+SGPP_TARGET_AVX512 void OperationMultiEvalModMaskStreaming::multTransposeImplAVX512(
+    std::vector<double>& level, std::vector<double>& index, std::vector<double>& mask,
+    std::vector<double>& offset, sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& source,
+    sgpp::base::DataVector& result, const size_t start_index_grid,
+    const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
+  double* ptrLevel = level.data();
+  double* ptrIndex = index.data();
+  double* ptrMask = mask.data();
+  double* ptrOffset = offset.data();
+  double* ptrSource = source.getPointer();
+  double* ptrData = dataset->getPointer();
+  double* ptrResult = result.getPointer();
+  size_t sourceSize = source.getSize();
+  size_t dims = dataset->getNrows();
+
+  const __m512d zero = _mm512_setzero_pd();
+  const size_t chunkGridPoints = getChunkGridPoints();
+  __m512d sums[16];
+
+  // a block of grid points is processed per pass over the data to reuse the data in the cache
+  for (size_t k = start_index_grid; k < end_index_grid; k += chunkGridPoints) {
+    size_t grid_inc = std::min<size_t>(chunkGridPoints, (end_index_grid - k));
+
+    for (size_t j = 0; j < grid_inc; j++) {
+      sums[j] = zero;
+    }
+
+    for (size_t i = start_index_data; i < end_index_data; i += 24) {
+      for (size_t j = k; j < k + grid_inc; j++) {
+        __m512d support_0 = _mm512_loadu_pd(&(ptrSource[i]));
+        __m512d support_1 = _mm512_loadu_pd(&(ptrSource[i + 8]));
+        __m512d support_2 = _mm512_loadu_pd(&(ptrSource[i + 16]));
+
+        for (size_t d = 0; d < dims; d++) {
+          __m512d eval_0 = _mm512_loadu_pd(&(ptrData[(d * sourceSize) + i]));
+          __m512d eval_1 = _mm512_loadu_pd(&(ptrData[(d * sourceSize) + i + 8]));
+          __m512d eval_2 = _mm512_loadu_pd(&(ptrData[(d * sourceSize) + i + 16]));
+
+          __m512d level = _mm512_set1_pd(ptrLevel[(j * dims) + d]);
+          __m512d index = _mm512_set1_pd(ptrIndex[(j * dims) + d]);
+
+          eval_0 = _mm512_fmsub_pd(eval_0, level, index);
+          eval_1 = _mm512_fmsub_pd(eval_1, level, index);
+          eval_2 = _mm512_fmsub_pd(eval_2, level, index);
+
+          // a set sign bit in the mask turns x * level - index into -|x * level - index|
+          __m512i mask = _mm512_castpd_si512(_mm512_set1_pd(ptrMask[(j * dims) + d]));
+          __m512d offset = _mm512_set1_pd(ptrOffset[(j * dims) + d]);
+
+          eval_0 = _mm512_castsi512_pd(_mm512_or_si512(mask, _mm512_castpd_si512(eval_0)));
+          eval_1 = _mm512_castsi512_pd(_mm512_or_si512(mask, _mm512_castpd_si512(eval_1)));
+          eval_2 = _mm512_castsi512_pd(_mm512_or_si512(mask, _mm512_castpd_si512(eval_2)));
+
+          eval_0 = _mm512_max_pd(zero, _mm512_add_pd(offset, eval_0));
+          eval_1 = _mm512_max_pd(zero, _mm512_add_pd(offset, eval_1));
+          eval_2 = _mm512_max_pd(zero, _mm512_add_pd(offset, eval_2));
+
+          support_0 = _mm512_mul_pd(support_0, eval_0);
+          support_1 = _mm512_mul_pd(support_1, eval_1);
+          support_2 = _mm512_mul_pd(support_2, eval_2);
+        }
+
+        sums[j - k] = _mm512_add_pd(sums[j - k],
+                                    _mm512_add_pd(_mm512_add_pd(support_0, support_1), support_2));
+      }
+    }
+
+    for (size_t j = 0; j < grid_inc; j++) {
+      double tmp_reduce[8];
+      _mm512_storeu_pd(tmp_reduce, sums[j]);
+      ptrResult[k + j] += ((tmp_reduce[0] + tmp_reduce[1]) + (tmp_reduce[2] + tmp_reduce[3])) +
+                          ((tmp_reduce[4] + tmp_reduce[5]) + (tmp_reduce[6] + tmp_reduce[7]));
+    }
+  }
+}
+
+#else
+
+void OperationMultiEvalModMaskStreaming::multImplAVX512(
+    std::vector<double>& level, std::vector<double>& index, std::vector<double>& mask,
+    std::vector<double>& offset, sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& alpha,
+    sgpp::base::DataVector& result, const size_t start_index_grid,
+    const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
+  throw sgpp::base::operation_exception(
+      "OperationMultiEvalModMaskStreaming: library wasn't compiled with AVX-512 support");
+}
+
+void OperationMultiEvalModMaskStreaming::multTransposeImplAVX512(
+    std::vector<double>& level, std::vector<double>& index, std::vector<double>& mask,
+    std::vector<double>& offset, sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& source,
+    sgpp::base::DataVector& result, const size_t start_index_grid,
+    const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
+  throw sgpp::base::operation_exception(
+      "OperationMultiEvalModMaskStreaming: library wasn't compiled with AVX-512 support");
+}
+
+#endif
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -5,6 +5,7 @@
 
 #include <sgpp/datadriven/operation/hash/OperationMultiEvalStreaming/OperationMultiEvalStreaming.hpp>
 
+#include <sgpp/base/tools/CPUFeatures.hpp>
 #include <sgpp/globaldef.hpp>
 
 namespace sgpp {
@@ -16,6 +17,12 @@ OperationMultiEvalStreaming::OperationMultiEvalStreaming(base::Grid& grid,
       preparedDataset(dataset),
       myTimer_(sgpp::base::SGppStopwatch()),
       duration(-1.0) {
+#if defined(SGPP_CPU_DISPATCH) && !defined(__AVX512F__) && !defined(__MIC__)
+  // the library was built for an older ARCH, pick the AVX-512 kernels if the CPU has them
+  this->useAVX512Kernels = base::CPUFeatures::hasAVX512F();
+#else
+  this->useAVX512Kernels = false;
+#endif
   this->storage = &grid.getStorage();
   this->padDataset(this->preparedDataset);
   this->preparedDataset.transpose();
@@ -102,8 +109,13 @@ void OperationMultiEvalStreaming::mult(sgpp::base::DataVector& alpha,
     getOpenMPPartitionSegment(0, this->preparedDataset.getNcols(), &start, &end,
                               getChunkDataPoints());
 
-    this->multImpl(level_, index_, &this->preparedDataset, alpha, result, 0, alpha.getSize(), start,
-                   end);
+    if (this->useAVX512Kernels) {
+      this->multImplAVX512(level_, index_, &this->preparedDataset, alpha, result, 0,
+                           alpha.getSize(), start, end);
+    } else {
+      this->multImpl(level_, index_, &this->preparedDataset, alpha, result, 0, alpha.getSize(),
+                     start, end);
+    }
   }
   result.resize(originalSize);
   this->duration = this->myTimer_.stop();
@@ -131,8 +143,13 @@ void OperationMultiEvalStreaming::multTranspose(sgpp::base::DataVector& source,
 
     getOpenMPPartitionSegment(0, this->storage->getSize(), &start, &end, 1);
 
-    this->multTransposeImpl(this->level_, this->index_, &this->preparedDataset, source, result,
-                            start, end, 0, this->preparedDataset.getNcols());
+    if (this->useAVX512Kernels) {
+      this->multTransposeImplAVX512(this->level_, this->index_, &this->preparedDataset, source,
+                                    result, start, end, 0, this->preparedDataset.getNcols());
+    } else {
+      this->multTransposeImpl(this->level_, this->index_, &this->preparedDataset, source, result,
+                              start, end, 0, this->preparedDataset.getNcols());
+    }
   }
   source.resize(originalSize);
   this->duration = this->myTimer_.stop();
@@ -174,6 +191,8 @@ size_t OperationMultiEvalStreaming::padDataset(sgpp::base::DataMatrix& dataset)
 
 double OperationMultiEvalStreaming::getDuration() { return this->duration; }
 
+bool OperationMultiEvalStreaming::usesAVX512Kernels() const { return this->useAVX512Kernels; }
+
 void OperationMultiEvalStreaming::prepare() { this->recalculateLevelAndIndex(); }
 }  // namespace datadriven
 }  // namespace sgpp
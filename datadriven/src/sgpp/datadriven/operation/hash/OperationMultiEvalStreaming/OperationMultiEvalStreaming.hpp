@@ -34,6 +34,9 @@ class OperationMultiEvalStreaming : public base::OperationMultipleEval {
 
   double duration;
 
+  /// use the runtime-dispatched AVX-512 kernels instead of the ones selected by ARCH
+  bool useAVX512Kernels;
+
  public:
   OperationMultiEvalStreaming(base::Grid& grid, base::DataMatrix& dataset);
 
@@ -51,6 +54,11 @@ class OperationMultiEvalStreaming : public base::OperationMultipleEval {
 
   double getDuration() override;
 
+  /**
+   * @return whether the runtime-dispatched AVX-512 kernels are used
+   */
+  bool usesAVX512Kernels() const;
+
  private:
   void getPartitionSegment(size_t start, size_t end, size_t segmentCount, size_t segmentNumber,
                            size_t* segmentStart, size_t* segmentEnd, size_t blockSize);
@@ -72,6 +80,18 @@ class OperationMultiEvalStreaming : public base::OperationMultipleEval {
                          const size_t end_index_grid, const size_t start_index_data,
                          const size_t end_index_data);
 
+  void multImplAVX512(sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index,
+                      sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& alpha,
+                      sgpp::base::DataVector& result, const size_t start_index_grid,
+                      const size_t end_index_grid, const size_t start_index_data,
+                      const size_t end_index_data);
+
+  void multTransposeImplAVX512(sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index,
+                               sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& source,
+                               sgpp::base::DataVector& result, const size_t start_index_grid,
+                               const size_t end_index_grid, const size_t start_index_data,
+                               const size_t end_index_data);
+
   void recalculateLevelAndIndex();
 };
 
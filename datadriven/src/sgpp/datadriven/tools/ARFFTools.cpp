@@ -5,6 +5,7 @@
 
 #include <sgpp/base/exception/file_exception.hpp>
 #include <sgpp/datadriven/tools/ARFFTools.hpp>
+#include <sgpp/datadriven/tools/DataFileReader.hpp>
 #include <sgpp/datadriven/datamining/base/StringTokenizer.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -27,13 +28,10 @@ void ARFFTools::readARFFSizeFromFile(const std::string& filename,
                              size_t& dimension,
                              bool hasTargets,
                              std::vector<double> selectedTargets) {
-  std::ifstream stream(filename.c_str());
-  if (!stream) {
-    std::string msg = "readARFFSizeFromFile: Unable to open file: " + filename;
-    throw sgpp::base::file_exception(msg.c_str());
-  }
-  readARFFSize(stream, numberInstances, dimension, hasTargets, selectedTargets);
-  stream.close();
+  DataFileReader reader(filename, DataFileReader::Format::ARFF, false, hasTargets, -1,
+                        std::vector<size_t>(), selectedTargets);
+  numberInstances = reader.getNumberInstances();
+  dimension = reader.getDimension();
 }
 
 void ARFFTools::readARFFSizeFromString(const std::string& content,
@@ -50,14 +48,9 @@ Dataset ARFFTools::readARFFFromFile(const std::string& filename,
                                     size_t instanceCutoff,
                                     std::vector<size_t> selectedCols,
                                     std::vector<double> selectedTargets) {
-  std::ifstream stream(filename.c_str());
-  if (!stream) {
-    std::string msg = "readARFFFromFile: Unable to open file: " + filename;
-    throw sgpp::base::file_exception(msg.c_str());
-  }
-  Dataset d = readARFF(stream, hasTargets, instanceCutoff, selectedCols, selectedTargets);
-  stream.close();
-  return d;
+  DataFileReader reader(filename, DataFileReader::Format::ARFF, false, hasTargets,
+                        instanceCutoff, selectedCols, selectedTargets);
+  return reader.read();
 }
 
 Dataset ARFFTools::readARFFFromString(const std::string& content,
@@ -7,6 +7,7 @@
 
 #include <sgpp/datadriven/tools/CSVTools.hpp>
 #include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/datadriven/tools/DataFileReader.hpp>
 #include <sgpp/datadriven/datamining/base/StringTokenizer.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -28,15 +29,9 @@ Dataset CSVTools::readCSVFromFile(const std::string& filename,
                                   size_t instanceCutoff,
                                   std::vector<size_t> selectedCols,
                                   std::vector<double> selectedTargets) {
-  std::ifstream stream(filename.c_str());
-  if (!stream.is_open()) {
-    std::string msg = "Unable to open file: " + filename;
-    throw sgpp::base::file_exception(msg.c_str());
-  }
-  Dataset d =
-    readCSV(stream, skipFirstLine, hasTargets, instanceCutoff, selectedCols, selectedTargets);
-  stream.close();
-  return d;
+  DataFileReader reader(filename, DataFileReader::Format::CSV, skipFirstLine, hasTargets,
+                        instanceCutoff, selectedCols, selectedTargets);
+  return reader.read();
 }
 
 void CSVTools::readCSVSizeFromFile(const std::string& filename,
@@ -45,13 +40,10 @@ void CSVTools::readCSVSizeFromFile(const std::string& filename,
                                    bool skipFirstLine,
                                    bool hasTargets,
                                    std::vector<double> selectedTargets) {
-  std::ifstream stream(filename.c_str());
-  if (!stream.is_open()) {
-    std::string msg = "Unable to open file: " + filename;
-    throw sgpp::base::file_exception(msg.c_str());
-  }
-  readCSVSize(stream, numberInstances, dimension, skipFirstLine, hasTargets, selectedTargets);
-  stream.close();
+  DataFileReader reader(filename, DataFileReader::Format::CSV, skipFirstLine, hasTargets, -1,
+                        std::vector<size_t>(), selectedTargets);
+  numberInstances = reader.getNumberInstances();
+  dimension = reader.getDimension();
 }
 
 Dataset CSVTools::readCSV(std::istream& stream,
@@ -0,0 +1,494 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/tools/DataFileReader.hpp>
+
+#include <sgpp/base/exception/file_exception.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <locale>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace sgpp {
+namespace datadriven {
+
+namespace {
+
+/// minimal number of bytes per chunk (smaller chunks aren't worth the scheduling overhead)
+const size_t MIN_CHUNK_SIZE = 1 << 16;
+
+/// powers of ten that are exactly representable as double
+const double POW10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+/**
+ * @return end of the line starting at begin (position of the line break or end)
+ */
+inline const char* findLineEnd(const char* begin, const char* end) {
+  const void* lineEnd = std::memchr(begin, '\n', end - begin);
+  return (lineEnd == nullptr) ? end : static_cast<const char*>(lineEnd);
+}
+
+/**
+ * @return start of the next line after the line starting at begin
+ */
+inline const char* nextLine(const char* lineEnd, const char* end) {
+  return (lineEnd == end) ? end : lineEnd + 1;
+}
+
+/**
+ * @return line end without a trailing carriage return
+ */
+inline const char* trimLine(const char* begin, const char* lineEnd) {
+  return ((lineEnd > begin) && (*(lineEnd - 1) == '\r')) ? lineEnd - 1 : lineEnd;
+}
+
+/**
+ * Splits [begin, end) into chunks that start at line boundaries.
+ *
+ * @return chunk boundaries, chunk i is [result[i], result[i + 1])
+ */
+std::vector<const char*> splitIntoChunks(const char* begin, const char* end) {
+  const size_t length = end - begin;
+#ifdef _OPENMP
+  const size_t numThreads = static_cast<size_t>(omp_get_max_threads());
+#else
+  const size_t numThreads = 1;
+#endif
+  const size_t numChunks =
+      std::max<size_t>(1, std::min<size_t>(4 * numThreads, length / MIN_CHUNK_SIZE));
+  std::vector<const char*> bounds;
+  bounds.push_back(begin);
+
+  for (size_t i = 1; i < numChunks; i++) {
+    const char* bound = begin + length / numChunks * i;
+
+    if (bound <= bounds.back()) {
+      continue;
+    }
+
+    bound = nextLine(findLineEnd(bound - 1, end), end);
+
+    if (bound < end) {
+      bounds.push_back(bound);
+    }
+  }
+
+  bounds.push_back(end);
+  return bounds;
+}
+
+}  // namespace
+
+DataFileReader::DataFileReader(const std::string& filename, Format format, bool skipFirstLine,
+                               bool hasTargets, size_t instanceCutoff,
+                               std::vector<size_t> selectedCols,
+                               std::vector<double> selectedTargets)
+    : file(std::make_shared<base::MemoryMappedFile>(filename)),
+      format(format),
+      hasTargets(hasTargets),
+      instanceCutoff(instanceCutoff),
+      selectedCols(selectedCols),
+      selectedTargets(selectedTargets),
+      dataBegin(file->getData()),
+      dataEnd(file->getData() + file->getSize()),
+      numColumns(0),
+      dimension(0),
+      numberInstances(-1),
+      position(nullptr),
+      samplesRead(0) {
+  file->adviseSequential();
+
+  if (skipFirstLine) {
+    dataBegin = nextLine(findLineEnd(dataBegin, dataEnd), dataEnd);
+  }
+
+  // the first data line determines the number of columns
+  for (const char* line = dataBegin; line < dataEnd;) {
+    const char* lineEnd = findLineEnd(line, dataEnd);
+
+    if (isDataLine(line, trimLine(line, lineEnd))) {
+      numColumns = std::count(line, lineEnd, ',') + 1;
+      break;
+    }
+
+    line = nextLine(lineEnd, dataEnd);
+  }
+
+  const size_t maxDim = ((numColumns > 0) && hasTargets) ? numColumns - 1 : numColumns;
+
+  if (selectedCols.size() > 0) {
+    if (*std::max_element(selectedCols.begin(), selectedCols.end()) >= maxDim) {
+      throw base::file_exception("DataFileReader: invalid column selection");
+    }
+
+    dimension = selectedCols.size();
+  } else {
+    dimension = maxDim;
+  }
+
+  position = dataBegin;
+}
+
+size_t DataFileReader::getDimension() const { return dimension; }
+
+size_t DataFileReader::getNumberInstances() {
+  if (numberInstances != static_cast<size_t>(-1)) {
+    return numberInstances;
+  }
+
+  const std::vector<const char*> chunks = splitIntoChunks(dataBegin, dataEnd);
+  const int numChunks = static_cast<int>(chunks.size() - 1);
+  size_t count = 0;
+  int failed = 0;
+
+#pragma omp parallel for schedule(dynamic) reduction(+ : count, failed)
+  for (int i = 0; i < numChunks; i++) {
+    bool chunkFailed = false;
+    count += countLines(chunks[i], chunks[i + 1], chunkFailed);
+    failed += chunkFailed ? 1 : 0;
+  }
+
+  if (failed > 0) {
+    throw base::file_exception("DataFileReader: columns missing in data line");
+  }
+
+  numberInstances = std::min(count, instanceCutoff);
+  return numberInstances;
+}
+
+Dataset DataFileReader::read() {
+  Dataset* dataset = readRange(dataBegin, dataEnd, instanceCutoff);
+  Dataset result = std::move(*dataset);
+  delete dataset;
+  return result;
+}
+
+Dataset* DataFileReader::readNext(size_t howMany) {
+  howMany = std::min(howMany, instanceCutoff - std::min(samplesRead, instanceCutoff));
+
+  // find the end of the howMany-th admissible line
+  const char* stop = position;
+  size_t count = 0;
+  bool failed = false;
+
+  while ((count < howMany) && (stop < dataEnd)) {
+    const char* lineEnd = findLineEnd(stop, dataEnd);
+    const char* trimmedEnd = trimLine(stop, lineEnd);
+
+    if (isDataLine(stop, trimmedEnd) && isSelectedLine(stop, trimmedEnd, failed)) {
+      count++;
+    }
+
+    if (failed) {
+      throw base::file_exception("DataFileReader: columns missing in data line");
+    }
+
+    stop = nextLine(lineEnd, dataEnd);
+  }
+
+  Dataset* dataset = readRange(position, stop, count);
+  position = stop;
+  samplesRead += dataset->getNumberInstances();
+  return dataset;
+}
+
+bool DataFileReader::isAtEnd() const {
+  if (samplesRead >= instanceCutoff) {
+    return true;
+  }
+
+  bool failed = false;
+
+  for (const char* line = position; line < dataEnd;) {
+    const char* lineEnd = findLineEnd(line, dataEnd);
+    const char* trimmedEnd = trimLine(line, lineEnd);
+
+    if (isDataLine(line, trimmedEnd) && (isSelectedLine(line, trimmedEnd, failed) || failed)) {
+      return false;
+    }
+
+    line = nextLine(lineEnd, dataEnd);
+  }
+
+  return true;
+}
+
+void DataFileReader::reset() {
+  position = dataBegin;
+  samplesRead = 0;
+}
+
+double DataFileReader::parseDouble(const char* begin, const char* end) {
+  const char* p = begin;
+
+  while ((p < end) && ((*p == ' ') || (*p == '\t'))) {
+    p++;
+  }
+
+  const char* tokenBegin = p;
+  bool negative = false;
+
+  if ((p < end) && ((*p == '-') || (*p == '+'))) {
+    negative = (*p == '-');
+    p++;
+  }
+
+  if ((p == end) || !(std::isdigit(static_cast<unsigned char>(*p)) || (*p == '.'))) {
+    // no decimal number (e.g., inf, nan or empty), leave this to strtod
+    const std::string token(tokenBegin, end);
+    return std::strtod(token.c_str(), nullptr);
+  }
+
+  // read up to 19 significant digits, which always fit into 64 bits
+  uint64_t mantissa = 0;
+  int numDigits = 0;
+  int exponent = 0;
+  bool truncated = false;
+  bool hasDigits = false;
+
+  for (; (p < end) && std::isdigit(static_cast<unsigned char>(*p)); p++) {
+    hasDigits = true;
+
+    if (numDigits < 19) {
+      mantissa = 10 * mantissa + static_cast<uint64_t>(*p - '0');
+      numDigits += (mantissa > 0) ? 1 : 0;
+    } else {
+      exponent++;
+      truncated = truncated || (*p != '0');
+    }
+  }
+
+  if ((p < end) && (*p == '.')) {
+    for (p++; (p < end) && std::isdigit(static_cast<unsigned char>(*p)); p++) {
+      hasDigits = true;
+
+      if (numDigits < 19) {
+        mantissa = 10 * mantissa + static_cast<uint64_t>(*p - '0');
+        numDigits += (mantissa > 0) ? 1 : 0;
+        exponent--;
+      } else {
+        truncated = truncated || (*p != '0');
+      }
+    }
+  }
+
+  if (!hasDigits) {
+    return 0.0;
+  }
+
+  if ((p < end) && ((*p == 'e') || (*p == 'E'))) {
+    const char* q = p + 1;
+    bool negativeExponent = false;
+
+    if ((q < end) && ((*q == '-') || (*q == '+'))) {
+      negativeExponent = (*q == '-');
+      q++;
+    }
+
+    if ((q < end) && std::isdigit(static_cast<unsigned char>(*q))) {
+      int explicitExponent = 0;
+
+      for (; (q < end) && std::isdigit(static_cast<unsigned char>(*q)); q++) {
+        explicitExponent = std::min(10 * explicitExponent + (*q - '0'), 100000);
+      }
+
+      exponent += negativeExponent ? -explicitExponent : explicitExponent;
+      p = q;
+    }
+  }
+
+  double value;
+
+  if (mantissa == 0) {
+    value = 0.0;
+  } else if (!truncated && (mantissa <= (uint64_t(1) << 53)) && (exponent >= -22) &&
+             (exponent <= 22)) {
+    // both factors are exact, so the result is correctly rounded (Clinger's fast path)
+    value = static_cast<double>(mantissa);
+    value = (exponent < 0) ? value / POW10[-exponent] : value * POW10[exponent];
+  } else {
+    // rare case, use the slow, but correctly rounding conversion of the classic locale
+    std::istringstream stream(std::string(negative ? tokenBegin + 1 : tokenBegin, p));
+    stream.imbue(std::locale::classic());
+    stream >> value;
+
+    if (stream.fail()) {
+      // overflow or underflow
+      value = (exponent > 0) ? HUGE_VAL : 0.0;
+    }
+  }
+
+  return negative ? -value : value;
+}
+
+Dataset* DataFileReader::readRange(const char* begin, const char* end, size_t maxSamples) {
+  const std::vector<const char*> chunks = splitIntoChunks(begin, end);
+  const int numChunks = static_cast<int>(chunks.size() - 1);
+  std::vector<size_t> offsets(numChunks + 1, 0);
+  int failed = 0;
+
+  // count the admissible lines of each chunk
+#pragma omp parallel for schedule(dynamic) reduction(+ : failed)
+  for (int i = 0; i < numChunks; i++) {
+    bool chunkFailed = false;
+    offsets[i + 1] = countLines(chunks[i], chunks[i + 1], chunkFailed);
+    failed += chunkFailed ? 1 : 0;
+  }
+
+  if (failed > 0) {
+    throw base::file_exception("DataFileReader: columns missing in data line");
+  }
+
+  for (int i = 0; i < numChunks; i++) {
+    offsets[i + 1] += offsets[i];
+  }
+
+  const size_t numSamples = std::min(offsets[numChunks], maxSamples);
+  Dataset* dataset = new Dataset(numSamples, dimension);
+
+  // parse each chunk directly into its rows
+#pragma omp parallel for schedule(dynamic) reduction(+ : failed)
+  for (int i = 0; i < numChunks; i++) {
+    if (offsets[i] < numSamples) {
+      bool chunkFailed = false;
+      parseLines(chunks[i], chunks[i + 1], *dataset, offsets[i], numSamples, chunkFailed);
+      failed += chunkFailed ? 1 : 0;
+    }
+  }
+
+  if (failed > 0) {
+    delete dataset;
+    throw base::file_exception("DataFileReader: columns missing in data line");
+  }
+
+  return dataset;
+}
+
+bool DataFileReader::isDataLine(const char* begin, const char* end) const {
+  if (begin == end) {
+    return false;
+  }
+
+  if (format == Format::ARFF) {
+    // skip the header and comments
+    for (const char* p = begin; p < end; p++) {
+      if ((*p == '%') || (*p == '@')) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+bool DataFileReader::isSelectedLine(const char* begin, const char* end, bool& failed) const {
+  if (static_cast<size_t>(std::count(begin, end, ',')) + 1 != numColumns) {
+    failed = true;
+    return false;
+  }
+
+  if (!hasTargets || selectedTargets.empty()) {
+    return true;
+  }
+
+  const char* targetBegin = end;
+
+  while ((targetBegin > begin) && (*(targetBegin - 1) != ',')) {
+    targetBegin--;
+  }
+
+  const double target = parseDouble(targetBegin, end);
+
+  for (double selectedTarget : selectedTargets) {
+    if (std::fabs(target - selectedTarget) < 0.001) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+size_t DataFileReader::countLines(const char* begin, const char* end, bool& failed) const {
+  size_t count = 0;
+
+  for (const char* line = begin; line < end;) {
+    const char* lineEnd = findLineEnd(line, end);
+    const char* trimmedEnd = trimLine(line, lineEnd);
+
+    if (isDataLine(line, trimmedEnd) && isSelectedLine(line, trimmedEnd, failed)) {
+      count++;
+    }
+
+    if (failed) {
+      return count;
+    }
+
+    line = nextLine(lineEnd, end);
+  }
+
+  return count;
+}
+
+void DataFileReader::parseLines(const char* begin, const char* end, Dataset& dataset,
+                                size_t firstRow, size_t endRow, bool& failed) const {
+  double* data = dataset.getData().getPointer();
+  double* targets = dataset.getTargets().getPointer();
+  std::vector<double> values(numColumns);
+  size_t row = firstRow;
+
+  for (const char* line = begin; (line < end) && (row < endRow);) {
+    const char* lineEnd = findLineEnd(line, end);
+    const char* trimmedEnd = trimLine(line, lineEnd);
+
+    if (isDataLine(line, trimmedEnd) && isSelectedLine(line, trimmedEnd, failed)) {
+      const char* token = line;
+
+      for (size_t j = 0; j < numColumns; j++) {
+        const char* tokenEnd = std::find(token, trimmedEnd, ',');
+        values[j] = parseDouble(token, tokenEnd);
+        token = tokenEnd + 1;
+      }
+
+      double* rowData = data + row * dimension;
+
+      if (selectedCols.empty()) {
+        std::copy(values.begin(), values.begin() + dimension, rowData);
+      } else {
+        for (size_t j = 0; j < dimension; j++) {
+          rowData[j] = values[selectedCols[j]];
+        }
+      }
+
+      if (hasTargets) {
+        targets[row] = values[numColumns - 1];
+      }
+
+      row++;
+    }
+
+    if (failed) {
+      return;
+    }
+
+    line = nextLine(lineEnd, end);
+  }
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
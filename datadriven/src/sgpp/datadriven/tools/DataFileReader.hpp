@@ -0,0 +1,179 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef DATAFILEREADER_HPP
+#define DATAFILEREADER_HPP
+
+#include <sgpp/base/tools/MemoryMappedFile.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * High-throughput reader for comma-separated data files (CSV and the data section of ARFF).
+ *
+ * The file is mapped into memory (see base::MemoryMappedFile). read() splits the file into
+ * chunks at line boundaries, counts the admissible lines of all chunks in parallel, allocates
+ * the Dataset once and then parses the chunks in parallel directly into it. readNext() reads
+ * the file in order, a given number of samples at a time, so large files can be streamed
+ * without keeping a copy of the whole dataset in memory.
+ *
+ * The lines are interpreted in the same way as by CSVTools::readCSV and ARFFTools::readARFF:
+ * empty lines are skipped (for ARFF, also all lines containing '%' or '@'), the number of
+ * columns is determined by the first data line and the last column contains the targets if
+ * hasTargets is set. Numbers are parsed with a locale-independent parser.
+ *
+ * Copies of a reader share the mapped file, but have their own read position.
+ */
+class DataFileReader {
+ public:
+  /**
+   * Supported file formats
+   */
+  enum class Format { CSV, ARFF };
+
+  /**
+   * Opens a file. Throws a file_exception if the file cannot be opened or the column
+   * selection is invalid.
+   *
+   * @param filename name of the file
+   * @param format format of the file
+   * @param skipFirstLine whether to skip the first line (e.g., a CSV header with column names)
+   * @param hasTargets whether the last column contains targets
+   * @param instanceCutoff maximal number of samples to read (-1 for all)
+   * @param selectedCols which columns are used as dimensions (in this order, see
+   *        CSVTools::readCSV), empty for all columns except for the targets
+   * @param selectedTargets only lines with one of these targets are read (see
+   *        CSVTools::readCSV), empty for all lines
+   */
+  DataFileReader(const std::string& filename, Format format, bool skipFirstLine = false,
+                 bool hasTargets = true, size_t instanceCutoff = -1,
+                 std::vector<size_t> selectedCols = std::vector<size_t>(),
+                 std::vector<double> selectedTargets = std::vector<double>());
+
+  /**
+   * @return dimension of the samples (number of selected columns)
+   */
+  size_t getDimension() const;
+
+  /**
+   * Counts the admissible samples of the file (at most instanceCutoff). The file is scanned
+   * in parallel on the first call.
+   *
+   * @return number of samples
+   */
+  size_t getNumberInstances();
+
+  /**
+   * Reads all samples of the file in parallel, independently of the read position.
+   *
+   * @return dataset containing all samples
+   */
+  Dataset read();
+
+  /**
+   * Reads the next samples (in the order of the file) starting at the read position and
+   * advances the read position.
+   *
+   * @param howMany number of samples to read
+   * @return dataset containing min(howMany, number of remaining samples) samples,
+   *         the caller takes ownership
+   */
+  Dataset* readNext(size_t howMany);
+
+  /**
+   * @return whether all samples have been read by readNext()
+   */
+  bool isAtEnd() const;
+
+  /**
+   * Resets the read position to the first sample.
+   */
+  void reset();
+
+  /**
+   * Locale-independent conversion of a decimal floating point number, which accepts the same
+   * syntax as atof. Leading spaces are skipped, parsing stops at the first invalid character
+   * and 0 is returned if there is no number.
+   *
+   * @param begin start of the text
+   * @param end end of the text
+   * @return parsed number
+   */
+  static double parseDouble(const char* begin, const char* end);
+
+ private:
+  /// the mapped file (shared between copies)
+  std::shared_ptr<base::MemoryMappedFile> file;
+  /// format of the file
+  Format format;
+  /// whether the last column contains targets
+  bool hasTargets;
+  /// maximal number of samples
+  size_t instanceCutoff;
+  /// selected columns (all non-target columns if empty)
+  std::vector<size_t> selectedCols;
+  /// admissible targets (all if empty)
+  std::vector<double> selectedTargets;
+  /// start of the data (after the skipped first line)
+  const char* dataBegin;
+  /// end of the file
+  const char* dataEnd;
+  /// number of columns of the data lines (including the targets), 0 if there are none
+  size_t numColumns;
+  /// dimension of the samples
+  size_t dimension;
+  /// cached result of getNumberInstances (or -1)
+  size_t numberInstances;
+  /// read position of readNext
+  const char* position;
+  /// number of samples read by readNext
+  size_t samplesRead;
+
+  /**
+   * Parallel implementation of read and readNext: counts and parses the admissible lines in
+   * [begin, end) and writes at most maxSamples of them into a new dataset.
+   */
+  Dataset* readRange(const char* begin, const char* end, size_t maxSamples);
+
+  /**
+   * @return whether the line [begin, end) (without line break) contains data
+   */
+  bool isDataLine(const char* begin, const char* end) const;
+
+  /**
+   * @return whether the data line [begin, end) has one of the selected targets
+   * @param[out] failed set to true if the line has the wrong number of columns
+   */
+  bool isSelectedLine(const char* begin, const char* end, bool& failed) const;
+
+  /**
+   * Counts the admissible lines in [begin, end).
+   *
+   * @param[out] failed set to true if a line has the wrong number of columns
+   */
+  size_t countLines(const char* begin, const char* end, bool& failed) const;
+
+  /**
+   * Parses the admissible lines in [begin, end) into rows firstRow, firstRow + 1, ... of
+   * dataset, but not beyond endRow.
+   *
+   * @param[out] failed set to true if a line has the wrong number of columns
+   */
+  void parseLines(const char* begin, const char* end, Dataset& dataset, size_t firstRow,
+                  size_t endRow, bool& failed) const;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
+
+#endif /* DATAFILEREADER_HPP */
@@ -20,8 +20,10 @@
 #include <sgpp/datadriven/datamining/modules/hpo/harmonica/Harmonica.hpp>
 #include <sgpp/datadriven/datamining/modules/hpo/BoHyperparameterOptimizer.hpp>
 #include <sgpp/datadriven/datamining/modules/hpo/HarmonicaHyperparameterOptimizer.hpp>
+#include <sgpp/datadriven/datamining/modules/hpo/LeastSquaresRegressionFitterFactory.hpp>
 #include <sgpp/datadriven/datamining/builder/LeastSquaresRegressionMinerFactory.hpp>
 #include <sgpp/datadriven/datamining/modules/fitting/FitterConfigurationLeastSquares.hpp>
+#include <sgpp/optimization/tools/RandomNumberGenerator.hpp>
 
 
 #include <string>
@@ -137,6 +139,45 @@ BOOST_AUTO_TEST_CASE(upperLevelTest) {
   BOOST_CHECK_LE(res2, 0.3);
 }
 
+/**
+ * Provides access to the configuration of a hyperparameter optimizer to run it with a given
+ * number of concurrent trials.
+ */
+template <class Optimizer>
+class ConcurrentTrialsTester : public Optimizer {
+ public:
+  using Optimizer::Optimizer;
+  sgpp::datadriven::HPOConfig &getConfig() { return this->config; }
+};
+
+template <class Optimizer>
+double runWithConcurrentTrials(size_t concurrentTrials) {
+  std::string path("datadriven/tests/hpo_concurrent_testconfig.json");
+  sgpp::datadriven::DataMiningConfigParser parser(path);
+  sgpp::datadriven::LeastSquaresRegressionMinerFactory minfac{};
+  ConcurrentTrialsTester<Optimizer> hpo(
+      minfac.buildMiner(path), new sgpp::datadriven::LeastSquaresRegressionFitterFactory(parser),
+      parser);
+  hpo.getConfig().setConcurrentTrials(concurrentTrials);
+  for (size_t i = 1; i < concurrentTrials; i++) {
+    hpo.addMiner(minfac.buildMiner(path));
+  }
+  // the Bayesian optimization draws its candidates from the global random number generator,
+  // so every run has to start from the same state for the results to be comparable
+  sgpp::optimization::RandomNumberGenerator::getInstance().setSeed(42);
+  return hpo.run(false);
+}
+
+BOOST_AUTO_TEST_CASE(concurrentTrials) {
+  // the trials are independent, so running them concurrently must not change the results
+  // (up to rounding, as the trials are run with fewer threads each)
+  BOOST_CHECK_CLOSE(
+      runWithConcurrentTrials<sgpp::datadriven::HarmonicaHyperparameterOptimizer>(3),
+      runWithConcurrentTrials<sgpp::datadriven::HarmonicaHyperparameterOptimizer>(1), 1e-6);
+  BOOST_CHECK_CLOSE(runWithConcurrentTrials<sgpp::datadriven::BoHyperparameterOptimizer>(3),
+                    runWithConcurrentTrials<sgpp::datadriven::BoHyperparameterOptimizer>(1), 1e-6);
+}
+
 BOOST_AUTO_TEST_CASE(harmonicaConfigs) {
   // tests the bit management, especially setParameters and addConstraint by comparing
   // to a vector of all possible bit configurations
@@ -353,6 +394,74 @@ BOOST_AUTO_TEST_CASE(addSamplesGP) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(batchAcquisitionGP) {
+  // incrementally updated Gaussian Process has to match a rebuilt one, batched acquisition
+  // evaluation has to match the pointwise one
+  std::vector<BOConfig> initialConfigs{};
+  std::mt19937 generator(42);
+
+  std::vector<int> discOptions = {2, 3};
+  std::vector<int> catOptions = {2, 3};
+  size_t nCont = 3;
+  BOConfig prototype{&discOptions, &catOptions, nCont};
+
+  for (size_t i = 0; i < 5; i++) {
+    initialConfigs.emplace_back(prototype);
+    initialConfigs[i].randomize(generator);
+    initialConfigs[i].setScore(static_cast<double>((i * 7) % 5));
+  }
+
+  sgpp::datadriven::BayesianOptimization bo(initialConfigs);
+  DataVector scales(prototype.getNPar() + 1, 0.5);
+  scales.back() = 0.8;
+  bo.setScales(scales, 1);
+
+  for (size_t i = 0; i < 30; i++) {
+    BOConfig npoint(prototype);
+    npoint.randomize(generator);
+    npoint.setScore(static_cast<double>((i * 3) % 11));
+    initialConfigs.push_back(npoint);
+    bo.updateGP(npoint, true);
+  }
+
+  sgpp::datadriven::BayesianOptimization rebuilt(bo);
+  rebuilt.setScales(scales, 0);
+
+  BOConfig discPart(prototype);
+  discPart.randomize(generator);
+  for (auto& config : initialConfigs) {
+    config.calcDiscDistance(discPart, scales);
+  }
+
+  std::uniform_real_distribution<double> rand(0.0, 1.0);
+  DataMatrix candidates(50, nCont);
+  for (size_t i = 0; i < candidates.getSize(); i++) {
+    candidates[i] = rand(generator);
+  }
+
+  DataVector kernelrow(initialConfigs.size());
+  DataVector point(nCont);
+  for (size_t c = 0; c < candidates.getNrows(); c++) {
+    candidates.getRow(c, point);
+    for (size_t i = 0; i < initialConfigs.size(); i++) {
+      kernelrow[i] = bo.kernel(initialConfigs[i].getTotalDistance(point, scales));
+    }
+    BOOST_CHECK_CLOSE(bo.mean(kernelrow), rebuilt.mean(kernelrow), 1e-6);
+    BOOST_CHECK_SMALL(bo.var(kernelrow, 1) - rebuilt.var(kernelrow, 1), 1e-10);
+  }
+
+  // the batch shares the discrete distances of the configurations set above
+  sgpp::datadriven::BayesianOptimization batchbo(initialConfigs);
+  batchbo.setScales(scales, 1);
+  DataVector values;
+  batchbo.acquisitionBatch(candidates, values);
+  BOOST_CHECK_EQUAL(values.size(), candidates.getNrows());
+  for (size_t c = 0; c < candidates.getNrows(); c++) {
+    candidates.getRow(c, point);
+    BOOST_CHECK_CLOSE(values[c], batchbo.acquisitionOuter(point), 1e-10);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(fitScalesGP) {
   // test gaussian process fitting by fitting to a second GP
   std::vector<BOConfig> initialConfigs{};
@@ -0,0 +1,235 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/datadriven/algorithm/DBMatBinaryFile.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineDenseIChol.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineFactory.hpp>
+#include <sgpp/datadriven/algorithm/GridFactory.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::datadriven::DBMatBinaryFile;
+using sgpp::datadriven::MatrixDecompositionType;
+
+namespace {
+DataMatrix createMatrix(size_t nrows, size_t ncols, double offset) {
+  DataMatrix matrix(nrows, ncols);
+
+  for (size_t i = 0; i < nrows * ncols; i++) {
+    matrix[i] = offset + 0.5 * static_cast<double>(i);
+  }
+
+  return matrix;
+}
+
+void flipByte(const std::string& fileName, size_t position) {
+  std::fstream file(fileName, std::ios::in | std::ios::out | std::ios::binary);
+  file.seekg(static_cast<std::streamoff>(position));
+  char c;
+  file.read(&c, 1);
+  c = static_cast<char>(c ^ 0x10);
+  file.seekp(static_cast<std::streamoff>(position));
+  file.write(&c, 1);
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(dBMatBinaryFile_test)
+
+BOOST_AUTO_TEST_CASE(testWriteRead) {
+  const std::string fileName = "test_binary.dbmat";
+  const DataMatrix lhs = createMatrix(7, 5, 1.0);
+  const DataMatrix q = createMatrix(3, 3, -2.0);
+  const std::vector<size_t> permutation{2, 0, 1, 4, 3};
+  const std::vector<std::vector<size_t>> interactions{{0}, {1}, {0, 1}, {}};
+
+  std::vector<DBMatBinaryFile::Section> sections;
+  sections.emplace_back(lhs);
+  sections.emplace_back(q);
+  sections.emplace_back(permutation.data(), permutation.size());
+  DBMatBinaryFile::write(fileName, MatrixDecompositionType::OrthoAdapt, interactions, sections);
+
+  BOOST_CHECK(DBMatBinaryFile::isBinaryFile(fileName));
+
+  {
+    DBMatBinaryFile file(fileName);
+    BOOST_CHECK(file.getDecompositionType() == MatrixDecompositionType::OrthoAdapt);
+    BOOST_CHECK(file.getInteractions() == interactions);
+    BOOST_CHECK_EQUAL(file.getSectionCount(), 3);
+
+    BOOST_CHECK(file.getElementType(0) == DBMatBinaryFile::ElementType::Double);
+    BOOST_CHECK_EQUAL(file.getRows(0), lhs.getNrows());
+    BOOST_CHECK_EQUAL(file.getCols(0), lhs.getNcols());
+    BOOST_CHECK_EQUAL(reinterpret_cast<uintptr_t>(file.getMatrixData(0)) % 64, 0);
+
+    DataMatrix lhsRead;
+    file.copyMatrix(0, lhsRead);
+    BOOST_CHECK_EQUAL(lhsRead.getNrows(), lhs.getNrows());
+    BOOST_CHECK_EQUAL(lhsRead.getNcols(), lhs.getNcols());
+
+    for (size_t i = 0; i < lhs.getSize(); i++) {
+      BOOST_CHECK_EQUAL(lhsRead[i], lhs[i]);
+    }
+
+    const double* qData = file.getMatrixData(1);
+
+    for (size_t i = 0; i < q.getSize(); i++) {
+      BOOST_CHECK_EQUAL(qData[i], q[i]);
+    }
+
+    std::vector<size_t> permutationRead;
+    file.copyIndices(2, permutationRead);
+    BOOST_CHECK(permutationRead == permutation);
+
+    // sections have to be accessed with the right type
+    BOOST_CHECK_THROW(file.getIndexData(0), sgpp::base::file_exception);
+    BOOST_CHECK_THROW(file.getMatrixData(3), sgpp::base::file_exception);
+  }
+
+  std::remove(fileName.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(testCorruption) {
+  const std::string fileName = "test_corrupt.dbmat";
+  const DataMatrix lhs = createMatrix(20, 20, 3.0);
+  std::vector<DBMatBinaryFile::Section> sections;
+  sections.emplace_back(lhs);
+  DBMatBinaryFile::write(fileName, MatrixDecompositionType::Chol, {}, sections);
+
+  {
+    DBMatBinaryFile file(fileName);
+    BOOST_CHECK(file.getInteractions().empty());
+  }
+
+  // corrupt the last entry of the matrix (the last section ends at the end of the file)
+  std::ifstream sizeStream(fileName, std::ios::binary | std::ios::ate);
+  const size_t fileSize = static_cast<size_t>(sizeStream.tellg());
+  sizeStream.close();
+  flipByte(fileName, fileSize - 4);
+
+  BOOST_CHECK_THROW(DBMatBinaryFile file(fileName), sgpp::base::file_exception);
+
+  // without verification of the sections, the file can be opened
+  BOOST_CHECK_NO_THROW(DBMatBinaryFile file(fileName, false));
+
+  // the header is always verified
+  flipByte(fileName, 20);
+  BOOST_CHECK_THROW(DBMatBinaryFile file(fileName, false), sgpp::base::file_exception);
+
+  std::remove(fileName.c_str());
+
+  // legacy text files are not binary files
+  std::ofstream textFile(fileName);
+  textFile << "3,3,2,0\n";
+  textFile.close();
+  BOOST_CHECK(!DBMatBinaryFile::isBinaryFile(fileName));
+  BOOST_CHECK_THROW(DBMatBinaryFile file(fileName), sgpp::base::file_exception);
+  std::remove(fileName.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(testConcurrentWrite) {
+  // concurrent writers of the same file use different temporary files,
+  // such that the result is always one complete file
+  const std::string fileName = "test_concurrent.dbmat";
+  const size_t numberOfWriters = 4;
+  std::vector<DataMatrix> matrices;
+
+  for (size_t k = 0; k < numberOfWriters; k++) {
+    matrices.push_back(createMatrix(50, 50, static_cast<double>(k)));
+  }
+
+  std::vector<std::thread> writers;
+
+  for (size_t k = 0; k < numberOfWriters; k++) {
+    writers.emplace_back([&fileName, &matrices, k]() {
+      for (size_t repetition = 0; repetition < 10; repetition++) {
+        std::vector<DBMatBinaryFile::Section> sections;
+        sections.emplace_back(matrices[k]);
+        DBMatBinaryFile::write(fileName, MatrixDecompositionType::Chol, {}, sections);
+      }
+    });
+  }
+
+  for (std::thread& writer : writers) {
+    writer.join();
+  }
+
+  {
+    DBMatBinaryFile file(fileName);
+    DataMatrix matrix;
+    file.copyMatrix(0, matrix);
+    const size_t k = static_cast<size_t>(matrix[0]);
+    BOOST_REQUIRE(k < numberOfWriters);
+
+    for (size_t i = 0; i < matrix.getSize(); i++) {
+      BOOST_CHECK_EQUAL(matrix[i], matrices[k][i]);
+    }
+  }
+
+  std::remove(fileName.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(testStoreLoadDenseIChol) {
+  sgpp::base::RegularGridConfiguration gridConfig;
+  gridConfig.dim_ = 2;
+  gridConfig.level_ = 3;
+  gridConfig.type_ = sgpp::base::GridType::Linear;
+
+  sgpp::base::AdaptivityConfiguration adaptivityConfig;
+
+  sgpp::datadriven::RegularizationConfiguration regularizationConfig;
+  regularizationConfig.type_ = sgpp::datadriven::RegularizationType::Identity;
+  regularizationConfig.lambda_ = 0.1;
+
+  sgpp::datadriven::DensityEstimationConfiguration densityEstimationConfig;
+  densityEstimationConfig.decomposition_ = MatrixDecompositionType::DenseIchol;
+  densityEstimationConfig.iCholSweepsDecompose_ = 2;
+
+  sgpp::datadriven::GridFactory gridFactory;
+  std::unique_ptr<sgpp::base::Grid> grid{
+      gridFactory.createGrid(gridConfig, std::vector<std::vector<size_t>>())};
+
+  std::unique_ptr<sgpp::datadriven::DBMatOffline> offline{
+      sgpp::datadriven::DBMatOfflineFactory::buildOfflineObject(
+          gridConfig, adaptivityConfig, regularizationConfig, densityEstimationConfig)};
+  offline->buildMatrix(grid.get(), regularizationConfig);
+  offline->decomposeMatrix(regularizationConfig, densityEstimationConfig);
+  offline->interactions = {{0}, {1}};
+
+  const std::string fileName = "test_ichol.dbmat";
+  offline->store(fileName);
+
+  std::unique_ptr<sgpp::datadriven::DBMatOffline> newOffline{
+      sgpp::datadriven::DBMatOfflineFactory::buildFromFile(fileName)};
+  sgpp::datadriven::DBMatOfflineDenseIChol fromConstructor(fileName);
+  std::remove(fileName.c_str());
+
+  BOOST_CHECK(newOffline->getDecompositionType() == MatrixDecompositionType::DenseIchol);
+  BOOST_CHECK(newOffline->interactions == offline->interactions);
+  BOOST_CHECK(fromConstructor.interactions == offline->interactions);
+
+  DataMatrix& oldMatrix = offline->getDecomposedMatrix();
+  DataMatrix& newMatrix = newOffline->getDecomposedMatrix();
+  DataMatrix& constructedMatrix = fromConstructor.getDecomposedMatrix();
+  BOOST_CHECK_EQUAL(oldMatrix.getSize(), newMatrix.getSize());
+  BOOST_CHECK_EQUAL(oldMatrix.getSize(), constructedMatrix.getSize());
+
+  for (size_t i = 0; i < oldMatrix.getSize(); i++) {
+    BOOST_CHECK_EQUAL(newMatrix[i], oldMatrix[i]);
+    BOOST_CHECK_EQUAL(constructedMatrix[i], oldMatrix[i]);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
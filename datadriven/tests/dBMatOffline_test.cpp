@@ -14,6 +14,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineChol.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineEigen.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineFactory.hpp>
@@ -24,6 +25,7 @@
 #include <sgpp/datadriven/algorithm/GridFactory.hpp>
 #include <sgpp/globaldef.hpp>
 
+#include <list>
 #include <string>
 #include <vector>
 
@@ -159,6 +161,67 @@ BOOST_AUTO_TEST_CASE(testReadWriteCholesky) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(testCholeskyModification) {
+  sgpp::base::RegularGridConfiguration gridConfig;
+  gridConfig.dim_ = 2;
+  gridConfig.level_ = 4;
+  gridConfig.type_ = sgpp::base::GridType::Linear;
+
+  sgpp::base::AdaptivityConfiguration adaptivityConfig;
+
+  sgpp::datadriven::RegularizationConfiguration regularizationConfig;
+  regularizationConfig.type_ = sgpp::datadriven::RegularizationType::Identity;
+  regularizationConfig.lambda_ = 0.1;
+
+  sgpp::datadriven::DensityEstimationConfiguration densityEstimationConfig;
+  densityEstimationConfig.decomposition_ = sgpp::datadriven::MatrixDecompositionType::Chol;
+
+  sgpp::datadriven::GridFactory gridFactory;
+  std::unique_ptr<sgpp::base::Grid> grid = std::unique_ptr<sgpp::base::Grid>{
+    gridFactory.createGrid(gridConfig, std::vector<std::vector <size_t>>())
+  };
+
+  sgpp::datadriven::DBMatOfflineChol offline;
+  offline.buildMatrix(grid.get(), regularizationConfig);
+  offline.decomposeMatrix(regularizationConfig, densityEstimationConfig);
+
+  // factor of the system matrix of the current grid computed from scratch
+  auto checkFactor = [&]() {
+    sgpp::datadriven::DBMatOfflineChol reference;
+    reference.buildMatrix(grid.get(), regularizationConfig);
+    reference.decomposeMatrix(regularizationConfig, densityEstimationConfig);
+
+    auto& matrix = offline.getDecomposedMatrix();
+    auto& referenceMatrix = reference.getDecomposedMatrix();
+    BOOST_CHECK_EQUAL(matrix.getNrows(), grid->getSize());
+    BOOST_CHECK_EQUAL(matrix.getSize(), referenceMatrix.getSize());
+
+    for (size_t i = 0; i < referenceMatrix.getSize(); i++) {
+      BOOST_CHECK_SMALL(matrix[i] - referenceMatrix[i], 1e-10);
+    }
+  };
+
+  // refine all leaves at once
+  size_t oldSize = grid->getSize();
+  sgpp::base::DataVector alpha(oldSize, 1.0);
+  sgpp::base::SurplusRefinementFunctor functor(alpha, oldSize);
+  grid->getGenerator().refine(functor);
+  size_t newPoints = grid->getSize() - oldSize;
+  BOOST_CHECK(newPoints > 1);
+
+  offline.choleskyModification(*grid, densityEstimationConfig, newPoints, std::list<size_t>(),
+                               regularizationConfig.lambda_);
+  checkFactor();
+
+  // coarsen several points at once
+  std::list<size_t> deletedPoints{grid->getSize() - 1, 40, 3, 17, 18};
+  grid->getStorage().deletePoints(deletedPoints);
+
+  offline.choleskyModification(*grid, densityEstimationConfig, 0, deletedPoints,
+                               regularizationConfig.lambda_);
+  checkFactor();
+}
+
 BOOST_AUTO_TEST_CASE(testReadWriteEigen) {
   sgpp::base::RegularGridConfiguration gridConfig;
   gridConfig.dim_ = 2;
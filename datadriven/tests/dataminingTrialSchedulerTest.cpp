@@ -0,0 +1,101 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/exception/application_exception.hpp>
+#include <sgpp/datadriven/configuration/CrossvalidationConfiguration.hpp>
+#include <sgpp/datadriven/datamining/base/SparseGridMiner.hpp>
+#include <sgpp/datadriven/datamining/base/TrialScheduler.hpp>
+#include <sgpp/datadriven/datamining/builder/DataSourceBuilder.hpp>
+#include <sgpp/datadriven/datamining/builder/LeastSquaresRegressionMinerFactory.hpp>
+#include <sgpp/datadriven/datamining/configuration/DataMiningConfigParser.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+using sgpp::datadriven::CrossvalidationConfiguration;
+using sgpp::datadriven::DataMiningConfigParser;
+using sgpp::datadriven::DataSourceBuilder;
+using sgpp::datadriven::DataSourceConfig;
+using sgpp::datadriven::DataSourceCrossValidation;
+using sgpp::datadriven::SparseGridMiner;
+using sgpp::datadriven::TrialScheduler;
+
+namespace {
+/// builds cross validation miners that train the given number of folds concurrently
+class ConcurrentFoldsMinerFactory : public sgpp::datadriven::LeastSquaresRegressionMinerFactory {
+ public:
+  explicit ConcurrentFoldsMinerFactory(size_t concurrentFolds)
+      : concurrentFolds(concurrentFolds) {}
+
+ protected:
+  DataSourceCrossValidation* createDataSourceCrossValidation(
+      const DataMiningConfigParser& parser) const override {
+    DataSourceConfig config{};
+    CrossvalidationConfiguration crossValidationConfig{};
+    parser.getDataSourceConfig(config, config);
+    parser.getFitterCrossvalidationConfig(crossValidationConfig, crossValidationConfig);
+    crossValidationConfig.concurrentFolds_ = concurrentFolds;
+    return DataSourceBuilder().crossValidationFromConfig(config, crossValidationConfig);
+  }
+
+  size_t concurrentFolds;
+};
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(dataminingTrialSchedulerTest)
+
+BOOST_AUTO_TEST_CASE(testRunAllTrials) {
+  for (size_t concurrentTrials : {1, 3, 8}) {
+    TrialScheduler scheduler(concurrentTrials, 1);
+    const size_t numTrials = 5;
+    std::vector<int> runs(numTrials, 0);
+    std::atomic<size_t> maxSlot{0};
+
+    scheduler.run(numTrials, [&](size_t trial, size_t slot) {
+      runs[trial]++;
+      size_t current = maxSlot;
+      while (slot > current && !maxSlot.compare_exchange_weak(current, slot)) {
+      }
+    });
+
+    for (size_t i = 0; i < numTrials; i++) {
+      BOOST_CHECK_EQUAL(runs[i], 1);
+    }
+    BOOST_CHECK_EQUAL(scheduler.getSlots(numTrials), std::min(concurrentTrials, numTrials));
+    BOOST_CHECK(maxSlot < scheduler.getSlots(numTrials));
+    BOOST_CHECK_EQUAL(scheduler.getThreadsPerTrial(numTrials), 1);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testException) {
+  TrialScheduler scheduler(2, 1);
+  BOOST_CHECK_THROW(scheduler.run(4,
+                                  [](size_t trial, size_t) {
+                                    if (trial == 1) {
+                                      throw sgpp::base::application_exception("trial failed");
+                                    }
+                                  }),
+                    sgpp::base::application_exception);
+}
+
+BOOST_AUTO_TEST_CASE(testConcurrentFolds) {
+  const std::string path("datadriven/tests/crossvalidation_testconfig.json");
+  std::unique_ptr<SparseGridMiner> sequentialMiner(ConcurrentFoldsMinerFactory(1).buildMiner(path));
+  std::unique_ptr<SparseGridMiner> concurrentMiner(ConcurrentFoldsMinerFactory(3).buildMiner(path));
+
+  // the folds are independent, so training them concurrently must not change the mean score
+  // (up to rounding, as the folds are trained with fewer threads each)
+  const double sequentialScore = sequentialMiner->learn(false);
+  const double concurrentScore = concurrentMiner->learn(false);
+  BOOST_CHECK_CLOSE(concurrentScore, sequentialScore, 1e-6);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,242 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/exception/algorithm_exception.hpp>
+#include <sgpp/datadriven/algorithm/DBMatDenseDecomposition.hpp>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::datadriven::DBMatDenseDecomposition;
+
+namespace {
+// symmetric positive definite test matrix A = B * B^t + n * I with random B
+DataMatrix createSPDMatrix(size_t n) {
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+  DataMatrix B(n, n);
+
+  for (size_t i = 0; i < n * n; i++) {
+    B[i] = distribution(generator);
+  }
+
+  DataMatrix A(n, n);
+
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = 0; j < n; j++) {
+      double s = (i == j) ? static_cast<double>(n) : 0.0;
+
+      for (size_t k = 0; k < n; k++) {
+        s += B.get(i, k) * B.get(j, k);
+      }
+
+      A.set(i, j, s);
+    }
+  }
+
+  return A;
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(DenseDecomposition_test)
+
+BOOST_AUTO_TEST_CASE(cholesky) {
+  // sizes smaller than, equal to and not a multiple of the block size
+  for (size_t n : {1u, 7u, 16u, 45u}) {
+    const DataMatrix A = createSPDMatrix(n);
+    DataMatrix L(A);
+    DBMatDenseDecomposition::choleskyDecomposition(L, 8);
+
+    for (size_t i = 0; i < n; i++) {
+      for (size_t j = 0; j < n; j++) {
+        double s = 0.0;
+
+        for (size_t k = 0; k < n; k++) {
+          s += L.get(i, k) * L.get(j, k);
+        }
+
+        if (i < j) {
+          BOOST_CHECK_EQUAL(L.get(i, j), 0.0);
+        }
+
+        BOOST_CHECK_SMALL(s - A.get(i, j), 1e-10);
+      }
+    }
+  }
+
+  // indefinite matrix
+  DataMatrix B(2, 2, 1.0);
+  B.set(1, 1, -1.0);
+  BOOST_CHECK_THROW(DBMatDenseDecomposition::choleskyDecomposition(B),
+                    sgpp::base::algorithm_exception);
+}
+
+BOOST_AUTO_TEST_CASE(choleskyAppend) {
+  const size_t n = 45;
+  const DataMatrix A = createSPDMatrix(n);
+
+  // append several rows/columns at once (fewer than, equal to and more than a block)
+  for (size_t k : {1u, 8u, 19u}) {
+    const size_t nOld = n - k;
+    DataMatrix L(A);
+    L.resizeQuadratic(nOld);
+    DBMatDenseDecomposition::choleskyDecomposition(L, 8);
+
+    DataMatrix newColumns(n, k);
+
+    for (size_t i = 0; i < n; i++) {
+      for (size_t j = 0; j < k; j++) {
+        newColumns.set(i, j, A.get(i, nOld + j));
+      }
+    }
+
+    DBMatDenseDecomposition::choleskyAppend(L, newColumns, 8);
+
+    DataMatrix reference(A);
+    DBMatDenseDecomposition::choleskyDecomposition(reference, 8);
+    BOOST_CHECK_EQUAL(L.getNrows(), n);
+    BOOST_CHECK_EQUAL(L.getNcols(), n);
+
+    for (size_t i = 0; i < n * n; i++) {
+      BOOST_CHECK_SMALL(L[i] - reference[i], 1e-10);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(choleskyRemove) {
+  const size_t n = 45;
+  const DataMatrix A = createSPDMatrix(n);
+  DataMatrix factor(A);
+  DBMatDenseDecomposition::choleskyDecomposition(factor, 8);
+
+  for (const std::vector<size_t>& removed : std::vector<std::vector<size_t>>{
+           {44}, {0}, {3, 4, 5, 20, 31, 44}, {1, 2, 6, 7, 9, 11, 12, 13, 15, 17, 23, 30, 38}}) {
+    DataMatrix L(factor);
+    DBMatDenseDecomposition::choleskyRemove(L, removed, 4);
+
+    // Cholesky factor of A without the removed rows/columns
+    std::vector<size_t> kept;
+
+    for (size_t i = 0, t = 0; i < n; i++) {
+      if ((t < removed.size()) && (removed[t] == i)) {
+        t++;
+      } else {
+        kept.push_back(i);
+      }
+    }
+
+    DataMatrix reference(kept.size(), kept.size());
+
+    for (size_t i = 0; i < kept.size(); i++) {
+      for (size_t j = 0; j < kept.size(); j++) {
+        reference.set(i, j, A.get(kept[i], kept[j]));
+      }
+    }
+
+    DBMatDenseDecomposition::choleskyDecomposition(reference, 8);
+    BOOST_CHECK_EQUAL(L.getNrows(), kept.size());
+    BOOST_CHECK_EQUAL(L.getNcols(), kept.size());
+
+    for (size_t i = 0; i < reference.getSize(); i++) {
+      BOOST_CHECK_SMALL(L[i] - reference[i], 1e-10);
+    }
+  }
+
+  DataMatrix L(factor);
+  BOOST_CHECK_THROW(DBMatDenseDecomposition::choleskyRemove(L, {5, 3}),
+                    sgpp::base::algorithm_exception);
+  BOOST_CHECK_THROW(DBMatDenseDecomposition::choleskyRemove(L, {n}),
+                    sgpp::base::algorithm_exception);
+}
+
+BOOST_AUTO_TEST_CASE(tridiagonal) {
+  for (size_t n : {2u, 7u, 16u, 45u}) {
+    const DataMatrix A = createSPDMatrix(n);
+    DataMatrix M(A);
+    DataMatrix Q;
+    DataVector diag;
+    DataVector subdiag;
+    DBMatDenseDecomposition::tridiagonalDecomposition(M, Q, diag, subdiag, 8);
+
+    BOOST_CHECK_EQUAL(subdiag.getSize(), n - 1);
+
+    // Q^t * Q == I and Q * T * Q^t == A
+    for (size_t i = 0; i < n; i++) {
+      for (size_t j = 0; j < n; j++) {
+        double qTq = 0.0;
+        double qTqT = 0.0;
+
+        for (size_t k = 0; k < n; k++) {
+          qTq += Q.get(k, i) * Q.get(k, j);
+          double tqT = diag[k] * Q.get(j, k);
+
+          if (k > 0) {
+            tqT += subdiag[k - 1] * Q.get(j, k - 1);
+          }
+
+          if (k + 1 < n) {
+            tqT += subdiag[k] * Q.get(j, k + 1);
+          }
+
+          qTqT += Q.get(i, k) * tqT;
+        }
+
+        BOOST_CHECK_SMALL(qTq - ((i == j) ? 1.0 : 0.0), 1e-12);
+        BOOST_CHECK_SMALL(qTqT - A.get(i, j), 1e-10);
+      }
+    }
+
+    // T * T^{-1} == I
+    DataMatrix Tinv;
+    DBMatDenseDecomposition::invertSymmetricTridiagonal(diag, subdiag, Tinv);
+
+    for (size_t i = 0; i < n; i++) {
+      for (size_t j = 0; j < n; j++) {
+        double s = diag[i] * Tinv.get(i, j);
+
+        if (i > 0) {
+          s += subdiag[i - 1] * Tinv.get(i - 1, j);
+        }
+
+        if (i + 1 < n) {
+          s += subdiag[i] * Tinv.get(i + 1, j);
+        }
+
+        BOOST_CHECK_SMALL(s - ((i == j) ? 1.0 : 0.0), 1e-12);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(eigen) {
+  for (size_t n : {1u, 7u, 16u, 45u}) {
+    const DataMatrix A = createSPDMatrix(n);
+    DataMatrix M(A);
+    DataMatrix Q;
+    DataVector e;
+    DBMatDenseDecomposition::eigenDecomposition(M, e, Q, 8);
+
+    // Q * diag(e) * Q^t == A
+    for (size_t i = 0; i < n; i++) {
+      for (size_t j = 0; j < n; j++) {
+        double s = 0.0;
+
+        for (size_t k = 0; k < n; k++) {
+          s += Q.get(i, k) * e[k] * Q.get(j, k);
+        }
+
+        BOOST_CHECK_SMALL(s - A.get(i, j), 1e-10);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,116 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifdef __AVX__
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/tools/CPUFeatures.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalModMaskStreaming/OperationMultiEvalModMaskStreaming.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreaming/OperationMultiEvalStreaming.hpp>
+
+#include <memory>
+#include <random>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::base::OperationMultipleEval;
+
+namespace {
+// compares mult and multTranspose of the given streaming operation with the naive operation
+void compareWithNaive(Grid& grid, DataMatrix& dataset, OperationMultipleEval& streamingOp) {
+  std::unique_ptr<OperationMultipleEval> naiveOp(
+      sgpp::op_factory::createOperationMultipleEval(grid, dataset));
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+
+  DataVector alpha(grid.getSize());
+  for (size_t i = 0; i < alpha.getSize(); i++) {
+    alpha[i] = distribution(generator);
+  }
+
+  DataVector result(dataset.getNrows());
+  DataVector resultNaive(dataset.getNrows());
+  streamingOp.mult(alpha, result);
+  naiveOp->mult(alpha, resultNaive);
+
+  for (size_t i = 0; i < result.getSize(); i++) {
+    BOOST_CHECK_CLOSE(result[i], resultNaive[i], 1e-9);
+  }
+
+  DataVector source(dataset.getNrows());
+  for (size_t i = 0; i < source.getSize(); i++) {
+    source[i] = distribution(generator);
+  }
+
+  DataVector resultTranspose(grid.getSize());
+  DataVector resultTransposeNaive(grid.getSize());
+  streamingOp.multTranspose(source, resultTranspose);
+  naiveOp->multTranspose(source, resultTransposeNaive);
+
+  for (size_t i = 0; i < resultTranspose.getSize(); i++) {
+    BOOST_CHECK_CLOSE(resultTranspose[i], resultTransposeNaive[i], 1e-9);
+  }
+}
+
+DataMatrix createDataset(size_t numberOfPoints, size_t dim) {
+  std::mt19937 generator(7);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  DataMatrix dataset(numberOfPoints, dim);
+
+  for (size_t i = 0; i < dataset.getSize(); i++) {
+    dataset[i] = distribution(generator);
+  }
+
+  return dataset;
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestStreamingAVX512)
+
+BOOST_AUTO_TEST_CASE(Linear) {
+  if (!sgpp::base::CPUFeatures::hasAVX512F()) {
+    BOOST_TEST_MESSAGE("CPU does not support AVX-512, test skipped");
+    return;
+  }
+
+  // the number of points is not a multiple of the padding
+  DataMatrix dataset = createDataset(1001, 4);
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(4));
+  grid->getGenerator().regular(5);
+
+  sgpp::datadriven::OperationMultiEvalStreaming streamingOp(*grid, dataset);
+#if defined(SGPP_CPU_DISPATCH) && !defined(__AVX512F__) && !defined(__MIC__)
+  BOOST_CHECK(streamingOp.usesAVX512Kernels());
+#endif
+  compareWithNaive(*grid, dataset, streamingOp);
+}
+
+BOOST_AUTO_TEST_CASE(ModLinear) {
+  if (!sgpp::base::CPUFeatures::hasAVX512F()) {
+    BOOST_TEST_MESSAGE("CPU does not support AVX-512, test skipped");
+    return;
+  }
+
+  DataMatrix dataset = createDataset(1001, 4);
+  std::unique_ptr<Grid> grid(Grid::createModLinearGrid(4));
+  grid->getGenerator().regular(5);
+
+  sgpp::datadriven::OperationMultiEvalModMaskStreaming streamingOp(*grid, dataset);
+#if defined(SGPP_CPU_DISPATCH) && !defined(__AVX512F__) && !defined(__MIC__)
+  BOOST_CHECK(streamingOp.usesAVX512Kernels());
+#endif
+  compareWithNaive(*grid, dataset, streamingOp);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
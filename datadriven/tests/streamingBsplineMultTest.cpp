@@ -0,0 +1,155 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/tools/CPUFeatures.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalBsplineStreaming/OperationMultiEvalBsplineStreaming.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::base::OperationMultipleEval;
+using sgpp::datadriven::OperationMultiEvalBsplineStreaming;
+
+namespace TestStreamingBsplineMultFixture {
+struct GridsAndDataFixture {
+  GridsAndDataFixture() : dataset(numberOfDataPoints, dim) {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+    for (size_t i = 0; i < dataset.getSize(); i++) {
+      dataset[i] = distribution(generator);
+    }
+
+    for (size_t degree : {1, 3, 5}) {
+      grids.push_back(std::unique_ptr<Grid>(Grid::createBsplineGrid(dim, degree)));
+      grids.push_back(std::unique_ptr<Grid>(Grid::createModBsplineGrid(dim, degree)));
+      grids.push_back(std::unique_ptr<Grid>(Grid::createBsplineBoundaryGrid(dim, degree)));
+    }
+
+    for (auto& grid : grids) {
+      grid->getGenerator().regular(level);
+    }
+
+    kernelTypes.push_back(OperationMultiEvalBsplineStreaming::KernelType::SCALAR);
+
+    if (sgpp::base::CPUFeatures::hasAVX2()) {
+      kernelTypes.push_back(OperationMultiEvalBsplineStreaming::KernelType::AVX2);
+    }
+
+    if (sgpp::base::CPUFeatures::hasAVX512F()) {
+      kernelTypes.push_back(OperationMultiEvalBsplineStreaming::KernelType::AVX512);
+    }
+  }
+
+  ~GridsAndDataFixture() {}
+
+  size_t dim = 3;
+  size_t level = 4;
+  // not a multiple of the chunk size to test the padding
+  size_t numberOfDataPoints = 203;
+  DataMatrix dataset;
+  std::vector<std::unique_ptr<Grid>> grids;
+  std::vector<OperationMultiEvalBsplineStreaming::KernelType> kernelTypes;
+};
+}  // namespace TestStreamingBsplineMultFixture
+
+BOOST_FIXTURE_TEST_SUITE(TestStreamingBsplineMult,
+                         TestStreamingBsplineMultFixture::GridsAndDataFixture)
+
+BOOST_AUTO_TEST_CASE(Mult) {
+  for (auto& grid : grids) {
+    DataVector alpha(grid->getSize());
+
+    for (size_t i = 0; i < alpha.getSize(); i++) {
+      alpha[i] = static_cast<double>(i % 7) - 3.0;
+    }
+
+    std::unique_ptr<OperationMultipleEval> opNaive(
+        sgpp::op_factory::createOperationMultipleEvalNaive(*grid, dataset));
+    DataVector resultNaive(numberOfDataPoints);
+    opNaive->mult(alpha, resultNaive);
+
+    OperationMultiEvalBsplineStreaming op(*grid, dataset);
+
+    for (auto kernelType : kernelTypes) {
+      op.setKernelType(kernelType);
+      DataVector result(numberOfDataPoints);
+      op.mult(alpha, result);
+
+      BOOST_CHECK_EQUAL(result.getSize(), numberOfDataPoints);
+
+      for (size_t i = 0; i < numberOfDataPoints; i++) {
+        BOOST_CHECK_SMALL(result[i] - resultNaive[i], 1e-10);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(MultTranspose) {
+  DataVector source(numberOfDataPoints);
+
+  for (size_t i = 0; i < numberOfDataPoints; i++) {
+    source[i] = static_cast<double>(i % 5) - 2.0;
+  }
+
+  for (auto& grid : grids) {
+    std::unique_ptr<OperationMultipleEval> opNaive(
+        sgpp::op_factory::createOperationMultipleEvalNaive(*grid, dataset));
+    DataVector resultNaive(grid->getSize());
+    opNaive->multTranspose(source, resultNaive);
+
+    OperationMultiEvalBsplineStreaming op(*grid, dataset);
+
+    for (auto kernelType : kernelTypes) {
+      op.setKernelType(kernelType);
+      DataVector result(grid->getSize());
+      op.multTranspose(source, result);
+
+      for (size_t i = 0; i < grid->getSize(); i++) {
+        BOOST_CHECK_SMALL(result[i] - resultNaive[i], 1e-10);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(PrepareAfterRefinement) {
+  auto& grid = grids[1];
+  OperationMultiEvalBsplineStreaming op(*grid, dataset);
+
+  // the operation is created before the grid changes, as in the learners
+  DataVector alpha(grid->getSize(), 1.0);
+  sgpp::base::SurplusRefinementFunctor functor(alpha, 10);
+  grid->getGenerator().refine(functor);
+  op.prepare();
+
+  alpha.resize(grid->getSize());
+  alpha.setAll(1.0);
+  std::unique_ptr<OperationMultipleEval> opNaive(
+      sgpp::op_factory::createOperationMultipleEvalNaive(*grid, dataset));
+  DataVector resultNaive(numberOfDataPoints);
+  DataVector result(numberOfDataPoints);
+  opNaive->mult(alpha, resultNaive);
+  op.mult(alpha, result);
+
+  for (size_t i = 0; i < numberOfDataPoints; i++) {
+    BOOST_CHECK_SMALL(result[i] - resultNaive[i], 1e-10);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
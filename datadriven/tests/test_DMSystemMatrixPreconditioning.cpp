@@ -0,0 +1,150 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/datadriven/algorithm/DMSystemMatrix.hpp>
+#include <sgpp/datadriven/datamining/configuration/SLESolverTypeParser.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+#include <sgpp/solver/sle/PipelinedConjugateGradients.hpp>
+#include <sgpp/solver/sle/PreconditionedConjugateGradients.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::datadriven::DMSystemMatrix;
+using sgpp::datadriven::DMSystemMatrixBase;
+using sgpp::datadriven::SLESolverTypeParser;
+using sgpp::solver::ConjugateGradients;
+using sgpp::solver::PipelinedConjugateGradients;
+using sgpp::solver::PreconditionedConjugateGradients;
+using sgpp::solver::SLESolverType;
+
+namespace {
+
+/**
+ * Diagonal system matrix that counts its multiplications.
+ */
+class CountingSystemMatrix : public DMSystemMatrixBase {
+ public:
+  explicit CountingSystemMatrix(DataMatrix& data) : DMSystemMatrixBase(data, 0.0), numMults(0) {}
+
+  void mult(DataVector& alpha, DataVector& result) override {
+    numMults++;
+
+    for (size_t i = 0; i < alpha.getSize(); i++) {
+      result[i] = static_cast<double>(i + 1) * alpha[i];
+    }
+  }
+
+  void generateb(DataVector& classes, DataVector& b) override { b.setAll(1.0); }
+
+  size_t numMults;
+};
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestDMSystemMatrixPreconditioning)
+
+BOOST_AUTO_TEST_CASE(testParseSolverTypes) {
+  BOOST_CHECK(SLESolverTypeParser::parse("PCG") == SLESolverType::PCG);
+  BOOST_CHECK(SLESolverTypeParser::parse("pipelinedcg") == SLESolverType::PipelinedCG);
+  BOOST_CHECK_EQUAL(SLESolverTypeParser::toString(SLESolverType::PipelinedCG), "PipelinedCG");
+}
+
+BOOST_AUTO_TEST_CASE(testPreconditionedSolvers) {
+  std::unique_ptr<Grid> grid(Grid::createModLinearGrid(2));
+  grid->getGenerator().regular(5);
+  const size_t n = grid->getSize();
+
+  // clustered data, so that the diagonal of B^T B varies strongly
+  DataMatrix data(1000, 2);
+  DataVector targets(data.getNrows());
+  std::mt19937 generator(42);
+  std::normal_distribution<double> distribution(0.3, 0.1);
+
+  for (size_t i = 0; i < data.getNrows(); i++) {
+    for (size_t d = 0; d < 2; d++) {
+      data.set(i, d, std::min(std::max(distribution(generator), 0.0), 1.0));
+    }
+
+    targets[i] = data.get(i, 0) * data.get(i, 1);
+  }
+
+  DMSystemMatrix systemMatrix(
+      *grid, data,
+      std::shared_ptr<sgpp::base::OperationMatrix>(sgpp::op_factory::createOperationIdentity(*grid)),
+      1e-6);
+  DataVector b(n);
+  systemMatrix.generateb(targets, b);
+
+  DataVector alphaCG(n);
+  ConjugateGradients cg(5000, 1e-10);
+  // solvers without preconditioner are left unchanged
+  systemMatrix.preconditionSolver(cg, grid->getStorage());
+  cg.solve(systemMatrix, alphaCG, b);
+
+  DataVector alphaPCG(n);
+  PreconditionedConjugateGradients pcg(5000, 1e-10);
+  systemMatrix.preconditionSolver(pcg, grid->getStorage());
+  pcg.solve(systemMatrix, alphaPCG, b);
+  BOOST_CHECK_LT(pcg.getNumberIterations(), cg.getNumberIterations());
+
+  DataVector alphaPipelined(n);
+  PipelinedConjugateGradients pipelined(5000, 1e-10);
+  systemMatrix.preconditionSolver(pipelined, grid->getStorage());
+  pipelined.solve(systemMatrix, alphaPipelined, b);
+  // the rounding errors of the pipelined recurrences cost some additional iterations
+  BOOST_CHECK_LT(pipelined.getNumberIterations(), 3 * pcg.getNumberIterations() / 2);
+
+  for (size_t i = 0; i < n; i++) {
+    BOOST_CHECK_SMALL(alphaPCG[i] - alphaCG[i], 1e-4);
+    BOOST_CHECK_SMALL(alphaPipelined[i] - alphaCG[i], 1e-4);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testPreconditionerReuse) {
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(2));
+  grid->getGenerator().regular(3);
+  DataMatrix data(1, 2);
+  CountingSystemMatrix systemMatrix(data);
+  PreconditionedConjugateGradients pcg(100, 1e-10);
+
+  systemMatrix.preconditionSolver(pcg, grid->getStorage());
+  const size_t numProbes = systemMatrix.numMults;
+  BOOST_CHECK_GT(numProbes, 0U);
+
+  // the grid is unchanged, so the preconditioner is reused
+  systemMatrix.preconditionSolver(pcg, grid->getStorage());
+  BOOST_CHECK_EQUAL(systemMatrix.numMults, numProbes);
+
+  // after a refinement, the diagonal is probed again
+  DataVector alpha(grid->getSize(), 1.0);
+  sgpp::base::SurplusRefinementFunctor functor(alpha, 1);
+  grid->getGenerator().refine(functor);
+  systemMatrix.preconditionSolver(pcg, grid->getStorage());
+  BOOST_CHECK_GT(systemMatrix.numMults, numProbes);
+
+  // the preconditioned solver solves the diagonal system
+  DataVector b(grid->getSize(), 1.0);
+  DataVector x(grid->getSize());
+  pcg.solve(systemMatrix, x, b);
+
+  for (size_t i = 0; i < x.getSize(); i++) {
+    BOOST_CHECK_CLOSE(x[i], 1.0 / static_cast<double>(i + 1), 1e-8);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,211 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/ArffFileSampleProvider.hpp>
+#include <sgpp/datadriven/tools/ARFFTools.hpp>
+#include <sgpp/datadriven/tools/CSVTools.hpp>
+#include <sgpp/datadriven/tools/DataFileReader.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using sgpp::datadriven::ArffFileSampleProvider;
+using sgpp::datadriven::ARFFTools;
+using sgpp::datadriven::CSVTools;
+using sgpp::datadriven::DataFileReader;
+using sgpp::datadriven::Dataset;
+
+namespace {
+
+/**
+ * Writes a CSV file with a header line, four columns of mixed precision and integer targets.
+ */
+void writeCSVFile(const std::string& filename, size_t numberInstances) {
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+  std::ofstream file(filename);
+  file << "x0,x1,x2,x3,class\n";
+
+  for (size_t i = 0; i < numberInstances; i++) {
+    file << std::setprecision(6) << distribution(generator) << ","
+         << std::setprecision(17) << distribution(generator) << ","
+         << std::scientific << std::setprecision(3) << 1e5 * distribution(generator) << ","
+         << std::defaultfloat << std::setprecision(4) << distribution(generator) << ","
+         << (i % 3);
+    // mix line endings and add some empty lines
+    file << ((i % 7 == 0) ? "\r\n" : "\n") << ((i % 101 == 0) ? "\n" : "");
+  }
+}
+
+void checkEqualDatasets(const Dataset& dataset, const Dataset& other) {
+  BOOST_REQUIRE_EQUAL(dataset.getNumberInstances(), other.getNumberInstances());
+  BOOST_REQUIRE_EQUAL(dataset.getDimension(), other.getDimension());
+
+  for (size_t i = 0; i < dataset.getNumberInstances(); i++) {
+    for (size_t d = 0; d < dataset.getDimension(); d++) {
+      BOOST_CHECK_EQUAL(dataset.getData().get(i, d), other.getData().get(i, d));
+    }
+
+    BOOST_CHECK_EQUAL(dataset.getTargets().get(i), other.getTargets().get(i));
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestDataFileReader)
+
+BOOST_AUTO_TEST_CASE(testParseDouble) {
+  const std::vector<std::string> inputs = {
+      "0",       "-0.5",     "  3.25",  "+17",          "1e5",       "1.5E-3", ".5",
+      "-.125e2", "123456789012345678901234", "0.1000000000000000055511151231257827",
+      "2.2250738585072014e-308", "1.7976931348623157e308", "4.9e-324", "1e400", "1e-400",
+      "12abc",   "",         "abc",     "1e",           "0.000000000000000000000000123"};
+
+  for (const std::string& input : inputs) {
+    const double expected = std::atof(input.c_str());
+    const double value = DataFileReader::parseDouble(input.data(), input.data() + input.size());
+    BOOST_CHECK_EQUAL(value, expected);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testReadCSV) {
+  const std::string filename = "test_DataFileReader.csv";
+  writeCSVFile(filename, 20000);
+
+  std::ifstream stream(filename);
+  Dataset expected = CSVTools::readCSV(stream, true);
+
+  DataFileReader reader(filename, DataFileReader::Format::CSV, true);
+  BOOST_CHECK_EQUAL(reader.getDimension(), 4);
+  BOOST_CHECK_EQUAL(reader.getNumberInstances(), 20000);
+  checkEqualDatasets(reader.read(), expected);
+  checkEqualDatasets(CSVTools::readCSVFromFile(filename, true), expected);
+
+  // cutoff, column and target selection
+  const std::vector<size_t> selectedCols = {3, 0, 2};
+  const std::vector<double> selectedTargets = {0.0, 2.0};
+  stream.clear();
+  stream.seekg(0, std::ios::beg);
+  expected = CSVTools::readCSV(stream, true, true, 5000, selectedCols, selectedTargets);
+
+  DataFileReader selectingReader(filename, DataFileReader::Format::CSV, true, true, 5000,
+                                 selectedCols, selectedTargets);
+  BOOST_CHECK_EQUAL(selectingReader.getDimension(), 3);
+  BOOST_CHECK_EQUAL(selectingReader.getNumberInstances(), 5000);
+  checkEqualDatasets(selectingReader.read(), expected);
+
+  // without targets
+  stream.clear();
+  stream.seekg(0, std::ios::beg);
+  expected = CSVTools::readCSV(stream, true, false);
+  checkEqualDatasets(DataFileReader(filename, DataFileReader::Format::CSV, true, false).read(),
+                     expected);
+
+  BOOST_CHECK_THROW(DataFileReader(filename, DataFileReader::Format::CSV, true, true, -1,
+                                   std::vector<size_t>{4}),
+                    sgpp::base::file_exception);
+  stream.close();
+  std::remove(filename.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(testReadNext) {
+  const std::string filename = "test_DataFileReader_stream.csv";
+  writeCSVFile(filename, 3000);
+
+  DataFileReader reader(filename, DataFileReader::Format::CSV, true, true, 2500,
+                        std::vector<size_t>(), std::vector<double>{1.0, 2.0});
+  Dataset expected = reader.read();
+  BOOST_CHECK_EQUAL(expected.getNumberInstances(), 2000);
+
+  for (size_t epoch = 0; epoch < 2; epoch++) {
+    size_t row = 0;
+
+    while (!reader.isAtEnd()) {
+      std::unique_ptr<Dataset> batch(reader.readNext(333));
+      BOOST_REQUIRE(batch->getNumberInstances() > 0);
+      BOOST_REQUIRE(row + batch->getNumberInstances() <= expected.getNumberInstances());
+
+      for (size_t i = 0; i < batch->getNumberInstances(); i++, row++) {
+        for (size_t d = 0; d < batch->getDimension(); d++) {
+          BOOST_CHECK_EQUAL(batch->getData().get(i, d), expected.getData().get(row, d));
+        }
+
+        BOOST_CHECK_EQUAL(batch->getTargets().get(i), expected.getTargets().get(row));
+      }
+    }
+
+    BOOST_CHECK_EQUAL(row, expected.getNumberInstances());
+    std::unique_ptr<Dataset> empty(reader.readNext(10));
+    BOOST_CHECK_EQUAL(empty->getNumberInstances(), 0);
+    reader.reset();
+  }
+
+  std::remove(filename.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(testMissingColumns) {
+  const std::string filename = "test_DataFileReader_invalid.csv";
+
+  {
+    std::ofstream file(filename);
+    file << "0.1,0.2,1\n0.3,0.4,0\n0.5,1\n";
+  }
+
+  DataFileReader reader(filename, DataFileReader::Format::CSV);
+  BOOST_CHECK_THROW(reader.read(), sgpp::base::file_exception);
+  BOOST_CHECK_THROW(reader.getNumberInstances(), sgpp::base::file_exception);
+  std::unique_ptr<Dataset> batch(reader.readNext(2));
+  BOOST_CHECK_EQUAL(batch->getNumberInstances(), 2);
+  BOOST_CHECK_THROW(reader.readNext(1), sgpp::base::file_exception);
+  std::remove(filename.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(testARFFStreaming) {
+  const std::string filename = "datadriven/datasets/liver/liver-disorders_normalized_small.arff";
+
+  std::ifstream stream(filename);
+  Dataset expected = ARFFTools::readARFF(stream);
+  checkEqualDatasets(DataFileReader(filename, DataFileReader::Format::ARFF).read(), expected);
+
+  ArffFileSampleProvider sampleProvider;
+  sampleProvider.openFile(filename, true);
+  BOOST_CHECK_EQUAL(sampleProvider.getNumSamples(), expected.getNumberInstances());
+  BOOST_CHECK_EQUAL(sampleProvider.getDim(), expected.getDimension());
+
+  std::unique_ptr<Dataset> first(sampleProvider.getNextSamples(7));
+  std::unique_ptr<ArffFileSampleProvider> clone(
+      dynamic_cast<ArffFileSampleProvider*>(sampleProvider.clone()));
+  std::unique_ptr<Dataset> second(sampleProvider.getNextSamples(7));
+  std::unique_ptr<Dataset> cloneSecond(clone->getNextSamples(7));
+  BOOST_CHECK_EQUAL(first->getNumberInstances(), 7);
+  BOOST_CHECK_EQUAL(second->getNumberInstances(), expected.getNumberInstances() - 7);
+  checkEqualDatasets(*second, *cloneSecond);
+
+  for (size_t i = 0; i < expected.getNumberInstances(); i++) {
+    const Dataset& batch = (i < 7) ? *first : *second;
+    const size_t row = (i < 7) ? i : i - 7;
+    BOOST_CHECK_EQUAL(batch.getData().get(row, 0), expected.getData().get(i, 0));
+    BOOST_CHECK_EQUAL(batch.getTargets().get(row), expected.getTargets().get(i));
+  }
+
+  sampleProvider.reset();
+  std::unique_ptr<Dataset> all(sampleProvider.getAllSamples());
+  checkEqualDatasets(*all, expected);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,129 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/application_exception.hpp>
+#include <sgpp/datadriven/application/KernelDensityEstimator.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <cmath>
+#include <random>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::datadriven::KernelDensityEstimator;
+using sgpp::datadriven::KernelType;
+
+namespace {
+
+void randn(DataMatrix& m, std::uint64_t seed) {
+  std::mt19937 generator(seed);
+  std::normal_distribution<double> distribution(0.0, 1.0);
+
+  for (size_t i = 0; i < m.getSize(); i++) {
+    m[i] = distribution(generator);
+  }
+}
+
+/// straightforward evaluation of the kernel density estimator as reference
+double pdfReference(KernelDensityEstimator& kde, DataMatrix& samples, DataVector& x) {
+  DataVector bandwidths;
+  kde.getBandwidths(bandwidths);
+  double res = 0.0;
+
+  for (size_t i = 0; i < samples.getNrows(); i++) {
+    double value = 1.0;
+
+    for (size_t idim = 0; idim < samples.getNcols(); idim++) {
+      value *= kde.getKernel().norm() / bandwidths[idim] *
+               kde.getKernel().eval((x[idim] - samples.get(i, idim)) / bandwidths[idim]);
+    }
+
+    res += value;
+  }
+
+  return res / static_cast<double>(samples.getNrows());
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestKernelDensityEstimator)
+
+BOOST_AUTO_TEST_CASE(testBatchedPdf) {
+  size_t numDims = 3;
+  DataMatrix samples(1000, numDims);
+  DataMatrix points(301, numDims);
+  randn(samples, 1);
+  randn(points, 2);
+
+  for (KernelType kernelType : {KernelType::GAUSSIAN, KernelType::EPANECHNIKOV}) {
+    KernelDensityEstimator kde(samples, kernelType);
+    DataVector res;
+    kde.pdf(points, res);
+
+    BOOST_CHECK_EQUAL(res.getSize(), points.getNrows());
+    DataVector x(numDims);
+
+    for (size_t i = 0; i < points.getNrows(); i++) {
+      points.getRow(i, x);
+      double reference = pdfReference(kde, samples, x);
+      BOOST_CHECK_SMALL(res[i] - reference, 1e-12);
+      BOOST_CHECK_SMALL(kde.pdf(x) - reference, 1e-12);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testApproximatePdf) {
+  size_t numDims = 2;
+  DataMatrix samples(5000, numDims);
+  DataMatrix points(200, numDims);
+  randn(samples, 3);
+  randn(points, 4);
+
+  for (KernelType kernelType : {KernelType::GAUSSIAN, KernelType::EPANECHNIKOV}) {
+    KernelDensityEstimator kde(samples, kernelType);
+    DataVector exact;
+    kde.pdf(points, exact);
+
+    // the error is bounded by the tolerance times the peak of a single kernel
+    double tolerance = 1e-6;
+    DataVector bandwidths;
+    kde.getBandwidths(bandwidths);
+    double kernelPeak = 1.0;
+
+    for (size_t idim = 0; idim < numDims; idim++) {
+      kernelPeak *= kde.getKernel().norm() / bandwidths[idim];
+    }
+
+    kde.setApproximationTolerance(tolerance);
+    DataVector approximate;
+    kde.pdf(points, approximate);
+
+    for (size_t i = 0; i < points.getNrows(); i++) {
+      BOOST_CHECK_SMALL(approximate[i] - exact[i], tolerance * kernelPeak);
+    }
+
+    // the tree has to be rebuilt after changing the bandwidths
+    bandwidths.mult(2.0);
+    kde.setBandwidths(bandwidths);
+    kernelPeak /= std::pow(2.0, static_cast<double>(numDims));
+    kde.pdf(points, approximate);
+    kde.setApproximationTolerance(0.0);
+    kde.pdf(points, exact);
+
+    for (size_t i = 0; i < points.getNrows(); i++) {
+      BOOST_CHECK_SMALL(approximate[i] - exact[i], tolerance * kernelPeak);
+    }
+  }
+
+  KernelDensityEstimator kde(samples);
+  BOOST_CHECK_THROW(kde.setApproximationTolerance(1.0), sgpp::base::application_exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -77,6 +77,8 @@ const bool UMFPACK_ENABLED;
 %rename(OptIterativeGridGeneratorRitterNovak)   sgpp::optimization::IterativeGridGeneratorRitterNovak;
 %rename(OptIterativeGridGeneratorSOO)           sgpp::optimization::IterativeGridGeneratorSOO;
 
+%rename(OptIncrementalHierarchisation) sgpp::optimization::IncrementalHierarchisation;
+
 %rename(OptSLE)                     sgpp::optimization::SLE;
 %rename(OptFullSLE)                 sgpp::optimization::FullSLE;
 %rename(OptHierarchisationSLE)      sgpp::optimization::HierarchisationSLE;
@@ -87,6 +89,7 @@ const bool UMFPACK_ENABLED;
 %rename(OptEigen)                   sgpp::optimization::sle_solver::Eigen;
 %rename(OptGaussianElimination)     sgpp::optimization::sle_solver::GaussianElimination;
 %rename(OptGmmpp)                   sgpp::optimization::sle_solver::Gmmpp;
+%rename(OptGMRES)                   sgpp::optimization::sle_solver::GMRES;
 %rename(OptUMFPACK)                 sgpp::optimization::sle_solver::UMFPACK;
 
 %rename(OptUnconstrainedOptimizer)  sgpp::optimization::optimizer::UnconstrainedOptimizer;
@@ -352,6 +355,7 @@ const bool UMFPACK_ENABLED;
 %include "optimization/src/sgpp/optimization/gridgen/IterativeGridGeneratorSOO.hpp"
 
 %include "optimization/src/sgpp/optimization/operation/hash/OperationMultipleHierarchisation.hpp"
+%include "optimization/src/sgpp/optimization/operation/hash/IncrementalHierarchisation.hpp"
 
 %include "optimization/src/sgpp/optimization/sle/system/SLE.hpp"
 %include "optimization/src/sgpp/optimization/sle/system/CloneableSLE.hpp"
@@ -365,6 +369,7 @@ const bool UMFPACK_ENABLED;
 %include "optimization/src/sgpp/optimization/sle/solver/Eigen.hpp"
 %include "optimization/src/sgpp/optimization/sle/solver/GaussianElimination.hpp"
 %include "optimization/src/sgpp/optimization/sle/solver/Gmmpp.hpp"
+%include "optimization/src/sgpp/optimization/sle/solver/GMRES.hpp"
 %include "optimization/src/sgpp/optimization/sle/solver/UMFPACK.hpp"
 
 %include "optimization/src/sgpp/optimization/optimizer/unconstrained/UnconstrainedOptimizer.hpp"
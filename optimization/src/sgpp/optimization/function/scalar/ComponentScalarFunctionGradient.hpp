@@ -25,6 +25,8 @@ namespace optimization {
  */
 class ComponentScalarFunctionGradient : public ScalarFunctionGradient {
  public:
+  using ScalarFunctionGradient::eval;
+
   /**
    * Constructor.
    *
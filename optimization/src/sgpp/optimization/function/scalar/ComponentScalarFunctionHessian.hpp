@@ -25,6 +25,8 @@ namespace optimization {
  */
 class ComponentScalarFunctionHessian : public ScalarFunctionHessian {
  public:
+  using ScalarFunctionHessian::eval;
+
   /**
    * Constructor.
    *
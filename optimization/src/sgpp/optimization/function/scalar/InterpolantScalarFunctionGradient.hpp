@@ -61,6 +61,29 @@ class InterpolantScalarFunctionGradient : public ScalarFunctionGradient {
     return opEvalGradient->evalGradient(alpha, x, gradient);
   }
 
+  /**
+   * Evaluation of the function and its gradient at multiple points.
+   * Points outside of \f$[0, 1]^d\f$ get the value \f$\infty\f$.
+   *
+   * @param      x        evaluation points \f$\vec{x}_j \in [0, 1]^d\f$ (one per row)
+   * @param[out] value    function values \f$f(\vec{x}_j)\f$
+   * @param[out] gradient gradients \f$\nabla f(\vec{x}_j) \in \mathbb{R}^d\f$
+   *                      (one per row)
+   */
+  void eval(const base::DataMatrix& x, base::DataVector& value,
+            base::DataMatrix& gradient) override {
+    opEvalGradient->evalGradient(alpha, x, value, gradient);
+
+    for (size_t j = 0; j < x.getNrows(); j++) {
+      for (size_t t = 0; t < d; t++) {
+        if ((x(j, t) < 0.0) || (x(j, t) > 1.0)) {
+          value[j] = INFINITY;
+          break;
+        }
+      }
+    }
+  }
+
   /**
    * @param[out] clone pointer to cloned object
    */
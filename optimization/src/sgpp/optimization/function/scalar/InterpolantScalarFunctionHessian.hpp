@@ -15,6 +15,8 @@
 #include <sgpp/optimization/function/scalar/ScalarFunctionHessian.hpp>
 #include <sgpp/base/operation/hash/OperationEvalHessian.hpp>
 
+#include <vector>
+
 namespace sgpp {
 namespace optimization {
 
@@ -65,6 +67,31 @@ class InterpolantScalarFunctionHessian : public ScalarFunctionHessian {
     return opEvalHessian->evalHessian(alpha, x, gradient, hessian);
   }
 
+  /**
+   * Evaluation of the function, its gradient and its Hessian at multiple points.
+   * Points outside of \f$[0, 1]^d\f$ get the value \f$\infty\f$.
+   *
+   * @param      x        evaluation points \f$\vec{x}_j \in [0, 1]^d\f$ (one per row)
+   * @param[out] value    function values \f$f(\vec{x}_j)\f$
+   * @param[out] gradient gradients \f$\nabla f(\vec{x}_j) \in \mathbb{R}^d\f$
+   *                      (one per row)
+   * @param[out] hessian  Hessian matrices
+   *                      \f$H_f(\vec{x}_j) \in \mathbb{R}^{d \times d}\f$
+   */
+  void eval(const base::DataMatrix& x, base::DataVector& value, base::DataMatrix& gradient,
+            std::vector<base::DataMatrix>& hessian) override {
+    opEvalHessian->evalHessian(alpha, x, value, gradient, hessian);
+
+    for (size_t j = 0; j < x.getNrows(); j++) {
+      for (size_t t = 0; t < d; t++) {
+        if ((x(j, t) < 0.0) || (x(j, t) > 1.0)) {
+          value[j] = INFINITY;
+          break;
+        }
+      }
+    }
+  }
+
   /**
    * @param[out] clone pointer to cloned object
    */
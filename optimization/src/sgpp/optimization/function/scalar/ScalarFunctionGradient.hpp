@@ -8,6 +8,7 @@
 
 #include <sgpp/globaldef.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 
 #include <cstddef>
 #include <memory>
@@ -47,6 +48,32 @@ class ScalarFunctionGradient {
    */
   virtual double eval(const base::DataVector& x, base::DataVector& gradient) = 0;
 
+  /**
+   * Calculates \f$f(\vec{x}_j)\f$ together with \f$\nabla f(\vec{x}_j)\f$
+   * for multiple points \f$\vec{x}_j\f$ at once.
+   * The default implementation calls eval() for every point.
+   *
+   * @param      x          evaluation points \f$\vec{x}_j \in [0, 1]^d\f$ (one per row)
+   * @param[out] value      function values \f$f(\vec{x}_j)\f$
+   * @param[out] gradient   gradients \f$\nabla f(\vec{x}_j) \in \mathbb{R}^d\f$
+   *                        (one per row)
+   */
+  virtual void eval(const base::DataMatrix& x, base::DataVector& value,
+                    base::DataMatrix& gradient) {
+    const size_t m = x.getNrows();
+    base::DataVector curX(d);
+    base::DataVector curGradient(d);
+
+    value.resize(m);
+    gradient.resize(m, d);
+
+    for (size_t j = 0; j < m; j++) {
+      x.getRow(j, curX);
+      value[j] = eval(curX, curGradient);
+      gradient.setRow(j, curGradient);
+    }
+  }
+
   /**
    * @return dimension \f$d\f$ of the domain
    */
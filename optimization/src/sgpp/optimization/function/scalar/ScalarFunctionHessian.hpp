@@ -55,6 +55,35 @@ class ScalarFunctionHessian {
   virtual double eval(const base::DataVector& x, base::DataVector& gradient,
                        base::DataMatrix& hessian) = 0;
 
+  /**
+   * Calculates \f$f(\vec{x}_j)\f$ together with \f$\nabla f(\vec{x}_j)\f$ and
+   * \f$H_f(\vec{x}_j)\f$ for multiple points \f$\vec{x}_j\f$ at once.
+   * The default implementation calls eval() for every point.
+   *
+   * @param      x          evaluation points \f$\vec{x}_j \in [0, 1]^d\f$ (one per row)
+   * @param[out] value      function values \f$f(\vec{x}_j)\f$
+   * @param[out] gradient   gradients \f$\nabla f(\vec{x}_j) \in \mathbb{R}^d\f$
+   *                        (one per row)
+   * @param[out] hessian    Hessian matrices
+   *                        \f$H_f(\vec{x}_j) \in \mathbb{R}^{d \times d}\f$
+   */
+  virtual void eval(const base::DataMatrix& x, base::DataVector& value,
+                    base::DataMatrix& gradient, std::vector<base::DataMatrix>& hessian) {
+    const size_t m = x.getNrows();
+    base::DataVector curX(d);
+    base::DataVector curGradient(d);
+
+    value.resize(m);
+    gradient.resize(m, d);
+    hessian.resize(m);
+
+    for (size_t j = 0; j < m; j++) {
+      x.getRow(j, curX);
+      value[j] = eval(curX, curGradient, hessian[j]);
+      gradient.setRow(j, curGradient);
+    }
+  }
+
   /**
    * @return dimension \f$d\f$ of the domain
    */
@@ -22,6 +22,8 @@ namespace optimization {
  */
 class WrapperScalarFunctionGradient : public ScalarFunctionGradient {
  public:
+  using ScalarFunctionGradient::eval;
+
   typedef std::function<double(const base::DataVector&, base::DataVector&)>
       FunctionGradientEvalType;
 
@@ -22,6 +22,8 @@ namespace optimization {
  */
 class WrapperScalarFunctionHessian : public ScalarFunctionHessian {
  public:
+  using ScalarFunctionHessian::eval;
+
   typedef std::function<double(const base::DataVector&, base::DataVector&, base::DataMatrix&)>
       FunctionHessianEvalType;
 
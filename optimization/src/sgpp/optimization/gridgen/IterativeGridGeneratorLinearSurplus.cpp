@@ -17,6 +17,7 @@
 #include <sgpp/base/grid/type/ModBsplineClenshawCurtisGrid.hpp>
 #include <sgpp/base/grid/type/LinearClenshawCurtisBoundaryGrid.hpp>
 
+#include <sgpp/optimization/operation/hash/IncrementalHierarchisation.hpp>
 #include <sgpp/optimization/sle/system/HierarchisationSLE.hpp>
 #include <sgpp/optimization/sle/solver/BiCGStab.hpp>
 
@@ -24,6 +25,7 @@
 #include <stdexcept>
 #include <algorithm>
 #include <string>
+#include <vector>
 
 namespace sgpp {
 namespace optimization {
@@ -102,6 +104,9 @@ bool IterativeGridGeneratorLinearSurplus::generate() {
   // The right-hand side of the system does only matter for the
   // first purpose.
   HierarchisationSLE hierSLE(*linearGrid, gridStorage);
+  // incremental update of the coefficients after each refinement
+  // (only the hierarchical ancestors of the new points are considered)
+  IncrementalHierarchisation incrementalHierarchisation(*linearGrid, gridStorage);
 
   // generate initial grid
   grid.getGenerator().regular(initialLevel);
@@ -199,13 +204,43 @@ bool IterativeGridGeneratorLinearSurplus::generate() {
     // evaluation of f in the new grid points
     evalFunction(currentN);
 
-    // forward substitution
-    // (hierSLE should always be a lower triangular matrix)
-    for (size_t i = currentN; i < newN; i++) {
-      coeffs[i] = fX[i];
+    if (incrementalHierarchisation.isSupported()) {
+      // incremental hierarchization (no linear solver, as the basis functions
+      // of the new points vanish at the old points)
+      base::DataVector fXCutoff(fX.getPointer(), newN);
+      std::vector<size_t> newPoints(newN - currentN);
 
-      for (size_t j = 0; j < i; j++) {
-        coeffs[i] -= hierSLE.getMatrixEntry(i, j) * coeffs[j];
+      for (size_t i = currentN; i < newN; i++) {
+        newPoints[i - currentN] = i;
+      }
+
+      Printer::getInstance().disableStatusPrinting();
+      bool updated = incrementalHierarchisation.update(coeffs, fXCutoff, newPoints);
+
+      if (!updated) {
+        // fall back to a full hierarchization
+        sle_solver::BiCGStab sleSolver;
+        coeffs = fXCutoff;
+        updated = sleSolver.solve(hierSLE, fXCutoff, coeffs);
+      }
+
+      Printer::getInstance().enableStatusPrinting();
+
+      if (!updated) {
+        Printer::getInstance().printStatusEnd(
+            "error: could not hierarchize in IterativeGridGeneratorLinearSurplus");
+        result = false;
+        break;
+      }
+    } else {
+      // forward substitution
+      // (hierSLE should always be a lower triangular matrix)
+      for (size_t i = currentN; i < newN; i++) {
+        coeffs[i] = fX[i];
+
+        for (size_t j = 0; j < i; j++) {
+          coeffs[i] -= hierSLE.getMatrixEntry(i, j) * coeffs[j];
+        }
       }
     }
 
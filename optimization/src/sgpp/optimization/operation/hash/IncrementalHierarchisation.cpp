@@ -0,0 +1,321 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/globaldef.hpp>
+
+#include <sgpp/optimization/operation/hash/IncrementalHierarchisation.hpp>
+#include <sgpp/base/grid/type/BsplineBoundaryGrid.hpp>
+#include <sgpp/base/grid/type/BsplineGrid.hpp>
+#include <sgpp/base/grid/type/ModBsplineGrid.hpp>
+#include <sgpp/optimization/sle/solver/Auto.hpp>
+#include <sgpp/optimization/sle/solver/GMRES.hpp>
+#include <sgpp/optimization/sle/system/HierarchisationSLE.hpp>
+
+#include <cmath>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace sgpp {
+namespace optimization {
+
+IncrementalHierarchisation::IncrementalHierarchisation(base::Grid& grid)
+    : IncrementalHierarchisation(grid, grid.getStorage()) {}
+
+IncrementalHierarchisation::IncrementalHierarchisation(base::Grid& grid,
+                                                       base::GridStorage& gridStorage)
+    : grid(grid),
+      gridStorage(gridStorage),
+      supported(true),
+      hasBoundary(false),
+      supportRadius(1.0),
+      tol(DEFAULT_TOLERANCE),
+      maxRoundCount(DEFAULT_MAX_ROUND_COUNT),
+      wholeSystemSolved(false) {
+  if ((grid.getType() == base::GridType::Linear) ||
+      (grid.getType() == base::GridType::ModLinear)) {
+    supportRadius = 1.0;
+  } else if (grid.getType() == base::GridType::LinearBoundary) {
+    supportRadius = 1.0;
+    hasBoundary = true;
+  } else if (grid.getType() == base::GridType::Bspline) {
+    supportRadius =
+        static_cast<double>(dynamic_cast<base::BsplineGrid&>(grid).getDegree() + 1) / 2.0;
+  } else if (grid.getType() == base::GridType::BsplineBoundary) {
+    supportRadius =
+        static_cast<double>(dynamic_cast<base::BsplineBoundaryGrid&>(grid).getDegree() + 1) /
+        2.0;
+    hasBoundary = true;
+  } else if (grid.getType() == base::GridType::ModBspline) {
+    supportRadius =
+        static_cast<double>(dynamic_cast<base::ModBsplineGrid&>(grid).getDegree() + 1) / 2.0;
+  } else {
+    supported = false;
+  }
+}
+
+IncrementalHierarchisation::~IncrementalHierarchisation() {}
+
+bool IncrementalHierarchisation::update(base::DataVector& alpha,
+                                        const base::DataVector& nodeValues,
+                                        const std::vector<size_t>& newPoints) {
+  const size_t n = gridStorage.getSize();
+  const size_t d = gridStorage.getDimension();
+  wholeSystemSolved = false;
+
+  if (!supported) {
+    return solveWholeSystem(alpha, nodeValues);
+  }
+
+  alpha.resize(n);
+
+  const std::unordered_set<size_t> isNew(newPoints.begin(), newPoints.end());
+
+  for (size_t k : newPoints) {
+    alpha[k] = 0.0;
+  }
+
+  HierarchisationSLE system(grid, gridStorage);
+  const double absTol = tol * nodeValues.maxNorm();
+  std::vector<double> center(d);
+  std::vector<double> radius(d);
+  std::vector<size_t> indices;
+  // residual of the coefficients at the grid points,
+  // only non-zero entries are stored (the old coefficients are exact)
+  std::unordered_map<size_t, double> residual;
+
+  // residual at the new grid points
+  for (size_t k : newPoints) {
+    for (size_t t = 0; t < d; t++) {
+      center[t] = gridStorage.getUnitCoordinate(gridStorage[k], t);
+    }
+
+    indices.clear();
+    findFunctionsContaining(center, indices);
+    double r = nodeValues[k];
+
+    for (size_t j : indices) {
+      if (isNew.find(j) == isNew.end()) {
+        r -= system.getMatrixEntry(k, j) * alpha[j];
+      }
+    }
+
+    residual[k] = r;
+  }
+
+  std::vector<size_t> patch(newPoints);
+  std::unordered_set<size_t> isInPatch(newPoints.begin(), newPoints.end());
+
+  for (size_t round = 0; round < maxRoundCount; round++) {
+    const size_t m = patch.size();
+
+    if (static_cast<double>(m) > MAX_PATCH_RATIO * static_cast<double>(n)) {
+      break;
+    }
+
+    // solve hierarchisation system restricted to the patch
+    base::GridStorage patchStorage(d);
+
+    for (size_t j : patch) {
+      patchStorage.insert(gridStorage[j]);
+    }
+
+    HierarchisationSLE patchSystem(grid, patchStorage);
+    sle_solver::Auto solver;
+    base::DataVector b(m);
+    base::DataVector delta(m);
+
+    for (size_t q = 0; q < m; q++) {
+      b[q] = residual[patch[q]];
+    }
+
+    if (!solver.solve(patchSystem, b, delta)) {
+      break;
+    }
+
+    // correct coefficients and update residual in the supports of the
+    // corrected basis functions
+    for (size_t q = 0; q < m; q++) {
+      if (delta[q] == 0.0) {
+        continue;
+      }
+
+      const size_t j = patch[q];
+      const base::GridPoint& gp = gridStorage[j];
+      alpha[j] += delta[q];
+
+      for (size_t t = 0; t < d; t++) {
+        center[t] = gridStorage.getUnitCoordinate(gp, t);
+        radius[t] = supportRadius * std::ldexp(1.0, -static_cast<int>(gp.getLevel(t)));
+      }
+
+      indices.clear();
+      findPointsInBox(center, radius, indices);
+
+      for (size_t i : indices) {
+        const double entry = system.getMatrixEntry(i, j);
+
+        if (entry != 0.0) {
+          residual[i] -= entry * delta[q];
+        }
+      }
+    }
+
+    // enlarge patch by the grid points with too large residuals
+    bool converged = true;
+
+    for (const std::pair<const size_t, double>& entry : residual) {
+      if (std::abs(entry.second) > absTol) {
+        converged = false;
+
+        if (isInPatch.insert(entry.first).second) {
+          patch.push_back(entry.first);
+        }
+      }
+    }
+
+    if (converged) {
+      return true;
+    }
+  }
+
+  // patch too large, patch solve failed, or no convergence
+  return solveWholeSystem(alpha, nodeValues);
+}
+
+bool IncrementalHierarchisation::isSupported() const { return supported; }
+
+bool IncrementalHierarchisation::isWholeSystemSolved() const { return wholeSystemSolved; }
+
+double IncrementalHierarchisation::getTolerance() const { return tol; }
+
+void IncrementalHierarchisation::setTolerance(double tolerance) { tol = tolerance; }
+
+size_t IncrementalHierarchisation::getMaxRoundCount() const { return maxRoundCount; }
+
+void IncrementalHierarchisation::setMaxRoundCount(size_t maxRoundCount) {
+  this->maxRoundCount = maxRoundCount;
+}
+
+bool IncrementalHierarchisation::solveWholeSystem(base::DataVector& alpha,
+                                                  const base::DataVector& nodeValues) {
+  wholeSystemSolved = true;
+  HierarchisationSLE system(grid, gridStorage);
+  base::DataVector b(nodeValues);
+
+  if (alpha.getSize() == b.getSize()) {
+    // use the current coefficients as starting point for GMRES
+    // (usually, only few iterations are necessary)
+    sle_solver::GMRES solver;
+    solver.setStartingPoint(alpha);
+
+    if (solver.solve(system, b, alpha)) {
+      return true;
+    }
+  }
+
+  sle_solver::Auto solver;
+  return solver.solve(system, b, alpha);
+}
+
+void IncrementalHierarchisation::findPointsInBox(const std::vector<double>& center,
+                                                 const std::vector<double>& radius,
+                                                 std::vector<size_t>& result) {
+  const size_t d = gridStorage.getDimension();
+  base::GridPoint gp(d);
+
+  for (size_t t = 0; t < d; t++) {
+    gp.push(t, 1, 1);
+  }
+
+  gp.rehash();
+  traverse(gp, 0, center, radius, result);
+}
+
+void IncrementalHierarchisation::findFunctionsContaining(const std::vector<double>& center,
+                                                         std::vector<size_t>& result) {
+  findPointsInBox(center, std::vector<double>(), result);
+}
+
+void IncrementalHierarchisation::traverse(base::GridPoint& gp, size_t t,
+                                          const std::vector<double>& center,
+                                          const std::vector<double>& radius,
+                                          std::vector<size_t>& result) {
+  if (t == gridStorage.getDimension()) {
+    result.push_back(gridStorage.getSequenceNumber(gp));
+    return;
+  }
+
+  if (hasBoundary) {
+    visitNode(gp, t, 0, 0, center, radius, result);
+    visitNode(gp, t, 0, 1, center, radius, result);
+  }
+
+  visitNode(gp, t, 1, 1, center, radius, result);
+  gp.set(t, 1, 1);
+}
+
+void IncrementalHierarchisation::visitNode(base::GridPoint& gp, size_t t, base::level_t l,
+                                           base::index_t i, const std::vector<double>& center,
+                                           const std::vector<double>& radius,
+                                           std::vector<size_t>& result) {
+  gp.set(t, l, i);
+
+  // if the grid point is not contained in the grid, then neither
+  // are its descendants (in dimension t and in the following dimensions)
+  if (!isPrefixContained(gp, t)) {
+    return;
+  }
+
+  const double h = std::ldexp(1.0, -static_cast<int>(l));
+  const double x = static_cast<double>(i) * h;
+  const double c = center[t];
+  // if radius is empty, search for basis functions whose supports contain
+  // the center (the support radius decreases with increasing level);
+  // the basis functions vanish on the boundary of their supports
+  const double nodeRadius = (radius.empty() ? supportRadius * h : radius[t]);
+
+  if (std::abs(x - c) < nodeRadius) {
+    traverse(gp, t + 1, center, radius, result);
+  }
+
+  if (l == 0) {
+    return;
+  }
+
+  // descendants lie in ((i-1)*h, (i+1)*h)
+  const double descendantRadius = (radius.empty() ? supportRadius * h / 2.0 : radius[t]);
+
+  if ((c + descendantRadius > static_cast<double>(i - 1) * h) &&
+      (c - descendantRadius < static_cast<double>(i + 1) * h)) {
+    visitNode(gp, t, l + 1, 2 * i - 1, center, radius, result);
+    visitNode(gp, t, l + 1, 2 * i + 1, center, radius, result);
+  }
+}
+
+bool IncrementalHierarchisation::isPrefixContained(base::GridPoint& gp, size_t t) {
+  if (gridStorage.isContaining(gp)) {
+    return true;
+  }
+
+  const size_t d = gridStorage.getDimension();
+
+  if (!hasBoundary || (t + 1 == d)) {
+    return false;
+  }
+
+  // the refinement of boundary points does not create inner points,
+  // but every grid point implies the existence of its projections
+  // onto the boundary
+  base::GridPoint gpBoundary(gp);
+
+  for (size_t t2 = t + 1; t2 < d; t2++) {
+    gpBoundary.push(t2, 0, 0);
+  }
+
+  gpBoundary.rehash();
+  return gridStorage.isContaining(gpBoundary);
+}
+}  // namespace optimization
+}  // namespace sgpp
@@ -0,0 +1,228 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef SGPP_OPTIMIZATION_OPERATION_HASH_INCREMENTALHIERARCHISATION_HPP
+#define SGPP_OPTIMIZATION_OPERATION_HASH_INCREMENTALHIERARCHISATION_HPP
+
+#include <sgpp/globaldef.hpp>
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace sgpp {
+namespace optimization {
+
+/**
+ * Update of hierarchical coefficients after new grid points have been
+ * inserted into the grid (e.g., by refinement).
+ * Instead of solving the whole hierarchisation system again, the residual
+ * of the old coefficients is only computed at the new grid points.
+ * Corrections are then computed by solving the hierarchisation system
+ * restricted to a patch of grid points (initially the new points).
+ * As the basis functions of the new points may not vanish at old grid points
+ * (e.g., for B-splines), the residual is updated at all grid points in the
+ * supports of the corrected basis functions and the patch is enlarged by
+ * those points whose residual exceeds the tolerance.
+ * This is repeated until the residual is small enough.
+ *
+ * For basis functions whose supports do not contain any coarser grid point
+ * (e.g., piecewise linear functions), the new basis functions vanish at
+ * all old grid points, i.e., the update is exact after the first patch
+ * solve (forward substitution).
+ * The costs of the update only depend on the number of new grid points and
+ * the number of grid points in the supports of the corrected basis functions,
+ * but not on the total number of grid points.
+ *
+ * If the patch grows too large, the whole system is solved with GMRES,
+ * starting from the coefficients corrected so far.
+ * For B-splines, this is usually the case, as their hierarchisation is
+ * not local (the residual spreads over the whole grid), i.e., the update
+ * mainly provides a good starting point for GMRES.
+ *
+ * Grid points and basis functions in the supports are enumerated
+ * by traversing the grid dimension by dimension, which requires that
+ * all hierarchical ancestors of every grid point (and, for grids with
+ * boundary points, its projections onto the boundary) are contained in
+ * the grid, which is the case for grids generated by the refinement
+ * methods of SG++.
+ * Supported grid types are Linear, LinearBoundary, ModLinear, Bspline,
+ * BsplineBoundary and ModBspline. For other grid types, the whole system
+ * is solved.
+ */
+class IncrementalHierarchisation {
+ public:
+  /// default tolerance for the residual (relative to the maximal function value)
+  static constexpr double DEFAULT_TOLERANCE = 1e-10;
+  /// default maximal number of patch solves
+  static const size_t DEFAULT_MAX_ROUND_COUNT = 5;
+  /// maximal ratio of patch size and grid size before the whole system is solved
+  static constexpr double MAX_PATCH_RATIO = 0.25;
+
+  /**
+   * Constructor.
+   * Do not destruct the grid before this object!
+   *
+   * @param grid  sparse grid
+   */
+  explicit IncrementalHierarchisation(base::Grid& grid);
+
+  /**
+   * Constructor.
+   * Do not destruct the grid before this object!
+   *
+   * @param grid              sparse grid
+   * @param gridStorage       custom grid storage (use basis function
+   *                          according to grid, but use another set of
+   *                          grid points according to gridStorage)
+   */
+  IncrementalHierarchisation(base::Grid& grid, base::GridStorage& gridStorage);
+
+  /**
+   * Destructor.
+   */
+  virtual ~IncrementalHierarchisation();
+
+  /**
+   * @param[in,out] alpha       before: hierarchical coefficients w.r.t.
+   *                            the grid without the new grid points
+   *                            (entries corresponding to the new grid points
+   *                            are ignored, missing entries are added),
+   *                            after: hierarchical coefficients w.r.t.
+   *                            the whole grid
+   * @param         nodeValues  function values at all grid points
+   * @param         newPoints   indices of the new grid points
+   * @return                    whether the update was successful
+   */
+  bool update(base::DataVector& alpha, const base::DataVector& nodeValues,
+              const std::vector<size_t>& newPoints);
+
+  /**
+   * @return  whether the incremental update is supported for the type of
+   *          the grid (if not, update() solves the whole system)
+   */
+  bool isSupported() const;
+
+  /**
+   * @return  whether the last call of update() had to solve the whole
+   *          system (fallback) instead of updating the coefficients
+   *          on a patch of grid points
+   */
+  bool isWholeSystemSolved() const;
+
+  /**
+   * @return  tolerance for the residual (relative to the maximal function value)
+   */
+  double getTolerance() const;
+
+  /**
+   * @param tolerance   tolerance for the residual
+   *                    (relative to the maximal function value)
+   */
+  void setTolerance(double tolerance);
+
+  /**
+   * @return  maximal number of patch solves
+   */
+  size_t getMaxRoundCount() const;
+
+  /**
+   * @param maxRoundCount   maximal number of patch solves
+   */
+  void setMaxRoundCount(size_t maxRoundCount);
+
+ protected:
+  /// sparse grid
+  base::Grid& grid;
+  /// grid storage
+  base::GridStorage& gridStorage;
+  /// whether the grid type is supported
+  bool supported;
+  /// whether the grid contains boundary points (level 0)
+  bool hasBoundary;
+  /// half width of the supports of the basis functions in multiples of the mesh width
+  double supportRadius;
+  /// tolerance
+  double tol;
+  /// maximal number of patch solves
+  size_t maxRoundCount;
+  /// whether the last update solved the whole system
+  bool wholeSystemSolved;
+
+  /**
+   * Solve the whole system (fallback).
+   *
+   * @param[out]  alpha       hierarchical coefficients
+   * @param       nodeValues  function values at all grid points
+   * @return                  whether the solution was successful
+   */
+  bool solveWholeSystem(base::DataVector& alpha, const base::DataVector& nodeValues);
+
+  /**
+   * Enumerate the grid points whose 1D coordinates lie in given intervals.
+   *
+   * @param       center      centers of the intervals
+   * @param       radius      half widths of the intervals
+   * @param[out]  result      indices of the grid points
+   */
+  void findPointsInBox(const std::vector<double>& center, const std::vector<double>& radius,
+                       std::vector<size_t>& result);
+
+  /**
+   * Enumerate the grid points whose basis functions' supports contain a
+   * given point.
+   *
+   * @param       center      point
+   * @param[out]  result      indices of the grid points
+   */
+  void findFunctionsContaining(const std::vector<double>& center, std::vector<size_t>& result);
+
+  /**
+   * Recursive traversal for findPointsInBox() and findFunctionsContaining().
+   *
+   * @param           gp          current grid point (dimensions after t are
+   *                              set to level 1, index 1)
+   * @param           t           current dimension
+   * @param           center      centers of the intervals
+   * @param           radius      half widths of the intervals
+   *                              (empty: use the supports of the basis functions)
+   * @param[in,out]   result      indices of the grid points
+   */
+  void traverse(base::GridPoint& gp, size_t t, const std::vector<double>& center,
+                const std::vector<double>& radius, std::vector<size_t>& result);
+
+  /**
+   * Visit a node of the 1D hierarchy in dimension t and its descendants
+   * (helper function of traverse()).
+   *
+   * @param           gp          current grid point
+   * @param           t           current dimension
+   * @param           l           level of the node
+   * @param           i           index of the node
+   * @param           center      centers of the intervals
+   * @param           radius      half widths of the intervals
+   *                              (empty: use the supports of the basis functions)
+   * @param[in,out]   result      indices of the grid points
+   */
+  void visitNode(base::GridPoint& gp, size_t t, base::level_t l, base::index_t i,
+                 const std::vector<double>& center, const std::vector<double>& radius,
+                 std::vector<size_t>& result);
+
+  /**
+   * @param gp    grid point (dimensions after t are set to level 1, index 1)
+   * @param t     current dimension
+   * @return      whether the grid contains a grid point whose first t + 1
+   *              levels and indices coincide with those of gp
+   *              (exact for t = d - 1)
+   */
+  bool isPrefixContained(base::GridPoint& gp, size_t t);
+};
+}  // namespace optimization
+}  // namespace sgpp
+
+#endif /* SGPP_OPTIMIZATION_OPERATION_HASH_INCREMENTALHIERARCHISATION_HPP */
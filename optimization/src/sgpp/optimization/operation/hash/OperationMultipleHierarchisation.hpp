@@ -72,6 +72,27 @@ class OperationMultipleHierarchisation {
    *                      the grid points
    */
   virtual void doDehierarchisation(base::DataMatrix& alpha) = 0;
+
+  /**
+   * Virtual method for updating the hierarchical coefficients after
+   * new grid points have been inserted into the grid (e.g., by refinement).
+   * Standard implementation: hierarchisation of all function values.
+   *
+   * @param[in,out] alpha       before: vector of hierarchical coefficients
+   *                            w.r.t. the grid without the new grid points,
+   *                            after: vector of hierarchical coefficients
+   *                            w.r.t. the whole grid
+   * @param         nodeValues  vector of function values at all grid points
+   * @param         newPoints   indices of the new grid points
+   * @return                    whether hierarchisation was successful
+   */
+  virtual bool doIncrementalHierarchisation(base::DataVector& alpha,
+                                            const base::DataVector& nodeValues,
+                                            const std::vector<size_t>& newPoints) {
+    alpha.resize(nodeValues.getSize());
+    alpha = nodeValues;
+    return doHierarchisation(alpha);
+  }
 };
 }  // namespace optimization
 }  // namespace sgpp
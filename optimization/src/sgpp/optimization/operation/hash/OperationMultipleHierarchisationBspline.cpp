@@ -7,9 +7,12 @@
 
 #include <sgpp/optimization/operation/hash/OperationMultipleHierarchisationBspline.hpp>
 #include <sgpp/base/operation/hash/OperationEvalBsplineNaive.hpp>
+#include <sgpp/optimization/operation/hash/IncrementalHierarchisation.hpp>
 #include <sgpp/optimization/sle/solver/Auto.hpp>
 #include <sgpp/optimization/sle/system/HierarchisationSLE.hpp>
 
+#include <vector>
+
 namespace sgpp {
 namespace optimization {
 
@@ -68,5 +71,12 @@ void OperationMultipleHierarchisationBspline::doDehierarchisation(base::DataMatr
     alpha.setColumn(i, nodeValues);
   }
 }
+
+bool OperationMultipleHierarchisationBspline::doIncrementalHierarchisation(
+    base::DataVector& alpha, const base::DataVector& nodeValues,
+    const std::vector<size_t>& newPoints) {
+  IncrementalHierarchisation incrementalHierarchisation(grid);
+  return incrementalHierarchisation.update(alpha, nodeValues, newPoints);
+}
 }  // namespace optimization
 }  // namespace sgpp
@@ -12,6 +12,8 @@
 #include <sgpp/base/grid/type/BsplineBoundaryGrid.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 
+#include <vector>
+
 namespace sgpp {
 namespace optimization {
 
@@ -63,6 +65,18 @@ class OperationMultipleHierarchisationBsplineBoundary : public OperationMultiple
    */
   void doDehierarchisation(base::DataMatrix& alpha) override;
 
+  /**
+   * @param[in,out] alpha       before: vector of hierarchical coefficients
+   *                            w.r.t. the grid without the new grid points,
+   *                            after: vector of hierarchical coefficients
+   *                            w.r.t. the whole grid
+   * @param         nodeValues  vector of function values at all grid points
+   * @param         newPoints   indices of the new grid points
+   * @return                    whether hierarchisation was successful
+   */
+  bool doIncrementalHierarchisation(base::DataVector& alpha, const base::DataVector& nodeValues,
+                                    const std::vector<size_t>& newPoints) override;
+
  protected:
   /// storage of the sparse grid
   base::BsplineBoundaryGrid& grid;
@@ -7,9 +7,12 @@
 
 #include <sgpp/optimization/operation/hash/OperationMultipleHierarchisationLinearBoundary.hpp>
 #include <sgpp/base/operation/hash/OperationEvalLinearBoundaryNaive.hpp>
+#include <sgpp/optimization/operation/hash/IncrementalHierarchisation.hpp>
 #include <sgpp/optimization/sle/solver/Auto.hpp>
 #include <sgpp/optimization/sle/system/HierarchisationSLE.hpp>
 
+#include <vector>
+
 namespace sgpp {
 namespace optimization {
 
@@ -71,5 +74,12 @@ void OperationMultipleHierarchisationLinearBoundary::doDehierarchisation(base::D
   }
 }
 
+
+bool OperationMultipleHierarchisationLinearBoundary::doIncrementalHierarchisation(
+    base::DataVector& alpha, const base::DataVector& nodeValues,
+    const std::vector<size_t>& newPoints) {
+  IncrementalHierarchisation incrementalHierarchisation(grid);
+  return incrementalHierarchisation.update(alpha, nodeValues, newPoints);
+}
 }  // namespace optimization
 }  // namespace sgpp
@@ -82,6 +82,8 @@ class PenalizedObjectiveFunction : public ScalarFunction {
 
 class PenalizedObjectiveGradient : public ScalarFunctionGradient {
  public:
+  using ScalarFunctionGradient::eval;
+
   PenalizedObjectiveGradient(ScalarFunctionGradient& fGradient, VectorFunctionGradient& gGradient,
                              VectorFunctionGradient& hGradient, double mu,
                              base::DataVector& lambda)
@@ -194,6 +196,8 @@ class AuxiliaryObjectiveFunction : public ScalarFunction {
 
 class AuxiliaryObjectiveGradient : public ScalarFunctionGradient {
  public:
+  using ScalarFunctionGradient::eval;
+
   AuxiliaryObjectiveGradient(size_t d, double sMin, double sMax)
       : ScalarFunctionGradient(d + 1), sMin(sMin), sMax(sMax) {}
 
@@ -65,6 +65,8 @@ class PenalizedObjectiveFunction : public ScalarFunction {
 
 class PenalizedObjectiveGradient : public ScalarFunctionGradient {
  public:
+  using ScalarFunctionGradient::eval;
+
   PenalizedObjectiveGradient(ScalarFunctionGradient& fGradient, VectorFunctionGradient& gGradient,
                              double mu)
       : ScalarFunctionGradient(fGradient.getNumberOfParameters()),
@@ -74,6 +74,8 @@ class PenalizedObjectiveFunction : public ScalarFunction {
 
 class PenalizedObjectiveGradient : public ScalarFunctionGradient {
  public:
+  using ScalarFunctionGradient::eval;
+
   PenalizedObjectiveGradient(ScalarFunctionGradient& fGradient, VectorFunctionGradient& gGradient,
                              VectorFunctionGradient& hGradient, double mu)
       : ScalarFunctionGradient(fGradient.getNumberOfParameters()),
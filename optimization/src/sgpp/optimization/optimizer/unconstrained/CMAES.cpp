@@ -10,19 +10,29 @@
 #include <sgpp/optimization/tools/Printer.hpp>
 #include <sgpp/optimization/tools/RandomNumberGenerator.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif /* _OPENMP */
+
 #include <algorithm>
 #include <cmath>
+#include <memory>
+#include <string>
 #include <vector>
 
 namespace sgpp {
 namespace optimization {
 namespace optimizer {
 
-CMAES::CMAES(const ScalarFunction& f, size_t maxFcnEvalCount)
-    : UnconstrainedOptimizer(f, maxFcnEvalCount) {}
+CMAES::CMAES(const ScalarFunction& f, size_t maxFcnEvalCount, size_t eigenUpdateInterval)
+    : UnconstrainedOptimizer(f, maxFcnEvalCount),
+      eigenUpdateInterval(eigenUpdateInterval),
+      parallelEvaluation(true) {}
 
 CMAES::CMAES(const CMAES& other)
-    : UnconstrainedOptimizer(other) {
+    : UnconstrainedOptimizer(other),
+      eigenUpdateInterval(other.eigenUpdateInterval),
+      parallelEvaluation(other.parallelEvaluation) {
 }
 
 CMAES::~CMAES() {}
@@ -65,9 +75,17 @@ void CMAES::optimize() {
   const double cMu = std::min(1.0 - c1, alphaMu * (muEff - 2.0 + 1.0 / muEff) /
                                              (std::pow(dDbl + 2.0, 2.0) + alphaMu * muEff / 2.0));
 
+  // number of function evaluations between two eigendecompositions of C; by default the
+  // usual lambda / ((c1 + cMu) * d * 10), but at least d, such that the O(d^3) decompositions
+  // cost amortized O(d^2) per function evaluation
+  const double fcnEvalsPerEigen =
+      (eigenUpdateInterval > 0)
+          ? static_cast<double>(eigenUpdateInterval)
+          : std::max(static_cast<double>(lambda) / ((c1 + cMu) * dDbl * 10.0), dDbl);
+
   base::DataVector pSigma(d, 0.0);
   base::DataVector pC(d, 0.0);
-  base::DataMatrix C(d, d, 0.0), CNew(d, d);
+  base::DataMatrix C(d, d, 0.0);
   base::DataMatrix B(d, d), D(d, d), CInvSqrt(d, d);
   base::DataVector DDiag(d);
 
@@ -84,29 +102,61 @@ void CMAES::optimize() {
   std::vector<size_t> fXOrder(lambda);
 
   base::DataVector yW(d);
+  // selected steps y_{i:lambda} (i = 1, ..., mu) as rows
+  base::DataMatrix YMu(mu, d);
+
+  // one clone of the objective function per thread for the parallel evaluation
+  int numThreads = 1;
+  std::vector<std::unique_ptr<ScalarFunction>> fClones;
+
+#ifdef _OPENMP
+
+  if (parallelEvaluation && !omp_in_parallel()) {
+    numThreads = std::min(omp_get_max_threads(), static_cast<int>(lambda));
+  }
+
+  if (numThreads > 1) {
+    fClones.resize(numThreads);
+
+    for (auto& fClone : fClones) {
+      f->clone(fClone);
+    }
+  }
+
+#endif /* _OPENMP */
 
   size_t k = 0;
   size_t numberOfFcnEvals = 0;
+  size_t lastEigenFcnEvals = 0;
 
   while (numberOfFcnEvals < N) {
-    D = C;
-    math::schurDecomposition(D, B);
-    D.sqrt();
+    if ((k == 0) ||
+        (static_cast<double>(numberOfFcnEvals - lastEigenFcnEvals) >= fcnEvalsPerEigen)) {
+      lastEigenFcnEvals = numberOfFcnEvals;
+      D = C;
+      math::schurDecomposition(D, B);
+      D.sqrt();
 
-    for (size_t t = 0; t < d; t++) {
-      DDiag[t] = D(t, t);
-    }
+      for (size_t t = 0; t < d; t++) {
+        DDiag[t] = D(t, t);
+      }
 
-    for (size_t t1 = 0; t1 < d; t1++) {
-      for (size_t t2 = 0; t2 < d; t2++) {
-        CInvSqrt(t1, t2) = 0.0;
+      // C^(-1/2) = B D^(-1) B^T is symmetric, so only the upper triangle is computed
+      for (size_t t1 = 0; t1 < d; t1++) {
+        for (size_t t2 = t1; t2 < d; t2++) {
+          double entry = 0.0;
 
-        for (size_t t3 = 0; t3 < d; t3++) {
-          CInvSqrt(t1, t2) += B(t1, t3) * B(t2, t3) / DDiag[t3];
+          for (size_t t3 = 0; t3 < d; t3++) {
+            entry += B(t1, t3) * B(t2, t3) / DDiag[t3];
+          }
+
+          CInvSqrt(t1, t2) = entry;
+          CInvSqrt(t2, t1) = entry;
         }
       }
     }
 
+    // sample the offspring sequentially to keep the sequence of random numbers
     for (size_t j = 0; j < lambda; j++) {
       for (size_t t = 0; t < d; t++) {
         tmp[t] = DDiag[t] * RandomNumberGenerator::getInstance().getGaussianRN();
@@ -119,19 +169,37 @@ void CMAES::optimize() {
       x.mult(sigma);
       x.add(m);
       X.setColumn(j, x);
+      fXOrder[j] = j;
+    }
+
+    // evaluate the offspring
+#pragma omp parallel num_threads(numThreads) if (numThreads > 1)
+    {
+      base::DataVector xj(d);
+      ScalarFunction* curFPtr = f.get();
+
+#ifdef _OPENMP
 
-      {
+      if (numThreads > 1) {
+        curFPtr = fClones[omp_get_thread_num()].get();
+      }
+
+#endif /* _OPENMP */
+
+#pragma omp for schedule(dynamic)
+
+      for (size_t j = 0; j < lambda; j++) {
+        X.getColumn(j, xj);
         bool inDomain = true;
 
         for (size_t t = 0; t < d; t++) {
-          if ((x[t] < 0.0) || (x[t] > 1.0)) {
+          if ((xj[t] < 0.0) || (xj[t] > 1.0)) {
             inDomain = false;
             break;
           }
         }
 
-        fX[j] = (inDomain ? f->eval(x) : INFINITY);
-        fXOrder[j] = j;
+        fX[j] = (inDomain ? curFPtr->eval(xj) : INFINITY);
       }
     }
 
@@ -140,11 +208,17 @@ void CMAES::optimize() {
     std::sort(fXOrder.begin(), fXOrder.end(),
               [&fX](size_t a, size_t b) { return (fX[a] < fX[b]); });
 
+    for (size_t i = 0; i < mu; i++) {
+      for (size_t t = 0; t < d; t++) {
+        YMu(i, t) = Y(t, fXOrder[i]);
+      }
+    }
+
     for (size_t t = 0; t < d; t++) {
       yW[t] = 0.0;
 
       for (size_t i = 0; i < mu; i++) {
-        yW[t] += w[i] * Y(t, fXOrder[i]);
+        yW[t] += w[i] * YMu(i, t);
       }
 
       m[t] += sigma * yW[t];
@@ -170,17 +244,32 @@ void CMAES::optimize() {
     pC.mult(1.0 - cC);
     pC.add(tmp);
 
+    // rank-one and rank-mu update of C in place, row by row as a sequence of axpy operations
+    // on the contiguous rows of C and YMu (only the upper triangle, C is symmetric)
+    const double cOld = 1.0 - c1 - cMu + c1 * delta;
+
     for (size_t t1 = 0; t1 < d; t1++) {
-      for (size_t t2 = 0; t2 < d; t2++) {
-        CNew(t1, t2) = (1.0 - c1 - cMu) * C(t1, t2) + c1 * (pC[t1] * pC[t2] + delta * C(t1, t2));
+      double* CRow = C.getPointer() + t1 * d;
+      const double pCt1 = c1 * pC[t1];
+
+      for (size_t t2 = t1; t2 < d; t2++) {
+        CRow[t2] = cOld * CRow[t2] + pCt1 * pC[t2];
+      }
 
-        for (size_t i = 0; i < mu; i++) {
-          CNew(t1, t2) += cMu * w[i] * Y(t1, fXOrder[i]) * Y(t2, fXOrder[i]);
+      for (size_t i = 0; i < mu; i++) {
+        const double* YMuRow = YMu.getPointer() + i * d;
+        const double factor = cMu * w[i] * YMuRow[t1];
+
+        for (size_t t2 = t1; t2 < d; t2++) {
+          CRow[t2] += factor * YMuRow[t2];
         }
       }
+
+      for (size_t t2 = t1 + 1; t2 < d; t2++) {
+        C(t2, t1) = CRow[t2];
+      }
     }
 
-    C = CNew;
     k++;
 
     Printer::getInstance().printStatusUpdate(std::to_string(k) + " steps, f(x) = " +
@@ -200,6 +289,18 @@ void CMAES::optimize() {
   Printer::getInstance().printStatusEnd();
 }
 
+size_t CMAES::getEigenUpdateInterval() const { return eigenUpdateInterval; }
+
+void CMAES::setEigenUpdateInterval(size_t eigenUpdateInterval) {
+  this->eigenUpdateInterval = eigenUpdateInterval;
+}
+
+bool CMAES::isParallelEvaluationEnabled() const { return parallelEvaluation; }
+
+void CMAES::setParallelEvaluationEnabled(bool parallelEvaluation) {
+  this->parallelEvaluation = parallelEvaluation;
+}
+
 void CMAES::clone(std::unique_ptr<UnconstrainedOptimizer>& clone) const {
   clone = std::unique_ptr<UnconstrainedOptimizer>(new CMAES(*this));
 }
@@ -21,6 +21,8 @@ class CMAES : public UnconstrainedOptimizer {
  public:
   /// default maximal number of function evaluations
   static const size_t DEFAULT_MAX_FCN_EVAL_COUNT = 1000;
+  /// default number of function evaluations between eigendecompositions (0: automatic)
+  static const size_t DEFAULT_EIGEN_UPDATE_INTERVAL = 0;
 
   /**
    * Constructor.
@@ -30,8 +32,17 @@ class CMAES : public UnconstrainedOptimizer {
    * @param f                     objective function
    * @param maxFcnEvalCount       maximal number of
    *                              function evaluations
+   * @param eigenUpdateInterval   number of function evaluations between two
+   *                              eigendecompositions of the covariance
+   *                              matrix, rounded up to whole generations
+   *                              (0: choose automatically, i.e., the usual
+   *                              \f$\lambda / (10 d (c_1 + c_\mu))\f$, but at
+   *                              least \f$d\f$, such that the decompositions
+   *                              cost amortized \f$\mathcal{O}(d^2)\f$ per
+   *                              function evaluation)
    */
-  explicit CMAES(const ScalarFunction& f, size_t maxFcnEvalCount = DEFAULT_MAX_FCN_EVAL_COUNT);
+  explicit CMAES(const ScalarFunction& f, size_t maxFcnEvalCount = DEFAULT_MAX_FCN_EVAL_COUNT,
+                 size_t eigenUpdateInterval = DEFAULT_EIGEN_UPDATE_INTERVAL);
 
   /**
    * Copy constructor.
@@ -47,10 +58,40 @@ class CMAES : public UnconstrainedOptimizer {
 
   void optimize() override;
 
+  /**
+   * @return                      number of function evaluations between two
+   *                              eigendecompositions (0: automatic)
+   */
+  size_t getEigenUpdateInterval() const;
+
+  /**
+   * @param eigenUpdateInterval   number of function evaluations between two
+   *                              eigendecompositions (0: automatic)
+   */
+  void setEigenUpdateInterval(size_t eigenUpdateInterval);
+
+  /**
+   * @return                      whether the offspring of a generation are
+   *                              evaluated in parallel (using one clone of the
+   *                              objective function per thread, default: true)
+   */
+  bool isParallelEvaluationEnabled() const;
+
+  /**
+   * @param parallelEvaluation    whether the offspring are evaluated in parallel
+   */
+  void setParallelEvaluationEnabled(bool parallelEvaluation);
+
   /**
    * @param[out] clone pointer to cloned object
    */
   void clone(std::unique_ptr<UnconstrainedOptimizer>& clone) const override;
+
+ protected:
+  /// number of function evaluations between two eigendecompositions (0: automatic)
+  size_t eigenUpdateInterval;
+  /// whether the offspring are evaluated in parallel
+  bool parallelEvaluation;
 };
 }  // namespace optimizer
 }  // namespace optimization
@@ -9,9 +9,14 @@
 #include <sgpp/optimization/tools/Printer.hpp>
 #include <sgpp/optimization/tools/RandomNumberGenerator.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif /* _OPENMP */
+
 #include <algorithm>
 #include <cstdlib>
 #include <iostream>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -30,7 +35,8 @@ DifferentialEvolution::DifferentialEvolution(const ScalarFunction& f, size_t max
       scalingFactor(scalingFactor),
       idleGenerationsCount(idleGenerationsCount),
       avgImprovementThreshold(avgImprovementThreshold),
-      maxDistanceThreshold(maxDistanceThreshold) {}
+      maxDistanceThreshold(maxDistanceThreshold),
+      parallelEvaluation(true) {}
 
 DifferentialEvolution::DifferentialEvolution(const DifferentialEvolution& other)
     : UnconstrainedOptimizer(other),
@@ -39,7 +45,8 @@ DifferentialEvolution::DifferentialEvolution(const DifferentialEvolution& other)
       scalingFactor(other.scalingFactor),
       idleGenerationsCount(other.idleGenerationsCount),
       avgImprovementThreshold(other.avgImprovementThreshold),
-      maxDistanceThreshold(other.maxDistanceThreshold) {
+      maxDistanceThreshold(other.maxDistanceThreshold),
+      parallelEvaluation(other.parallelEvaluation) {
 }
 
 DifferentialEvolution::~DifferentialEvolution() {}
@@ -67,19 +74,65 @@ void DifferentialEvolution::optimize() {
   // (no need to swape those)
   base::DataVector fx(populationSize);
 
+  // one clone of the objective function per thread (created once instead of in every
+  // generation, as cloning may be expensive)
+  int numThreads = 1;
+  std::vector<std::unique_ptr<ScalarFunction>> fClones;
+
+#ifdef _OPENMP
+
+  if (parallelEvaluation && !omp_in_parallel()) {
+    numThreads = omp_get_max_threads();
+  }
+
+  if (numThreads > 1) {
+    fClones.resize(numThreads);
+
+    for (auto& fClone : fClones) {
+      f->clone(fClone);
+    }
+  }
+
+#endif /* _OPENMP */
+
   // initial pseudorandom points
   for (size_t i = 0; i < populationSize; i++) {
     for (size_t t = 0; t < d; t++) {
       (*xOld)[i][t] = RandomNumberGenerator::getInstance().getUniformRN();
     }
+  }
+
+#pragma omp parallel num_threads(numThreads) if (numThreads > 1)
+  {
+    ScalarFunction* curFPtr = f.get();
+
+#ifdef _OPENMP
+
+    if (numThreads > 1) {
+      curFPtr = fClones[omp_get_thread_num()].get();
+    }
 
-    fx[i] = f->eval((*xOld)[i]);
+#endif /* _OPENMP */
+
+#pragma omp for schedule(dynamic)
+
+    for (size_t i = 0; i < populationSize; i++) {
+      fx[i] = curFPtr->eval((*xOld)[i]);
+    }
   }
 
   // smallest function value in the population
   double fCurrentOpt = INFINITY;
   // index of the point with value fOpt
   size_t xOptIndex = 0;
+
+  for (size_t i = 0; i < populationSize; i++) {
+    if (fx[i] < fCurrentOpt) {
+      xOptIndex = i;
+      fCurrentOpt = fx[i];
+    }
+  }
+
   // iteration number of the last iteration with significant improvement
   size_t lastNonidleK = 0;
   // average of all function values
@@ -129,17 +182,15 @@ void DifferentialEvolution::optimize() {
     const std::vector<size_t>& j_k = j[k];
     const std::vector<base::DataVector>& prob_k = prob[k];
 
-#pragma omp parallel shared(k, a_k, b_k, c_k, j_k, prob_k, xOld, fx, fCurrentOpt, xOptIndex, \
-                            xNew) default(none)
-    {  // NOLINT(whitespace/braces)
+#pragma omp parallel num_threads(numThreads) if (numThreads > 1)
+    {
       base::DataVector y(d);
       ScalarFunction* curFPtr = f.get();
+
 #ifdef _OPENMP
-      std::unique_ptr<ScalarFunction> curF;
 
-      if (omp_get_max_threads() > 1) {
-        f->clone(curF);
-        curFPtr = curF.get();
+      if (numThreads > 1) {
+        curFPtr = fClones[omp_get_thread_num()].get();
       }
 
 #endif /* _OPENMP */
@@ -176,16 +227,8 @@ void DifferentialEvolution::optimize() {
         const double fy = (inDomain ? curFPtr->eval(y) : INFINITY);
 
         if (fy < fx[i]) {
-// function_value is better ==> replace point with mutated one
-#pragma omp critical
-          {
-            fx[i] = fy;
-
-            if (fy < fCurrentOpt) {
-              xOptIndex = i;
-              fCurrentOpt = fy;
-            }
-          }
+          // function_value is better ==> replace point with mutated one
+          fx[i] = fy;
 
           for (size_t t = 0; t < d; t++) {
             (*xNew)[i][t] = y[t];
@@ -199,6 +242,15 @@ void DifferentialEvolution::optimize() {
       }
     }
 
+    // update the best point after the parallel loop, so that ties are always resolved
+    // in favor of the smallest index (independently of the number of threads)
+    for (size_t i = 0; i < populationSize; i++) {
+      if (fx[i] < fCurrentOpt) {
+        xOptIndex = i;
+        fCurrentOpt = fx[i];
+      }
+    }
+
     // swap populations
     std::swap(xOld, xNew);
     avg = 0.0;
@@ -271,6 +323,12 @@ void DifferentialEvolution::setPopulationSize(size_t populationSize) {
   this->populationSize = populationSize;
 }
 
+bool DifferentialEvolution::isParallelEvaluationEnabled() const { return parallelEvaluation; }
+
+void DifferentialEvolution::setParallelEvaluationEnabled(bool parallelEvaluation) {
+  this->parallelEvaluation = parallelEvaluation;
+}
+
 void DifferentialEvolution::clone(std::unique_ptr<UnconstrainedOptimizer>& clone) const {
   clone = std::unique_ptr<UnconstrainedOptimizer>(new DifferentialEvolution(*this));
 }
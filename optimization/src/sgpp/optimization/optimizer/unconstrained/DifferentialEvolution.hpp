@@ -76,6 +76,18 @@ class DifferentialEvolution : public UnconstrainedOptimizer {
    */
   void setPopulationSize(size_t populationSize);
 
+  /**
+   * @return                  whether the individuals of a generation are
+   *                          evaluated in parallel (using one clone of the
+   *                          objective function per thread, default: true)
+   */
+  bool isParallelEvaluationEnabled() const;
+
+  /**
+   * @param parallelEvaluation  whether the individuals are evaluated in parallel
+   */
+  void setParallelEvaluationEnabled(bool parallelEvaluation);
+
   /**
    * @param[out] clone pointer to cloned object
    */
@@ -94,6 +106,8 @@ class DifferentialEvolution : public UnconstrainedOptimizer {
   double avgImprovementThreshold;
   /// stopping criterion parameter 3
   double maxDistanceThreshold;
+  /// whether the individuals are evaluated in parallel
+  bool parallelEvaluation;
 };
 }  // namespace optimizer
 }  // namespace optimization
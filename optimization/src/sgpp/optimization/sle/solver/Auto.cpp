@@ -11,6 +11,7 @@
 #include <sgpp/optimization/sle/solver/Eigen.hpp>
 #include <sgpp/optimization/sle/solver/GaussianElimination.hpp>
 #include <sgpp/optimization/sle/solver/Gmmpp.hpp>
+#include <sgpp/optimization/sle/solver/GMRES.hpp>
 #include <sgpp/optimization/sle/solver/UMFPACK.hpp>
 #include <sgpp/optimization/tools/Printer.hpp>
 
@@ -66,16 +67,18 @@ bool Auto::solve(SLE& system, base::DataMatrix& B, base::DataMatrix& X) const {
   UMFPACK solverUMFPACK;
   Gmmpp solverGmmpp;
   BiCGStab solverBiCGStab;
+  GMRES solverGMRES;
   GaussianElimination solverGaussianElimination;
 
   std::map<SLESolver*, bool> supports;
 
-  // by default, only BiCGStab and GaussianElimination supported
+  // by default, only BiCGStab, GMRES and GaussianElimination supported
   supports[&solverArmadillo] = false;
   supports[&solverEigen] = false;
   supports[&solverUMFPACK] = false;
   supports[&solverGmmpp] = false;
   supports[&solverBiCGStab] = true;
+  supports[&solverGMRES] = true;
   supports[&solverGaussianElimination] = true;
 
 #ifdef USE_ARMADILLO
@@ -99,7 +102,12 @@ bool Auto::solve(SLE& system, base::DataMatrix& B, base::DataMatrix& X) const {
   std::vector<SLESolver*> solvers;
   const size_t n = system.getDimension();
 
-  if (supports[&solverUMFPACK] || supports[&solverGmmpp]) {
+  if ((n > MAX_DIM_FOR_FULL) && system.hasFastMatrixVectorMultiplication()) {
+    // the matrix is too large to be assembled, but the system provides a
+    // fast matrix-vector product ==> try iterative solver first
+    // (this also avoids the quadratic costs of the sparsity estimation)
+    addSLESolver(&solverGMRES, solvers, supports);
+  } else if (supports[&solverUMFPACK] || supports[&solverGmmpp]) {
     // if at least one of the sparse solvers is supported
     // ==> estimate sparsity ratio of matrix by considering
     // every inc-th row
@@ -149,6 +157,11 @@ bool Auto::solve(SLE& system, base::DataMatrix& B, base::DataMatrix& X) const {
     addSLESolver(&solverGaussianElimination, solvers, supports);
   }
 
+  if (system.hasFastMatrixVectorMultiplication()) {
+    // GMRES only pays off if the matrix-vector product is cheap
+    addSLESolver(&solverGMRES, solvers, supports);
+  }
+
   addSLESolver(&solverBiCGStab, solvers, supports);
   addSLESolver(&solverGaussianElimination, solvers, supports);
 
@@ -0,0 +1,198 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/globaldef.hpp>
+
+#include <sgpp/optimization/sle/solver/GMRES.hpp>
+#include <sgpp/optimization/tools/Printer.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace optimization {
+namespace sle_solver {
+
+GMRES::GMRES()
+    : GMRES(DEFAULT_MAX_IT_COUNT, DEFAULT_TOLERANCE, DEFAULT_RESTART, base::DataVector(0)) {}
+
+GMRES::GMRES(size_t maxItCount, double tolerance, size_t restart, const base::DataVector& x0)
+    : SLESolver(), N(maxItCount), tol(tolerance), restart(std::max<size_t>(restart, 1)), x0(x0) {}
+
+GMRES::~GMRES() {}
+
+bool GMRES::solve(SLE& system, base::DataVector& b, base::DataVector& x) const {
+  Printer::getInstance().printStatusBegin("Solving linear system (GMRES)...");
+
+  const size_t n = b.getSize();
+  const double bNorm = b.l2Norm();
+
+  x.resize(n);
+
+  if (x0.getSize() == n) {
+    x = x0;
+  } else {
+    x.setAll(0.0);
+  }
+
+  if (bNorm == 0.0) {
+    x.setAll(0.0);
+    Printer::getInstance().printStatusEnd();
+    return true;
+  }
+
+  const size_t m = restart;
+  // Krylov basis
+  std::vector<base::DataVector> V(m + 1, base::DataVector(n));
+  // Hessenberg matrix (column-wise), Givens rotations and right-hand side
+  std::vector<std::vector<double>> H(m, std::vector<double>(m + 1, 0.0));
+  std::vector<double> cs(m, 0.0);
+  std::vector<double> sn(m, 0.0);
+  std::vector<double> g(m + 1, 0.0);
+  std::vector<double> y(m, 0.0);
+  base::DataVector r(n);
+  base::DataVector z(n);
+
+  // r = b - A*x
+  system.matrixVectorMultiplication(x, r);
+
+  for (size_t i = 0; i < n; i++) {
+    r[i] = b[i] - r[i];
+  }
+
+  double rNorm = r.l2Norm();
+  size_t k = 0;
+
+  while ((rNorm > tol * bNorm) && (k < N)) {
+    for (size_t i = 0; i < n; i++) {
+      V[0][i] = r[i] / rNorm;
+    }
+
+    std::fill(g.begin(), g.end(), 0.0);
+    g[0] = rNorm;
+    size_t j = 0;
+
+    while ((j < m) && (k < N)) {
+      // w = A * M^{-1} * V[j] (stored in V[j + 1])
+      system.applyPreconditioner(V[j], z);
+      system.matrixVectorMultiplication(z, V[j + 1]);
+
+      // modified Gram-Schmidt
+      for (size_t q = 0; q <= j; q++) {
+        H[j][q] = V[j + 1].dotProduct(V[q]);
+        V[j + 1].axpy(-H[j][q], V[q]);
+      }
+
+      H[j][j + 1] = V[j + 1].l2Norm();
+
+      if (std::isnan(H[j][j + 1])) {
+        Printer::getInstance().printStatusEnd("error: Could not solve linear system!");
+        return false;
+      }
+
+      if (H[j][j + 1] != 0.0) {
+        V[j + 1].mult(1.0 / H[j][j + 1]);
+      }
+
+      // apply previous Givens rotations to the new column
+      for (size_t q = 0; q < j; q++) {
+        const double tmp = cs[q] * H[j][q] + sn[q] * H[j][q + 1];
+        H[j][q + 1] = -sn[q] * H[j][q] + cs[q] * H[j][q + 1];
+        H[j][q] = tmp;
+      }
+
+      // compute new Givens rotation to eliminate H[j][j + 1]
+      const double denom = std::sqrt(H[j][j] * H[j][j] + H[j][j + 1] * H[j][j + 1]);
+
+      if (denom == 0.0) {
+        Printer::getInstance().printStatusEnd("error: Could not solve linear system!");
+        return false;
+      }
+
+      cs[j] = H[j][j] / denom;
+      sn[j] = H[j][j + 1] / denom;
+      H[j][j] = denom;
+      H[j][j + 1] = 0.0;
+      g[j + 1] = -sn[j] * g[j];
+      g[j] = cs[j] * g[j];
+
+      j++;
+      k++;
+
+      Printer::getInstance().printStatusUpdate("k = " + std::to_string(k) +
+                                               ", residual norm = " +
+                                               std::to_string(std::abs(g[j])));
+
+      if (std::abs(g[j]) <= tol * bNorm) {
+        break;
+      }
+    }
+
+    // solve the triangular system H * y = g
+    for (size_t q = j; q-- > 0;) {
+      y[q] = g[q];
+
+      for (size_t q2 = q + 1; q2 < j; q2++) {
+        y[q] -= H[q2][q] * y[q2];
+      }
+
+      y[q] /= H[q][q];
+    }
+
+    // x = x + M^{-1} * V * y
+    r.setAll(0.0);
+
+    for (size_t q = 0; q < j; q++) {
+      r.axpy(y[q], V[q]);
+    }
+
+    system.applyPreconditioner(r, z);
+    x.add(z);
+
+    // compute the true residual
+    system.matrixVectorMultiplication(x, r);
+
+    for (size_t i = 0; i < n; i++) {
+      r[i] = b[i] - r[i];
+    }
+
+    rNorm = r.l2Norm();
+  }
+
+  Printer::getInstance().printStatusUpdate("k = " + std::to_string(k) + ", residual norm = " +
+                                           std::to_string(rNorm));
+
+  if (rNorm > tol * bNorm) {
+    Printer::getInstance().printStatusEnd("error: Could not solve linear system!");
+    return false;
+  }
+
+  Printer::getInstance().printStatusEnd();
+  return true;
+}
+
+size_t GMRES::getMaxItCount() const { return N; }
+
+void GMRES::setMaxItCount(size_t maxItCount) { N = maxItCount; }
+
+double GMRES::getTolerance() const { return tol; }
+
+void GMRES::setTolerance(double tolerance) { tol = tolerance; }
+
+size_t GMRES::getRestart() const { return restart; }
+
+void GMRES::setRestart(size_t restart) { this->restart = std::max<size_t>(restart, 1); }
+
+const base::DataVector& GMRES::getStartingPoint() const { return x0; }
+
+void GMRES::setStartingPoint(const base::DataVector& startingPoint) {
+  x0.resize(startingPoint.getSize());
+  x0 = startingPoint;
+}
+}  // namespace sle_solver
+}  // namespace optimization
+}  // namespace sgpp
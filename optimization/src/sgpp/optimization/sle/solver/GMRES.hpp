@@ -0,0 +1,120 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef SGPP_OPTIMIZATION_SLE_SOLVER_GMRES_HPP
+#define SGPP_OPTIMIZATION_SLE_SOLVER_GMRES_HPP
+
+#include <sgpp/globaldef.hpp>
+#include <sgpp/optimization/sle/solver/SLESolver.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+
+#include <cstddef>
+
+namespace sgpp {
+namespace optimization {
+namespace sle_solver {
+
+/**
+ * Linear system solver implementing the restarted GMRES method with
+ * right preconditioning (see SLE::applyPreconditioner()).
+ * The system matrix is only accessed via SLE::matrixVectorMultiplication()
+ * and SLE::applyPreconditioner(), which makes the solver suitable for
+ * large systems with a matrix-free product (e.g., HierarchisationSLE).
+ * Apart from the system, the memory requirements are
+ * \f$\mathcal{O}(mn)\f$ for \f$m\f$ iterations per restart.
+ */
+class GMRES : public SLESolver {
+ public:
+  /// default maximal number of iterations
+  static const size_t DEFAULT_MAX_IT_COUNT = 1000;
+  /// default number of iterations after which GMRES is restarted
+  static const size_t DEFAULT_RESTART = 50;
+  /// default tolerance
+  static constexpr double DEFAULT_TOLERANCE = 1e-10;
+
+  /**
+   * Constructor.
+   */
+  GMRES();
+
+  /**
+   * @param maxItCount        maximal number of iterations
+   * @param tolerance         tolerance for the relative residual
+   *                          \f$\lVert b - Ax\rVert_2 / \lVert b\rVert_2\f$
+   * @param restart           number of iterations after which GMRES is restarted
+   * @param startingPoint     starting vector
+   */
+  GMRES(size_t maxItCount, double tolerance, size_t restart,
+        const base::DataVector& startingPoint);
+
+  /**
+   * Destructor.
+   */
+  ~GMRES() override;
+
+  /**
+   * @param       system  system to be solved
+   * @param       b       right-hand side
+   * @param[out]  x       solution to the system
+   * @return              whether all went well
+   *                      (false if errors occurred or the method did not converge)
+   */
+  bool solve(SLE& system, base::DataVector& b, base::DataVector& x) const override;
+
+  /**
+   * @return              maximal number of iterations
+   */
+  size_t getMaxItCount() const;
+
+  /**
+   * @param maxItCount   maximal number of iterations
+   */
+  void setMaxItCount(size_t maxItCount);
+
+  /**
+   * @return              tolerance
+   */
+  double getTolerance() const;
+
+  /**
+   * @param tolerance     tolerance
+   */
+  void setTolerance(double tolerance);
+
+  /**
+   * @return              number of iterations after which GMRES is restarted
+   */
+  size_t getRestart() const;
+
+  /**
+   * @param restart       number of iterations after which GMRES is restarted
+   */
+  void setRestart(size_t restart);
+
+  /**
+   * @return                  starting vector
+   */
+  const base::DataVector& getStartingPoint() const;
+
+  /**
+   * @param startingPoint     starting vector
+   */
+  void setStartingPoint(const base::DataVector& startingPoint);
+
+ protected:
+  /// maximal number of iterations
+  size_t N;
+  /// tolerance
+  double tol;
+  /// number of iterations after which GMRES is restarted
+  size_t restart;
+  /// starting vector
+  base::DataVector x0;
+};
+}  // namespace sle_solver
+}  // namespace optimization
+}  // namespace sgpp
+
+#endif /* SGPP_OPTIMIZATION_SLE_SOLVER_GMRES_HPP */
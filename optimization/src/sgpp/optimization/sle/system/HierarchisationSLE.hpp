@@ -40,16 +40,33 @@
 #include <sgpp/base/grid/type/ModFundamentalSplineGrid.hpp>
 #include <sgpp/base/grid/type/NakBsplineBoundaryCombigridGrid.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace sgpp {
 namespace optimization {
 
 /**
  * Linear system of the hierarchization in a sparse grid.
+ *
+ * The system matrix is never assembled by matrixVectorMultiplication().
+ * Instead, the product is computed matrix-free (and in parallel) by exploiting
+ * the tensor product structure: the values of the 1D basis functions at the
+ * 1D grid coordinates are tabulated sparsely per dimension and the non-zero
+ * entries of a row are found by traversing the lexicographically sorted grid
+ * points dimension by dimension, skipping all grid points whose basis function
+ * vanishes in one of the dimensions.
+ * The memory requirements are \f$\mathcal{O}(N)\f$ (apart from the
+ * 1D tables), so large systems can be solved with iterative solvers
+ * (e.g., sle_solver::GMRES).
  */
 class HierarchisationSLE : public CloneableSLE {
  public:
@@ -176,6 +193,79 @@ class HierarchisationSLE : public CloneableSLE {
 
   size_t getDimension() const override { return gridStorage.getSize(); }
 
+  /**
+   * Matrix-free multiplication of the system matrix with a vector.
+   * The 1D tables are computed on the first call (and again if the
+   * grid points have been modified in the meantime).
+   * The method may be called concurrently, as long as the grid is not modified.
+   *
+   * @param       x   vector to be multiplied
+   * @param[out]  y   \f$y = Ax\f$
+   */
+  void matrixVectorMultiplication(const base::DataVector& x, base::DataVector& y) override {
+    const size_t n = gridStorage.getSize();
+    const size_t d = gridStorage.getDimension();
+
+    updateMatrixVectorMultiplication();
+
+    y.resize(n);
+
+    if ((n == 0) || (d == 0)) {
+      y.setAll((n == 0) ? 0.0 : x[0]);
+      return;
+    }
+
+    #pragma omp parallel
+    {
+      // non-zero entries of the current row of the matrix
+      std::vector<std::pair<size_t, double>> entries;
+
+      #pragma omp for schedule(dynamic, 64)
+      for (size_t i = 0; i < n; i++) {
+        entries.clear();
+        collectRowEntries(&functionNumbers[i * d], 0, 0, nodeFunctions[0].size(), 1.0,
+                          entries);
+
+        // sum up in the order of the columns to obtain the same result
+        // as the standard implementation
+        std::sort(entries.begin(), entries.end());
+        double result = 0.0;
+
+        for (const std::pair<size_t, double>& entry : entries) {
+          result += entry.second * x[entry.first];
+        }
+
+        y[i] = result;
+      }
+    }
+  }
+
+  /**
+   * Jacobi preconditioner with the diagonal of the matrix computed in
+   * prepareMatrixVectorMultiplication().
+   *
+   * @param       x   vector to be preconditioned
+   * @param[out]  y   \f$y_i = x_i / A_{ii}\f$
+   */
+  void applyPreconditioner(const base::DataVector& x, base::DataVector& y) override {
+    const size_t n = gridStorage.getSize();
+
+    updateMatrixVectorMultiplication();
+
+    y.resize(n);
+
+    #pragma omp parallel for schedule(static)
+    for (size_t i = 0; i < n; i++) {
+      y[i] = ((diagonal[i] != 0.0) ? (x[i] / diagonal[i]) : x[i]);
+    }
+  }
+
+  /**
+   * @return  true, as matrixVectorMultiplication() does not need
+   *          \f$\mathcal{O}(n^2)\f$ operations
+   */
+  bool hasFastMatrixVectorMultiplication() const override { return true; }
+
   /**
    * @param[out] clone pointer to cloned object
    */
@@ -243,6 +333,319 @@ class HierarchisationSLE : public CloneableSLE {
     NAK_BSPLINEBOUNDARY_COMBIGRID
   } basisType;
 
+  /// whether the 1D tables have been computed
+  bool tablesPrepared = false;
+  /// modification count of the grid storage the 1D tables were computed for
+  size_t tableModificationCount = 0;
+  /// mutex for the (re-)computation of the 1D tables
+  std::mutex tableMutex;
+  /**
+   * number of the 1D basis function (and the 1D grid coordinate) of
+   * the i-th grid point in the t-th dimension at position i * d + t
+   */
+  std::vector<size_t> functionNumbers;
+  /// per dimension, start of the rows of the sparse 1D tables (CSR format)
+  std::vector<std::vector<size_t>> tableRowStart;
+  /// per dimension, function numbers of the non-zero table entries
+  std::vector<std::vector<size_t>> tableFunctions;
+  /// per dimension, values of the non-zero table entries
+  std::vector<std::vector<double>> tableValues;
+  /**
+   * per dimension t, 1D function numbers of the nodes of the tree of
+   * grid points (a node in depth t corresponds to a distinct prefix of
+   * function numbers of length t + 1, the nodes are sorted lexicographically)
+   */
+  std::vector<std::vector<size_t>> nodeFunctions;
+  /// per dimension t < d - 1, start of the children of the nodes in depth t + 1
+  std::vector<std::vector<size_t>> nodeChildrenStart;
+  /// grid point indices of the leaves (nodes in depth d - 1)
+  std::vector<size_t> leafPoints;
+  /// diagonal entries of the matrix
+  std::vector<double> diagonal;
+
+  /**
+   * Computes the data structures for matrixVectorMultiplication().
+   * For every dimension, the distinct pairs of level and index are numbered
+   * and the values of the corresponding 1D basis functions at the
+   * corresponding 1D grid coordinates are stored in a sparse table.
+   * For bases whose functions are positive in the interior of an interval
+   * support, the non-zero entries are found by searching from the center
+   * of the function, otherwise all pairs are evaluated.
+   */
+  void prepareMatrixVectorMultiplication() {
+    const size_t n = gridStorage.getSize();
+    const size_t d = gridStorage.getDimension();
+    const bool hasIntervalSupport =
+        (basisType == BSPLINE) || (basisType == BSPLINE_BOUNDARY) ||
+        (basisType == BSPLINE_CLENSHAW_CURTIS) || (basisType == BSPLINE_MODIFIED) ||
+        (basisType == BSPLINE_MODIFIED_CLENSHAW_CURTIS) || (basisType == LINEAR) ||
+        (basisType == LINEAR_BOUNDARY) || (basisType == LINEAR_CLENSHAW_CURTIS) ||
+        (basisType == LINEAR_CLENSHAW_CURTIS_BOUNDARY) || (basisType == LINEAR_MODIFIED);
+
+    functionNumbers.assign(n * d, 0);
+    tableRowStart.assign(d, std::vector<size_t>());
+    tableFunctions.assign(d, std::vector<size_t>());
+    tableValues.assign(d, std::vector<double>());
+
+    for (size_t t = 0; t < d; t++) {
+      // number the distinct 1D functions, sorted by their coordinates
+      std::unordered_map<uint64_t, size_t> numbers;
+      std::vector<std::pair<double, size_t>> representatives;
+
+      for (size_t i = 0; i < n; i++) {
+        const base::GridPoint& gp = gridStorage[i];
+        const uint64_t key = (static_cast<uint64_t>(gp.getLevel(t)) << 32) |
+                             static_cast<uint64_t>(gp.getIndex(t));
+
+        if (numbers.insert(std::make_pair(key, representatives.size())).second) {
+          representatives.push_back(std::make_pair(gridStorage.getUnitCoordinate(gp, t), i));
+        }
+      }
+
+      std::vector<size_t> order(representatives.size());
+
+      for (size_t k = 0; k < order.size(); k++) {
+        order[k] = k;
+      }
+
+      std::sort(order.begin(), order.end(), [&representatives](size_t a, size_t b) {
+        return representatives[a].first < representatives[b].first;
+      });
+
+      std::vector<size_t> ranks(order.size());
+
+      for (size_t k = 0; k < order.size(); k++) {
+        ranks[order[k]] = k;
+      }
+
+      for (size_t i = 0; i < n; i++) {
+        const base::GridPoint& gp = gridStorage[i];
+        const uint64_t key = (static_cast<uint64_t>(gp.getLevel(t)) << 32) |
+                             static_cast<uint64_t>(gp.getIndex(t));
+        functionNumbers[i * d + t] = ranks[numbers[key]];
+      }
+
+      // tabulate the 1D functions (column f) at the 1D coordinates (row c)
+      const size_t m = order.size();
+      std::vector<std::vector<std::pair<size_t, double>>> rows(m);
+
+      for (size_t f = 0; f < m; f++) {
+        const base::GridPoint& gpBasis = gridStorage[representatives[order[f]].second];
+
+        if (hasIntervalSupport) {
+          for (size_t c = f + 1; c-- > 0;) {
+            const double value =
+                evalBasisFunction1D(gpBasis, gridStorage[representatives[order[c]].second], t);
+
+            if (value == 0.0) {
+              break;
+            }
+
+            rows[c].push_back(std::make_pair(f, value));
+          }
+
+          for (size_t c = f + 1; c < m; c++) {
+            const double value =
+                evalBasisFunction1D(gpBasis, gridStorage[representatives[order[c]].second], t);
+
+            if (value == 0.0) {
+              break;
+            }
+
+            rows[c].push_back(std::make_pair(f, value));
+          }
+        } else {
+          for (size_t c = 0; c < m; c++) {
+            const double value =
+                evalBasisFunction1D(gpBasis, gridStorage[representatives[order[c]].second], t);
+
+            if (value != 0.0) {
+              rows[c].push_back(std::make_pair(f, value));
+            }
+          }
+        }
+      }
+
+      tableRowStart[t].resize(m + 1);
+      tableRowStart[t][0] = 0;
+
+      for (size_t c = 0; c < m; c++) {
+        tableRowStart[t][c + 1] = tableRowStart[t][c] + rows[c].size();
+
+        for (const std::pair<size_t, double>& entry : rows[c]) {
+          tableFunctions[t].push_back(entry.first);
+          tableValues[t].push_back(entry.second);
+        }
+      }
+    }
+
+    // build tree of grid points by sorting them lexicographically
+    // by their 1D function numbers
+    std::vector<size_t> sortedPoints(n);
+
+    for (size_t i = 0; i < n; i++) {
+      sortedPoints[i] = i;
+    }
+
+    const size_t* numbers = functionNumbers.data();
+    std::sort(sortedPoints.begin(), sortedPoints.end(), [numbers, d](size_t a, size_t b) {
+      return std::lexicographical_compare(numbers + a * d, numbers + (a + 1) * d,
+                                          numbers + b * d, numbers + (b + 1) * d);
+    });
+
+    nodeFunctions.assign(d, std::vector<size_t>());
+    nodeChildrenStart.assign(d, std::vector<size_t>());
+    leafPoints.clear();
+
+    for (size_t k = 0; k < n; k++) {
+      const size_t* curNumbers = numbers + sortedPoints[k] * d;
+      const size_t* prevNumbers = (k > 0) ? (numbers + sortedPoints[k - 1] * d) : nullptr;
+      // first dimension in which the prefix differs from the previous point
+      size_t t0 = 0;
+
+      while ((prevNumbers != nullptr) && (t0 < d) && (curNumbers[t0] == prevNumbers[t0])) {
+        t0++;
+      }
+
+      for (size_t t = t0; t < d; t++) {
+        if (t + 1 < d) {
+          nodeChildrenStart[t].push_back(nodeFunctions[t + 1].size());
+        }
+
+        nodeFunctions[t].push_back(curNumbers[t]);
+      }
+
+      leafPoints.push_back(sortedPoints[k]);
+    }
+
+    for (size_t t = 0; t + 1 < d; t++) {
+      nodeChildrenStart[t].push_back(nodeFunctions[t + 1].size());
+    }
+
+    // diagonal of the matrix (for the preconditioner)
+    diagonal.assign(n, 1.0);
+
+    for (size_t i = 0; i < n; i++) {
+      for (size_t t = 0; t < d; t++) {
+        diagonal[i] *= evalBasisFunction1D(gridStorage[i], gridStorage[i], t);
+      }
+    }
+
+    tableModificationCount = gridStorage.getModificationCount();
+    tablesPrepared = true;
+  }
+
+  /**
+   * Computes the data structures for matrixVectorMultiplication() if they
+   * have not been computed yet or if the grid storage has been modified
+   * since then (see base::HashGridStorage::getModificationCount()).
+   */
+  void updateMatrixVectorMultiplication() {
+    std::lock_guard<std::mutex> lock(tableMutex);
+
+    if (!tablesPrepared || (tableModificationCount != gridStorage.getModificationCount())) {
+      prepareMatrixVectorMultiplication();
+    }
+  }
+
+  /**
+   * Collects the non-zero entries of a row of the matrix by traversing the
+   * tree of grid points: in the t-th dimension, only the children whose
+   * 1D function does not vanish at the 1D coordinate of the row's grid point
+   * are visited.
+   *
+   * @param       pointNumbers  1D function numbers of the row's grid point
+   * @param       t             current dimension
+   * @param       begin         index of the first node in depth t to be considered
+   * @param       end           index after the last node in depth t to be considered
+   * @param       product       product of the 1D values of the dimensions
+   *                            before t
+   * @param[out]  entries       pairs of column indices and values of
+   *                            the non-zero entries
+   */
+  void collectRowEntries(const size_t* pointNumbers, size_t t, size_t begin, size_t end,
+                         double product, std::vector<std::pair<size_t, double>>& entries) const {
+    const size_t d = gridStorage.getDimension();
+    const size_t c = pointNumbers[t];
+    const std::vector<size_t>& functions = nodeFunctions[t];
+    size_t k = tableRowStart[t][c];
+    const size_t kEnd = tableRowStart[t][c + 1];
+    size_t node = begin;
+
+    // intersect the (ascending) function numbers of the nodes and the table row
+    while ((k < kEnd) && (node < end)) {
+      const size_t f = tableFunctions[t][k];
+
+      if (functions[node] < f) {
+        node++;
+      } else if (f < functions[node]) {
+        k++;
+      } else {
+        const double newProduct = product * tableValues[t][k];
+
+        if (t + 1 == d) {
+          entries.push_back(std::make_pair(leafPoints[node], newProduct));
+        } else {
+          collectRowEntries(pointNumbers, t + 1, nodeChildrenStart[t][node],
+                            nodeChildrenStart[t][node + 1], newProduct, entries);
+        }
+
+        node++;
+        k++;
+      }
+    }
+  }
+
+  /**
+   * @param gpBasis   grid point corresponding to the basis function
+   * @param gpPoint   grid point at which the basis function is evaluated
+   * @param t         dimension
+   * @return          value of the 1D factor in the t-th dimension of the
+   *                  basis function at the grid point
+   */
+  inline double evalBasisFunction1D(const base::GridPoint& gpBasis,
+                                    const base::GridPoint& gpPoint, size_t t) {
+    const base::level_t l = gpBasis.getLevel(t);
+    const base::index_t i = gpBasis.getIndex(t);
+    const double x = gridStorage.getUnitCoordinate(gpPoint, t);
+
+    if (basisType == BSPLINE) {
+      return bsplineBasis->eval(l, i, x);
+    } else if (basisType == BSPLINE_BOUNDARY) {
+      return bsplineBoundaryBasis->eval(l, i, x);
+    } else if (basisType == BSPLINE_CLENSHAW_CURTIS) {
+      return bsplineClenshawCurtisBasis->eval(l, i, x);
+    } else if (basisType == BSPLINE_MODIFIED) {
+      return modBsplineBasis->eval(l, i, x);
+    } else if (basisType == BSPLINE_MODIFIED_CLENSHAW_CURTIS) {
+      return modBsplineClenshawCurtisBasis->eval(l, i, x);
+    } else if (basisType == FUNDAMENTAL_SPLINE) {
+      return fundamentalSplineBasis->eval(l, i, x);
+    } else if (basisType == FUNDAMENTAL_SPLINE_MODIFIED) {
+      return modFundamentalSplineBasis->eval(l, i, x);
+    } else if (basisType == LINEAR) {
+      return linearBasis->eval(l, i, x);
+    } else if (basisType == LINEAR_BOUNDARY) {
+      return linearL0BoundaryBasis->eval(l, i, x);
+    } else if (basisType == LINEAR_CLENSHAW_CURTIS) {
+      return linearClenshawCurtisBasis->eval(l, i, x);
+    } else if (basisType == LINEAR_CLENSHAW_CURTIS_BOUNDARY) {
+      return linearClenshawCurtisBoundaryBasis->eval(l, i, x);
+    } else if (basisType == LINEAR_MODIFIED) {
+      return modLinearBasis->eval(l, i, x);
+    } else if (basisType == WAVELET) {
+      return waveletBasis->eval(l, i, x);
+    } else if (basisType == WAVELET_BOUNDARY) {
+      return waveletBoundaryBasis->eval(l, i, x);
+    } else if (basisType == WAVELET_MODIFIED) {
+      return modWaveletBasis->eval(l, i, x);
+    } else if (basisType == NAK_BSPLINEBOUNDARY_COMBIGRID) {
+      return nakBsplineBoundaryCombigridBasis->eval(l, i, gridStorage.getCoordinate(gpPoint, t));
+    } else {
+      return 0.0;
+    }
+  }
+
   /**
    * @param basisI    basis function index
    * @param pointJ    grid point index
@@ -68,6 +68,32 @@ class SLE {
     }
   }
 
+  /**
+   * Apply a preconditioner, i.e., an approximation of the inverse of
+   * the matrix, to a vector.
+   * Standard implementation: Jacobi preconditioner (inverse diagonal).
+   *
+   * @param       x   vector to be preconditioned
+   * @param[out]  y   \f$y \approx A^{-1} x\f$
+   */
+  virtual void applyPreconditioner(const base::DataVector& x, base::DataVector& y) {
+    const size_t n = getDimension();
+    y.resize(n);
+
+    for (size_t i = 0; i < n; i++) {
+      const double Aii = getMatrixEntry(i, i);
+      y[i] = ((Aii != 0.0) ? (x[i] / Aii) : x[i]);
+    }
+  }
+
+  /**
+   * @return whether matrixVectorMultiplication() is considerably faster than
+   *         the \f$\mathcal{O}(n^2)\f$ standard implementation, i.e., whether
+   *         iterative solvers should be preferred for large systems
+   *         (standard: false)
+   */
+  virtual bool hasFastMatrixVectorMultiplication() const { return false; }
+
   /**
    * Count all non-zero entries.
    * Standard implementation with \f$\mathcal{O}(n^2)\f$ checks.
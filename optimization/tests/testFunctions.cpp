@@ -9,6 +9,8 @@
 #include <sgpp/optimization/function/scalar/ComponentScalarFunction.hpp>
 #include <sgpp/optimization/function/scalar/ComponentScalarFunctionGradient.hpp>
 #include <sgpp/optimization/function/scalar/ComponentScalarFunctionHessian.hpp>
+#include <sgpp/optimization/function/scalar/InterpolantScalarFunctionGradient.hpp>
+#include <sgpp/optimization/function/scalar/InterpolantScalarFunctionHessian.hpp>
 #include <sgpp/optimization/function/scalar/WrapperScalarFunction.hpp>
 #include <sgpp/optimization/function/scalar/WrapperScalarFunctionGradient.hpp>
 #include <sgpp/optimization/function/scalar/WrapperScalarFunctionHessian.hpp>
@@ -28,6 +30,8 @@ using sgpp::base::DataVector;
 using sgpp::optimization::ComponentScalarFunction;
 using sgpp::optimization::ComponentScalarFunctionGradient;
 using sgpp::optimization::ComponentScalarFunctionHessian;
+using sgpp::optimization::InterpolantScalarFunctionGradient;
+using sgpp::optimization::InterpolantScalarFunctionHessian;
 using sgpp::optimization::RandomNumberGenerator;
 using sgpp::optimization::ScalarFunction;
 using sgpp::optimization::ScalarFunctionGradient;
@@ -450,3 +454,87 @@ BOOST_AUTO_TEST_CASE(TestWrapperVectorFunctionHessian) {
   f2.clone(f2Clone);
   checkEqualFunction(f1, *f2Clone);
 }
+
+BOOST_AUTO_TEST_CASE(TestInterpolantScalarFunctionBatchEvaluation) {
+  // Test batch evaluation of sgpp::optimization::InterpolantScalarFunctionGradient
+  // and sgpp::optimization::InterpolantScalarFunctionHessian.
+  RandomNumberGenerator::getInstance().setSeed(42);
+
+  const size_t d = 3;
+  const size_t p = 3;
+  const size_t l = 4;
+  const size_t m = 20;
+
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createModBsplineGrid(d, p));
+  grid->getGenerator().regular(l);
+  DataVector alpha(grid->getSize());
+  RandomNumberGenerator::getInstance().getGaussianRV(alpha);
+
+  InterpolantScalarFunctionGradient fGradient(*grid, alpha);
+  InterpolantScalarFunctionHessian fHessian(*grid, alpha);
+  ScalarFunctionGradient& fGradientBase = fGradient;
+  ScalarFunctionHessian& fHessianBase = fHessian;
+
+  // last point is outside of the domain
+  DataMatrix x(m, d);
+  DataVector xRow(d);
+
+  for (size_t j = 0; j < m; j++) {
+    RandomNumberGenerator::getInstance().getUniformRV(xRow);
+    x.setRow(j, xRow);
+  }
+
+  x(m - 1, 0) = 1.5;
+
+  DataVector value(0);
+  DataMatrix gradient(0, 0);
+  std::vector<DataMatrix> hessian;
+  fGradientBase.eval(x, value, gradient);
+  BOOST_CHECK_EQUAL(value.getSize(), m);
+  BOOST_CHECK_EQUAL(gradient.getNrows(), m);
+  BOOST_CHECK_EQUAL(gradient.getNcols(), d);
+
+  DataVector gradient2(d);
+  DataMatrix hessian2(d, d);
+
+  for (size_t j = 0; j < m; j++) {
+    x.getRow(j, xRow);
+    const double fx = fGradient.eval(xRow, gradient2);
+
+    if (j == m - 1) {
+      BOOST_CHECK_EQUAL(fx, INFINITY);
+      BOOST_CHECK_EQUAL(value[j], INFINITY);
+      continue;
+    }
+
+    BOOST_CHECK_CLOSE(value[j], fx, 1e-10);
+
+    for (size_t t = 0; t < d; t++) {
+      BOOST_CHECK_CLOSE(gradient(j, t), gradient2[t], 1e-10);
+    }
+  }
+
+  fHessianBase.eval(x, value, gradient, hessian);
+  BOOST_CHECK_EQUAL(hessian.size(), m);
+
+  for (size_t j = 0; j < m; j++) {
+    x.getRow(j, xRow);
+    const double fx = fHessian.eval(xRow, gradient2, hessian2);
+
+    if (j == m - 1) {
+      BOOST_CHECK_EQUAL(fx, INFINITY);
+      BOOST_CHECK_EQUAL(value[j], INFINITY);
+      continue;
+    }
+
+    BOOST_CHECK_CLOSE(value[j], fx, 1e-10);
+
+    for (size_t t = 0; t < d; t++) {
+      BOOST_CHECK_CLOSE(gradient(j, t), gradient2[t], 1e-10);
+
+      for (size_t t2 = 0; t2 < d; t2++) {
+        BOOST_CHECK_CLOSE(hessian[j](t, t2), hessian2(t, t2), 1e-10);
+      }
+    }
+  }
+}
@@ -6,8 +6,10 @@
 #define BOOST_TEST_DYN_LINK
 #include <boost/test/unit_test.hpp>
 
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
 #include <sgpp/optimization/test_problems/unconstrained/Sphere.hpp>
 #include <sgpp/optimization/operation/OptimizationOpFactory.hpp>
+#include <sgpp/optimization/operation/hash/IncrementalHierarchisation.hpp>
 #include <sgpp/optimization/tools/Printer.hpp>
 #include <sgpp/optimization/tools/RandomNumberGenerator.hpp>
 
@@ -15,6 +17,7 @@
 
 #include "GridCreator.hpp"
 
+using sgpp::optimization::IncrementalHierarchisation;
 using sgpp::optimization::OperationMultipleHierarchisation;
 using sgpp::optimization::Printer;
 using sgpp::optimization::RandomNumberGenerator;
@@ -75,3 +78,77 @@ BOOST_AUTO_TEST_CASE(TestOperationMultipleHierarchisation) {
     }
   }
 }
+
+BOOST_AUTO_TEST_CASE(TestOperationMultipleHierarchisationIncremental) {
+  Printer::getInstance().setVerbosity(-1);
+  RandomNumberGenerator::getInstance().setSeed(42);
+
+  const size_t d = 2;
+  const size_t p = 3;
+  const size_t l = 4;
+  const size_t refinementCount = 3;
+  const double tol = 1e-4;
+
+  Sphere testProblem(d);
+  ScalarFunction& f = testProblem.getObjectiveFunction();
+
+  std::vector<std::unique_ptr<sgpp::base::Grid>> grids;
+  createSupportedGrids(d, p, grids);
+
+  for (auto& grid : grids) {
+    sgpp::base::GridStorage& gridStorage = grid->getStorage();
+    sgpp::base::DataVector functionValues(0);
+    testProblem.generateDisplacement();
+    createSampleGrid(*grid, l, f, functionValues);
+
+    std::unique_ptr<OperationMultipleHierarchisation> op(
+      sgpp::op_factory::createOperationMultipleHierarchisation(*grid));
+
+    sgpp::base::DataVector alpha(functionValues);
+    op->doHierarchisation(alpha);
+
+    // refine some points and evaluate f at the new points
+    const size_t oldSize = gridStorage.getSize();
+    sgpp::base::DataVector refinementAlpha(oldSize);
+
+    for (size_t i = 0; i < oldSize; i++) {
+      refinementAlpha[i] = RandomNumberGenerator::getInstance().getUniformRN();
+    }
+
+    sgpp::base::SurplusRefinementFunctor refineFunc(refinementAlpha, refinementCount);
+    grid->getGenerator().refine(refineFunc);
+
+    const size_t newSize = gridStorage.getSize();
+    BOOST_CHECK_GT(newSize, oldSize);
+    std::vector<size_t> newPoints;
+    sgpp::base::DataVector x(d);
+    functionValues.resize(newSize);
+
+    for (size_t i = oldSize; i < newSize; i++) {
+      newPoints.push_back(i);
+      x = gridStorage.getCoordinates(gridStorage[i]);
+      functionValues[i] = f.eval(x);
+    }
+
+    // for hat functions, a normal refinement step has to be handled by the
+    // patch update (without solving the whole system)
+    if ((grid->getType() == sgpp::base::GridType::Linear) ||
+        (grid->getType() == sgpp::base::GridType::LinearBoundary) ||
+        (grid->getType() == sgpp::base::GridType::ModLinear)) {
+      IncrementalHierarchisation incrementalHierarchisation(*grid);
+      sgpp::base::DataVector alphaPatch(alpha);
+      BOOST_CHECK(incrementalHierarchisation.update(alphaPatch, functionValues, newPoints));
+      BOOST_CHECK(!incrementalHierarchisation.isWholeSystemSolved());
+    }
+
+    BOOST_CHECK(op->doIncrementalHierarchisation(alpha, functionValues, newPoints));
+    BOOST_CHECK_EQUAL(alpha.getSize(), newSize);
+
+    // the updated coefficients have to interpolate the function values
+    op->doDehierarchisation(alpha);
+
+    for (size_t i = 0; i < newSize; i++) {
+      BOOST_CHECK_CLOSE(functionValues[i], alpha[i], tol);
+    }
+  }
+}
@@ -31,6 +31,7 @@
 #include <sgpp/optimization/optimizer/constrained/LogBarrier.hpp>
 #include <sgpp/optimization/optimizer/constrained/SquaredPenalty.hpp>
 #include <sgpp/optimization/tools/Printer.hpp>
+#include <sgpp/optimization/tools/RandomNumberGenerator.hpp>
 
 #include <vector>
 
@@ -308,12 +309,25 @@ BOOST_AUTO_TEST_CASE(TestUnconstrainedOptimizers) {
     differentialEvolution.setPopulationSize(populationSize);
     BOOST_CHECK_EQUAL(differentialEvolution.getPopulationSize(),
                       populationSize);
+
+    BOOST_CHECK(differentialEvolution.isParallelEvaluationEnabled());
+    differentialEvolution.setParallelEvaluationEnabled(false);
+    BOOST_CHECK(!differentialEvolution.isParallelEvaluationEnabled());
   }
 
   {
     sgpp::optimization::optimizer::CMAES cmaes(f, N);
 
     checkEqualFunction(cmaes.getObjectiveFunction(), f);
+
+    BOOST_CHECK_EQUAL(cmaes.getEigenUpdateInterval(), 0U);
+    const size_t eigenUpdateInterval = 5;
+    cmaes.setEigenUpdateInterval(eigenUpdateInterval);
+    BOOST_CHECK_EQUAL(cmaes.getEigenUpdateInterval(), eigenUpdateInterval);
+
+    BOOST_CHECK(cmaes.isParallelEvaluationEnabled());
+    cmaes.setParallelEvaluationEnabled(false);
+    BOOST_CHECK(!cmaes.isParallelEvaluationEnabled());
   }
 
   for (size_t k = 0; k < 2; k++) {
@@ -380,6 +394,49 @@ BOOST_AUTO_TEST_CASE(TestUnconstrainedOptimizers) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(TestPopulationBasedOptimizersParallelEvaluation) {
+  // Test that the parallel evaluation of the population does not change the results.
+  Printer::getInstance().setVerbosity(-1);
+
+  ExampleFunction f;
+  const size_t N = 1000;
+
+  std::vector<std::unique_ptr<sgpp::optimization::optimizer::UnconstrainedOptimizer>> optimizers;
+  optimizers.push_back(std::unique_ptr<sgpp::optimization::optimizer::UnconstrainedOptimizer>(
+                           new sgpp::optimization::optimizer::DifferentialEvolution(f, N)));
+  optimizers.push_back(std::unique_ptr<sgpp::optimization::optimizer::UnconstrainedOptimizer>(
+                           new sgpp::optimization::optimizer::CMAES(f, N)));
+  optimizers.push_back(std::unique_ptr<sgpp::optimization::optimizer::UnconstrainedOptimizer>(
+                           new sgpp::optimization::optimizer::CMAES(f, N, 3)));
+
+  for (size_t i = 0; i < optimizers.size(); i++) {
+    sgpp::base::DataVector xOpt[2];
+    double fOpt[2];
+
+    for (size_t k = 0; k < 2; k++) {
+      if (i == 0) {
+        dynamic_cast<sgpp::optimization::optimizer::DifferentialEvolution&>(*optimizers[i])
+            .setParallelEvaluationEnabled(k == 1);
+      } else {
+        dynamic_cast<sgpp::optimization::optimizer::CMAES&>(*optimizers[i])
+            .setParallelEvaluationEnabled(k == 1);
+      }
+
+      sgpp::optimization::RandomNumberGenerator::getInstance().setSeed(42);
+      optimizers[i]->optimize();
+      xOpt[k] = optimizers[i]->getOptimalPoint();
+      fOpt[k] = optimizers[i]->getOptimalValue();
+    }
+
+    BOOST_CHECK_EQUAL(xOpt[0].getSize(), 2U);
+    BOOST_CHECK_EQUAL(xOpt[1].getSize(), 2U);
+    BOOST_CHECK_EQUAL(xOpt[0][0], xOpt[1][0]);
+    BOOST_CHECK_EQUAL(xOpt[0][1], xOpt[1][1]);
+    BOOST_CHECK_EQUAL(fOpt[0], fOpt[1]);
+    BOOST_CHECK_CLOSE(fOpt[1], -2.0, 1e-4);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(TestLeastSquaresOptimizers) {
   // Test least squares optimizers in sgpp::optimization::optimizer.
   Printer::getInstance().setVerbosity(-1);
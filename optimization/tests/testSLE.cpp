@@ -13,6 +13,7 @@
 #include <sgpp/optimization/sle/solver/Eigen.hpp>
 #include <sgpp/optimization/sle/solver/GaussianElimination.hpp>
 #include <sgpp/optimization/sle/solver/Gmmpp.hpp>
+#include <sgpp/optimization/sle/solver/GMRES.hpp>
 #include <sgpp/optimization/sle/solver/UMFPACK.hpp>
 #include <sgpp/optimization/sle/system/FullSLE.hpp>
 #include <sgpp/optimization/sle/system/HierarchisationSLE.hpp>
@@ -99,6 +100,10 @@ BOOST_AUTO_TEST_CASE(TestSLESolvers) {
                                 new sgpp::optimization::sle_solver::BiCGStab()));
   solvers.push_back(std::unique_ptr<sgpp::optimization::sle_solver::SLESolver>(
                                 new sgpp::optimization::sle_solver::GaussianElimination()));
+  // without restarts, GMRES is exact after at most n iterations
+  solvers.push_back(std::unique_ptr<sgpp::optimization::sle_solver::SLESolver>(
+                                new sgpp::optimization::sle_solver::GMRES(
+                                    1000, 1e-10, 200, sgpp::base::DataVector(0))));
   solvers.push_back(std::unique_ptr<sgpp::optimization::sle_solver::SLESolver>(
                                 new sgpp::optimization::sle_solver::Auto()));
 
@@ -145,6 +150,28 @@ BOOST_AUTO_TEST_CASE(TestSLESolvers) {
     }
   }
 
+  {
+    sgpp::optimization::sle_solver::GMRES gmres;
+
+    const size_t maxItCount = 42;
+    gmres.setMaxItCount(maxItCount);
+    BOOST_CHECK_EQUAL(gmres.getMaxItCount(), maxItCount);
+
+    const double tolerance = 0.42;
+    gmres.setTolerance(tolerance);
+    BOOST_CHECK_EQUAL(gmres.getTolerance(), tolerance);
+
+    const size_t restart = 13;
+    gmres.setRestart(restart);
+    BOOST_CHECK_EQUAL(gmres.getRestart(), restart);
+
+    sgpp::base::DataVector startingPoint(2);
+    startingPoint[0] = 1.2;
+    startingPoint[1] = 3.4;
+    gmres.setStartingPoint(startingPoint);
+    BOOST_CHECK_EQUAL(gmres.getStartingPoint().getSize(), startingPoint.getSize());
+  }
+
   // test various SLE dimensions
   for (size_t n : {
          1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 20, 50, 100, 200
@@ -272,3 +299,61 @@ BOOST_AUTO_TEST_CASE(TestHierarchisationSLE) {
     }
   }
 }
+
+BOOST_AUTO_TEST_CASE(TestHierarchisationSLEMatrixFree) {
+  // Test solving sgpp::optimization::HierarchisationSLE with
+  // sgpp::optimization::sle_solver::GMRES (matrix-free).
+  Printer::getInstance().setVerbosity(-1);
+
+  const size_t d = 3;
+  const size_t p = 3;
+  const size_t l = 5;
+
+  sgpp::optimization::sle_solver::GMRES solver(1000, 1e-12, 50, sgpp::base::DataVector(0));
+  ExampleFunction f;
+
+  std::vector<std::unique_ptr<sgpp::base::Grid>> grids;
+  grids.push_back(std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createBsplineGrid(d, p)));
+  grids.push_back(
+      std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createModBsplineGrid(d, p)));
+  grids.push_back(std::unique_ptr<sgpp::base::Grid>(
+      sgpp::base::Grid::createFundamentalSplineGrid(d, p)));
+
+  for (auto& grid : grids) {
+    sgpp::base::DataVector functionValues(0);
+    createSampleGrid(*grid, l, f, functionValues);
+    const size_t n = grid->getSize();
+
+    HierarchisationSLE system(*grid);
+    BOOST_CHECK(system.hasFastMatrixVectorMultiplication());
+
+    // solve system
+    sgpp::base::DataVector alpha(0);
+    BOOST_CHECK(solver.solve(system, functionValues, alpha));
+    BOOST_CHECK_EQUAL(alpha.getSize(), n);
+
+    // test residual (with standard matrix-vector product)
+    sgpp::base::DataVector Ax(n);
+    system.SLE::matrixVectorMultiplication(alpha, Ax);
+    Ax.sub(functionValues);
+    BOOST_CHECK_SMALL(Ax.l2Norm() / functionValues.l2Norm(), 1e-8);
+
+    // replace the last grid point (same grid size), the matrix-free product
+    // has to use the new grid point
+    sgpp::base::GridStorage& gridStorage = grid->getStorage();
+    sgpp::base::GridPoint gp(gridStorage[0]);
+    gp.set(0, static_cast<sgpp::base::level_t>(l + 2), 1);
+    gridStorage.deleteLast();
+    gridStorage.insert(gp);
+    BOOST_CHECK_EQUAL(grid->getSize(), n);
+
+    sgpp::base::DataVector y(n);
+    sgpp::base::DataVector yStandard(n);
+    system.matrixVectorMultiplication(alpha, y);
+    system.SLE::matrixVectorMultiplication(alpha, yStandard);
+
+    for (size_t i = 0; i < n; i++) {
+      BOOST_CHECK_SMALL(y[i] - yStandard[i], 1e-10);
+    }
+  }
+}
@@ -11,10 +11,6 @@
 
 #include <sgpp/pde/operation/PdeOpFactory.hpp>
 
-#ifdef _OPENMP
-#include <omp.h>
-#endif
-
 #include <sgpp/globaldef.hpp>
 
 #include <vector>
@@ -95,37 +91,24 @@ void HeatEquationParabolicPDESolverSystemParallelOMP::applyLOperatorComplete(
 
   std::vector<size_t> algoDims = this->InnerGrid->getStorage().getAlgorithmicDimensions();
   size_t nDims = algoDims.size();
-#ifdef _OPENMP
-  omp_lock_t Mutex;
-  omp_init_lock(&Mutex);
-#endif
+  // one result per dimension, summed up in a fixed order after all tasks have finished
+  std::vector<sgpp::base::DataVector> myResults(nDims, sgpp::base::DataVector(result.getSize()));
 
   // Apply Laplace, parallel in Dimensions
   for (size_t i = 0; i < nDims; i++) {
-#pragma omp task firstprivate(i) shared(alpha, temp, result, algoDims)
+#pragma omp task firstprivate(i) shared(alpha, myResults, algoDims)
     {
-      sgpp::base::DataVector myResult(result.getSize());
-
       /// discuss methods in order to avoid this cast
       reinterpret_cast<UpDownOneOpDim*>(this->OpLaplaceBound)
-          ->multParallelBuildingBlock(alpha, myResult, algoDims[i]);
-
-// semaphore
-#ifdef _OPENMP
-      omp_set_lock(&Mutex);
-#endif
-      temp.add(myResult);
-#ifdef _OPENMP
-      omp_unset_lock(&Mutex);
-#endif
+          ->multParallelBuildingBlock(alpha, myResults[i], algoDims[i]);
     }
   }
 
 #pragma omp taskwait
 
-#ifdef _OPENMP
-  omp_destroy_lock(&Mutex);
-#endif
+  for (size_t i = 0; i < nDims; i++) {
+    temp.add(myResults[i]);
+  }
 
   result.axpy((-1.0) * this->a, temp);
 }
@@ -150,37 +133,24 @@ void HeatEquationParabolicPDESolverSystemParallelOMP::applyLOperatorInner(
 
   std::vector<size_t> algoDims = this->InnerGrid->getStorage().getAlgorithmicDimensions();
   size_t nDims = algoDims.size();
-#ifdef _OPENMP
-  omp_lock_t Mutex;
-  omp_init_lock(&Mutex);
-#endif
+  // one result per dimension, summed up in a fixed order after all tasks have finished
+  std::vector<sgpp::base::DataVector> myResults(nDims, sgpp::base::DataVector(result.getSize()));
 
   // Apply Laplace, parallel in Dimensions
   for (size_t i = 0; i < nDims; i++) {
-#pragma omp task firstprivate(i) shared(alpha, temp, result, algoDims)
+#pragma omp task firstprivate(i) shared(alpha, myResults, algoDims)
     {
-      sgpp::base::DataVector myResult(result.getSize());
-
       /// discuss methods in order to avoid this cast
       reinterpret_cast<UpDownOneOpDim*>(this->OpLaplaceInner)
-          ->multParallelBuildingBlock(alpha, myResult, algoDims[i]);
-
-// semaphore
-#ifdef _OPENMP
-      omp_set_lock(&Mutex);
-#endif
-      temp.add(myResult);
-#ifdef _OPENMP
-      omp_unset_lock(&Mutex);
-#endif
+          ->multParallelBuildingBlock(alpha, myResults[i], algoDims[i]);
     }
   }
 
 #pragma omp taskwait
 
-#ifdef _OPENMP
-  omp_destroy_lock(&Mutex);
-#endif
+  for (size_t i = 0; i < nDims; i++) {
+    temp.add(myResults[i]);
+  }
 
   result.axpy((-1.0) * this->a, temp);
 }
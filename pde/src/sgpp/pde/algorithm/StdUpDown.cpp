@@ -18,24 +18,24 @@ StdUpDown::StdUpDown(sgpp::base::GridStorage* storage)
 StdUpDown::~StdUpDown() {}
 
 void StdUpDown::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) {
-  sgpp::base::DataVector beta(result.getSize());
+  UpDownScratchPool::Buffer beta(this->scratch, result.getSize());
   result.setAll(0.0);
 #pragma omp parallel
   {
 #pragma omp single nowait
-    { this->updown(alpha, beta, this->numAlgoDims_ - 1); }
+    { this->updown(alpha, *beta, this->numAlgoDims_ - 1); }
   }
-  result.add(beta);
+  result.add(*beta);
 }
 
 void StdUpDown::multParallelBuildingBlock(sgpp::base::DataVector& alpha,
                                           sgpp::base::DataVector& result) {
-  sgpp::base::DataVector beta(result.getSize());
+  UpDownScratchPool::Buffer beta(this->scratch, result.getSize());
   result.setAll(0.0);
 
-  this->updown(alpha, beta, this->numAlgoDims_ - 1);
+  this->updown(alpha, *beta, this->numAlgoDims_ - 1);
 
-  result.add(beta);
+  result.add(*beta);
 }
 
 void StdUpDown::updown(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim) {
@@ -45,39 +45,39 @@ void StdUpDown::updown(sgpp::base::DataVector& alpha, sgpp::base::DataVector& re
   // Unidirectional scheme
   if (dim > 0) {
     // Reordering ups and downs
-    sgpp::base::DataVector temp(alpha.getSize());
-    sgpp::base::DataVector result_temp(alpha.getSize());
-    sgpp::base::DataVector temp_two(alpha.getSize());
+    UpDownScratchPool::Buffer temp(this->scratch, alpha.getSize());
+    UpDownScratchPool::Buffer result_temp(this->scratch, alpha.getSize());
+    UpDownScratchPool::Buffer temp_two(this->scratch, alpha.getSize());
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp, result)
     {
-      up(alpha, temp, this->algoDims[dim]);
-      updown(temp, result, dim - 1);
+      up(alpha, *temp, this->algoDims[dim]);
+      updown(*temp, result, dim - 1);
     }
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp_two, \
                                                                         result_temp)
     {  // NOLINT(whitespace/braces)
-      updown(alpha, temp_two, dim - 1);
-      down(temp_two, result_temp, this->algoDims[dim]);
+      updown(alpha, *temp_two, dim - 1);
+      down(*temp_two, *result_temp, this->algoDims[dim]);
     }
 
 #pragma omp taskwait
 
-    result.add(result_temp);
+    result.add(*result_temp);
   } else {
     // Terminates dimension recursion
-    sgpp::base::DataVector temp(alpha.getSize());
+    UpDownScratchPool::Buffer temp(this->scratch, alpha.getSize());
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, result)
     up(alpha, result, this->algoDims[dim]);
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp)
-    down(alpha, temp, this->algoDims[dim]);
+    down(alpha, *temp, this->algoDims[dim]);
 
 #pragma omp taskwait
 
-    result.add(temp);
+    result.add(*temp);
   }
 }
 }  // namespace pde
@@ -27,34 +27,41 @@ UpDownOneOpDim::~UpDownOneOpDim() {}
 void UpDownOneOpDim::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) {
   result.setAll(0.0);
 
+  // one partial result per dimension, summed up in a fixed order afterwards so that the
+  // result does not depend on the order in which the tasks finish
+  this->dimResults.resize(this->numAlgoDims_);
+
 #pragma omp parallel
   {
 #pragma omp single nowait
     {
       for (size_t i = 0; i < this->numAlgoDims_; i++) {
+        if (this->coefs != NULL && this->coefs->get(i) == 0.0) {
+          continue;
+        }
+
 #pragma omp task firstprivate(i) shared(alpha, result)
         {
-          sgpp::base::DataVector beta(result.getSize());
-
-          if (this->coefs != NULL) {
-            if (this->coefs->get(i) != 0.0) {
-              this->updown(alpha, beta, this->numAlgoDims_ - 1, i);
-
-#pragma omp critical
-              { result.axpy(this->coefs->get(i), beta); }
-            }
-          } else {
-            this->updown(alpha, beta, this->numAlgoDims_ - 1, i);
-
-#pragma omp critical
-            { result.add(beta); }
-          }
+          sgpp::base::DataVector& beta = this->dimResults[i];
+          beta.resize(result.getSize());
+          beta.setAll(0.0);
+          this->updown(alpha, beta, this->numAlgoDims_ - 1, i);
         }
       }
 
 #pragma omp taskwait
     }
   }
+
+  for (size_t i = 0; i < this->numAlgoDims_; i++) {
+    if (this->coefs != NULL) {
+      if (this->coefs->get(i) != 0.0) {
+        result.axpy(this->coefs->get(i), this->dimResults[i]);
+      }
+    } else {
+      result.add(this->dimResults[i]);
+    }
+  }
 }
 
 void UpDownOneOpDim::multParallelBuildingBlock(sgpp::base::DataVector& alpha,
@@ -62,18 +69,18 @@ void UpDownOneOpDim::multParallelBuildingBlock(sgpp::base::DataVector& alpha,
                                                size_t operationDim) {
   result.setAll(0.0);
 
-  sgpp::base::DataVector beta(result.getSize());
-
   if (this->coefs != NULL) {
     if (this->coefs->get(operationDim) != 0.0) {
-      this->updown(alpha, beta, this->numAlgoDims_ - 1, operationDim);
+      UpDownScratchPool::Buffer beta(this->scratch, result.getSize());
+      this->updown(alpha, *beta, this->numAlgoDims_ - 1, operationDim);
 
-      result.axpy(this->coefs->get(operationDim), beta);
+      result.axpy(this->coefs->get(operationDim), *beta);
     }
   } else {
-    this->updown(alpha, beta, this->numAlgoDims_ - 1, operationDim);
+    UpDownScratchPool::Buffer beta(this->scratch, result.getSize());
+    this->updown(alpha, *beta, this->numAlgoDims_ - 1, operationDim);
 
-    result.add(beta);
+    result.add(*beta);
   }
 }
 
@@ -88,40 +95,40 @@ void UpDownOneOpDim::updown(sgpp::base::DataVector& alpha, sgpp::base::DataVecto
     // Unidirectional scheme
     if (dim > 0) {
       // Reordering ups and downs
-      sgpp::base::DataVector temp(alpha.getSize());
-      sgpp::base::DataVector result_temp(alpha.getSize());
-      sgpp::base::DataVector temp_two(alpha.getSize());
+      UpDownScratchPool::Buffer temp(this->scratch, alpha.getSize());
+      UpDownScratchPool::Buffer result_temp(this->scratch, alpha.getSize());
+      UpDownScratchPool::Buffer temp_two(this->scratch, alpha.getSize());
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp, result)
       {
-        up(alpha, temp, this->algoDims[dim]);
-        updown(temp, result, dim - 1, op_dim);
+        up(alpha, *temp, this->algoDims[dim]);
+        updown(*temp, result, dim - 1, op_dim);
       }
 
 // Same from the other direction:
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp_two, \
                                                                         result_temp)
       {  // NOLINT(whitespace/braces)
-        updown(alpha, temp_two, dim - 1, op_dim);
-        down(temp_two, result_temp, this->algoDims[dim]);
+        updown(alpha, *temp_two, dim - 1, op_dim);
+        down(*temp_two, *result_temp, this->algoDims[dim]);
       }
 
 #pragma omp taskwait
 
-      result.add(result_temp);
+      result.add(*result_temp);
     } else {
       // Terminates dimension recursion
-      sgpp::base::DataVector temp(alpha.getSize());
+      UpDownScratchPool::Buffer temp(this->scratch, alpha.getSize());
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, result)
       up(alpha, result, this->algoDims[dim]);
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp)
-      down(alpha, temp, this->algoDims[dim]);
+      down(alpha, *temp, this->algoDims[dim]);
 
 #pragma omp taskwait
 
-      result.add(temp);
+      result.add(*temp);
     }
   }
 }
@@ -134,40 +141,40 @@ void UpDownOneOpDim::specialOP(sgpp::base::DataVector& alpha, sgpp::base::DataVe
   // Unidirectional scheme
   if (dim > 0) {
     // Reordering ups and downs
-    sgpp::base::DataVector temp(alpha.getSize());
-    sgpp::base::DataVector result_temp(alpha.getSize());
-    sgpp::base::DataVector temp_two(alpha.getSize());
+    UpDownScratchPool::Buffer temp(this->scratch, alpha.getSize());
+    UpDownScratchPool::Buffer result_temp(this->scratch, alpha.getSize());
+    UpDownScratchPool::Buffer temp_two(this->scratch, alpha.getSize());
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp, result)
     {
-      upOpDim(alpha, temp, this->algoDims[dim]);
-      updown(temp, result, dim - 1, op_dim);
+      upOpDim(alpha, *temp, this->algoDims[dim]);
+      updown(*temp, result, dim - 1, op_dim);
     }
 
 // Same from the other direction:
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp_two, \
                                                                         result_temp)
     {  // NOLINT(whitespace/braces)
-      updown(alpha, temp_two, dim - 1, op_dim);
-      downOpDim(temp_two, result_temp, this->algoDims[dim]);
+      updown(alpha, *temp_two, dim - 1, op_dim);
+      downOpDim(*temp_two, *result_temp, this->algoDims[dim]);
     }
 
 #pragma omp taskwait
 
-    result.add(result_temp);
+    result.add(*result_temp);
   } else {
     // Terminates dimension recursion
-    sgpp::base::DataVector temp(alpha.getSize());
+    UpDownScratchPool::Buffer temp(this->scratch, alpha.getSize());
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, result)
     upOpDim(alpha, result, this->algoDims[dim]);
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp)
-    downOpDim(alpha, temp, this->algoDims[dim]);
+    downOpDim(alpha, *temp, this->algoDims[dim]);
 
 #pragma omp taskwait
 
-    result.add(temp);
+    result.add(*temp);
   }
 }
 }  // namespace pde
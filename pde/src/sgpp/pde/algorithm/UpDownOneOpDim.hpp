@@ -9,6 +9,7 @@
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/pde/algorithm/UpDownScratchPool.hpp>
 
 #ifndef TASKS_PARALLEL_UPDOWN
 #define TASKS_PARALLEL_UPDOWN 4
@@ -87,6 +88,10 @@ class UpDownOneOpDim : public sgpp::base::OperationMatrix {
   const size_t numAlgoDims_;
   /// max number of parallel stages (dimension recursive calls)
   static const size_t maxParallelDims_ = TASKS_PARALLEL_UPDOWN;
+  /// temporary vectors of the recursion, reused across calls of mult()
+  UpDownScratchPool scratch;
+  /// partial results of mult() (one per dimension), reused across calls of mult()
+  std::vector<sgpp::base::DataVector> dimResults;
 
   /**
    * Recursive procedure for updown(), parallel version using OpenMP 3
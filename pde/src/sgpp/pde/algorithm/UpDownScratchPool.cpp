@@ -0,0 +1,75 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/pde/algorithm/UpDownScratchPool.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace sgpp {
+namespace pde {
+
+UpDownScratchPool::UpDownScratchPool() {
+#ifdef _OPENMP
+  freeLists.resize(omp_get_max_threads());
+#else
+  freeLists.resize(1);
+#endif
+}
+
+UpDownScratchPool::~UpDownScratchPool() {
+  for (size_t t = 0; t < freeLists.size(); t++) {
+    for (size_t i = 0; i < freeLists[t].size(); i++) {
+      delete freeLists[t][i];
+    }
+  }
+}
+
+size_t UpDownScratchPool::getFreeListIndex() const {
+#ifdef _OPENMP
+
+  // thread numbers are only unique if at most one team is active
+  if (omp_get_active_level() > 1) {
+    return freeLists.size();
+  }
+
+  return static_cast<size_t>(omp_get_thread_num());
+#else
+  return 0;
+#endif
+}
+
+sgpp::base::DataVector* UpDownScratchPool::acquire(size_t size) {
+  size_t t = getFreeListIndex();
+
+  if (t >= freeLists.size() || freeLists[t].empty()) {
+    return new sgpp::base::DataVector(size);
+  }
+
+  sgpp::base::DataVector* vector = freeLists[t].back();
+  freeLists[t].pop_back();
+
+  if (vector->getSize() != size) {
+    vector->resize(size);
+  }
+
+  vector->setAll(0.0);
+  return vector;
+}
+
+void UpDownScratchPool::release(sgpp::base::DataVector* vector) {
+  size_t t = getFreeListIndex();
+
+  if (t >= freeLists.size()) {
+    delete vector;
+  } else {
+    freeLists[t].push_back(vector);
+  }
+}
+}  // namespace pde
+}  // namespace sgpp
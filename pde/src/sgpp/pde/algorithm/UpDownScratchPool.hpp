@@ -0,0 +1,88 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef UPDOWNSCRATCHPOOL_HPP
+#define UPDOWNSCRATCHPOOL_HPP
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace pde {
+
+/**
+ * Pool of temporary vectors for the Up/Down schemes.
+ *
+ * The recursive up/down algorithms need several temporary vectors of the grid's size per
+ * recursion step. Instead of allocating them anew in every call of mult(), which is called
+ * in every iteration of a solver, they are taken from and returned to this pool.
+ * The pool keeps one free list per OpenMP thread, so no locking is needed. Inside nested
+ * parallel regions, the buffers are simply allocated and freed. As the free lists are selected
+ * by the OpenMP thread number, an operator must not be applied concurrently from threads that
+ * were not created by OpenMP.
+ */
+class UpDownScratchPool {
+ public:
+  /**
+   * Temporary vector that is filled with zeros on construction and returned to the pool on
+   * destruction.
+   */
+  class Buffer {
+   public:
+    /**
+     * @param pool pool the vector is taken from
+     * @param size size of the vector
+     */
+    Buffer(UpDownScratchPool& pool, size_t size) : pool(pool), vector(pool.acquire(size)) {}
+
+    ~Buffer() { pool.release(vector); }
+
+    sgpp::base::DataVector& operator*() { return *vector; }
+
+   private:
+    UpDownScratchPool& pool;
+    sgpp::base::DataVector* vector;
+
+    Buffer(const Buffer&) = delete;
+    Buffer& operator=(const Buffer&) = delete;
+  };
+
+  UpDownScratchPool();
+
+  ~UpDownScratchPool();
+
+  /**
+   * @param size size of the vector
+   * @return a vector of the given size filled with zeros
+   */
+  sgpp::base::DataVector* acquire(size_t size);
+
+  /**
+   * Returns a vector obtained by acquire() to the pool.
+   *
+   * @param vector the vector
+   */
+  void release(sgpp::base::DataVector* vector);
+
+ private:
+  /// one free list per OpenMP thread
+  std::vector<std::vector<sgpp::base::DataVector*> > freeLists;
+
+  /**
+   * @return index of the calling thread's free list or freeLists.size() if the pool cannot
+   * be used by the calling thread
+   */
+  size_t getFreeListIndex() const;
+
+  UpDownScratchPool(const UpDownScratchPool&) = delete;
+  UpDownScratchPool& operator=(const UpDownScratchPool&) = delete;
+};
+}  // namespace pde
+}  // namespace sgpp
+
+#endif /* UPDOWNSCRATCHPOOL_HPP */
@@ -27,32 +27,28 @@ UpDownTwoOpDims::~UpDownTwoOpDims() {}
 void UpDownTwoOpDims::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) {
   result.setAll(0.0);
 
+  // one partial result per pair of dimensions (i, j) with j <= i, stored at
+  // i * (i + 1) / 2 + j and summed up in a fixed order afterwards so that the result does not
+  // depend on the order in which the tasks finish
+  this->dimResults.resize(this->numAlgoDims_ * (this->numAlgoDims_ + 1) / 2);
+
 #pragma omp parallel
   {
 #pragma omp single nowait
     {
       for (size_t i = 0; i < this->numAlgoDims_; i++) {
-        for (size_t j = 0; j < this->numAlgoDims_; j++) {
-          // use the operator's symmetry
-          if (j <= i) {
+        // use the operator's symmetry
+        for (size_t j = 0; j <= i; j++) {
+          if (this->coefs != NULL && this->coefs->get(i, j) == 0.0) {
+            continue;
+          }
+
 #pragma omp task firstprivate(i, j) shared(alpha, result)
-            {
-              sgpp::base::DataVector beta(result.getSize());
-
-              if (this->coefs != NULL) {
-                if (this->coefs->get(i, j) != 0.0) {
-                  this->updown(alpha, beta, this->numAlgoDims_ - 1, i, j);
-
-#pragma omp critical
-                  { result.axpy(this->coefs->get(i, j), beta); }
-                }
-              } else {
-                this->updown(alpha, beta, this->numAlgoDims_ - 1, i, j);
-
-#pragma omp critical
-                { result.add(beta); }
-              }
-            }
+          {
+            sgpp::base::DataVector& beta = this->dimResults[i * (i + 1) / 2 + j];
+            beta.resize(result.getSize());
+            beta.setAll(0.0);
+            this->updown(alpha, beta, this->numAlgoDims_ - 1, i, j);
           }
         }
       }
@@ -60,24 +56,39 @@ void UpDownTwoOpDims::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector
 #pragma omp taskwait
     }
   }
+
+  for (size_t i = 0; i < this->numAlgoDims_; i++) {
+    for (size_t j = 0; j <= i; j++) {
+      sgpp::base::DataVector& beta = this->dimResults[i * (i + 1) / 2 + j];
+
+      if (this->coefs != NULL) {
+        if (this->coefs->get(i, j) != 0.0) {
+          result.axpy(this->coefs->get(i, j), beta);
+        }
+      } else {
+        result.add(beta);
+      }
+    }
+  }
 }
 
 void UpDownTwoOpDims::multParallelBuildingBlock(sgpp::base::DataVector& alpha,
                                                 sgpp::base::DataVector& result,
                                                 size_t operationDimOne, size_t operationDimTwo) {
   result.setAll(0.0);
-  sgpp::base::DataVector beta(result.getSize());
 
   // use the operator's symmetry
   if (operationDimTwo <= operationDimOne) {
     if (this->coefs != NULL) {
       if (this->coefs->get(operationDimOne, operationDimTwo) != 0.0) {
-        this->updown(alpha, beta, this->numAlgoDims_ - 1, operationDimOne, operationDimTwo);
-        result.axpy(this->coefs->get(operationDimOne, operationDimTwo), beta);
+        UpDownScratchPool::Buffer beta(this->scratch, result.getSize());
+        this->updown(alpha, *beta, this->numAlgoDims_ - 1, operationDimOne, operationDimTwo);
+        result.axpy(this->coefs->get(operationDimOne, operationDimTwo), *beta);
       }
     } else {
-      this->updown(alpha, beta, this->numAlgoDims_ - 1, operationDimOne, operationDimTwo);
-      result.add(beta);
+      UpDownScratchPool::Buffer beta(this->scratch, result.getSize());
+      this->updown(alpha, *beta, this->numAlgoDims_ - 1, operationDimOne, operationDimTwo);
+      result.add(*beta);
     }
   }
 }
@@ -101,40 +112,40 @@ void UpDownTwoOpDims::updown(sgpp::base::DataVector& alpha, sgpp::base::DataVect
     // Unidirectional scheme
     if (dim > 0) {
       // Reordering ups and downs
-      sgpp::base::DataVector temp(alpha.getSize());
-      sgpp::base::DataVector result_temp(alpha.getSize());
-      sgpp::base::DataVector temp_two(alpha.getSize());
+      UpDownScratchPool::Buffer temp(this->scratch, alpha.getSize());
+      UpDownScratchPool::Buffer result_temp(this->scratch, alpha.getSize());
+      UpDownScratchPool::Buffer temp_two(this->scratch, alpha.getSize());
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp, result)
       {
-        up(alpha, temp, this->algoDims[dim]);
-        updown(temp, result, dim - 1, op_dim_one, op_dim_two);
+        up(alpha, *temp, this->algoDims[dim]);
+        updown(*temp, result, dim - 1, op_dim_one, op_dim_two);
       }
 
 // Same from the other direction:
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp_two, \
                                                                         result_temp)
       {  // NOLINT(whitespace/braces)
-        updown(alpha, temp_two, dim - 1, op_dim_one, op_dim_two);
-        down(temp_two, result_temp, this->algoDims[dim]);
+        updown(alpha, *temp_two, dim - 1, op_dim_one, op_dim_two);
+        down(*temp_two, *result_temp, this->algoDims[dim]);
       }
 
 #pragma omp taskwait
 
-      result.add(result_temp);
+      result.add(*result_temp);
     } else {
       // Terminates dimension recursion
-      sgpp::base::DataVector temp(alpha.getSize());
+      UpDownScratchPool::Buffer temp(this->scratch, alpha.getSize());
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, result)
       up(alpha, result, this->algoDims[dim]);
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp)
-      down(alpha, temp, this->algoDims[dim]);
+      down(alpha, *temp, this->algoDims[dim]);
 
 #pragma omp taskwait
 
-      result.add(temp);
+      result.add(*temp);
     }
   }
 }
@@ -147,40 +158,40 @@ void UpDownTwoOpDims::specialOpOne(sgpp::base::DataVector& alpha, sgpp::base::Da
   // Unidirectional scheme
   if (dim > 0) {
     // Reordering ups and downs
-    sgpp::base::DataVector temp(alpha.getSize());
-    sgpp::base::DataVector result_temp(alpha.getSize());
-    sgpp::base::DataVector temp_two(alpha.getSize());
+    UpDownScratchPool::Buffer temp(this->scratch, alpha.getSize());
+    UpDownScratchPool::Buffer result_temp(this->scratch, alpha.getSize());
+    UpDownScratchPool::Buffer temp_two(this->scratch, alpha.getSize());
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp, result)
     {
-      upOpDimOne(alpha, temp, this->algoDims[dim]);
-      updown(temp, result, dim - 1, op_dim_one, op_dim_two);
+      upOpDimOne(alpha, *temp, this->algoDims[dim]);
+      updown(*temp, result, dim - 1, op_dim_one, op_dim_two);
     }
 
 // Same from the other direction:
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp_two, \
                                                                         result_temp)
     {  // NOLINT(whitespace/braces)
-      updown(alpha, temp_two, dim - 1, op_dim_one, op_dim_two);
-      downOpDimOne(temp_two, result_temp, this->algoDims[dim]);
+      updown(alpha, *temp_two, dim - 1, op_dim_one, op_dim_two);
+      downOpDimOne(*temp_two, *result_temp, this->algoDims[dim]);
     }
 
 #pragma omp taskwait
 
-    result.add(result_temp);
+    result.add(*result_temp);
   } else {
     // Terminates dimension recursion
-    sgpp::base::DataVector temp(alpha.getSize());
+    UpDownScratchPool::Buffer temp(this->scratch, alpha.getSize());
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, result)
     upOpDimOne(alpha, result, this->algoDims[dim]);
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp)
-    downOpDimOne(alpha, temp, this->algoDims[dim]);
+    downOpDimOne(alpha, *temp, this->algoDims[dim]);
 
 #pragma omp taskwait
 
-    result.add(temp);
+    result.add(*temp);
   }
 }
 
@@ -192,40 +203,40 @@ void UpDownTwoOpDims::specialOpTwo(sgpp::base::DataVector& alpha, sgpp::base::Da
   // Unidirectional scheme
   if (dim > 0) {
     // Reordering ups and downs
-    sgpp::base::DataVector temp(alpha.getSize());
-    sgpp::base::DataVector result_temp(alpha.getSize());
-    sgpp::base::DataVector temp_two(alpha.getSize());
+    UpDownScratchPool::Buffer temp(this->scratch, alpha.getSize());
+    UpDownScratchPool::Buffer result_temp(this->scratch, alpha.getSize());
+    UpDownScratchPool::Buffer temp_two(this->scratch, alpha.getSize());
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp, result)
     {
-      upOpDimTwo(alpha, temp, this->algoDims[dim]);
-      updown(temp, result, dim - 1, op_dim_one, op_dim_two);
+      upOpDimTwo(alpha, *temp, this->algoDims[dim]);
+      updown(*temp, result, dim - 1, op_dim_one, op_dim_two);
     }
 
 // Same from the other direction:
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp_two, \
                                                                         result_temp)
     {  // NOLINT(whitespace/braces)
-      updown(alpha, temp_two, dim - 1, op_dim_one, op_dim_two);
-      downOpDimTwo(temp_two, result_temp, this->algoDims[dim]);
+      updown(alpha, *temp_two, dim - 1, op_dim_one, op_dim_two);
+      downOpDimTwo(*temp_two, *result_temp, this->algoDims[dim]);
     }
 
 #pragma omp taskwait
 
-    result.add(result_temp);
+    result.add(*result_temp);
   } else {
     // Terminates dimension recursion
-    sgpp::base::DataVector temp(alpha.getSize());
+    UpDownScratchPool::Buffer temp(this->scratch, alpha.getSize());
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, result)
     upOpDimTwo(alpha, result, this->algoDims[dim]);
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp)
-    downOpDimTwo(alpha, temp, this->algoDims[dim]);
+    downOpDimTwo(alpha, *temp, this->algoDims[dim]);
 
 #pragma omp taskwait
 
-    result.add(temp);
+    result.add(*temp);
   }
 }
 
@@ -238,40 +249,40 @@ void UpDownTwoOpDims::specialOpOneAndOpTwo(sgpp::base::DataVector& alpha,
   // Unidirectional scheme
   if (dim > 0) {
     // Reordering ups and downs
-    sgpp::base::DataVector temp(alpha.getSize());
-    sgpp::base::DataVector result_temp(alpha.getSize());
-    sgpp::base::DataVector temp_two(alpha.getSize());
+    UpDownScratchPool::Buffer temp(this->scratch, alpha.getSize());
+    UpDownScratchPool::Buffer result_temp(this->scratch, alpha.getSize());
+    UpDownScratchPool::Buffer temp_two(this->scratch, alpha.getSize());
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp, result)
     {
-      upOpDimOneAndOpDimTwo(alpha, temp, this->algoDims[dim]);
-      updown(temp, result, dim - 1, op_dim_one, op_dim_two);
+      upOpDimOneAndOpDimTwo(alpha, *temp, this->algoDims[dim]);
+      updown(*temp, result, dim - 1, op_dim_one, op_dim_two);
     }
 
 // Same from the other direction:
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp_two, \
                                                                         result_temp)
     {  // NOLINT(whitespace/braces)
-      updown(alpha, temp_two, dim - 1, op_dim_one, op_dim_two);
-      downOpDimOneAndOpDimTwo(temp_two, result_temp, this->algoDims[dim]);
+      updown(alpha, *temp_two, dim - 1, op_dim_one, op_dim_two);
+      downOpDimOneAndOpDimTwo(*temp_two, *result_temp, this->algoDims[dim]);
     }
 
 #pragma omp taskwait
 
-    result.add(result_temp);
+    result.add(*result_temp);
   } else {
     // Terminates dimension recursion
-    sgpp::base::DataVector temp(alpha.getSize());
+    UpDownScratchPool::Buffer temp(this->scratch, alpha.getSize());
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, result)
     upOpDimOneAndOpDimTwo(alpha, result, this->algoDims[dim]);
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp)
-    downOpDimOneAndOpDimTwo(alpha, temp, this->algoDims[dim]);
+    downOpDimOneAndOpDimTwo(alpha, *temp, this->algoDims[dim]);
 
 #pragma omp taskwait
 
-    result.add(temp);
+    result.add(*temp);
   }
 }
 }  // namespace pde
@@ -10,6 +10,7 @@
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/pde/algorithm/UpDownScratchPool.hpp>
 
 #ifndef TASKS_PARALLEL_UPDOWN
 #define TASKS_PARALLEL_UPDOWN 4
@@ -99,6 +100,10 @@ class UpDownTwoOpDims : public sgpp::base::OperationMatrix {
   const size_t numAlgoDims_;
   /// max number of parallel stages (dimension recursive calls)
   static const size_t maxParallelDims_ = TASKS_PARALLEL_UPDOWN;
+  /// temporary vectors of the recursion, reused across calls of mult()
+  UpDownScratchPool scratch;
+  /// partial results of mult() (one per pair of dimensions), reused across calls of mult()
+  std::vector<sgpp::base::DataVector> dimResults;
 
   /**
    * Recursive procedure for updown, parallel version using OpenMP 3
@@ -45,14 +45,14 @@ void OperationLaplaceLinear::up(sgpp::base::DataVector& alpha, sgpp::base::DataV
                                 size_t dim) {
   PhiPhiUpBBLinear func(this->storage);
   sgpp::base::sweep<PhiPhiUpBBLinear> s(func, *this->storage);
-  s.sweep1D(alpha, result, dim);
+  s.sweep1DParallel(alpha, result, dim);
 }
 
 void OperationLaplaceLinear::down(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
                                   size_t dim) {
   PhiPhiDownBBLinear func(this->storage);
   sgpp::base::sweep<PhiPhiDownBBLinear> s(func, *this->storage);
-  s.sweep1D(alpha, result, dim);
+  s.sweep1DParallel(alpha, result, dim);
 }
 
 void OperationLaplaceLinear::downOpDim(sgpp::base::DataVector& alpha,
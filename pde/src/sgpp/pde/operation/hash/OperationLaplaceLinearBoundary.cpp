@@ -33,14 +33,14 @@ void OperationLaplaceLinearBoundary::up(sgpp::base::DataVector& alpha,
                                         sgpp::base::DataVector& result, size_t dim) {
   PhiPhiUpBBLinearBoundary func(this->storage);
   sgpp::base::sweep<PhiPhiUpBBLinearBoundary> s(func, *this->storage);
-  s.sweep1D_Boundary(alpha, result, dim);
+  s.sweep1D_BoundaryParallel(alpha, result, dim);
 }
 
 void OperationLaplaceLinearBoundary::down(sgpp::base::DataVector& alpha,
                                           sgpp::base::DataVector& result, size_t dim) {
   PhiPhiDownBBLinearBoundary func(this->storage);
   sgpp::base::sweep<PhiPhiDownBBLinearBoundary> s(func, *this->storage);
-  s.sweep1D_Boundary(alpha, result, dim);
+  s.sweep1D_BoundaryParallel(alpha, result, dim);
 }
 
 void OperationLaplaceLinearBoundary::downOpDim(sgpp::base::DataVector& alpha,
@@ -30,14 +30,14 @@ void OperationLaplaceLinearStretchedBoundary::up(sgpp::base::DataVector& alpha,
                                                  sgpp::base::DataVector& result, size_t dim) {
   PhiPhiUpBBLinearStretchedBoundary func(this->storage);
   sgpp::base::sweep<PhiPhiUpBBLinearStretchedBoundary> s(func, *this->storage);
-  s.sweep1D_Boundary(alpha, result, dim);
+  s.sweep1D_BoundaryParallel(alpha, result, dim);
 }
 
 void OperationLaplaceLinearStretchedBoundary::down(sgpp::base::DataVector& alpha,
                                                    sgpp::base::DataVector& result, size_t dim) {
   PhiPhiDownBBLinearStretchedBoundary func(this->storage);
   sgpp::base::sweep<PhiPhiDownBBLinearStretchedBoundary> s(func, *this->storage);
-  s.sweep1D_Boundary(alpha, result, dim);
+  s.sweep1D_BoundaryParallel(alpha, result, dim);
 }
 
 void OperationLaplaceLinearStretchedBoundary::downOpDim(sgpp::base::DataVector& alpha,
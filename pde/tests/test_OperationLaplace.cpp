@@ -11,6 +11,14 @@
 #include <sgpp_pde.hpp>
 #include <sgpp/pde/operation/PdeOpFactory.hpp>
 #include <sgpp/globaldef.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <cmath>
+#include <vector>
+
 namespace sgpp {
 namespace pde {
   /*
@@ -398,6 +406,56 @@ namespace pde {
     }
   }
 
+  /*
+    The 1D sweeps along the poles and the dimensions of the Up/Down scheme are executed in
+    parallel. The result must not depend on the number of threads.
+   */
+  BOOST_AUTO_TEST_CASE(testOperationLaplaceLinearThreadIndependence) {
+    const size_t d = 3;
+    const size_t l = 5;
+    std::vector<sgpp::base::Grid*> grids;
+    grids.push_back(sgpp::base::Grid::createLinearGrid(d));
+    grids.push_back(sgpp::base::Grid::createLinearBoundaryGrid(d));
+
+    for (sgpp::base::Grid* grid : grids) {
+      grid->getGenerator().regular(l);
+      std::vector<sgpp::base::OperationMatrix*> ops;
+      ops.push_back(sgpp::op_factory::createOperationLaplace(*grid));
+      ops.push_back(sgpp::op_factory::createOperationLTwoDotProduct(*grid));
+
+      sgpp::base::DataVector alpha(grid->getSize());
+
+      for (size_t i = 0; i < grid->getSize(); i++) {
+        alpha[i] = std::sin(static_cast<double>(i));
+      }
+
+      for (sgpp::base::OperationMatrix* op : ops) {
+        sgpp::base::DataVector resultSerial(grid->getSize());
+        sgpp::base::DataVector resultParallel(grid->getSize());
+
+#ifdef _OPENMP
+        int numThreads = omp_get_max_threads();
+        omp_set_num_threads(1);
+        op->mult(alpha, resultSerial);
+        omp_set_num_threads(4);
+        op->mult(alpha, resultParallel);
+        omp_set_num_threads(numThreads);
+#else
+        op->mult(alpha, resultSerial);
+        op->mult(alpha, resultParallel);
+#endif
+
+        for (size_t i = 0; i < grid->getSize(); i++) {
+          BOOST_CHECK_EQUAL(resultSerial[i], resultParallel[i]);
+        }
+
+        delete op;
+      }
+
+      delete grid;
+    }
+  }
+
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace pde
 }  // namespace sgpp
@@ -119,6 +119,7 @@ def doConfigure(env, moduleFolders, languageWrapperFolders):
   checkOpenCL(config)
   detectGSL(config)
   detectZlib(config)
+  detectLAPACK(config)
   detectScaLAPACK(config)
   checkDAKOTA(config)
   checkCGAL(config)
@@ -631,6 +632,22 @@ def detectZlib(config):
   else:
     Helper.printInfo("ZLIB support could not be enabled.")
 
+def detectLAPACK(config):
+  # LAPACK is only used if requested, otherwise the built-in decompositions are used
+  # (even if liblapack is installed)
+  if not config.env["USE_LAPACK"]:
+    Helper.printInfo("LAPACK support is disabled, " +
+                     "using built-in dense matrix decompositions.")
+    return
+  if "LAPACK_LIBRARY_PATH" in config.env:
+    config.env.AppendUnique(LIBPATH=[config.env["LAPACK_LIBRARY_PATH"]])
+  if (config.CheckLib("lapack", language="c++", autoadd=0) and
+      config.CheckLib("blas", language="c++", autoadd=0)):
+    Helper.printInfo("LAPACK is installed, enabling LAPACK support.")
+    config.env["CPPDEFINES"]["USE_LAPACK"] = "1"
+  else:
+    Helper.printErrorAndExit("liblapack or libblas was not found, but required for LAPACK")
+
 def detectScaLAPACK(config):
   if "SCALAPACK_LIBRARY_PATH" in config.env:
     config.env.AppendUnique(LIBPATH=[config.env["SCALAPACK_LIBRARY_PATH"]])
@@ -0,0 +1,202 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/solver/sle/PipelinedConjugateGradients.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <iostream>
+
+namespace sgpp {
+namespace solver {
+
+PipelinedConjugateGradients::PipelinedConjugateGradients(
+    size_t imax, double epsilon, sgpp::base::OperationMatrix* preconditioner)
+    : PreconditionedConjugateGradients(imax, epsilon, preconditioner) {}
+
+PipelinedConjugateGradients::~PipelinedConjugateGradients() {}
+
+PipelinedConjugateGradients::InnerProducts PipelinedConjugateGradients::computeInnerProducts(
+    sgpp::base::DataVector& r, sgpp::base::DataVector& u, sgpp::base::DataVector& w) {
+  const size_t size = r.getSize();
+  const double* ptrR = r.getPointer();
+  const double* ptrU = u.getPointer();
+  const double* ptrW = w.getPointer();
+  double rr = 0.0;
+  double ru = 0.0;
+  double wu = 0.0;
+
+#pragma omp parallel for reduction(+ : rr, ru, wu)
+  for (size_t i = 0; i < size; i++) {
+    rr += ptrR[i] * ptrR[i];
+    ru += ptrR[i] * ptrU[i];
+    wu += ptrW[i] * ptrU[i];
+  }
+
+  InnerProducts products = {rr, ru, wu};
+  return products;
+}
+
+void PipelinedConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
+                                        sgpp::base::DataVector& alpha, sgpp::base::DataVector& b,
+                                        bool reuse, bool verbose, double max_threshold) {
+  this->starting();
+
+  if (verbose == true) {
+    std::cout << "Starting Pipelined Conjugated Gradients" << std::endl;
+  }
+
+  const size_t size = alpha.getSize();
+
+  // needed for residuum calculation
+  double epsilonSquared = this->myEpsilon * this->myEpsilon;
+  // number off current iterations
+  this->nIterations = 0;
+
+  // r: residual, u = M^-1 r, w = A u, m = M^-1 w, n = A m,
+  // p: search direction, s = A p, q = M^-1 s, z = A q
+  sgpp::base::DataVector r(b);
+  sgpp::base::DataVector u(size);
+  sgpp::base::DataVector w(size);
+  sgpp::base::DataVector m(size);
+  sgpp::base::DataVector n(size);
+  sgpp::base::DataVector p(size, 0.0);
+  sgpp::base::DataVector s(size, 0.0);
+  sgpp::base::DataVector q(size, 0.0);
+  sgpp::base::DataVector z(size, 0.0);
+  sgpp::base::DataVector temp(size);
+
+  double delta_0 = 0.0;
+  // (r, r), (r, u) and (w, u)
+  double delta_new = 0.0;
+  double gamma = 0.0;
+  double gamma_old = 0.0;
+  double delta = 0.0;
+  double a = 0.0;
+  double a_old = 0.0;
+  double beta = 0.0;
+
+  if (reuse == true) {
+    // the target is relative to the right hand side, as in ConjugateGradients
+    delta_0 = b.dotProduct(b) * epsilonSquared;
+  } else {
+    alpha.setAll(0.0);
+  }
+
+  // calculate the starting residuum
+  SystemMatrix.mult(alpha, temp);
+  r.sub(temp);
+  applyPreconditioner(r, u);
+  SystemMatrix.mult(u, w);
+
+  InnerProducts products = computeInnerProducts(r, u, w);
+  delta_new = products.rr;
+  gamma = products.ru;
+  delta = products.wu;
+
+  if (reuse == false) {
+    delta_0 = delta_new * epsilonSquared;
+  }
+
+  this->residuum = (delta_0 / epsilonSquared);
+  this->calcStarting();
+
+  if (verbose == true) {
+    std::cout << "Starting norm of residuum: " << (delta_0 / epsilonSquared) << std::endl;
+    std::cout << "Target norm:               " << (delta_0) << std::endl;
+  }
+
+  while ((this->nIterations < this->nMaxIterations) && (delta_new > delta_0) &&
+         (delta_new > max_threshold)) {
+    beta = (this->nIterations > 0) ? gamma / gamma_old : 0.0;
+    double denominator = (this->nIterations > 0) ? delta - beta * gamma / a_old : delta;
+
+    if (denominator == 0.0) {
+      break;
+    }
+
+    a = gamma / denominator;
+    gamma_old = gamma;
+    a_old = a;
+
+    // m and n only depend on w, not on the inner products of this iteration
+    applyPreconditioner(w, m);
+    SystemMatrix.mult(m, n);
+
+    // fetched in every iteration as the operators may reallocate their result vectors
+    double* ptrAlpha = alpha.getPointer();
+    double* ptrR = r.getPointer();
+    double* ptrU = u.getPointer();
+    double* ptrW = w.getPointer();
+    double* ptrM = m.getPointer();
+    double* ptrN = n.getPointer();
+    double* ptrP = p.getPointer();
+    double* ptrS = s.getPointer();
+    double* ptrQ = q.getPointer();
+    double* ptrZ = z.getPointer();
+
+    // all vector updates and the inner products of the updated vectors in one sweep
+    double rr = 0.0;
+    double ru = 0.0;
+    double wu = 0.0;
+
+#pragma omp parallel for reduction(+ : rr, ru, wu)
+    for (size_t i = 0; i < size; i++) {
+      ptrZ[i] = ptrN[i] + beta * ptrZ[i];
+      ptrQ[i] = ptrM[i] + beta * ptrQ[i];
+      ptrS[i] = ptrW[i] + beta * ptrS[i];
+      ptrP[i] = ptrU[i] + beta * ptrP[i];
+      ptrAlpha[i] += a * ptrP[i];
+      ptrR[i] -= a * ptrS[i];
+      ptrU[i] -= a * ptrQ[i];
+      ptrW[i] -= a * ptrZ[i];
+      rr += ptrR[i] * ptrR[i];
+      ru += ptrR[i] * ptrU[i];
+      wu += ptrW[i] * ptrU[i];
+    }
+
+    products.rr = rr;
+    products.ru = ru;
+    products.wu = wu;
+    this->nIterations++;
+
+    // recompute the recursively updated vectors from time to time to avoid their drift
+    if ((this->nIterations % 20) == 0) {
+      // r = b - A*x, u = M^-1 r, w = A u, s = A p, q = M^-1 s, z = A q
+      SystemMatrix.mult(alpha, temp);
+      r.copyFrom(b);
+      r.sub(temp);
+      applyPreconditioner(r, u);
+      SystemMatrix.mult(u, w);
+      SystemMatrix.mult(p, s);
+      applyPreconditioner(s, q);
+      SystemMatrix.mult(q, z);
+      products = computeInnerProducts(r, u, w);
+    }
+
+    delta_new = products.rr;
+    gamma = products.ru;
+    delta = products.wu;
+
+    this->residuum = delta_new;
+    this->iterationComplete();
+
+    if (verbose == true) {
+      std::cout << "delta: " << delta_new << std::endl;
+    }
+  }
+
+  this->residuum = delta_new;
+  this->complete();
+
+  if (verbose == true) {
+    std::cout << "Number of iterations: " << this->nIterations << " (max. " << this->nMaxIterations
+              << ")" << std::endl;
+    std::cout << "Final norm of residuum: " << delta_new << std::endl;
+  }
+}
+
+}  // namespace solver
+}  // namespace sgpp
@@ -0,0 +1,75 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef PIPELINEDCONJUGATEGRADIENTS_HPP
+#define PIPELINEDCONJUGATEGRADIENTS_HPP
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/solver/sle/PreconditionedConjugateGradients.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace solver {
+
+/**
+ * Pipelined (preconditioned) conjugate gradients after Ghysels and Vanroose.
+ *
+ * The recurrences are rearranged such that the preconditioner application and the
+ * matrix-vector product of an iteration (m = M^-1 w, n = A m) do not depend on its inner
+ * products. Hence the inner products need no separate pass over the vectors: they are reduced
+ * in the same parallel sweep that performs all vector updates of the iteration, and the only
+ * synchronization point per iteration is the end of this sweep.
+ * The price are three additional vectors and slightly larger rounding errors, which
+ * are countered by recomputing the recursively updated vectors every 20 iterations. Hence the
+ * method typically needs somewhat more iterations than PreconditionedConjugateGradients and
+ * only pays off if the reductions take a notable part of an iteration.
+ */
+class PipelinedConjugateGradients : public PreconditionedConjugateGradients {
+ public:
+  /**
+   * Std-Constructor
+   *
+   * @param imax number of maximum executed iterations
+   * @param epsilon the final relative error in the iterative solver
+   * @param preconditioner preconditioner (not owned), nullptr for none
+   */
+  PipelinedConjugateGradients(size_t imax, double epsilon,
+                              sgpp::base::OperationMatrix* preconditioner = nullptr);
+
+  /**
+   * Std-Destructor
+   */
+  ~PipelinedConjugateGradients() override;
+
+  void solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataVector& alpha,
+             sgpp::base::DataVector& b, bool reuse = false, bool verbose = false,
+             double max_threshold = -1.0) override;
+
+ protected:
+  /// inner products (r, r), (r, u) and (w, u) of the pipelined recurrences
+  struct InnerProducts {
+    double rr;
+    double ru;
+    double wu;
+  };
+
+  /**
+   * Computes the inner products of r, u and w in one parallel pass.
+   *
+   * @param r residual
+   * @param u preconditioned residual
+   * @param w A u
+   * @return inner products (r, r), (r, u) and (w, u)
+   */
+  static InnerProducts computeInnerProducts(sgpp::base::DataVector& r, sgpp::base::DataVector& u,
+                                            sgpp::base::DataVector& w);
+};
+
+}  // namespace solver
+}  // namespace sgpp
+
+#endif /* PIPELINEDCONJUGATEGRADIENTS_HPP */
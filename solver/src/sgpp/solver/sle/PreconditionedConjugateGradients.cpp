@@ -0,0 +1,156 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/solver/sle/PreconditionedConjugateGradients.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <iostream>
+
+namespace sgpp {
+namespace solver {
+
+PreconditionedConjugateGradients::PreconditionedConjugateGradients(
+    size_t imax, double epsilon, sgpp::base::OperationMatrix* preconditioner)
+    : ConjugateGradients(imax, epsilon), preconditioner(preconditioner) {}
+
+PreconditionedConjugateGradients::~PreconditionedConjugateGradients() {}
+
+void PreconditionedConjugateGradients::setPreconditioner(
+    sgpp::base::OperationMatrix* preconditioner) {
+  this->preconditioner = preconditioner;
+}
+
+void PreconditionedConjugateGradients::applyPreconditioner(sgpp::base::DataVector& r,
+                                                           sgpp::base::DataVector& z) {
+  if (preconditioner == nullptr) {
+    z.copyFrom(r);
+  } else {
+    preconditioner->mult(r, z);
+  }
+}
+
+void PreconditionedConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
+                                             sgpp::base::DataVector& alpha,
+                                             sgpp::base::DataVector& b, bool reuse, bool verbose,
+                                             double max_threshold) {
+  this->starting();
+
+  if (verbose == true) {
+    std::cout << "Starting Preconditioned Conjugated Gradients" << std::endl;
+  }
+
+  // needed for residuum calculation
+  double epsilonSquared = this->myEpsilon * this->myEpsilon;
+  // number off current iterations
+  this->nIterations = 0;
+
+  // define temporal vectors
+  sgpp::base::DataVector temp(alpha.getSize());
+  sgpp::base::DataVector q(alpha.getSize());
+  sgpp::base::DataVector z(alpha.getSize());
+  sgpp::base::DataVector r(b);
+
+  double delta_0 = 0.0;
+  // squared norm of the residual
+  double delta_new = 0.0;
+  // r^T * M^-1 * r
+  double rho_old = 0.0;
+  double rho_new = 0.0;
+  double beta = 0.0;
+  double a = 0.0;
+
+  if (reuse == true) {
+    // the target is relative to the right hand side, as in ConjugateGradients
+    delta_0 = b.dotProduct(b) * epsilonSquared;
+  } else {
+    alpha.setAll(0.0);
+  }
+
+  // calculate the starting residuum
+  SystemMatrix.mult(alpha, temp);
+  r.sub(temp);
+
+  applyPreconditioner(r, z);
+  sgpp::base::DataVector d(z);
+
+  delta_new = r.dotProduct(r);
+  rho_new = r.dotProduct(z);
+
+  if (reuse == false) {
+    delta_0 = delta_new * epsilonSquared;
+  }
+
+  this->residuum = (delta_0 / epsilonSquared);
+  this->calcStarting();
+
+  if (verbose == true) {
+    std::cout << "Starting norm of residuum: " << (delta_0 / epsilonSquared) << std::endl;
+    std::cout << "Target norm:               " << (delta_0) << std::endl;
+  }
+
+  while ((this->nIterations < this->nMaxIterations) && (delta_new > delta_0) &&
+         (delta_new > max_threshold)) {
+    // q = A*d
+    SystemMatrix.mult(d, q);
+
+    double dq = d.dotProduct(q);
+
+    if (dq == 0.0) {
+      break;
+    }
+
+    // a = rho_new / d.q
+    a = rho_new / dq;
+
+    // x = x + a*d
+    alpha.axpy(a, d);
+
+    // recompute the residual from time to time to avoid the drift of the recursion
+    if ((this->nIterations % 50) == 0 && this->nIterations > 0) {
+      // r = b - A*x
+      SystemMatrix.mult(alpha, temp);
+      r.copyFrom(b);
+      r.sub(temp);
+    } else {
+      // r = r - a*q
+      r.axpy(-a, q);
+    }
+
+    // z = M^-1 * r
+    applyPreconditioner(r, z);
+
+    // calculate new deltas and determine beta
+    rho_old = rho_new;
+    rho_new = r.dotProduct(z);
+    delta_new = r.dotProduct(r);
+    beta = rho_new / rho_old;
+
+    this->residuum = delta_new;
+    this->iterationComplete();
+
+    if (verbose == true) {
+      std::cout << "delta: " << delta_new << std::endl;
+    }
+
+    // d = z + beta*d
+    d.mult(beta);
+    d.add(z);
+
+    this->nIterations++;
+  }
+
+  this->residuum = delta_new;
+  this->complete();
+
+  if (verbose == true) {
+    std::cout << "Number of iterations: " << this->nIterations << " (max. " << this->nMaxIterations
+              << ")" << std::endl;
+    std::cout << "Final norm of residuum: " << delta_new << std::endl;
+  }
+}
+
+}  // namespace solver
+}  // namespace sgpp
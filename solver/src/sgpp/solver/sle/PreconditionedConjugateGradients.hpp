@@ -0,0 +1,62 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef PRECONDITIONEDCONJUGATEGRADIENTS_HPP
+#define PRECONDITIONEDCONJUGATEGRADIENTS_HPP
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace solver {
+
+/**
+ * Preconditioned conjugate gradients. The preconditioner is an OperationMatrix that applies
+ * an approximation of the inverse system matrix, e.g., JacobiPreconditioner or
+ * ProbingJacobiPreconditioner; without preconditioner the method equals ConjugateGradients.
+ *
+ * As in ConjugateGradients, the iteration stops as soon as the squared norm of the
+ * (unpreconditioned) residual drops below epsilon^2 times its initial value.
+ */
+class PreconditionedConjugateGradients : public ConjugateGradients {
+ public:
+  /**
+   * Std-Constructor
+   *
+   * @param imax number of maximum executed iterations
+   * @param epsilon the final relative error in the iterative solver
+   * @param preconditioner preconditioner (not owned), nullptr for none
+   */
+  PreconditionedConjugateGradients(size_t imax, double epsilon,
+                                   sgpp::base::OperationMatrix* preconditioner = nullptr);
+
+  /**
+   * Std-Destructor
+   */
+  ~PreconditionedConjugateGradients() override;
+
+  void solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataVector& alpha,
+             sgpp::base::DataVector& b, bool reuse = false, bool verbose = false,
+             double max_threshold = -1.0) override;
+
+  /**
+   * @param preconditioner preconditioner (not owned), nullptr for none
+   */
+  void setPreconditioner(sgpp::base::OperationMatrix* preconditioner);
+
+ protected:
+  /// applies the preconditioner to r, copies r if there is none
+  void applyPreconditioner(sgpp::base::DataVector& r, sgpp::base::DataVector& z);
+
+  sgpp::base::OperationMatrix* preconditioner;
+};
+
+}  // namespace solver
+}  // namespace sgpp
+
+#endif /* PRECONDITIONEDCONJUGATEGRADIENTS_HPP */
@@ -0,0 +1,63 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/solver/sle/preconditioner/JacobiPreconditioner.hpp>
+
+#include <sgpp/base/exception/solver_exception.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace solver {
+
+JacobiPreconditioner::JacobiPreconditioner() : inverseDiagonal(0) {}
+
+JacobiPreconditioner::JacobiPreconditioner(const sgpp::base::DataVector& diagonal)
+    : inverseDiagonal(0) {
+  setDiagonal(diagonal);
+}
+
+JacobiPreconditioner::JacobiPreconditioner(sgpp::base::OperationMatrix& diagonalOperator,
+                                           size_t size)
+    : inverseDiagonal(0) {
+  sgpp::base::DataVector ones(size, 1.0);
+  sgpp::base::DataVector diagonal(size);
+  diagonalOperator.mult(ones, diagonal);
+  setDiagonal(diagonal);
+}
+
+JacobiPreconditioner::~JacobiPreconditioner() {}
+
+void JacobiPreconditioner::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) {
+  const size_t size = alpha.getSize();
+
+  if (size != inverseDiagonal.getSize()) {
+    throw sgpp::base::solver_exception(
+        "JacobiPreconditioner::mult : size of the vector does not match the diagonal");
+  }
+
+  result.resize(size);
+
+#pragma omp parallel for
+  for (size_t i = 0; i < size; i++) {
+    result[i] = inverseDiagonal[i] * alpha[i];
+  }
+}
+
+void JacobiPreconditioner::setDiagonal(const sgpp::base::DataVector& diagonal) {
+  inverseDiagonal.resize(diagonal.getSize());
+
+  for (size_t i = 0; i < diagonal.getSize(); i++) {
+    if (diagonal[i] == 0.0) {
+      throw sgpp::base::solver_exception(
+          "JacobiPreconditioner::setDiagonal : diagonal entries have to be nonzero");
+    }
+
+    inverseDiagonal[i] = 1.0 / diagonal[i];
+  }
+}
+
+}  // namespace solver
+}  // namespace sgpp
@@ -0,0 +1,62 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef JACOBIPRECONDITIONER_HPP
+#define JACOBIPRECONDITIONER_HPP
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace solver {
+
+/**
+ * Jacobi (diagonal) preconditioner for PreconditionedConjugateGradients,
+ * mult applies the inverse of a diagonal matrix.
+ */
+class JacobiPreconditioner : public sgpp::base::OperationMatrix {
+ public:
+  /**
+   * Constructor
+   *
+   * @param diagonal diagonal of the system matrix, all entries have to be nonzero
+   */
+  explicit JacobiPreconditioner(const sgpp::base::DataVector& diagonal);
+
+  /**
+   * Constructor for operators that are diagonal themselves, e.g., base::OperationDiagonal.
+   * The diagonal is obtained by applying the operator to the vector of ones.
+   *
+   * @param diagonalOperator diagonal operator
+   * @param size number of unknowns
+   */
+  JacobiPreconditioner(sgpp::base::OperationMatrix& diagonalOperator, size_t size);
+
+  /**
+   * Destructor
+   */
+  ~JacobiPreconditioner() override;
+
+  void mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) override;
+
+  /**
+   * @param diagonal new diagonal of the system matrix, all entries have to be nonzero
+   */
+  void setDiagonal(const sgpp::base::DataVector& diagonal);
+
+ protected:
+  /// Default constructor for subclasses that compute the diagonal themselves
+  JacobiPreconditioner();
+
+  /// reciprocals of the diagonal entries
+  sgpp::base::DataVector inverseDiagonal;
+};
+
+}  // namespace solver
+}  // namespace sgpp
+
+#endif /* JACOBIPRECONDITIONER_HPP */
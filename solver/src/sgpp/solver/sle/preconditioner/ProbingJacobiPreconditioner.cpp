@@ -0,0 +1,65 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/solver/sle/preconditioner/ProbingJacobiPreconditioner.hpp>
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <map>
+#include <vector>
+
+namespace sgpp {
+namespace solver {
+
+ProbingJacobiPreconditioner::ProbingJacobiPreconditioner(
+    sgpp::base::OperationMatrix& systemMatrix, sgpp::base::GridStorage& storage)
+    : JacobiPreconditioner(), numberOfProbes(0) {
+  const size_t size = storage.getSize();
+  const size_t dim = storage.getDimension();
+
+  // group the grid points by subspace, one probe per subspace
+  std::map<std::vector<sgpp::base::HashGridPoint::level_type>, std::vector<size_t>> subspaces;
+  std::vector<sgpp::base::HashGridPoint::level_type> level(dim);
+
+  for (size_t i = 0; i < size; i++) {
+    sgpp::base::GridPoint& gp = storage.getPoint(i);
+
+    for (size_t d = 0; d < dim; d++) {
+      level[d] = gp.getLevel(d);
+    }
+
+    subspaces[level].push_back(i);
+  }
+
+  numberOfProbes = subspaces.size();
+
+  sgpp::base::DataVector diagonal(size);
+  sgpp::base::DataVector probe(size, 0.0);
+  sgpp::base::DataVector result(size);
+
+  for (auto& subspace : subspaces) {
+    for (size_t i : subspace.second) {
+      probe[i] = 1.0;
+    }
+
+    systemMatrix.mult(probe, result);
+
+    for (size_t i : subspace.second) {
+      probe[i] = 0.0;
+      diagonal[i] = (result[i] > 0.0) ? result[i] : 1.0;
+    }
+  }
+
+  setDiagonal(diagonal);
+}
+
+ProbingJacobiPreconditioner::~ProbingJacobiPreconditioner() {}
+
+size_t ProbingJacobiPreconditioner::getNumberOfProbes() const { return numberOfProbes; }
+
+}  // namespace solver
+}  // namespace sgpp
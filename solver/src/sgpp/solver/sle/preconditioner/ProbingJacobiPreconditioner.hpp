@@ -0,0 +1,59 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef PROBINGJACOBIPRECONDITIONER_HPP
+#define PROBINGJACOBIPRECONDITIONER_HPP
+
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/solver/sle/preconditioner/JacobiPreconditioner.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace solver {
+
+/**
+ * Jacobi (diagonal) preconditioner for system matrices that are only available as
+ * matrix-vector products.
+ *
+ * The diagonal is obtained by probing the system matrix with the indicator vector of each
+ * hierarchical subspace (i.e., of each level vector of the grid points), which costs one
+ * matrix-vector product per subspace instead of one per grid point. For bases whose functions
+ * on one subspace have disjoint supports (e.g., the piecewise linear basis) the couplings within
+ * a subspace of mass, regression and Laplace matrices vanish and the probing yields the exact
+ * diagonal. Otherwise it yields the row sums of the subspace blocks (lumping); rows with
+ * non-positive sums are not scaled. The couplings between the grid points of a subspace are
+ * not inverted, so this is not a block-Jacobi preconditioner.
+ */
+class ProbingJacobiPreconditioner : public JacobiPreconditioner {
+ public:
+  /**
+   * Constructor
+   *
+   * @param systemMatrix system matrix of the linear system to be preconditioned
+   * @param storage grid storage the unknowns belong to
+   */
+  ProbingJacobiPreconditioner(sgpp::base::OperationMatrix& systemMatrix,
+                              sgpp::base::GridStorage& storage);
+
+  /**
+   * Destructor
+   */
+  ~ProbingJacobiPreconditioner() override;
+
+  /**
+   * @return number of matrix-vector products used for probing (number of subspaces)
+   */
+  size_t getNumberOfProbes() const;
+
+ private:
+  size_t numberOfProbes;
+};
+
+}  // namespace solver
+}  // namespace sgpp
+
+#endif /* PROBINGJACOBIPRECONDITIONER_HPP */
@@ -0,0 +1,205 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationDiagonal.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+#include <sgpp/solver/sle/PipelinedConjugateGradients.hpp>
+#include <sgpp/solver/sle/PreconditionedConjugateGradients.hpp>
+#include <sgpp/solver/sle/preconditioner/JacobiPreconditioner.hpp>
+#include <sgpp/solver/sle/preconditioner/ProbingJacobiPreconditioner.hpp>
+
+#include <cmath>
+#include <memory>
+#include <random>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::OperationMatrix;
+using sgpp::solver::ConjugateGradients;
+using sgpp::solver::JacobiPreconditioner;
+using sgpp::solver::PipelinedConjugateGradients;
+using sgpp::solver::PreconditionedConjugateGradients;
+using sgpp::solver::ProbingJacobiPreconditioner;
+
+namespace {
+
+/**
+ * Badly scaled SPD matrix S T S with the 1d Laplacian stencil T = tridiag(-1, 2.5, -1)
+ * and the diagonal scaling S = diag(scaling).
+ */
+class ScaledTridiagonalMatrix : public OperationMatrix {
+ public:
+  explicit ScaledTridiagonalMatrix(const DataVector& scaling) : scaling(scaling) {}
+
+  void mult(DataVector& alpha, DataVector& result) override {
+    const size_t n = alpha.getSize();
+    result.resize(n);
+
+    for (size_t i = 0; i < n; i++) {
+      double value = 2.5 * scaling[i] * alpha[i];
+
+      if (i > 0) {
+        value -= scaling[i - 1] * alpha[i - 1];
+      }
+
+      if (i + 1 < n) {
+        value -= scaling[i + 1] * alpha[i + 1];
+      }
+
+      result[i] = scaling[i] * value;
+    }
+  }
+
+  DataVector scaling;
+};
+
+/// regression system matrix B^T B / M + lambda I
+class RegressionMatrix : public OperationMatrix {
+ public:
+  RegressionMatrix(sgpp::base::Grid& grid, DataMatrix& data, double lambda)
+      : op(sgpp::op_factory::createOperationMultipleEval(grid, data)),
+        numData(data.getNrows()),
+        lambda(lambda) {}
+
+  void mult(DataVector& alpha, DataVector& result) override {
+    DataVector temp(numData);
+    op->mult(alpha, temp);
+    op->multTranspose(temp, result);
+    result.mult(1.0 / static_cast<double>(numData));
+    result.axpy(lambda, alpha);
+  }
+
+  std::unique_ptr<sgpp::base::OperationMultipleEval> op;
+  size_t numData;
+  double lambda;
+};
+
+double relativeResidual(OperationMatrix& A, DataVector& x, DataVector& b) {
+  DataVector r(b.getSize());
+  A.mult(x, r);
+  r.sub(b);
+  return r.l2Norm() / b.l2Norm();
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestConjugateGradients)
+
+BOOST_AUTO_TEST_CASE(testPreconditionedAndPipelined) {
+  const size_t n = 200;
+  DataVector scaling(n);
+  DataVector b(n);
+  DataVector diagonal(n);
+
+  for (size_t i = 0; i < n; i++) {
+    scaling[i] = std::pow(10.0, std::sin(static_cast<double>(i)));
+    b[i] = std::cos(static_cast<double>(i));
+    diagonal[i] = 2.5 * scaling[i] * scaling[i];
+  }
+
+  ScaledTridiagonalMatrix A(scaling);
+  JacobiPreconditioner jacobi(diagonal);
+  const double epsilon = 1e-10;
+
+  DataVector x(n);
+  ConjugateGradients cg(5000, epsilon);
+  cg.solve(A, x, b);
+  BOOST_CHECK_SMALL(relativeResidual(A, x, b), 1e-8);
+
+  // without preconditioner, PCG has to behave like CG
+  PreconditionedConjugateGradients pcgNone(5000, epsilon);
+  pcgNone.solve(A, x, b);
+  BOOST_CHECK_EQUAL(pcgNone.getNumberIterations(), cg.getNumberIterations());
+
+  PreconditionedConjugateGradients pcg(5000, epsilon, &jacobi);
+  pcg.solve(A, x, b);
+  BOOST_CHECK_SMALL(relativeResidual(A, x, b), 1e-8);
+  BOOST_CHECK_LT(pcg.getNumberIterations(), cg.getNumberIterations() / 4);
+
+  PipelinedConjugateGradients pipelined(5000, epsilon);
+  pipelined.solve(A, x, b);
+  BOOST_CHECK_SMALL(relativeResidual(A, x, b), 1e-8);
+
+  PipelinedConjugateGradients pipelinedJacobi(5000, epsilon, &jacobi);
+  pipelinedJacobi.solve(A, x, b);
+  BOOST_CHECK_SMALL(relativeResidual(A, x, b), 1e-8);
+  BOOST_CHECK_LT(pipelinedJacobi.getNumberIterations(), cg.getNumberIterations() / 4);
+}
+
+BOOST_AUTO_TEST_CASE(testJacobiFromOperationDiagonal) {
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(2));
+  grid->getGenerator().regular(3);
+  const size_t n = grid->getSize();
+
+  sgpp::base::OperationDiagonal opDiagonal(&grid->getStorage(), 0.25);
+  JacobiPreconditioner jacobi(opDiagonal, n);
+
+  DataVector x(n);
+  DataVector diag(n);
+  DataVector result(n);
+
+  for (size_t i = 0; i < n; i++) {
+    x[i] = static_cast<double>(i + 1);
+  }
+
+  opDiagonal.mult(x, diag);
+  jacobi.mult(diag, result);
+
+  for (size_t i = 0; i < n; i++) {
+    BOOST_CHECK_CLOSE(result[i], x[i], 1e-12);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testProbingJacobi) {
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(2));
+  grid->getGenerator().regular(4);
+  const size_t n = grid->getSize();
+
+  DataMatrix data(500, 2);
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+  for (size_t i = 0; i < data.getSize(); i++) {
+    data[i] = distribution(generator);
+  }
+
+  RegressionMatrix A(*grid, data, 1e-4);
+  ProbingJacobiPreconditioner probingJacobi(A, grid->getStorage());
+
+  // 1 + 2 + 3 + 4 subspaces
+  BOOST_CHECK_EQUAL(probingJacobi.getNumberOfProbes(), 10);
+
+  // hat functions of one subspace have disjoint supports, so probing yields the exact diagonal
+  DataVector unit(n, 0.0);
+  DataVector column(n);
+  DataVector ones(n, 1.0);
+  DataVector inverseDiagonal(n);
+  probingJacobi.mult(ones, inverseDiagonal);
+
+  for (size_t i = 0; i < n; i++) {
+    unit[i] = 1.0;
+    A.mult(unit, column);
+    unit[i] = 0.0;
+    BOOST_CHECK_CLOSE(1.0 / inverseDiagonal[i], column[i], 1e-10);
+  }
+
+  DataVector b(n);
+  DataVector x(n);
+  A.op->multTranspose(ones, b);
+  PreconditionedConjugateGradients pcg(2000, 1e-10, &probingJacobi);
+  pcg.solve(A, x, b);
+  BOOST_CHECK_SMALL(relativeResidual(A, x, b), 1e-8);
+}
+
+BOOST_AUTO_TEST_SUITE_END()